@@ -60,6 +60,84 @@ void SCM_Init(void);
 void SCM_SNMTM_RespClbk(UINT16 w_regNum, UINT16 w_tadr, UINT16 w_rxSdn,
                         const UINT8 *pb_data, BOOLEAN o_timeout);
 
+/** This symbol marks an FSM which is not in the deadline queue. */
+#define SCM_k_NO_DEADLINE   0xFFFFU
+
+/**
+ * Deadline queue of FSMs waiting for a response.
+ *
+ * The SNMTM and the SSDOC keep the FSMs waiting for a response in such a queue, so the
+ * timeout check only processes the FSMs whose response time has elapsed instead of all
+ * FSMs. The storage is provided by the owner of the queue, see SCM_DeadlineInit().
+ */
+typedef struct
+{
+  /** number of queued FSMs */
+  UINT16 w_num;
+  /** queued FSM numbers, binary min-heap ordered by deadline */
+  UINT16 *pw_heap;
+  /** heap position of every FSM, SCM_k_NO_DEADLINE if the FSM is not queued */
+  UINT16 *pw_pos;
+  /** deadline of every FSM */
+  UINT32 *pdw_deadline;
+} SCM_t_DEADLINE_QUEUE;
+
+/**
+* @brief This function initializes a deadline queue, no FSM is queued.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        pw_heap           storage of the heap, w_maxFsm entries (not checked, only called with reference to array), valid range: <> NULL
+*
+* @param        pw_pos            storage of the heap positions, w_maxFsm entries (not checked, only called with reference to array), valid range: <> NULL
+*
+* @param        pdw_deadline      storage of the deadlines, w_maxFsm entries (not checked, only called with reference to array), valid range: <> NULL
+*
+* @param        w_maxFsm          number of FSMs (not checked, only called with define), valid range: 1 .. SCM_k_NO_DEADLINE-1
+*/
+void SCM_DeadlineInit(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 *pw_heap,
+                      UINT16 *pw_pos, UINT32 *pdw_deadline, UINT16 w_maxFsm);
+
+/**
+* @brief This function queues an FSM with the given deadline or changes the deadline of
+* an already queued FSM.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        w_fsmNum          FSM number (not checked, checked by the caller), valid range: 0 .. w_maxFsm-1 of SCM_DeadlineInit()
+*
+* @param        dw_deadline       point of time the FSM has to be checked (not checked, any value allowed), valid range: any 32 bit value
+*/
+void SCM_DeadlineSet(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_fsmNum,
+                     UINT32 dw_deadline);
+
+/**
+* @brief This function removes an FSM from the deadline queue.
+*
+* The function may also be called for an FSM which is not queued.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        w_fsmNum          FSM number (not checked, checked by the caller), valid range: 0 .. w_maxFsm-1 of SCM_DeadlineInit()
+*/
+void SCM_DeadlineRemove(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_fsmNum);
+
+/**
+* @brief This function returns the queued FSM with the earliest deadline, if this
+* deadline has elapsed.
+*
+* The FSM stays queued, it has to be removed or get a new deadline by the caller.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        dw_ct             consecutive time (not checked, any value allowed), valid range: any 32 bit value
+*
+* @return
+* - FSM number        - deadline of this FSM has elapsed
+* - SCM_k_NO_DEADLINE - no deadline has elapsed
+*/
+UINT16 SCM_DeadlineExpired(const SCM_t_DEADLINE_QUEUE *ps_queue, UINT32 dw_ct);
+
 #endif
 
 /** @} */
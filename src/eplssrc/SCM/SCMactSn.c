@@ -39,7 +39,7 @@
 *
 * @param ps_fsmCb   Pointer to the current slot of the FSM control block (not checked,only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum    FSM slot number (=> index to the DVI list) (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum    FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct      Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -57,7 +57,7 @@ BOOLEAN SCM_SendPutToOp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* read the SOD timestamp */
-    pdw_timeStmp = (UINT32 *)SCM_SodRead(SCM_k_IDX_TIMESTAMP(w_snNum));
+    pdw_timeStmp = (UINT32 *)SCM_SodRead(SCM_k_IDX_TIMESTAMP(ps_fsmCb->w_dviIdx));
     if(pdw_timeStmp != NULL)
     {
       o_res = SNMTM_ReqSnTrans(dw_ct, w_snNum, ps_fsmCb->w_sadr,
@@ -88,7 +88,7 @@ BOOLEAN SCM_SendPutToOp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 * @param     ps_fsmCb           Pointer to the current slot of the FSM control block
 * 	(not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param     w_snNum            FSM slot number (=> index to the DVI list)(not checked,
+* @param     w_snNum            FSM slot number (not checked,
 * 	checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param     dw_ct              Consecutive time (not checked, any value allowed).
@@ -141,7 +141,7 @@ BOOLEAN SCM_SendReadTimestamp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -166,14 +166,14 @@ BOOLEAN SCM_WfOpResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* if reveived node status == OPERATIONAL */
     if(b_snStatus == (UINT8)SNMTS_k_SN_STS_OP)
     {
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_OK,
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_OK,
                                 ps_fsmCb->o_reportSnSts);
 
       /* if no error happened */
       if (o_res)
       {
         /* set the timer to the guard frequency */
-        ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
         ps_fsmCb->e_state = SCM_k_WF_GUARD_TIMER;
       }
       /* no else : error happened */
@@ -226,7 +226,7 @@ BOOLEAN SCM_WfOpResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -251,7 +251,7 @@ BOOLEAN SCM_WfOpResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct           Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -281,7 +281,7 @@ BOOLEAN SCM_WfPollTimeout(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct           Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -163,6 +163,70 @@ void SAPL_ScmSnFailClbk(UINT16 w_sadr, UINT8 b_errGroup, UINT8 b_errCode,
 */
 BOOLEAN SCM_SnFailAck(UINT16 w_hdl, UINT8 b_errGroup, UINT8 b_errCode);
 
+/**
+* @brief This function adds a SN to the running safety configuration manager.
+*
+* The SN is read from the SADR-DVI list (0xC400 + w_dviIdx) and commissioned without
+* affecting the other SNs. The SN gets the next free FSM slot and is added with the next
+* call of SCM_Trigger() for this slot. If the SN of w_dviIdx is already managed by the
+* SCM, the call is handled like SCM_ReconfigureNode().
+*
+* @param w_dviIdx	Index in the SADR-DVI list (checked).
+* 	valid range: < SCM_cfg_MAX_NUM_OF_NODES, a free FSM slot must be available
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+BOOLEAN SCM_AddNode(UINT16 w_dviIdx);
+
+/**
+* @brief This function removes a SN from the running safety configuration manager.
+*
+* The SN is not guarded any more and its status is reported as SCM_k_NS_MISSING. The
+* SN is removed with the next call of SCM_Trigger() for this SN in which no SNMT or
+* SSDO request of this SN is pending. The FSM slots of the other SNs are unchanged.
+*
+* @param w_dviIdx	Index of the SN in the SADR-DVI list (checked).
+* 	valid range: < SCM_cfg_MAX_NUM_OF_NODES, the SN must be managed by the SCM
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+BOOLEAN SCM_RemoveNode(UINT16 w_dviIdx);
+
+/**
+* @brief This function restarts the commissioning of a single SN.
+*
+* The entries of the SN in the SADR-DVI list (0xC400 + w_dviIdx) are read again and the
+* SN is commissioned from the SADR assignment on, e.g. after a module was replaced.
+* The other SNs are not affected. The SN is reconfigured with the next call of
+* SCM_Trigger() for this SN in which no SNMT or SSDO request of this SN is pending.
+* If the additional SADRs of the SN changed then SCM_UpdateAddSadr() has to be called
+* before.
+*
+* @param w_dviIdx	Index of the SN in the SADR-DVI list (checked).
+* 	valid range: < SCM_cfg_MAX_NUM_OF_NODES, the SN must be managed by the SCM
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+BOOLEAN SCM_ReconfigureNode(UINT16 w_dviIdx);
+
+/**
+* @brief This function reads one entry of the Additional SADR list again.
+*
+* The entry 0xC800 + w_addSadr is read and the main SADR of the additional SADR is
+* updated in the internal list, without reading the whole list. The index of the additional
+* SADRs is rebuilt by SCM_Trigger() as soon as no SN is in the additional SADR assignment,
+* so a running assignment is finished with the old list.
+*
+* @param w_addSadr	Additional SADR (checked). valid range: EPLS_k_MIN_SADR..EPLS_k_MAX_SADR
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+BOOLEAN SCM_UpdateAddSadr(UINT16 w_addSadr);
+
 /**
 * @brief This function is called for every Safety Node status change.
 *
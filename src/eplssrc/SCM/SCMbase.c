@@ -41,6 +41,18 @@ static UINT8 *pb_NumFreeFrms SAFE_NO_INIT_SEKTOR;
 
 /** List of main SADR from the SOD to speed up the searching for Additional SADRs */
 static UINT16 aw_MainSadr[EPLS_k_MAX_SADR] SAFE_NO_INIT_SEKTOR;
+/**
+ * Start of the additional SADRs of a main SADR in aw_AddSadr, addressed by the main SADR.
+ * The additional SADRs of the main SADR x are aw_AddSadr[aw_AddSadrStart[x]] up to
+ * aw_AddSadr[aw_AddSadrStart[x+1]-1].
+ */
+static UINT16 aw_AddSadrStart[EPLS_k_MAX_SADR+2U] SAFE_NO_INIT_SEKTOR;
+/** Additional SADRs grouped by main SADR, ascending within a group */
+static UINT16 aw_AddSadr[EPLS_k_MAX_SADR] SAFE_NO_INIT_SEKTOR;
+/** TRUE if aw_MainSadr was changed by SCM_UpdateAddSadr() and the index is not rebuilt yet */
+static BOOLEAN o_AddSadrIdxPending SAFE_NO_INIT_SEKTOR;
+
+static void BuildAddSadrIndex(void);
 /** @} */
 
 /**
@@ -388,8 +400,6 @@ BOOLEAN SCM_SodWrite(UINT16 w_idx, UINT8 b_subidx, const UINT8 *pb_data)
 *
 * @param        ps_fsmCb             Pointer to the current slot of the FSM control block (not checked, only called with reference to struct).
 *
-* @param        w_snNum              Safety Node number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
-*
 * @param        b_nodeStatus         node status (not checked, only called with define).
 *
 * @param        o_reportSnSts
@@ -399,13 +409,13 @@ BOOLEAN SCM_SodWrite(UINT16 w_idx, UINT8 b_subidx, const UINT8 *pb_data)
 * @return
 * - FALSE     - Abort forcing error
 */
-BOOLEAN SCM_SetNodeStatus(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
-                          UINT8 b_nodeStatus, BOOLEAN o_reportSnSts)
+BOOLEAN SCM_SetNodeStatus(SCM_t_FSM_CB *ps_fsmCb, UINT8 b_nodeStatus,
+                          BOOLEAN o_reportSnSts)
 {
   BOOLEAN o_res = FALSE;          /* function result */
 
   /* if SOD write succeeded */
-  if(SCM_SodWrite(SCM_k_IDX_SN_STATUS(w_snNum), &b_nodeStatus))
+  if(SCM_SodWrite(SCM_k_IDX_SN_STATUS(ps_fsmCb->w_dviIdx), &b_nodeStatus))
   {
     /* if the unchanged SN status shall be reported */
     if(o_reportSnSts)
@@ -492,46 +502,215 @@ BOOLEAN SCM_BuildLocalSadrList(void)
 
     w_idx++;
   }
+
+  /* if all entries were read */
+  if (o_error == FALSE)
+  {
+    BuildAddSadrIndex();
+    o_AddSadrIdxPending = FALSE;
+  }
+  /* no else : SOD error */
+
   /* call the Control Flow Monitoring */
   SCFM_TACK_PATH();
   return (BOOLEAN)(o_error == FALSE);
 }
 
 /**
-* @brief This function searches in the local SADR-List for the next g1iven main SADR value
-* and returns the corresponding additional SADR.
+* @brief This function reads one entry of the Additional SADR list again.
 *
-* Because one SN can have more than one additional SADR, the function must be called until
-* zero is returned. The searches through the complete list until the end of the list is
-* reached.
+* The entry 0xC800 + w_addSadr is read and the main SADR of the additional SADR is
+* updated in the internal list, without reading the whole list. The index of the additional
+* SADRs is rebuilt by SCM_Trigger() as soon as no SN is in the additional SADR assignment,
+* so a running assignment is finished with the old list.
 *
-* @param	w_mainSadr		Main SADR (not checked, checked in ScmInitFsm()).
-* @param    w_addSadr		Old "Additional SADR" as current search position.
-* 	Must be zero at the beginning (not checked, checked in SCM_WfParamDlResp()).
+* @param w_addSadr	Additional SADR (checked). valid range: EPLS_k_MIN_SADR..EPLS_k_MAX_SADR
 *
 * @return
-* - > 0:   - valid additional SADR
-* - = 0:   - end of list reached
+* - FALSE       - Abort forcing error
 */
-UINT16 SCM_GetNextAddSadr(UINT16 w_mainSadr, UINT16 w_addSadr)
+BOOLEAN SCM_UpdateAddSadr(UINT16 w_addSadr)
 {
-  /* search for the next value in the list, which is equal to the main SADR */
-  while((w_addSadr < EPLS_k_MAX_SADR) &&        /* not end-of-list */
-        (aw_MainSadr[w_addSadr] != w_mainSadr)) /* and not the same main-SADR */
+  BOOLEAN o_error = FALSE;          /* for the error from the SOD access */
+  UINT16 *pw_sadr = (UINT16 *)NULL; /* pointer to the SADR for SOD access */
+
+  /* if parameter is invalid */
+  if ((w_addSadr < EPLS_k_MIN_SADR) || (w_addSadr > EPLS_k_MAX_SADR))
   {
-    w_addSadr++;
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SCM_k_ADD_SADR_ERR, (UINT32)w_addSadr);
+    o_error = TRUE;
   }
+  else
+  {
+    pw_sadr = (UINT16 *)SCM_SodQueryRead((UINT16)(0xc800U + w_addSadr), 1U,
+                                         &o_error);
+    /* if additional SADR */
+    if ((pw_sadr != NULL) && (w_addSadr != *pw_sadr))
+    {
+      aw_MainSadr[w_addSadr-1U] = *pw_sadr;
+    }
+    /* else if main SADR or SOD entry is not available */
+    else if (o_error == FALSE)
+    {
+      aw_MainSadr[w_addSadr-1U] = 0U;  /* mark as "not available" */
+    }
+    else  /* o_error == TRUE */
+    {
+      /* other SOD error */
+    }
+
+    /* if the entry was read */
+    if (o_error == FALSE)
+    {
+      /* the positions of running assignments would be moved by a rebuild,
+         see SCM_AddSadrIdxUpdate() */
+      o_AddSadrIdxPending = TRUE;
+    }
+    /* no else : SOD error */
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return (BOOLEAN)(o_error == FALSE);
+}
 
-  /* if end-of-list found */
-  if (w_addSadr == EPLS_k_MAX_SADR)
+/**
+* @brief This function rebuilds the index of the additional SADRs after SCM_UpdateAddSadr(),
+* if no SN is in the additional SADR assignment.
+*
+* SCM_GetNextAddSadr() stores the position within the additional SADRs of the main SADR in
+* the FSM control block, so the index is not changed while an assignment is running.
+*
+* @param	w_noSlots	number of used FSM slots (not checked, only called with the
+* 	number of slots in SCM_Trigger()). valid range: <= SCM_cfg_MAX_NUM_OF_NODES
+*/
+void SCM_AddSadrIdxUpdate(UINT16 w_noSlots)
+{
+  const SCM_t_FSM_CB *ps_fsmCb;     /* pointer to the FSM control block */
+  UINT16 w_slot = 0U;               /* loop counter */
+  BOOLEAN o_busy = FALSE;           /* additional SADR assignment is running */
+
+  /* if the additional SADR list was changed */
+  if (o_AddSadrIdxPending)
   {
-    /* return "end of list reached" */
-    w_addSadr = 0U;
+    while ((w_slot < w_noSlots) && !o_busy)
+    {
+      ps_fsmCb = &SCM_as_FsmCb[w_slot];
+      /* if the SN is in the additional SADR assignment */
+      if ((!ps_fsmCb->o_removed) &&
+          ((ps_fsmCb->e_state == SCM_k_ASSIGN_ADD_SADR) ||
+           (ps_fsmCb->e_state == SCM_k_WF_ADD_SADR_RESP)))
+      {
+        o_busy = TRUE;
+      }
+      /* no else : next slot */
+      w_slot++;
+    }
+
+    /* if no assignment is running */
+    if (!o_busy)
+    {
+      BuildAddSadrIndex();
+      o_AddSadrIdxPending = FALSE;
+    }
+    /* no else : the index is rebuilt with a later call */
   }
-  else /* else: next valid add-SADR found */
+  /* no else : index is up to date */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function builds the index of the additional SADRs per main SADR from aw_MainSadr.
+*
+* The index is built by counting the additional SADRs per main SADR and distributing
+* them afterwards, both steps run once through the list.
+*/
+static void BuildAddSadrIndex(void)
+{
+  UINT16 w_idx;                     /* loop counter */
+  UINT16 w_mainSadr;                /* main SADR of an additional SADR */
+
+  for (w_idx = 0U; w_idx < (EPLS_k_MAX_SADR+2U); w_idx++)
+  {
+    aw_AddSadrStart[w_idx] = 0U;
+  }
+
+  /* number of additional SADRs per main SADR is counted */
+  for (w_idx = 0U; w_idx < EPLS_k_MAX_SADR; w_idx++)
+  {
+    w_mainSadr = aw_MainSadr[w_idx];
+    /* if additional SADR with a valid main SADR */
+    if ((w_mainSadr != 0U) && (w_mainSadr <= EPLS_k_MAX_SADR))
+    {
+      aw_AddSadrStart[w_mainSadr]++;
+    }
+    /* no else : no additional SADR */
+  }
+
+  /* aw_AddSadrStart[x] is set to the end of the group of the main SADR x */
+  for (w_idx = 1U; w_idx < (EPLS_k_MAX_SADR+2U); w_idx++)
+  {
+    aw_AddSadrStart[w_idx] = (UINT16)(aw_AddSadrStart[w_idx] +
+                                      aw_AddSadrStart[w_idx-1U]);
+  }
+
+  /* additional SADRs are inserted from the end of the groups, afterwards
+     aw_AddSadrStart[x] is the start of the group of the main SADR x */
+  w_idx = EPLS_k_MAX_SADR;
+  while (w_idx > 0U)
+  {
+    w_idx--;
+    w_mainSadr = aw_MainSadr[w_idx];
+    /* if additional SADR with a valid main SADR */
+    if ((w_mainSadr != 0U) && (w_mainSadr <= EPLS_k_MAX_SADR))
+    {
+      aw_AddSadrStart[w_mainSadr]--;
+      aw_AddSadr[aw_AddSadrStart[w_mainSadr]] = (UINT16)(w_idx + 1U);
+    }
+    /* no else : no additional SADR */
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function returns the next additional SADR of the given main SADR.
+*
+* Because one SN can have more than one additional SADR, the function must be called until
+* zero is returned. The additional SADRs are returned in ascending order.
+*
+* @param	w_mainSadr		Main SADR (not checked, checked in ScmInitFsm()).
+* @param    pw_pos		Position in the list of the additional SADRs of the main SADR,
+* 	incremented if a valid additional SADR is returned. Must be zero at the beginning
+* 	(not checked, only called with reference to variable in SCM_AssignAddSadr()).
+*
+* @return
+* - > 0:   - valid additional SADR
+* - = 0:   - end of list reached
+*/
+UINT16 SCM_GetNextAddSadr(UINT16 w_mainSadr, UINT16 *pw_pos)
+{
+  UINT16 w_addSadr = 0U;            /* return value */
+  UINT16 w_listIdx;                 /* index into aw_AddSadr */
+
+  /* if main SADR is valid */
+  if (w_mainSadr <= EPLS_k_MAX_SADR)
   {
-    w_addSadr++;  /* add-SADR = index + 1 */
+    w_listIdx = (UINT16)(aw_AddSadrStart[w_mainSadr] + *pw_pos);
+
+    /* if not end-of-list */
+    if (w_listIdx < aw_AddSadrStart[w_mainSadr+1U])
+    {
+      w_addSadr = aw_AddSadr[w_listIdx];
+      (*pw_pos)++;
+    }
+    /* no else : end of list reached */
   }
+  /* no else : no additional SADRs */
+
   /* call the Control Flow Monitoring */
   SCFM_TACK_PATH();
   return w_addSadr;
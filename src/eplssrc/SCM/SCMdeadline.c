@@ -0,0 +1,272 @@
+/**
+ * @addtogroup SCM
+ * @{
+ * @file SCMdeadline.c
+ *
+ * Deadline queue of the SNMT Master and SSDO Client FSMs.
+ *
+ * The queue is a binary min-heap of FSM numbers ordered by the deadline of the FSM. The
+ * position of every FSM in the heap is stored, so the deadline of a queued FSM can be
+ * changed and the FSM can be removed in O(log n). The FSM with the earliest deadline is
+ * always at position 0.
+ *
+ * The deadlines are compared like EPLS_TIMEOUT(), so the order is also valid after a
+ * wrap-around of the consecutive time, as long as all queued deadlines are less than
+ * 0x80000000 apart.
+ *
+ * @copyright Copyright (c) 2009,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H and IXXAT Automation GmbH
+ * @copyright All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * @copyright This source code is free software; you can redistribute it and/or modify it under the terms of the BSD license (according to License.txt).
+ *
+ */
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SCFMapi.h"
+#include "SCM.h"
+
+
+/**
+ * This macro returns TRUE if the deadline of the FSM at heap position w_posA is earlier
+ * than the deadline of the FSM at heap position w_posB.
+ */
+#define k_EARLIER(ps_queue, w_posA, w_posB) \
+  (!EPLS_TIMEOUT((ps_queue)->pdw_deadline[(ps_queue)->pw_heap[w_posA]], \
+                 (ps_queue)->pdw_deadline[(ps_queue)->pw_heap[w_posB]]))
+
+
+static void swapPos(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_posA,
+                    UINT16 w_posB);
+static void siftUp(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_pos);
+static void siftDown(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_pos);
+
+
+/**
+* @brief This function initializes a deadline queue, no FSM is queued.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        pw_heap           storage of the heap, w_maxFsm entries (not checked, only called with reference to array), valid range: <> NULL
+*
+* @param        pw_pos            storage of the heap positions, w_maxFsm entries (not checked, only called with reference to array), valid range: <> NULL
+*
+* @param        pdw_deadline      storage of the deadlines, w_maxFsm entries (not checked, only called with reference to array), valid range: <> NULL
+*
+* @param        w_maxFsm          number of FSMs (not checked, only called with define), valid range: 1 .. SCM_k_NO_DEADLINE-1
+*/
+void SCM_DeadlineInit(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 *pw_heap,
+                      UINT16 *pw_pos, UINT32 *pdw_deadline, UINT16 w_maxFsm)
+{
+  UINT16 w_fsmNum; /* loop counter */
+
+  ps_queue->w_num = 0U;
+  ps_queue->pw_heap = pw_heap;
+  ps_queue->pw_pos = pw_pos;
+  ps_queue->pdw_deadline = pdw_deadline;
+
+  for(w_fsmNum = 0U; w_fsmNum < w_maxFsm; w_fsmNum++)
+  {
+    pw_pos[w_fsmNum] = SCM_k_NO_DEADLINE;
+    pdw_deadline[w_fsmNum] = 0x00UL;
+  }
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function queues an FSM with the given deadline or changes the deadline of
+* an already queued FSM.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        w_fsmNum          FSM number (not checked, checked by the caller), valid range: 0 .. w_maxFsm-1 of SCM_DeadlineInit()
+*
+* @param        dw_deadline       point of time the FSM has to be checked (not checked, any value allowed), valid range: any 32 bit value
+*/
+void SCM_DeadlineSet(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_fsmNum,
+                     UINT32 dw_deadline)
+{
+  UINT16 w_pos = ps_queue->pw_pos[w_fsmNum]; /* heap position of the FSM */
+
+  ps_queue->pdw_deadline[w_fsmNum] = dw_deadline;
+
+  /* if the FSM is not queued yet */
+  if(w_pos == SCM_k_NO_DEADLINE)
+  {
+    /* append the FSM at the end of the heap */
+    w_pos = ps_queue->w_num;
+    ps_queue->pw_heap[w_pos] = w_fsmNum;
+    ps_queue->pw_pos[w_fsmNum] = w_pos;
+    ps_queue->w_num++;
+    siftUp(ps_queue, w_pos);
+  }
+  else /* the deadline of a queued FSM changed */
+  {
+    siftUp(ps_queue, w_pos);
+    siftDown(ps_queue, ps_queue->pw_pos[w_fsmNum]);
+  }
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function removes an FSM from the deadline queue.
+*
+* The function may also be called for an FSM which is not queued.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        w_fsmNum          FSM number (not checked, checked by the caller), valid range: 0 .. w_maxFsm-1 of SCM_DeadlineInit()
+*/
+void SCM_DeadlineRemove(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_fsmNum)
+{
+  UINT16 w_pos = ps_queue->pw_pos[w_fsmNum]; /* heap position of the FSM */
+  UINT16 w_lastFsm; /* FSM at the end of the heap */
+
+  /* if the FSM is queued */
+  if(w_pos != SCM_k_NO_DEADLINE)
+  {
+    ps_queue->w_num--;
+    ps_queue->pw_pos[w_fsmNum] = SCM_k_NO_DEADLINE;
+
+    /* if the FSM was not at the end of the heap */
+    if(w_pos != ps_queue->w_num)
+    {
+      /* the last FSM fills the gap */
+      w_lastFsm = ps_queue->pw_heap[ps_queue->w_num];
+      ps_queue->pw_heap[w_pos] = w_lastFsm;
+      ps_queue->pw_pos[w_lastFsm] = w_pos;
+      siftUp(ps_queue, w_pos);
+      siftDown(ps_queue, ps_queue->pw_pos[w_lastFsm]);
+    }
+    /* no else : nothing to reorder */
+  }
+  /* no else : FSM is not queued */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function returns the queued FSM with the earliest deadline, if this
+* deadline has elapsed.
+*
+* The FSM stays queued, it has to be removed or get a new deadline by the caller.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        dw_ct             consecutive time (not checked, any value allowed), valid range: any 32 bit value
+*
+* @return
+* - FSM number        - deadline of this FSM has elapsed
+* - SCM_k_NO_DEADLINE - no deadline has elapsed
+*/
+UINT16 SCM_DeadlineExpired(const SCM_t_DEADLINE_QUEUE *ps_queue, UINT32 dw_ct)
+{
+  UINT16 w_return = SCM_k_NO_DEADLINE; /* predefined return value */
+
+  /* if at least one FSM is queued and its deadline has elapsed */
+  if((ps_queue->w_num > 0U) &&
+     (EPLS_TIMEOUT(dw_ct, ps_queue->pdw_deadline[ps_queue->pw_heap[0]])))
+  {
+    w_return = ps_queue->pw_heap[0];
+  }
+  /* no else : no deadline has elapsed */
+  SCFM_TACK_PATH();
+  return w_return;
+}
+
+/**
+* @brief This function exchanges two FSMs in the heap.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        w_posA            heap position (not checked, only called with valid position), valid range: 0 .. w_num-1
+*
+* @param        w_posB            heap position (not checked, only called with valid position), valid range: 0 .. w_num-1
+*/
+static void swapPos(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_posA,
+                    UINT16 w_posB)
+{
+  UINT16 w_fsmNum = ps_queue->pw_heap[w_posA]; /* FSM at position A */
+
+  ps_queue->pw_heap[w_posA] = ps_queue->pw_heap[w_posB];
+  ps_queue->pw_heap[w_posB] = w_fsmNum;
+  ps_queue->pw_pos[ps_queue->pw_heap[w_posA]] = w_posA;
+  ps_queue->pw_pos[w_fsmNum] = w_posB;
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function moves an FSM towards the top of the heap until its parent has an
+* earlier or the same deadline.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        w_pos             heap position (not checked, only called with valid position), valid range: 0 .. w_num-1
+*/
+static void siftUp(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_pos)
+{
+  UINT16 w_parent; /* heap position of the parent */
+  BOOLEAN o_done = FALSE; /* flag to leave the loop */
+
+  while((w_pos > 0U) && (!o_done))
+  {
+    w_parent = (UINT16)((w_pos - 1U) / 2U);
+    /* if the FSM has an earlier deadline than its parent */
+    if(k_EARLIER(ps_queue, w_pos, w_parent))
+    {
+      swapPos(ps_queue, w_pos, w_parent);
+      w_pos = w_parent;
+    }
+    else /* heap order restored */
+    {
+      o_done = TRUE;
+    }
+  }
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function moves an FSM towards the bottom of the heap until no child has
+* an earlier deadline.
+*
+* @param        ps_queue          deadline queue (not checked, only called with reference to struct), valid range: <> NULL
+*
+* @param        w_pos             heap position (not checked, only called with valid position), valid range: 0 .. w_num-1
+*/
+static void siftDown(SCM_t_DEADLINE_QUEUE *ps_queue, UINT16 w_pos)
+{
+  UINT32 dw_child; /* heap position of the earlier child */
+  BOOLEAN o_done = FALSE; /* flag to leave the loop */
+
+  while(!o_done)
+  {
+    dw_child = (2UL * (UINT32)w_pos) + 1UL;
+    /* if the FSM has no child */
+    if(dw_child >= (UINT32)ps_queue->w_num)
+    {
+      o_done = TRUE;
+    }
+    else /* at least one child */
+    {
+      /* if the right child has an earlier deadline than the left child */
+      if(((dw_child + 1UL) < (UINT32)ps_queue->w_num) &&
+         (k_EARLIER(ps_queue, (UINT16)(dw_child + 1UL), (UINT16)dw_child)))
+      {
+        dw_child++;
+      }
+      /* if the child has an earlier deadline than the FSM */
+      if(k_EARLIER(ps_queue, (UINT16)dw_child, w_pos))
+      {
+        swapPos(ps_queue, w_pos, (UINT16)dw_child);
+        w_pos = (UINT16)dw_child;
+      }
+      else /* heap order restored */
+      {
+        o_done = TRUE;
+      }
+    }
+  }
+  SCFM_TACK_PATH();
+}
+
+/** @} */
@@ -55,7 +55,7 @@ typedef struct
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct           Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -99,7 +99,7 @@ BOOLEAN SCM_SendSaplAck(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct           Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -129,12 +129,12 @@ BOOLEAN SCM_SendAddParam(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
 
     /* try to read the parameter set */
-    pb_paraSet = (UINT8 *)SCM_SodRead(SCM_k_IDX_ADD_PARA_SET(w_snNum,ps_fsmCb->b_errCode));
+    pb_paraSet = (UINT8 *)SCM_SodRead(SCM_k_IDX_ADD_PARA_SET(ps_fsmCb->w_dviIdx,ps_fsmCb->b_errCode));
 
     if(pb_paraSet != NULL)
     {
 	  /* try to read the parameter set length */
-      dw_paraSetLen = SCM_SodGetActLen(SCM_k_IDX_ADD_PARA_SET(w_snNum,ps_fsmCb->b_errCode));
+      dw_paraSetLen = SCM_SodGetActLen(SCM_k_IDX_ADD_PARA_SET(ps_fsmCb->w_dviIdx,ps_fsmCb->b_errCode));
       /* if parameters are long enough */
       if(dw_paraSetLen >= sizeof(SCM_t_ADD_PAR_HEADER))
       {
@@ -144,14 +144,14 @@ BOOLEAN SCM_SendAddParam(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
         if ( SCM_k_ADD_PARAM_VERSION != ((SCM_t_ADD_PAR_HEADER*)pb_paraSet)->b_version)
         {
       	  SERR_SetError(EPLS_k_SCM_INST_NUM_ SCM_k_ADD_PARAM1_ERR,
-        			SCM_k_ADD_PARA_ERR_INFO(w_snNum,ps_fsmCb->b_errCode));
+        			SCM_k_ADD_PARA_ERR_INFO(ps_fsmCb->w_dviIdx,ps_fsmCb->b_errCode));
 
         }
         /* additional parameters are not for this SADR */
         else if (w_sadrParaSet != ps_fsmCb->w_sadr)
         {
           SERR_SetError(EPLS_k_SCM_INST_NUM_ SCM_k_ADD_PARAM2_ERR,
-                SCM_k_ADD_PARA_ERR_INFO(w_snNum,ps_fsmCb->b_errCode));
+                SCM_k_ADD_PARA_ERR_INFO(ps_fsmCb->w_dviIdx,ps_fsmCb->b_errCode));
         }
         else
         {
@@ -187,27 +187,27 @@ BOOLEAN SCM_SendAddParam(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
       else
       {
       	SERR_SetError(EPLS_k_SCM_INST_NUM_ SCM_k_ADD_PARAM3_ERR,
-      			SCM_k_ADD_PARA_ERR_INFO(w_snNum,ps_fsmCb->b_errCode));
+      			SCM_k_ADD_PARA_ERR_INFO(ps_fsmCb->w_dviIdx,ps_fsmCb->b_errCode));
 
       }
     }
     else
     {
     	SERR_SetError(EPLS_k_SCM_INST_NUM_ SCM_k_ADD_PARAM4_ERR,
-    			SCM_k_ADD_PARA_ERR_INFO(w_snNum,ps_fsmCb->b_errCode));
+    			SCM_k_ADD_PARA_ERR_INFO(ps_fsmCb->w_dviIdx,ps_fsmCb->b_errCode));
     }
     /* if any error happened */
     if (!o_ok)
     {
       /* set node state to wrong Parameters */
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_WRONG_ADD_PARAM,
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_WRONG_ADD_PARAM,
                                 ps_fsmCb->o_reportSnSts);
 
       /* if no error happened */
       if (o_res)
       {
         /* set the timer to the guard frequency */
-        ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
         ps_fsmCb->e_state = SCM_k_IDLE2;
       }
       /* no else : SOD Read failed */
@@ -223,7 +223,7 @@ BOOLEAN SCM_SendAddParam(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct           Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -248,7 +248,7 @@ BOOLEAN SCM_WfAddParamResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -263,14 +263,14 @@ BOOLEAN SCM_WfAddParamResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to wrong Parameters */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_WRONG_PARAM,
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_WRONG_PARAM,
                               ps_fsmCb->o_reportSnSts);
 
     /* if no error happened */
     if (o_res)
     {
       /* set the timer to the guard frequency */
-      ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+      ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
       ps_fsmCb->e_state = SCM_k_IDLE2;
     }
     /* no else : SOD Read failed */
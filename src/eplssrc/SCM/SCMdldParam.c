@@ -32,7 +32,7 @@
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct            Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -56,11 +56,11 @@ BOOLEAN SCM_WfPreOpResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* try to read the parameter set length */
-    pdw_dataLen = (UINT32 *)SCM_SodQueryRead(SCM_k_IDX_PARA_LEN(w_snNum),
+    pdw_dataLen = (UINT32 *)SCM_SodQueryRead(SCM_k_IDX_PARA_LEN(ps_fsmCb->w_dviIdx),
                                              &o_error);
     if(pdw_dataLen != NULL)
     {
-      pb_paraSet = (UINT8 *)SCM_SodRead(SCM_k_IDX_PARA_SET(w_snNum));
+      pb_paraSet = (UINT8 *)SCM_SodRead(SCM_k_IDX_PARA_SET(ps_fsmCb->w_dviIdx));
 
       /* if SOD Read succeeded */
       if(pb_paraSet != NULL)
@@ -90,14 +90,14 @@ BOOLEAN SCM_WfPreOpResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     else if(o_error == FALSE)
     {
       /* set node state to wrong Parameters */
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_WRONG_PARAM,
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_WRONG_PARAM,
                                 ps_fsmCb->o_reportSnSts);
 
       /* if no error happened */
       if (o_res)
       {
         /* set the timer to the guard frequency */
-        ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
         ps_fsmCb->e_state = SCM_k_IDLE2;
       }
       /* no else : SOD Read failed */
@@ -113,7 +113,7 @@ BOOLEAN SCM_WfPreOpResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -138,7 +138,7 @@ BOOLEAN SCM_WfPreOpResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct           Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -156,7 +156,8 @@ BOOLEAN SCM_WfParamDlResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     ps_fsmCb->w_event = SCM_k_EVT_GENERIC_EVENT;
     ps_fsmCb->e_state = SCM_k_ASSIGN_ADD_SADR;
 
-    ps_fsmCb->w_addSadr = 0U;      /* reset "Additional SADR" search position */
+    ps_fsmCb->w_addSadr = 0U;
+    ps_fsmCb->w_addSadrPos = 0U;   /* reset "Additional SADR" search position */
 
     o_res = TRUE;
   }
@@ -166,7 +167,7 @@ BOOLEAN SCM_WfParamDlResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -181,14 +182,14 @@ BOOLEAN SCM_WfParamDlResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to wrong Parameters */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_WRONG_PARAM,
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_WRONG_PARAM,
                               ps_fsmCb->o_reportSnSts);
 
     /* if no error happened */
     if (o_res)
     {
       /* set the timer to the guard frequency */
-      ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+      ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
       ps_fsmCb->e_state = SCM_k_IDLE2;
     }
     /* no else : SOD Read failed */
@@ -209,7 +210,7 @@ BOOLEAN SCM_WfParamDlResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param        ps_fsmCb        Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct           Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -229,7 +230,7 @@ BOOLEAN SCM_AssignAddSadr(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 
     /* read the next Additional SADR from the "Additional SADR List" */
     ps_fsmCb->w_addSadr = SCM_GetNextAddSadr(ps_fsmCb->w_sadr,
-                                             ps_fsmCb->w_addSadr);
+                                             &ps_fsmCb->w_addSadrPos);
     /* if additional SADR id valid */
     if(ps_fsmCb->w_addSadr != 0U)
     {
@@ -275,7 +276,7 @@ BOOLEAN SCM_AssignAddSadr(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param		ps_fsmCb	Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum  FSM slot number (=> index to the DVI list) (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum  FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param              dw_ct Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -304,14 +305,14 @@ BOOLEAN SCM_WfAddSadrResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     else /* unvalid received add SADR */
     {
       /* set node state to wrong Parameters */
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_WRONG_PARAM,
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_WRONG_PARAM,
                                 ps_fsmCb->o_reportSnSts);
 
       /* if no error happened */
       if (o_res)
       {
         /* set the timer to the guard frequency */
-        ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
         ps_fsmCb->e_state = SCM_k_IDLE2;
       }
       /* no else : error happened */
@@ -323,7 +324,7 @@ BOOLEAN SCM_WfAddSadrResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
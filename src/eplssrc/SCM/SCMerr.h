@@ -102,6 +102,15 @@
 
 /** parameter checksums are not available */
 #define SCM_k_PARA_CHKSM_ERR 	     SCM_ERR_MINOR(20)
+
+/** invalid parameter 'w_dviIdx' in function SCM_AddNode(), SCM_RemoveNode() or SCM_ReconfigureNode() */
+#define SCM_k_NODE_DVI_IDX_ERR        SCM_ERR_FATAL(21)
+
+/** SCM_AddNode(), SCM_RemoveNode() or SCM_ReconfigureNode() called while the SCM is deactivated */
+#define SCM_k_NODE_STOPPED_ERR        SCM_ERR_FATAL(22)
+
+/** invalid parameter 'w_addSadr' in function SCM_UpdateAddSadr() */
+#define SCM_k_ADD_SADR_ERR            SCM_ERR_FATAL(23)
 /** @} */
 
 #if(EPLS_cfg_ERROR_STRING == EPLS_k_ENABLE)
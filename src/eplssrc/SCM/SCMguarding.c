@@ -20,13 +20,52 @@
 
 #include "SCMint.h"
 
+/**
+* @brief This function returns the point of time of the next guarding or retry of an SN.
+*
+* If SCM_cfg_STAGGERED_GUARDING is enabled, every SN has its own phase within the guard
+* time (FSM slot number * SCM_dw_GuardSlotTime). The returned time is the last point of
+* time with this phase which is not later than one guard time from now on. So an SN stays
+* in its slot after a delayed response or a retry and is never guarded later than one guard
+* time after its last response.
+*
+* @param	w_snNum		FSM slot number (not checked, checked in SCM_Trigger()).
+* 	Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+*
+* @param	dw_ct		Consecutive time (not checked, any value allowed). Valid range: UINT32
+*
+* @return	point of time for the guard timer of the SN
+*/
+UINT32 SCM_GuardTimerGet(UINT16 w_snNum, UINT32 dw_ct)
+{
+  UINT32 dw_timer = dw_ct + SCM_dw_SnGuardTime; /* point of time to be returned */
+#if (SCM_cfg_STAGGERED_GUARDING == EPLS_k_ENABLE)
+  UINT32 dw_phase;    /* phase of the SN within the guard time */
+
+  /* if the guard time is not 0 */
+  if (SCM_dw_SnGuardTime > 0UL)
+  {
+    dw_phase = (UINT32)w_snNum * SCM_dw_GuardSlotTime;
+    /* move the point of time back to the last slot of the SN */
+    dw_timer -= (dw_timer - dw_phase) % SCM_dw_SnGuardTime;
+  }
+  /* no else : all SNs are guarded at once */
+#else
+  w_snNum = w_snNum; /* to avoid compiler warning */
+#endif
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return dw_timer;
+}
+
 
 /**
 * @brief This function represents the state SCM_k_WF_GUARD_TIMER of the finite state machine ScmFsmProcess().
 *
 * @param ps_fsmCb               Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum                FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum                FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct                  Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -67,7 +106,7 @@ BOOLEAN SCM_WfGuardTimer(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param	ps_fsmCb		Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param 	w_snNum    		FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param 	w_snNum    		FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param 	dw_ct        	Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -90,21 +129,21 @@ BOOLEAN SCM_WfGuardResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* if status_OP received */
     if(b_snStatus == (UINT8)SNMTS_k_SN_STS_OP)
     {
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_OK,
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_OK,
                                 ps_fsmCb->o_reportSnSts);
 
       /* if no error happened */
       if (o_res)
       {
         /* set the timer to the guard frequency */
-        ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
         ps_fsmCb->e_state = SCM_k_WF_GUARD_TIMER;
       }
     }
     /* if status_PRE_OP received */
     else if(b_snStatus == (UINT8)SNMTS_k_SN_STS_PREOP)
     {
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
       /* if no error happened */
       if (o_res)
@@ -125,7 +164,7 @@ BOOLEAN SCM_WfGuardResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
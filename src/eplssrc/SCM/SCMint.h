@@ -67,7 +67,23 @@
 /** Size of the response buffer (max. = SNMT UDID of the SCM) */
 #define SCM_k_RESP_BUFF_SIZE      (1U+EPLS_k_UDID_LEN)
 /** number of FSM state functions */
-#define SCM_k_NUM_CFG_FSM_STATES  26U
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+  #define SCM_k_NUM_CFG_FSM_STATES  27U
+#else
+  #define SCM_k_NUM_CFG_FSM_STATES  26U
+#endif
+
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/** number of objects read by the multi-object read of the DVI */
+#define SCM_k_DVI_NUM_OBJ         3U
+/** size of the DVI buffer (vendor ID, product code and revision number) */
+#define SCM_k_DVI_BUFF_SIZE       (SCM_k_DVI_NUM_OBJ * 4U)
+/**
+ * length of the multi-object read request of the DVI (SOD access command, index and
+ * sub-index of all objects), the SSDO payload of the SN has to be at least this long
+ */
+#define SCM_k_DVI_MULTI_REQ_LEN   (1U + (SCM_k_DVI_NUM_OBJ * 3U))
+#endif
 
 /**
  * @name SOD object sub-index definitions
@@ -163,6 +179,18 @@
 #define  k_SSDOC_SLOT   2U
 /** @} */
 
+/**
+ * @name Node commands requested by SCM_AddNode(), SCM_RemoveNode() and SCM_ReconfigureNode()
+ * @{
+ */
+/** no node command pending */
+#define SCM_k_NODE_CMD_NONE       0U
+/** SN is removed from the SCM */
+#define SCM_k_NODE_CMD_REMOVE     1U
+/** SN is read from the SOD and commissioned again */
+#define SCM_k_NODE_CMD_INIT       2U
+/** @} */
+
 /**
  * States of the SCM FSM
  */
@@ -201,6 +229,10 @@ typedef enum{
   SCM_k_SEND_SAPL_ACK           = 23,
   SCM_k_SEND_ADD_PAR            = 24,
   SCM_k_WF_ADD_PAR_DL_RESP      = 25
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+  /* Sub-FSM Verify DVI, multi-object read */
+  ,SCM_k_WF_DVI_RESP            = 26
+#endif
   /* RSM_IGNORE_QUALITY_END */
 }SCM_t_FSM_STATE;
 
@@ -222,6 +254,11 @@ typedef struct
   BOOLEAN  o_udidUsed;
   /** SADR of the SN, SADR_U16 (0xC400, 0x01) */
   UINT16   w_sadr;
+  /**
+   * index of the SN in the SADR-DVI list (0xC400 + w_dviIdx), the FSM slots are
+   * packed, so this index differs from the slot number if SADR-DVI entries are unused
+   */
+  UINT16   w_dviIdx;
   /** MaximumSsdoPayloadLen_U16 (0xC400, 0x08) */
   UINT16   w_payLd;
   /** SnmtCrcPollInterval_U32 (0xC400, 0x09) */
@@ -256,6 +293,17 @@ typedef struct
   UINT32  dw_timer;
   /** variable to store the last assigned additional SADR */
   UINT16   w_addSadr;
+  /** position of the next additional SADR in the list of the main SADR */
+  UINT16   w_addSadrPos;
+  /** pending node command, executed in SCM_Trigger() (see SCM_k_NODE_CMD_NONE) */
+  UINT8    b_nodeCmd;
+  /**
+   * SN is removed
+   *
+   * - TRUE  : the FSM of the SN is not processed
+   * - FALSE : the FSM of the SN is processed
+   */
+  BOOLEAN  o_removed;
 
   /** Error Group Variable for auto acknowledge of SN_Fail */
   UINT8 b_errGroup;
@@ -276,6 +324,17 @@ typedef struct
   UINT32 adw_respBuff[(SCM_k_RESP_BUFF_SIZE/4U)+1U];
   /** for UDID_MISMATCH handling, enforce UINT32 alignment */
   UINT32 adw_newUdid[(SCM_k_RESP_BUFF_SIZE/4U)+1U];
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+  /** response buffer of the multi-object read of the DVI */
+  UINT32 adw_dviBuff[SCM_k_DVI_NUM_OBJ];
+  /**
+   * Multi-object read of the DVI is not supported by the SN
+   *
+   * - TRUE  : the DVI is read by three single reads
+   * - FALSE : the DVI is read by one multi-object read
+   */
+  BOOLEAN o_dviMultiUnsup;
+#endif
 
   /** variables for comparing the timestamp checksum domain */
 
@@ -303,6 +362,9 @@ typedef struct{
 }t_FSM_FUNC;
 
 extern UINT32 SCM_dw_SnGuardTime SAFE_NO_INIT_SEKTOR;
+#if (SCM_cfg_STAGGERED_GUARDING == EPLS_k_ENABLE)
+extern UINT32 SCM_dw_GuardSlotTime SAFE_NO_INIT_SEKTOR;
+#endif
 extern UINT8 SCM_b_ConfigMode SAFE_NO_INIT_SEKTOR;
 
 extern SCM_t_FSM_CB SCM_as_FsmCb[SCM_cfg_MAX_NUM_OF_NODES] SAFE_NO_INIT_SEKTOR;
@@ -311,7 +373,8 @@ extern SCM_t_FSM_CB SCM_as_FsmCb[SCM_cfg_MAX_NUM_OF_NODES] SAFE_NO_INIT_SEKTOR;
 * @brief This function builds a local list with main-SADRs from the "Additional SADR List".
 *
 * This list is necessary for the "Additional SADR Assignment" process. All UDID are marked
-* as not used.
+* as not used. From this list an index of the additional SADRs per main SADR is built, so
+* SCM_GetNextAddSadr() does not have to search.
 *
 * @return
 * - FALSE - Abort forcing error
@@ -335,22 +398,67 @@ BOOLEAN SCM_BuildLocalSadrList(void);
 BOOLEAN SCM_UniqueUdid(const UINT8 *pb_newUdid);
 
 /**
-* @brief This function searches in the local SADR-List for the next g1iven main SADR value
-* and returns the corresponding additional SADR.
+* @brief This function returns the next additional SADR of the given main SADR.
 *
 * Because one SN can have more than one additional SADR, the function must be called until
-* zero is returned. The searches through the complete list until the end of the list is
-* reached.
+* zero is returned. The additional SADRs are returned in ascending order.
 *
 * @param	w_mainSadr		Main SADR (not checked, checked in ScmInitFsm()).
-* @param    w_addSadr		Old "Additional SADR" as current search position.
-* 	Must be zero at the beginning (not checked, checked in SCM_WfParamDlResp()).
+* @param    pw_pos		Position in the list of the additional SADRs of the main SADR,
+* 	incremented if a valid additional SADR is returned. Must be zero at the beginning
+* 	(not checked, only called with reference to variable in SCM_AssignAddSadr()).
 *
 * @return
 * - > 0:   - valid additional SADR
 * - = 0:   - end of list reached
 */
-UINT16 SCM_GetNextAddSadr(UINT16 w_mainSadr, UINT16 w_addSadr);
+UINT16 SCM_GetNextAddSadr(UINT16 w_mainSadr, UINT16 *pw_pos);
+
+/**
+* @brief This function rebuilds the index of the additional SADRs after SCM_UpdateAddSadr(),
+* if no SN is in the additional SADR assignment.
+*
+* SCM_GetNextAddSadr() stores the position within the additional SADRs of the main SADR in
+* the FSM control block, so the index is not changed while an assignment is running.
+*
+* @param	w_noSlots	number of used FSM slots (not checked, only called with the
+* 	number of slots in SCM_Trigger()). valid range: <= SCM_cfg_MAX_NUM_OF_NODES
+*/
+void SCM_AddSadrIdxUpdate(UINT16 w_noSlots);
+
+/**
+* @brief This function returns the point of time of the next guarding or retry of an SN.
+*
+* If SCM_cfg_STAGGERED_GUARDING is enabled, the time is the last slot of the SN within the
+* guard time from now on. The slots of all SNs are spread evenly over the guard time.
+* Otherwise the time is one guard time from now on.
+*
+* @param	w_snNum		FSM slot number (not checked, checked in SCM_Trigger()).
+* 	Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+*
+* @param	dw_ct		Consecutive time (not checked, any value allowed). Valid range: UINT32
+*
+* @return	point of time for the guard timer of the SN
+*/
+UINT32 SCM_GuardTimerGet(UINT16 w_snNum, UINT32 dw_ct);
+
+/**
+* @brief This function sends the first read request of the process "Verify DVI" and sets
+* the FSM into the corresponding "wait for response" state.
+*
+* @param	ps_fsmCb	Pointer to the current slot of the FSM control block (not checked,
+* 	only called with reference to struct in SCM_WfAssignScmUdidResp() or SCM_WfDviResp()).
+*
+* @param	w_snNum		FSM slot number (not checked, checked
+* 	in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+*
+* @param	dw_ct		Consecutive time (not checked, any value allowed). Valid range: UINT32
+*
+* @return
+* - TRUE  - request sent
+* - FALSE - Abort forcing error
+*/
+BOOLEAN SCM_SendDviReadReq(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct);
 
 /**
  * @name SCM FSM state functions
@@ -378,6 +486,9 @@ BOOLEAN SCM_WfProductCodeResp(SCM_t_FSM_CB *ps_fsmCb,
                               UINT16 w_snNum, UINT32 dw_ct);
 BOOLEAN SCM_WfRevisionNumberResp(SCM_t_FSM_CB *ps_fsmCb,
                                  UINT16 w_snNum, UINT32 dw_ct);
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+BOOLEAN SCM_WfDviResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct);
+#endif
 /* Sub-FSM Verify Parameters */
 BOOLEAN SCM_WfTimestamp(SCM_t_FSM_CB *ps_fsmCb,
                         UINT16 w_snNum, UINT32 dw_ct);
@@ -504,8 +615,6 @@ BOOLEAN SCM_SodWrite(UINT16 w_idx, UINT8 b_subidx, const UINT8 *pb_data);
 *
 * @param        ps_fsmCb             Pointer to the current slot of the FSM control block (not checked, only called with reference to struct).
 *
-* @param        w_snNum              Safety Node number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
-*
 * @param        b_nodeStatus         node status (not checked, only called with define).
 *
 * @param        o_reportSnSts
@@ -515,8 +624,8 @@ BOOLEAN SCM_SodWrite(UINT16 w_idx, UINT8 b_subidx, const UINT8 *pb_data);
 * @return
 * - FALSE     - Abort forcing error
 */
-BOOLEAN SCM_SetNodeStatus(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
-                          UINT8 b_nodeStatus, BOOLEAN o_reportSnSts);
+BOOLEAN SCM_SetNodeStatus(SCM_t_FSM_CB *ps_fsmCb, UINT8 b_nodeStatus,
+                          BOOLEAN o_reportSnSts);
 
 /**
 * @brief This function is a callback function used by the SSDOC.
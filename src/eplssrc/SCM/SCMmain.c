@@ -37,6 +37,10 @@
 
 /** safety node guard time */
 UINT32 SCM_dw_SnGuardTime SAFE_NO_INIT_SEKTOR;
+#if (SCM_cfg_STAGGERED_GUARDING == EPLS_k_ENABLE)
+/** time between the guard slots of two consecutive SNs, see SCM_GuardTimerGet() */
+UINT32 SCM_dw_GuardSlotTime SAFE_NO_INIT_SEKTOR;
+#endif
 /** To distinguish between ACM and MCM */
 UINT8 SCM_b_ConfigMode SAFE_NO_INIT_SEKTOR;
 
@@ -82,6 +86,10 @@ static t_FSM_FUNC as_FsmStateFunctions[SCM_k_NUM_CFG_FSM_STATES] SAFE_INIT_SEKTO
   {k_SNMTM_SLOT, SCM_SendSaplAck},
   {k_SSDOC_SLOT, SCM_SendAddParam},
   {k_NO_SLOT, SCM_WfAddParamResp}
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+  /* Sub-FSM Verify DVI, multi-object read */
+  ,{k_SSDOC_SLOT, SCM_WfDviResp}
+#endif
 };
 
 /** Index into FSM control blocks */
@@ -94,6 +102,13 @@ static UINT16 w_SnRealNum SAFE_NO_INIT_SEKTOR;
 static BOOLEAN ScmInitFsm(void);
 static BOOLEAN SnSodEntryInit(UINT16 w_snNum, UINT16 w_cbIdx, BOOLEAN *po_break,
                               BOOLEAN *po_error);
+static void InitFsmCb(SCM_t_FSM_CB *ps_fsmCb);
+static UINT16 FsmSlotGet(UINT16 w_dviIdx);
+#if (SCM_cfg_STAGGERED_GUARDING == EPLS_k_ENABLE)
+static void GuardSlotTimeSet(void);
+#endif
+static BOOLEAN RequestNodeCmd(UINT16 w_dviIdx, UINT16 w_hdl, UINT8 b_nodeCmd);
+static BOOLEAN ProcessNodeCmd(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_hdl);
 static void CheckTimeout(SCM_t_FSM_CB *ps_fsmCb, UINT32 dw_ct);
 static BOOLEAN ScmFsmPreCon(const SCM_t_FSM_CB *ps_fsmCb,
                             const UINT8 *pb_numFreeFrms);
@@ -171,6 +186,9 @@ void SCM_Trigger(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
     /* if SCM is activated */
     if(o_Stopped == FALSE)
     {
+      /* apply a changed additional SADR list between two assignments */
+      SCM_AddSadrIdxUpdate(w_SnRealNum);
+
       /* call the FSM for all SNs until the number of 
         maximum processed nodes per function call is reached */
       while((w_idx < (UINT16)SCM_cfg_NUM_OF_PROCESSED_NODES_PER_CALL) &&
@@ -178,8 +196,18 @@ void SCM_Trigger(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
       {
         /* determine next FSM slot */
         ps_fsmCb = &SCM_as_FsmCb[w_FsmIdx];
+        /* if the pending node command failed */
+        if (!ProcessNodeCmd(ps_fsmCb, w_FsmIdx))
+        {
+          o_break = TRUE;
+        }
+        /* else if the SN was removed */
+        else if (ps_fsmCb->o_removed)
+        {
+          /* SN is not processed */
+        }
         /* check if node may be processed */
-        if (SAPL_ScmProcessSn(ps_fsmCb->w_sadr))
+        else if (SAPL_ScmProcessSn(ps_fsmCb->w_sadr))
         {
 			/* plausibility check */
 			if((UINT16)ps_fsmCb->e_state < (UINT16)SCM_k_NUM_CFG_FSM_STATES)
@@ -396,6 +424,107 @@ BOOLEAN SCM_SnFailAck(UINT16 w_hdl, UINT8 b_errGroup, UINT8 b_errCode)
   return o_res;
 }
 
+/**
+* @brief This function adds a SN to the running safety configuration manager.
+*
+* The SN is read from the SADR-DVI list (0xC400 + w_dviIdx) and commissioned without
+* affecting the other SNs. The SN gets the next free FSM slot and is added with the next
+* call of SCM_Trigger() for this slot. If the SN of w_dviIdx is already managed by the
+* SCM, the call is handled like SCM_ReconfigureNode().
+*
+* @param w_dviIdx	Index in the SADR-DVI list (checked).
+* 	valid range: < SCM_cfg_MAX_NUM_OF_NODES, a free FSM slot must be available
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+BOOLEAN SCM_AddNode(UINT16 w_dviIdx)
+{
+  SCM_t_FSM_CB *ps_fsmCb = (SCM_t_FSM_CB *)NULL;  /* pointer to the FSM control
+                                                     block */
+  BOOLEAN o_res = FALSE;    /* function result */
+  UINT16 w_hdl;             /* FSM slot of the SN */
+
+  w_hdl = FsmSlotGet(w_dviIdx);
+
+  /* if a new FSM slot is appended */
+  if((o_Stopped == FALSE) && (w_hdl == w_SnRealNum) &&
+     (w_dviIdx < (UINT16)SCM_cfg_MAX_NUM_OF_NODES) &&
+     (w_hdl < (UINT16)SCM_cfg_MAX_NUM_OF_NODES))
+  {
+    /* the slot is processed after the SOD entries were read */
+    ps_fsmCb = &SCM_as_FsmCb[w_hdl];
+    ps_fsmCb->w_dviIdx = w_dviIdx;
+    ps_fsmCb->e_state = SCM_k_SEND_ASSIGN_SADR_REQ;
+    ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
+    ps_fsmCb->b_snStatus = SCM_k_NS_MISSING;
+    ps_fsmCb->o_removed = TRUE;
+    w_SnRealNum++;
+#if (SCM_cfg_STAGGERED_GUARDING == EPLS_k_ENABLE)
+    GuardSlotTimeSet();
+#endif
+  }
+  /* no else : existing slot or error is reported by RequestNodeCmd() */
+
+  o_res = RequestNodeCmd(w_dviIdx, w_hdl, SCM_k_NODE_CMD_INIT);
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+
+/**
+* @brief This function removes a SN from the running safety configuration manager.
+*
+* The SN is not guarded any more and its status is reported as SCM_k_NS_MISSING. The
+* SN is removed with the next call of SCM_Trigger() for this SN in which no SNMT or
+* SSDO request of this SN is pending. The FSM slots of the other SNs are unchanged.
+*
+* @param w_dviIdx	Index of the SN in the SADR-DVI list (checked).
+* 	valid range: < SCM_cfg_MAX_NUM_OF_NODES, the SN must be managed by the SCM
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+BOOLEAN SCM_RemoveNode(UINT16 w_dviIdx)
+{
+  BOOLEAN o_res;            /* function result */
+
+  o_res = RequestNodeCmd(w_dviIdx, FsmSlotGet(w_dviIdx),
+                         SCM_k_NODE_CMD_REMOVE);
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+
+/**
+* @brief This function restarts the commissioning of a single SN.
+*
+* The entries of the SN in the SADR-DVI list (0xC400 + w_dviIdx) are read again and the
+* SN is commissioned from the SADR assignment on, e.g. after a module was replaced.
+* The other SNs are not affected. The SN is reconfigured with the next call of
+* SCM_Trigger() for this SN in which no SNMT or SSDO request of this SN is pending.
+* If the additional SADRs of the SN changed then SCM_UpdateAddSadr() has to be called
+* before.
+*
+* @param w_dviIdx	Index of the SN in the SADR-DVI list (checked).
+* 	valid range: < SCM_cfg_MAX_NUM_OF_NODES, the SN must be managed by the SCM
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+BOOLEAN SCM_ReconfigureNode(UINT16 w_dviIdx)
+{
+  BOOLEAN o_res;            /* function result */
+
+  o_res = RequestNodeCmd(w_dviIdx, FsmSlotGet(w_dviIdx), SCM_k_NODE_CMD_INIT);
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+
 /**
 * @brief This function is a callback function which is provided by unit SCM.
 *
@@ -619,6 +748,35 @@ BOOLEAN SCM_UniqueUdid(const UINT8 *pb_newUdid)
                 SCM_k_ERR_REF_FREE_FRMS);
         break;
       }
+      case SCM_k_NODE_DVI_IDX_ERR:
+      {
+        /* Error string */
+        SPRINTF2(pac_str,
+                "%#x - SCM_k_NODE_DVI_IDX_ERR: SCM_AddNode(), SCM_RemoveNode() "
+                "or SCM_ReconfigureNode():\n"
+                "Invalid parameter 'w_dviIdx' (%u).\n",
+                SCM_k_NODE_DVI_IDX_ERR, (UINT16)(dw_addInfo));
+        break;
+      }
+      case SCM_k_NODE_STOPPED_ERR:
+      {
+        /* Error string */
+        SPRINTF2(pac_str,
+                "%#x - SCM_k_NODE_STOPPED_ERR: SCM_AddNode(), SCM_RemoveNode() "
+                "or SCM_ReconfigureNode():\n"
+                "SCM is deactivated, SADR-DVI list index (%u).\n",
+                SCM_k_NODE_STOPPED_ERR, (UINT16)(dw_addInfo));
+        break;
+      }
+      case SCM_k_ADD_SADR_ERR:
+      {
+        /* Error string */
+        SPRINTF2(pac_str,
+                "%#x - SCM_k_ADD_SADR_ERR: SCM_UpdateAddSadr():\n"
+                "Invalid parameter 'w_addSadr' (%u).\n",
+                SCM_k_ADD_SADR_ERR, (UINT16)(dw_addInfo));
+        break;
+      }
       default:
       {
         SPRINTF(pac_str, "Unknown error code was generated by the SCM\n");
@@ -640,13 +798,10 @@ BOOLEAN SCM_UniqueUdid(const UINT8 *pb_newUdid)
 */
 static BOOLEAN ScmInitFsm(void)
 {
-  SCM_t_FSM_CB *ps_fsmCb = (SCM_t_FSM_CB *)NULL;  /* pointer to the FSM control
-                                                     blocks */
   BOOLEAN o_ret = FALSE;    /* return value */
   BOOLEAN o_error = TRUE;   /* for SCM_SodQueryRead errors */
   BOOLEAN o_break = FALSE;  /* for SN SADR Init */
   UINT16 w_snNum = 0U;      /* counter to increment the SOD index */
-  UINT32 i;                 /* loop counter */
   void *pv_data = NULL;     /* pointer to the data for SCM_SodQueryRead */
 
   SCM_NumFreeFrmsSet((UINT8 *)NULL);
@@ -686,26 +841,7 @@ static BOOLEAN ScmInitFsm(void)
     if (SnSodEntryInit(w_snNum, w_SnRealNum, &o_break, &o_error))
     {
       /* occupy FSM slot */
-      ps_fsmCb = &SCM_as_FsmCb[w_SnRealNum];
-
-      /** Variables to store the state machine information for a SN **/
-      ps_fsmCb->e_state = SCM_k_SEND_ASSIGN_SADR_REQ;
-      ps_fsmCb->w_event = SCM_k_EVT_GENERIC_EVENT;
-      ps_fsmCb->b_snStatus = SCM_k_NS_MISSING;
-      ps_fsmCb->o_reportSnSts = TRUE;
-      ps_fsmCb->dw_timer = 0UL;
-      ps_fsmCb->w_addSadr = 0x0000U;
-
-      /** Variables to store the SN response information **/
-      ps_fsmCb->dw_SsdocAbortCode = 0UL;
-      ps_fsmCb->dw_SsdocUploadLen = 0UL;
-      ps_fsmCb->w_tadr = 0x0000U;
-      ps_fsmCb->w_rxSdn = 0x0000U;
-      for(i = 0U; i< (UINT32)((SCM_k_RESP_BUFF_SIZE/4U)+1U); i++)
-      {
-        ps_fsmCb->adw_respBuff[i] = 0UL;
-        ps_fsmCb->adw_newUdid[i]  = 0UL;
-      }
+      InitFsmCb(&SCM_as_FsmCb[w_SnRealNum]);
 
       w_SnRealNum++;
     }
@@ -721,6 +857,9 @@ static BOOLEAN ScmInitFsm(void)
     /* if the initialization succeeded */
     if (w_SnRealNum > 0U)
     {
+#if (SCM_cfg_STAGGERED_GUARDING == EPLS_k_ENABLE)
+      GuardSlotTimeSet();
+#endif
       o_ret = TRUE;
     }
     else /* SOD read error */
@@ -737,6 +876,210 @@ static BOOLEAN ScmInitFsm(void)
 }
 
 
+/**
+* @brief This function initializes the state machine information of one slot of the
+* configuration FSM, the SOD entries are read by SnSodEntryInit().
+*
+* @param ps_fsmCb	pointer to the slot of the FSM control block (not checked, only called with reference in ScmInitFsm() or ProcessNodeCmd()).
+*/
+static void InitFsmCb(SCM_t_FSM_CB *ps_fsmCb)
+{
+  UINT32 i;                 /* loop counter */
+
+  /** Variables to store the state machine information for a SN **/
+  ps_fsmCb->e_state = SCM_k_SEND_ASSIGN_SADR_REQ;
+  ps_fsmCb->w_event = SCM_k_EVT_GENERIC_EVENT;
+  ps_fsmCb->b_snStatus = SCM_k_NS_MISSING;
+  ps_fsmCb->o_reportSnSts = TRUE;
+  ps_fsmCb->dw_timer = 0UL;
+  ps_fsmCb->w_addSadr = 0x0000U;
+  ps_fsmCb->w_addSadrPos = 0x0000U;
+  ps_fsmCb->b_nodeCmd = SCM_k_NODE_CMD_NONE;
+  ps_fsmCb->o_removed = FALSE;
+
+  /** Variables to store the SN response information **/
+  ps_fsmCb->dw_SsdocAbortCode = 0UL;
+  ps_fsmCb->dw_SsdocUploadLen = 0UL;
+  ps_fsmCb->w_tadr = 0x0000U;
+  ps_fsmCb->w_rxSdn = 0x0000U;
+  for(i = 0U; i< (UINT32)((SCM_k_RESP_BUFF_SIZE/4U)+1U); i++)
+  {
+    ps_fsmCb->adw_respBuff[i] = 0UL;
+    ps_fsmCb->adw_newUdid[i]  = 0UL;
+  }
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+  for(i = 0U; i < (UINT32)SCM_k_DVI_NUM_OBJ; i++)
+  {
+    ps_fsmCb->adw_dviBuff[i] = 0UL;
+  }
+  ps_fsmCb->o_dviMultiUnsup = FALSE;
+#endif
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function returns the FSM slot of the SN with the given index in the SADR-DVI list.
+*
+* @param w_dviIdx	Index in the SADR-DVI list (not checked, any value allowed).
+*
+* @return
+* - < number of FSM slots  - FSM slot of the SN
+* - == number of FSM slots - the SN is not managed by the SCM
+*/
+static UINT16 FsmSlotGet(UINT16 w_dviIdx)
+{
+  UINT16 w_hdl = 0U;        /* FSM slot */
+
+  /* search the FSM slot of the SN */
+  while((w_hdl < w_SnRealNum) && (SCM_as_FsmCb[w_hdl].w_dviIdx != w_dviIdx))
+  {
+    w_hdl++;
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return w_hdl;
+}
+
+#if (SCM_cfg_STAGGERED_GUARDING == EPLS_k_ENABLE)
+/**
+* @brief This function spreads the guard slots of all FSM slots over the guard time.
+*
+* The function is called if the number of FSM slots changes. A removed SN keeps its FSM
+* slot, so only SCM_AddNode() changes the number of slots at runtime.
+*/
+static void GuardSlotTimeSet(void)
+{
+  /* if FSM slots are occupied */
+  if (w_SnRealNum > 0U)
+  {
+    SCM_dw_GuardSlotTime = SCM_dw_SnGuardTime / (UINT32)w_SnRealNum;
+  }
+  /* no else : no SN is guarded */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+#endif
+
+/**
+* @brief This function checks the parameters of SCM_AddNode(), SCM_RemoveNode() and
+* SCM_ReconfigureNode() and stores the node command for SCM_Trigger().
+*
+* @param w_dviIdx	Index of the SN in the SADR-DVI list, only used for the error
+* 	information (not checked, any value allowed).
+*
+* @param w_hdl		FSM slot of the SN got by FsmSlotGet() (checked).
+* 	valid range: < number of FSM slots
+*
+* @param b_nodeCmd	node command (not checked, only called with define).
+* 	valid range: SCM_k_NODE_CMD_REMOVE, SCM_k_NODE_CMD_INIT
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+static BOOLEAN RequestNodeCmd(UINT16 w_dviIdx, UINT16 w_hdl, UINT8 b_nodeCmd)
+{
+  BOOLEAN o_res = FALSE;    /* function result */
+
+  /* if SCM is deactivated */
+  if(o_Stopped)
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SCM_k_NODE_STOPPED_ERR,
+                  (UINT32)w_dviIdx);
+  }
+  /* else if the SN is not managed by the SCM */
+  else if(w_hdl >= w_SnRealNum)
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SCM_k_NODE_DVI_IDX_ERR,
+                  (UINT32)w_dviIdx);
+  }
+  else
+  {
+    /* a newer command replaces a pending one */
+    SCM_as_FsmCb[w_hdl].b_nodeCmd = b_nodeCmd;
+    o_res = TRUE;
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+
+/**
+* @brief This function executes the pending node command of a slot of the configuration FSM.
+*
+* The command is only executed if no SNMT or SSDO request of the SN is pending, i.e.
+* the FSM waits for a timer or an acknowledge, otherwise it is kept for the next call.
+*
+* @param ps_fsmCb	pointer to the slot of the FSM control block (not checked, only called with reference in SCM_Trigger()).
+*
+* @param w_hdl		FSM slot number (not checked, checked in SCM_Trigger()). valid range: 0..SCM_cfg_MAX_NUM_OF_NODES-1
+*
+* @return
+* - FALSE       - Abort forcing error
+*/
+static BOOLEAN ProcessNodeCmd(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_hdl)
+{
+  BOOLEAN o_res = TRUE;     /* function result */
+  BOOLEAN o_break = FALSE;  /* for SN SADR Init, not used */
+  BOOLEAN o_error = FALSE;  /* for SCM_SodQueryRead errors */
+
+  /* if a node command is pending and can be executed */
+  if((ps_fsmCb->b_nodeCmd != SCM_k_NODE_CMD_NONE) &&
+     ((ps_fsmCb->o_removed) ||
+      (ps_fsmCb->e_state == SCM_k_SEND_ASSIGN_SADR_REQ) ||
+      (ps_fsmCb->e_state == SCM_k_WF_OPERATOR_ACK) ||
+      (ps_fsmCb->e_state == SCM_k_IDLE2) ||
+      (ps_fsmCb->e_state == SCM_k_WF_POLL_TIMEOUT) ||
+      (ps_fsmCb->e_state == SCM_k_WF_SAPL_ACK) ||
+      (ps_fsmCb->e_state == SCM_k_WF_GUARD_TIMER)))
+  {
+    /* if the SN is removed */
+    if(ps_fsmCb->b_nodeCmd == SCM_k_NODE_CMD_REMOVE)
+    {
+      /* if the status change has to be reported */
+      if((!ps_fsmCb->o_removed) && (ps_fsmCb->b_snStatus != SCM_k_NS_MISSING))
+      {
+        SAPL_ScmNodeStatusChangedClbk(ps_fsmCb->w_sadr, ps_fsmCb->b_snStatus,
+                                      SCM_k_NS_MISSING);
+      }
+      /* no else : status is unchanged */
+
+      ps_fsmCb->b_snStatus = SCM_k_NS_MISSING;
+      ps_fsmCb->o_udidUsed = FALSE;
+      ps_fsmCb->o_removed = TRUE;
+    }
+    /* else the SN is read from the SOD again */
+    else
+    {
+      /* if the SOD entries of the SN are valid */
+      if(SnSodEntryInit(ps_fsmCb->w_dviIdx, w_hdl, &o_break, &o_error))
+      {
+        InitFsmCb(ps_fsmCb);
+      }
+      /* else if the SADR-DVI entry is not used */
+      else if(!o_error)
+      {
+        ps_fsmCb->o_removed = TRUE;
+      }
+      else /* SOD error */
+      {
+        o_res = FALSE;
+      }
+    }
+
+    ps_fsmCb->b_nodeCmd = SCM_k_NODE_CMD_NONE;
+  }
+  /* no else : no command pending or SN is busy */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+
 /**
 * @brief This function reads the SADR, the poll interval, the maximum SSDO payload size
 * and the place holder for the remote timestamp and crc domain for every SN from the SOD
@@ -809,6 +1152,8 @@ static BOOLEAN SnSodEntryInit(UINT16 w_snNum, UINT16 w_cbIdx, BOOLEAN *po_break,
               ps_fsmCb->o_udidUsed = FALSE;
               /* store the SN SARD in the SCM control block */
               ps_fsmCb->w_sadr = *pw_sadr;
+              /* store the SADR-DVI list index of the SN */
+              ps_fsmCb->w_dviIdx = w_snNum;
               /* store the max. SSDO payload data for the SN */
               ps_fsmCb->w_payLd = *pw_payLd;
               /* store the poll interval for the SN */
@@ -944,7 +1289,7 @@ static BOOLEAN ScmFsmPreCon(const SCM_t_FSM_CB *ps_fsmCb,
 *
 * @param ps_fsmCb        pointer to the current slot of the FSM control block (not checked, only called with reference in SCM_Trigger()).
 *
-* @param w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). valid range: 0..SCM_cfg_MAX_NUM_OF_NODES-1
+* @param w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). valid range: 0..SCM_cfg_MAX_NUM_OF_NODES-1
 *
 * @param dw_ct           consecutive time (not checked, any value allowed). valid range: UINT32
 *
@@ -29,7 +29,7 @@ static BOOLEAN CheckSnUdid(SCM_t_FSM_CB *ps_fsmCb, BOOLEAN *po_equal);
 *
 * @param ps_fsmCb		Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum		FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum		FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct   		Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -74,7 +74,7 @@ BOOLEAN SCM_SendAssignSadrReq(SCM_t_FSM_CB *ps_fsmCb,
 *
 * @param ps_fsmCb	Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum 	FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum 	FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct		Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -100,7 +100,7 @@ BOOLEAN SCM_WfAssignSadrResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
        (ps_fsmCb->w_tadr == ps_fsmCb->w_sadr))
     {
       /* if setting of the node state to valid succeeded */
-      if (SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_VALID, FALSE))
+      if (SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_VALID, FALSE))
       {
         /* read UDID of the SCM from the SOD */
         pb_scmUdid = (UINT8 *)SCM_SodRead(EPLS_k_IDX_COMMON_COM_PARAM,
@@ -128,14 +128,14 @@ BOOLEAN SCM_WfAssignSadrResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     else /* received SADR != SADR or SDN != own SDN */
     {
       /* set node state to wrong SADR */
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_WRONG_SADR,
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_WRONG_SADR,
                                 ps_fsmCb->o_reportSnSts);
 
       /* if no error happened */
       if (o_res)
       {
         /* set the timer to the guard frequency */
-        ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
         ps_fsmCb->e_state = SCM_k_IDLE2;
       }
       /* no else : error happened */
@@ -171,7 +171,7 @@ BOOLEAN SCM_WfAssignSadrResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
 *
 * @param ps_fsmCb	Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum 	FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum 	FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct      Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -183,7 +183,6 @@ BOOLEAN SCM_WfAssignSadrResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
 BOOLEAN SCM_WfAssignScmUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
                                 UINT32 dw_ct)
 {
-  SSDOC_t_REQ s_transInfo;           /* used for SSDOC_ReadWriteReq() */
   BOOLEAN o_res = FALSE;             /* function result */
   UINT8 *pb_scmUdid = (UINT8 *)NULL; /* UDID of the SCM */
   UINT32 adw_respScmUdid[(EPLS_k_UDID_LEN/4U)+1U]; /* deserialized SCM UDID
@@ -213,34 +212,20 @@ BOOLEAN SCM_WfAssignScmUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
         if((ps_fsmCb->w_rxSdn == SDN_GetSdn(EPLS_k_SCM_INST_NUM)) &&
            (ps_fsmCb->w_tadr == ps_fsmCb->w_sadr))
         {
-          /* send Vendor-ID read request */
-          s_transInfo.w_idx = EPLS_k_IDX_DEVICE_VEN_ID;
-          s_transInfo.b_subIdx = SCM_k_SUB_IDX_VENDOR_ID;
-          s_transInfo.e_dataType = EPLS_k_UINT32;
-          s_transInfo.b_payloadLen = (UINT8) ps_fsmCb->w_payLd;
-          s_transInfo.pb_data = (UINT8 *)ps_fsmCb->adw_respBuff;
-          s_transInfo.dw_dataLen = SCM_k_RESP_BUFF_SIZE;
-
-          /* if the SSDOC Read request succeeded */
-          if (SSDOC_SendReadReq(ps_fsmCb->w_sadr, w_snNum, SCM_SsdocClbk, dw_ct,
-                                &s_transInfo))
-          {
-            SCM_NumFreeFrmsDec();
-            ps_fsmCb->e_state = SCM_k_WF_VENDOR_ID_RESP;
-          }
-          /* no else : the SSDOC Read request failed */
+          /* send the read request of the DVI */
+          o_res = SCM_SendDviReadReq(ps_fsmCb, w_snNum, dw_ct);
         }
         else /* received SADR != SADR or SDN != own SDN */
         {
           /* set node state to missing */
-          o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING,
+          o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING,
                                     ps_fsmCb->o_reportSnSts);
 
           /* if no error happened */
           if (o_res)
           {
             /* set the timer to the guard frequency */
-            ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+            ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
             ps_fsmCb->e_state = SCM_k_IDLE2;
           }
           /* no else : error happened */
@@ -249,14 +234,14 @@ BOOLEAN SCM_WfAssignScmUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
       else /* received UDID of the SCM does not match */
       {
         /* set node state to missing */
-        o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING,
+        o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING,
                                   ps_fsmCb->o_reportSnSts);
 
         /* if no error happened */
         if (o_res)
         {
           /* set the timer to the guard frequency */
-          ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+          ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
           ps_fsmCb->e_state = SCM_k_IDLE2;
         }
         /* no else : error happened */
@@ -271,14 +256,14 @@ BOOLEAN SCM_WfAssignScmUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
 
     /* set node state to missing */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING,
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING,
                               ps_fsmCb->o_reportSnSts);
 
     /* if no error happened */
     if (o_res)
     {
       /* set the timer to the guard frequency */
-      ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+      ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
       ps_fsmCb->e_state = SCM_k_IDLE2;
     }
     /* no else : error happened */
@@ -298,7 +283,7 @@ BOOLEAN SCM_WfAssignScmUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
 *
 * @param ps_fsmCb 	Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum 	FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum 	FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct		Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -333,7 +318,7 @@ BOOLEAN SCM_WfUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
         SFS_NET_CPY_DOMSTR(ps_fsmCb->adw_newUdid, ps_fsmCb->adw_respBuff,
                            EPLS_k_UDID_LEN);
         /* set node state to UDID mismatch */
-        o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_UDID_MISMATCH,
+        o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_UDID_MISMATCH,
                                   ps_fsmCb->o_reportSnSts);
 
         /* if no error happened */
@@ -346,7 +331,7 @@ BOOLEAN SCM_WfUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
           else /* configuration mode = MCM */
           {
             /* set the timer to the guard frequency */
-            ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+            ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
             ps_fsmCb->e_state = SCM_k_IDLE2;
           }
           /* signal UDID mismatch to application */
@@ -363,14 +348,14 @@ BOOLEAN SCM_WfUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
   {
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING,
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING,
                               ps_fsmCb->o_reportSnSts);
 
     /* if no error happened */
     if (o_res)
     {
       /* set the timer to the guard frequency */
-      ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+      ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
       ps_fsmCb->e_state = SCM_k_IDLE2;
     }
     /* no else : error happened */
@@ -390,7 +375,7 @@ BOOLEAN SCM_WfUdidResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param ps_fsmCb 	Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum 	FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum 	FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct      Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -403,6 +388,7 @@ BOOLEAN SCM_WfOperatorAck(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 {
   BOOLEAN o_res = FALSE;        /* function result */
 
+  w_snNum = w_snNum; /* avoid compiler warning */
   dw_ct = dw_ct; /* avoid compiler warning */
 
   /* if acknowledge received or
@@ -424,7 +410,7 @@ BOOLEAN SCM_WfOperatorAck(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     ps_fsmCb->e_state = SCM_k_SEND_ASSIGN_SADR_REQ;
 
     /* setting node status to MISSING */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
   }
   else  /* other events ignored */
   {
@@ -441,7 +427,7 @@ BOOLEAN SCM_WfOperatorAck(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param ps_fsmCb	Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param w_snNum 	FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param w_snNum 	FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param dw_ct 		Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -34,7 +34,7 @@
 *
 * @param	ps_fsmCb    Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param	w_snNum		FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param	w_snNum		FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param    dw_ct       Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -57,8 +57,8 @@ BOOLEAN SCM_WfAssignSadrResp2(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
        (ps_fsmCb->w_tadr == ps_fsmCb->w_sadr))
     {
 		/* if setting of the node state to valid succeeded */
-		if (SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_VALID, FALSE))
-		{
+		if (SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_VALID, FALSE))
+         		{
 		  /* read UDID of the SCM from the SOD */
 		  pb_scmUdid = (UINT8 *)SCM_SodRead(EPLS_k_IDX_COMMON_COM_PARAM,
 											EPLS_k_SUBIDX_UDID_SCM);
@@ -82,14 +82,14 @@ BOOLEAN SCM_WfAssignSadrResp2(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     else /* received SADR != SADR or SDN != own SDN */
     {
       /* set node state to wrong SADR */
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_WRONG_SADR,
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_WRONG_SADR,
                                 ps_fsmCb->o_reportSnSts);
 
       /* if no error happened */
       if (o_res)
       {
         /* set the timer to the guard frequency */
-        ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
         ps_fsmCb->e_state = SCM_k_IDLE2;
       }
       /* no else : error happened */
@@ -101,7 +101,7 @@ BOOLEAN SCM_WfAssignSadrResp2(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -125,7 +125,7 @@ BOOLEAN SCM_WfAssignSadrResp2(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
 *
 * @param	ps_fsmCb	Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param    w_snNum 	FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param    w_snNum 	FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param    dw_ct       Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -166,14 +166,14 @@ BOOLEAN SCM_VerifyUniqUdid(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     else /* the new UDID is not unique */
     {
       /* set node status to INVALID */
-      o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_INVALID,
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
                                 ps_fsmCb->o_reportSnSts);
 
       /* if no error happened */
       if (o_res)
       {
         /* set the timer to the guard frequency */
-        ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
         ps_fsmCb->e_state = SCM_k_IDLE2;
       }
       /* no else : error happened */
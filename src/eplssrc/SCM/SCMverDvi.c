@@ -30,12 +30,194 @@
 
 #include "SCMint.h"
 
+static BOOLEAN SendVendorIdReq(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
+                               UINT32 dw_ct);
+static BOOLEAN SendTimestampReq(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
+                                UINT32 dw_ct);
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+static BOOLEAN DviValid(const SCM_t_FSM_CB *ps_fsmCb, BOOLEAN *po_valid);
+#endif
+
+/**
+* @brief This function sends the first read request of the process "Verify DVI" and sets
+* the FSM into the corresponding "wait for response" state.
+*
+* If the multi-object read is enabled, the vendor ID, product code and revision number are
+* read at once, unless the SN rejected the multi-object read before or its SSDO payload is
+* too short for the request. Otherwise the vendor ID is read first.
+*
+* @param	ps_fsmCb	Pointer to the current slot of the FSM control block (not checked,
+* 	only called with reference to struct in SCM_WfAssignScmUdidResp() or SCM_WfDviResp()).
+*
+* @param	w_snNum		FSM slot number (not checked, checked
+* 	in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+*
+* @param	dw_ct		Consecutive time (not checked, any value allowed). Valid range: UINT32
+*
+* @return
+* - TRUE  - request sent
+* - FALSE - Abort forcing error
+*/
+BOOLEAN SCM_SendDviReadReq(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
+{
+  BOOLEAN o_res = FALSE;              /* function result */
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+  SSDOC_t_MULTI_REQ s_multiInfo;      /* used for SSDOC_SendMultiReadReq() */
+
+  /* if the SN supports the multi-object read and the request fits into the
+     SSDO payload of the SN */
+  if ((!ps_fsmCb->o_dviMultiUnsup) &&
+      (ps_fsmCb->w_payLd >= (UINT16)SCM_k_DVI_MULTI_REQ_LEN))
+  {
+    s_multiInfo.b_numEntries = (UINT8)SCM_k_DVI_NUM_OBJ;
+    s_multiInfo.aw_idx[0] = EPLS_k_IDX_DEVICE_VEN_ID;
+    s_multiInfo.ab_subIdx[0] = SCM_k_SUB_IDX_VENDOR_ID;
+    s_multiInfo.aw_idx[1] = EPLS_k_IDX_DEVICE_VEN_ID;
+    s_multiInfo.ab_subIdx[1] = SCM_k_SUB_IDX_PROD_CODE;
+    s_multiInfo.aw_idx[2] = EPLS_k_IDX_DEVICE_VEN_ID;
+    s_multiInfo.ab_subIdx[2] = SCM_k_SUB_IDX_REV_NUM;
+    s_multiInfo.b_payloadLen = (UINT8) ps_fsmCb->w_payLd;
+    s_multiInfo.pb_data = (UINT8 *)ps_fsmCb->adw_dviBuff;
+    s_multiInfo.dw_dataLen = SCM_k_DVI_BUFF_SIZE;
+    o_res = SSDOC_SendMultiReadReq(ps_fsmCb->w_sadr, w_snNum, SCM_SsdocClbk,
+                                   dw_ct, &s_multiInfo);
+
+    /* if no error happened */
+    if (o_res)
+    {
+      SCM_NumFreeFrmsDec();
+      ps_fsmCb->e_state = SCM_k_WF_DVI_RESP;
+    }
+    /* no else : error happened */
+  }
+  else /* the DVI is read by single reads */
+  {
+    o_res = SendVendorIdReq(ps_fsmCb, w_snNum, dw_ct);
+  }
+#else
+  o_res = SendVendorIdReq(ps_fsmCb, w_snNum, dw_ct);
+#endif
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function represents the state SCM_k_WF_DVI_RESP of the finite state machine ScmFsmProcess().
+*
+* The response contains the vendor ID, product code and revision number of the SN. If the SN
+* rejects the multi-object read with SOD_ABT_CMD_ID_INVALID, the DVI of this SN is read by
+* single reads from then on.
+*
+* @param   ps_fsmCb     Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
+*
+* @param	w_snNum     FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+*
+* @param	dw_ct       Consecutive time (not checked, any value allowed). Valid range: UINT32
+*
+* @return
+* - FALSE - Abort forcing error
+*/
+BOOLEAN SCM_WfDviResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
+{
+  BOOLEAN o_res = FALSE;              /* function result */
+  BOOLEAN o_valid = FALSE;            /* DVI of the SN is valid */
+
+  /* if response received */
+  if(ps_fsmCb->w_event == SCM_k_EVT_SSDOC_RESP_RX)
+  {
+    /* reset the event */
+    ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
+
+    /* if the DVI check succeeded */
+    if (DviValid(ps_fsmCb, &o_valid))
+    {
+      /* if the DVI matches */
+      if (o_valid)
+      {
+        /* read request for the timestamp */
+        o_res = SendTimestampReq(ps_fsmCb, w_snNum, dw_ct);
+      }
+      else /* wrong DVI */
+      {
+        /* set node state to INVALID */
+        o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
+                                  ps_fsmCb->o_reportSnSts);
+
+        /* if no error happened */
+        if (o_res)
+        {
+          /* set the timer to the guard frequency */
+          ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
+          ps_fsmCb->e_state = SCM_k_IDLE2;
+        }
+        /* no else : error happened */
+      }
+    }
+    /* else: o_res = FALSE; */
+  }
+  /* else if SSDOC timeout occurred */
+  else if (ps_fsmCb->w_event == SCM_k_EVT_SSDOC_TIMEOUT)
+  {
+    /* reset the event */
+    ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
+    /* set node state to MISSING and restart FSM */
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
+
+    /* if no error happened */
+    if (o_res)
+    {
+      ps_fsmCb->w_event = SCM_k_EVT_GENERIC_EVENT;
+      ps_fsmCb->e_state = SCM_k_SEND_ASSIGN_SADR_REQ;
+    }
+  }
+  /* else if error occurred */
+  else if(ps_fsmCb->w_event == SCM_k_EVT_RESP_ERROR)
+  {
+    /* reset the event */
+    ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
+
+    /* if the SN does not support the multi-object read */
+    if (ps_fsmCb->dw_SsdocAbortCode == (UINT32)SOD_ABT_CMD_ID_INVALID)
+    {
+      /* read the DVI by single reads from now on */
+      ps_fsmCb->o_dviMultiUnsup = TRUE;
+      o_res = SendVendorIdReq(ps_fsmCb, w_snNum, dw_ct);
+    }
+    else /* other error */
+    {
+      /* set node state to INVALID */
+      o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
+                                ps_fsmCb->o_reportSnSts);
+
+      /* if no error happened */
+      if (o_res)
+      {
+        /* set the timer to the guard frequency */
+        ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
+        ps_fsmCb->e_state = SCM_k_IDLE2;
+      }
+      /* no else : error happened */
+    }
+  }
+  else  /* other events ignored */
+  {
+    /* error is generated in ScmFsmProcess() */
+    o_res = TRUE;
+  }
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+#endif
+
 /**
 * @brief This function represents the state SCM_k_WF_VENDOR_ID_RESP of the finite state machine ScmFsmProcess().
 *
 * @param   ps_fsmCb     Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param	w_snNum     FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param	w_snNum     FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param	dw_ct       Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -54,7 +236,7 @@ BOOLEAN SCM_WfVendorIdResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* read SOD VendorID */
-    pdw_venId = (UINT32 *)SCM_SodRead(SCM_k_IDX_VENDOR_ID(w_snNum));
+    pdw_venId = (UINT32 *)SCM_SodRead(SCM_k_IDX_VENDOR_ID(ps_fsmCb->w_dviIdx));
     if(pdw_venId != NULL)
     {
       /* if received VendorID == VendorID from DVI list */
@@ -81,14 +263,14 @@ BOOLEAN SCM_WfVendorIdResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
       else /* wrong received_VendorID */
       {
         /* set node state to INVALID */
-        o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_INVALID,
+        o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
                                   ps_fsmCb->o_reportSnSts);
 
         /* if no error happened */
         if (o_res)
         {
           /* set the timer to the guard frequency */
-          ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+          ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
           ps_fsmCb->e_state = SCM_k_IDLE2;
         }
         /* no else : error happened */
@@ -102,7 +284,7 @@ BOOLEAN SCM_WfVendorIdResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -117,14 +299,14 @@ BOOLEAN SCM_WfVendorIdResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to INVALID */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_INVALID,
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
                               ps_fsmCb->o_reportSnSts);
 
     /* if no error happened */
     if (o_res)
     {
       /* set the timer to the guard frequency */
-      ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+      ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
       ps_fsmCb->e_state = SCM_k_IDLE2;
     }
     /* no else : error happened */
@@ -145,7 +327,7 @@ BOOLEAN SCM_WfVendorIdResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
 *
 * @param       ps_fsmCb         Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param       w_snNum          FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param       w_snNum          FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param       dw_ct            Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -165,7 +347,7 @@ BOOLEAN SCM_WfProductCodeResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* read SOD ProductCode */
-    pdw_prodCode = (UINT32 *)SCM_SodRead(SCM_k_IDX_PROD_CODE(w_snNum));
+    pdw_prodCode = (UINT32 *)SCM_SodRead(SCM_k_IDX_PROD_CODE(ps_fsmCb->w_dviIdx));
     if(pdw_prodCode != NULL)
     {
       /* if received ProductCode == ProductCode from DVI list */
@@ -192,14 +374,14 @@ BOOLEAN SCM_WfProductCodeResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
       else /* wrong received ProductCode */
       {
         /* set node state to INVALID */
-        o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_INVALID,
+        o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
                                   ps_fsmCb->o_reportSnSts);
 
         /* if no error happened */
         if (o_res)
         {
           /* set the timer to the guard frequency */
-          ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+          ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
           ps_fsmCb->e_state = SCM_k_IDLE2;
         }
         /* no else : error happened */
@@ -213,7 +395,7 @@ BOOLEAN SCM_WfProductCodeResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -228,14 +410,14 @@ BOOLEAN SCM_WfProductCodeResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to INVALID */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_INVALID,
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
                               ps_fsmCb->o_reportSnSts);
 
     /* if no error happened */
     if (o_res)
     {
       /* set the timer to the guard frequency */
-      ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+      ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
       ps_fsmCb->e_state = SCM_k_IDLE2;
     }
     /* no else : error happened */
@@ -257,7 +439,7 @@ BOOLEAN SCM_WfProductCodeResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
 *
 * @param    ps_fsmCb            Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param    w_snNum             FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param    w_snNum             FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param    dw_ct				Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -267,7 +449,6 @@ BOOLEAN SCM_WfProductCodeResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
 BOOLEAN SCM_WfRevisionNumberResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
                                  UINT32 dw_ct)
 {
-  SSDOC_t_REQ s_transInfo;             /* used for SSDOC_ReadWriteReq() */
   BOOLEAN o_res = FALSE;               /* function result */
   UINT32 *pdw_revNum = (UINT32 *)NULL; /* data pointer fort SOD access */
 
@@ -277,7 +458,7 @@ BOOLEAN SCM_WfRevisionNumberResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* read the revision number from the DVI list */
-    pdw_revNum = (UINT32 *)SCM_SodRead(SCM_k_IDX_REV_NUM(w_snNum));
+    pdw_revNum = (UINT32 *)SCM_SodRead(SCM_k_IDX_REV_NUM(ps_fsmCb->w_dviIdx));
     if(pdw_revNum != NULL)
     {
       /* if revision number is accepted by the application */
@@ -285,34 +466,19 @@ BOOLEAN SCM_WfRevisionNumberResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
                                     ps_fsmCb->adw_respBuff[0]))
       {
         /* read request for the timestamp */
-        s_transInfo.w_idx = EPLS_k_IDX_DEVICE_VEN_ID;
-        s_transInfo.b_subIdx = EPLS_k_SUBIDX_PARAM_CHKSUM;
-        s_transInfo.e_dataType = EPLS_k_DOMAIN;
-        s_transInfo.b_payloadLen = (UINT8) ps_fsmCb->w_payLd;
-        s_transInfo.pb_data = ps_fsmCb->pb_remTimeCrc;
-        s_transInfo.dw_dataLen = ps_fsmCb->dw_maxRemTimeCrcLen;
-        o_res = SSDOC_SendReadReq(ps_fsmCb->w_sadr, w_snNum, SCM_SsdocClbk,
-                                  dw_ct, &s_transInfo);
-
-        /* if no error happened */
-        if (o_res)
-        {
-          ps_fsmCb->e_state = SCM_k_WF_TIMESTAMP;
-          SCM_NumFreeFrmsDec();
-        }
-        /* no else : error happened */
+        o_res = SendTimestampReq(ps_fsmCb, w_snNum, dw_ct);
       }
       else /* wrong RevisionNumber */
       {
         /* set node state to INVALID */
-        o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_INVALID,
+        o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
                                   ps_fsmCb->o_reportSnSts);
 
         /* if no error happened */
         if (o_res)
         {
           /* set the timer to the guard frequency */
-          ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+          ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
           ps_fsmCb->e_state = SCM_k_IDLE2;
         }
         /* no else : error happened */
@@ -326,7 +492,7 @@ BOOLEAN SCM_WfRevisionNumberResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -341,14 +507,14 @@ BOOLEAN SCM_WfRevisionNumberResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to INVALID */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_INVALID,
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
                               ps_fsmCb->o_reportSnSts);
 
     /* if no error happened */
     if (o_res)
     {
       /* set the timer to the guard frequency */
-      ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+      ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
       ps_fsmCb->e_state = SCM_k_IDLE2;
     }
     /* no else : error happened */
@@ -363,5 +529,165 @@ BOOLEAN SCM_WfRevisionNumberResp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
   return o_res;
 }
 
+/**
+* @brief This function sends the read request for the vendor ID and sets the FSM into the
+* state SCM_k_WF_VENDOR_ID_RESP.
+*
+* @param   ps_fsmCb     Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in SCM_SendDviReadReq() or SCM_WfDviResp()).
+*
+* @param	w_snNum     FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+*
+* @param	dw_ct       Consecutive time (not checked, any value allowed). Valid range: UINT32
+*
+* @return
+* - TRUE  - request sent
+* - FALSE - Abort forcing error
+*/
+static BOOLEAN SendVendorIdReq(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
+                               UINT32 dw_ct)
+{
+  SSDOC_t_REQ s_transInfo;            /* used for SSDOC_ReadWriteReq() */
+  BOOLEAN o_res = FALSE;              /* function result */
+
+  /* send Vendor-ID read request */
+  s_transInfo.w_idx = EPLS_k_IDX_DEVICE_VEN_ID;
+  s_transInfo.b_subIdx = SCM_k_SUB_IDX_VENDOR_ID;
+  s_transInfo.e_dataType = EPLS_k_UINT32;
+  s_transInfo.b_payloadLen = (UINT8) ps_fsmCb->w_payLd;
+  s_transInfo.pb_data = (UINT8 *)ps_fsmCb->adw_respBuff;
+  s_transInfo.dw_dataLen = SCM_k_RESP_BUFF_SIZE;
+  o_res = SSDOC_SendReadReq(ps_fsmCb->w_sadr, w_snNum, SCM_SsdocClbk, dw_ct,
+                            &s_transInfo);
+
+  /* if no error happened */
+  if (o_res)
+  {
+    SCM_NumFreeFrmsDec();
+    ps_fsmCb->e_state = SCM_k_WF_VENDOR_ID_RESP;
+  }
+  /* no else : error happened */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+
+/**
+* @brief This function sends the read request for the timestamp and sets the FSM into the
+* state SCM_k_WF_TIMESTAMP.
+*
+* @param   ps_fsmCb     Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in SCM_WfRevisionNumberResp() or SCM_WfDviResp()).
+*
+* @param	w_snNum     FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+*
+* @param	dw_ct       Consecutive time (not checked, any value allowed). Valid range: UINT32
+*
+* @return
+* - TRUE  - request sent
+* - FALSE - Abort forcing error
+*/
+static BOOLEAN SendTimestampReq(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum,
+                                UINT32 dw_ct)
+{
+  SSDOC_t_REQ s_transInfo;            /* used for SSDOC_ReadWriteReq() */
+  BOOLEAN o_res = FALSE;              /* function result */
+
+  s_transInfo.w_idx = EPLS_k_IDX_DEVICE_VEN_ID;
+  s_transInfo.b_subIdx = EPLS_k_SUBIDX_PARAM_CHKSUM;
+  s_transInfo.e_dataType = EPLS_k_DOMAIN;
+  s_transInfo.b_payloadLen = (UINT8) ps_fsmCb->w_payLd;
+  s_transInfo.pb_data = ps_fsmCb->pb_remTimeCrc;
+  s_transInfo.dw_dataLen = ps_fsmCb->dw_maxRemTimeCrcLen;
+  o_res = SSDOC_SendReadReq(ps_fsmCb->w_sadr, w_snNum, SCM_SsdocClbk,
+                            dw_ct, &s_transInfo);
+
+  /* if no error happened */
+  if (o_res)
+  {
+    ps_fsmCb->e_state = SCM_k_WF_TIMESTAMP;
+    SCM_NumFreeFrmsDec();
+  }
+  /* no else : error happened */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function compares the DVI received by the multi-object read with the DVI list.
+*
+* The vendor ID and product code have to match, the revision number has to be accepted by
+* the application. A response with a wrong length is handled as a wrong DVI.
+*
+* @param   ps_fsmCb     Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in SCM_WfDviResp()).
+*
+* @retval  po_valid
+* - TRUE  : the DVI matches
+* - FALSE : the DVI does not match (not checked, only called with reference to variable in SCM_WfDviResp())
+*
+* @return
+* - TRUE  - check succeeded
+* - FALSE - Abort forcing error, SOD read failed
+*/
+static BOOLEAN DviValid(const SCM_t_FSM_CB *ps_fsmCb, BOOLEAN *po_valid)
+{
+  BOOLEAN o_res = FALSE;              /* function result */
+  UINT32 dw_venId;                    /* received vendor ID */
+  UINT32 dw_prodCode;                 /* received product code */
+  UINT32 dw_revNum;                   /* received revision number */
+  const UINT32 *pdw_venId = (UINT32 *)NULL;    /* vendor ID of the DVI list */
+  const UINT32 *pdw_prodCode = (UINT32 *)NULL; /* product code of the DVI list */
+  const UINT32 *pdw_revNum = (UINT32 *)NULL;   /* revision number of the DVI list */
+
+  *po_valid = FALSE;
+
+  /* read the DVI list */
+  pdw_venId = (UINT32 *)SCM_SodRead(SCM_k_IDX_VENDOR_ID(ps_fsmCb->w_dviIdx));
+  if (pdw_venId != NULL)
+  {
+    pdw_prodCode = (UINT32 *)SCM_SodRead(SCM_k_IDX_PROD_CODE(ps_fsmCb->w_dviIdx));
+  }
+  /* no else : SOD read failed */
+  if (pdw_prodCode != NULL)
+  {
+    pdw_revNum = (UINT32 *)SCM_SodRead(SCM_k_IDX_REV_NUM(ps_fsmCb->w_dviIdx));
+  }
+  /* no else : SOD read failed */
+
+  /* if the DVI list was read */
+  if (pdw_revNum != NULL)
+  {
+    o_res = TRUE;
+
+    /* if the data of all objects was received */
+    if (ps_fsmCb->dw_SsdocUploadLen == SCM_k_DVI_BUFF_SIZE)
+    {
+      /* deserialize the received DVI */
+      SFS_NET_CPY32(&dw_venId, ADD_OFFSET(ps_fsmCb->adw_dviBuff, 0U));
+      SFS_NET_CPY32(&dw_prodCode, ADD_OFFSET(ps_fsmCb->adw_dviBuff, 4U));
+      SFS_NET_CPY32(&dw_revNum, ADD_OFFSET(ps_fsmCb->adw_dviBuff, 8U));
+
+      /* if vendor ID and product code match and the revision number is
+         accepted by the application */
+      if ((dw_venId == *pdw_venId) && (dw_prodCode == *pdw_prodCode) &&
+          SAPL_ScmRevisionNumberClbk(ps_fsmCb->w_sadr, *pdw_revNum,
+                                     dw_revNum))
+      {
+        *po_valid = TRUE;
+      }
+      /* no else : wrong DVI */
+    }
+    /* no else : wrong response length */
+  }
+  /* no else : SOD read failed */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return o_res;
+}
+#endif
+
 /** @} */
 /** @} */
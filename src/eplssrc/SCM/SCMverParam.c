@@ -36,7 +36,7 @@
 *
 * @param         ps_fsmCb       Pointer to the current slot of the FSM control block (not checked, only called with reference to struct in ScmFsmProcess()).
 *
-* @param        w_snNum         FSM slot number (=> index to the DVI list)(not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
+* @param        w_snNum         FSM slot number (not checked, checked in SCM_Trigger()). Valid range: < SCM_cfg_MAX_NUM_OF_NODES
 *
 * @param        dw_ct           Consecutive time (not checked, any value allowed). Valid range: UINT32
 *
@@ -55,12 +55,12 @@ BOOLEAN SCM_WfTimestamp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* read the timestamp and crc domain from the DVI list */
-    pb_timeCrc = (UINT8 *)SCM_SodRead(SCM_k_IDX_PARA_CHKSM(w_snNum));
+    pb_timeCrc = (UINT8 *)SCM_SodRead(SCM_k_IDX_PARA_CHKSM(ps_fsmCb->w_dviIdx));
 
     if(pb_timeCrc != NULL)
     {
       /* try to read the parameter set length */
-      dw_timeCrcLen = SCM_SodGetActLen(SCM_k_IDX_PARA_CHKSM(w_snNum));
+      dw_timeCrcLen = SCM_SodGetActLen(SCM_k_IDX_PARA_CHKSM(ps_fsmCb->w_dviIdx));
       /* if remote timestamp and crc domain ==
        * timestamp and crc domain from DVI list */
       if ((0 != dw_timeCrcLen) &&
@@ -94,7 +94,7 @@ BOOLEAN SCM_WfTimestamp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to MISSING and restart FSM */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_MISSING, FALSE);
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_MISSING, FALSE);
 
     /* if no error happened */
     if (o_res)
@@ -109,14 +109,14 @@ BOOLEAN SCM_WfTimestamp(SCM_t_FSM_CB *ps_fsmCb, UINT16 w_snNum, UINT32 dw_ct)
     /* reset the event */
     ps_fsmCb->w_event = SCM_k_EVT_NO_EVT_OCCURRED;
     /* set node state to INVALID */
-    o_res = SCM_SetNodeStatus(ps_fsmCb, w_snNum, SCM_k_NS_INVALID,
+    o_res = SCM_SetNodeStatus(ps_fsmCb, SCM_k_NS_INVALID,
                               ps_fsmCb->o_reportSnSts);
 
     /* if no error happened */
     if (o_res)
     {
       /* set the timer to the guard frequency */
-      ps_fsmCb->dw_timer = dw_ct + SCM_dw_SnGuardTime;
+      ps_fsmCb->dw_timer = SCM_GuardTimerGet(w_snNum, dw_ct);
       ps_fsmCb->e_state = SCM_k_IDLE2;
     }
     /* no else : error happened */
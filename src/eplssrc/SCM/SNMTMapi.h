@@ -22,8 +22,8 @@
 * @brief This function handles service request repetitions in case of a precedent service
 * request was not responded by the specified SNMT Slave in time or not responded at all.
 *
-* Generally this function checks every SNMT Master FSM pausing in state "wait for response"
-* for response timeout.
+* Generally this function checks the SNMT Master FSMs pausing in state "wait for response"
+* whose response timeout has elapsed, the FSM with the earliest response timeout first.
 *
 * @attention This function must not be called in SNMTS_k_ST_INITIALIZATION state. This
 * function must be called at least once within the SNMT timeout (SOD index EPLS_k_IDX_SSDO_COM_PARAM,
@@ -219,6 +219,19 @@ static SOD_t_ACCESS s_AccessTimeout SAFE_NO_INIT_SEKTOR;
 /** SOD access to entry 0x1202, 0x02, SNMT response repetitions */
 static SOD_t_ACCESS s_AccessRetries SAFE_NO_INIT_SEKTOR;
 
+
+/**
+ * Response timeouts of the FSMs waiting for response, ordered by the point of time.
+ * The heap, the heap positions and the response timeouts are stored in the arrays below.
+*/
+static SCM_t_DEADLINE_QUEUE s_TimeoutQueue SAFE_NO_INIT_SEKTOR;
+/** heap of the response timeout queue */
+static UINT16 aw_TimeoutHeap[SNMTM_cfg_MAX_NUM_FSM] SAFE_NO_INIT_SEKTOR;
+/** heap positions of the response timeout queue */
+static UINT16 aw_TimeoutPos[SNMTM_cfg_MAX_NUM_FSM] SAFE_NO_INIT_SEKTOR;
+/** response timeouts of the response timeout queue */
+static UINT32 adw_Timeout[SNMTM_cfg_MAX_NUM_FSM] SAFE_NO_INIT_SEKTOR;
+
 static BOOLEAN sendRequest(UINT32 dw_ct, UINT16 w_fsmNum, UINT16 w_regNum,
                               const EPLS_t_FRM_HDR *ps_hdrInfo,
                               const UINT8 *pb_data);
@@ -271,6 +284,10 @@ BOOLEAN SNMTM_InitFsm(void)
     }
     else  /* SOD entry response retries is available */
     {
+      /* no FSM waits for response */
+      SCM_DeadlineInit(&s_TimeoutQueue, aw_TimeoutHeap, aw_TimeoutPos,
+                       adw_Timeout, SNMTM_cfg_MAX_NUM_FSM);
+
       /* initialize modul global data structure of n SNMT Master FSM */
       for(w_fsmNum = 0U; w_fsmNum < SNMTM_cfg_MAX_NUM_FSM; w_fsmNum++)
       {
@@ -425,6 +442,21 @@ UINT16 SNMTM_GetFsmFree(void)
   return w_return;
 }
 
+/**
+* @brief This function returns the FSM waiting for response with the earliest response
+* timeout, if this timeout has elapsed.
+*
+* @param        dw_ct              consecutive time (not checked, any value allowed), valid range: any 32 bit value
+*
+* @return       0 .. SNMTM_cfg_MAX_NUM_FSM-1 - FSM number k_INVALID_FSM_NUM              - no response timeout elapsed
+*/
+UINT16 SNMTM_GetFsmTimedOut(UINT32 dw_ct)
+{
+  /* SCM_k_NO_DEADLINE is equal to k_INVALID_FSM_NUM */
+  SCFM_TACK_PATH();
+  return SCM_DeadlineExpired(&s_TimeoutQueue, dw_ct);
+}
+
 
 /**
 * @brief This function checks whether a single FSM is available to process transmission of one service request and reception of the  matching service response. *Attention:* This function must be called to ensure availability of a FSM to process a SNMT Service Request.
@@ -644,6 +676,8 @@ static BOOLEAN sendRequest(UINT32 dw_ct, UINT16 w_fsmNum, UINT16 w_regNum,
   {
     /* the subsequent state is WF_RESPONSE */
     as_Fsm[w_fsmNum].o_wfRequest = FALSE;
+    SCM_DeadlineSet(&s_TimeoutQueue, w_fsmNum,
+                    as_Fsm[w_fsmNum].dw_respTimeout);
     o_return = TRUE;
   }
   /* else transmission of the service request failed,
@@ -702,8 +736,14 @@ static BOOLEAN processTimeoutChk(UINT32 dw_ct, UINT8* pb_numMngtFrms,
     }
     else  /* repetition counter has NOT reached maximum */
     {
+      o_return = transmitRequest(w_fsmNum, dw_ct);
+      /* the response timeout may be restarted even if the transmission
+         failed, so the queue is updated in any case */
+      SCM_DeadlineSet(&s_TimeoutQueue, w_fsmNum,
+                      as_Fsm[w_fsmNum].dw_respTimeout);
+
       /* if transmission of the service request was successful */
-      if(transmitRequest(w_fsmNum, dw_ct))
+      if(o_return)
       {
         /* report repetition */
     	SERR_CountAcycEvt(w_fsmNum,SERR_k_SNMT_RETRY);
@@ -712,10 +752,9 @@ static BOOLEAN processTimeoutChk(UINT32 dw_ct, UINT8* pb_numMngtFrms,
         /* decrement the free number of management frames */
         (*pb_numMngtFrms)--;
         /* stay in this state because "waiting for response" */
-        o_return = TRUE;
       }
       /* else transmission of the service request failed,
-         error is already processed and reported, return predefined FALSE */
+         error is already processed and reported, return FALSE */
     }
   }
   else /* response time has NOT elapsed, yet */
@@ -869,6 +908,7 @@ static void resetFsm(UINT16 w_fsmNum)
 
   /* initialize control parameter */
   as_Fsm[w_fsmNum].o_wfRequest    = TRUE;    /* "wait for request" */
+  SCM_DeadlineRemove(&s_TimeoutQueue, w_fsmNum);
   as_Fsm[w_fsmNum].dw_respTimeout = 0x00UL;  /* no timeout is set */
   as_Fsm[w_fsmNum].b_actNumOfRep  = 0x00u;   /* no repetitions */
   as_Fsm[w_fsmNum].b_nomNumOfRep  = 0x00u;   /* no repetitions */
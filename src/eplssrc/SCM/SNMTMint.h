@@ -111,6 +111,16 @@ BOOLEAN SNMTM_ProcessFsm(UINT32 dw_ct, UINT8 *pb_numFreeMngtFrms,
 */
 UINT16 SNMTM_GetFsmFree(void);
 
+/**
+* @brief This function returns the FSM waiting for response with the earliest response
+* timeout, if this timeout has elapsed.
+*
+* @param        dw_ct              consecutive time (not checked, any value allowed), valid range: any 32 bit value
+*
+* @return       0 .. SNMTM_cfg_MAX_NUM_FSM-1 - FSM number k_INVALID_FSM_NUM              - no response timeout elapsed
+*/
+UINT16 SNMTM_GetFsmTimedOut(UINT32 dw_ct);
+
 
 /**
 * @brief This function assigns a single received response to the matching request that
@@ -85,8 +85,8 @@ BOOLEAN SNMTM_Init(void)
 * @brief This function handles service request repetitions in case of a precedent service
 * request was not responded by the specified SNMT Slave in time or not responded at all.
 *
-* Generally this function checks every SNMT Master FSM pausing in state "wait for response"
-* for response timeout.
+* Generally this function checks the SNMT Master FSMs pausing in state "wait for response"
+* whose response timeout has elapsed, the FSM with the earliest response timeout first.
 *
 * @attention This function must not be called in SNMTS_k_ST_INITIALIZATION state. This
 * function must be called at least once within the SNMT timeout (SOD index EPLS_k_IDX_SSDO_COM_PARAM,
@@ -101,8 +101,8 @@ BOOLEAN SNMTM_Init(void)
 void SNMTM_BuildRequest(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
 {
   BOOLEAN o_break = FALSE;   /* flag to break the while loop */
-  UINT16 w_fsmNum = 0x0000u;  /* start value of loop counter through the list
-                                 of FSM */
+  UINT16 w_fsmNum = 0x0000u;  /* FSM with elapsed response timeout */
+  UINT16 w_numChk = 0x0000u;  /* number of checked FSM */
 
   /* if reference to number of free frames is invalid */
   if(pb_numFreeFrms == NULL)
@@ -113,13 +113,22 @@ void SNMTM_BuildRequest(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
   }
   else  /* parameter from outside the stack are valid */
   {
-    /* linear search through the list of FSMs, scanning for SNMT Master FSM
-      waiting for response */
-    do
+    /* only the FSMs whose response timeout has elapsed are processed, in the
+       order of their response timeout. An FSM either repeats the request and
+       gets a later response timeout or it is reset and leaves the queue. */
+    while((!o_break) && (*pb_numFreeFrms > 0u) &&
+          (w_numChk < SNMTM_cfg_MAX_NUM_FSM))
     {
-      /* if FSM processing in state "wait on response" fails */
-      if(!(SNMTM_ProcessFsm(dw_ct, pb_numFreeFrms, w_fsmNum,
-              k_EVT_CHK_TIMEOUT, 0U, (EPLS_t_FRM_HDR *)NULL, (UINT8 *)NULL)))
+      w_fsmNum = SNMTM_GetFsmTimedOut(dw_ct);
+
+      /* if no further response timeout has elapsed */
+      if(w_fsmNum == k_INVALID_FSM_NUM)
+      {
+        o_break = TRUE;  /* leave while loop */
+      }
+      /* else if FSM processing in state "wait on response" fails */
+      else if(!(SNMTM_ProcessFsm(dw_ct, pb_numFreeFrms, w_fsmNum,
+                 k_EVT_CHK_TIMEOUT, 0U, (EPLS_t_FRM_HDR *)NULL, (UINT8 *)NULL)))
       {
         /* error: request could NOT be processed in FSM,
                   error is already reported */
@@ -127,12 +136,11 @@ void SNMTM_BuildRequest(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
       }
       else  /* request processed sucessfully */
       {
-        w_fsmNum++;       /* increment loop counter */
+        w_numChk++;       /* increment loop counter */
       }
     }
-    while((w_fsmNum < SNMTM_cfg_MAX_NUM_FSM) && !o_break);
-    /* (loop, while loop counter is less max. number of FSM)  AND
-      (loop, while no error occures) */
+    /* (loop, while no error occures and free frames are available)  AND
+      (loop, while less FSM than the max. number of FSM were checked) */
   }
 
   SCFM_TACK_PATH();
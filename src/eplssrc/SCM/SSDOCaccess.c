@@ -240,6 +240,105 @@ BOOLEAN SSDOC_SendReadReq(UINT16 w_sadr, UINT16 w_reqNum,
   return o_return;
 }
 
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function transmits a request to read several objects of a specified SSDO
+* Server at once.
+*
+* The SSDO Server answers with the data of all objects one after the other in network
+* format, the data is transferred like a DOMAIN by an expedited or segmented upload. An
+* abort of the SSDO Server refers to the first object of the request. An SSDO Server
+* which does not support the multi-object read answers with the abort code
+* SOD_ABT_CMD_ID_INVALID.
+*
+* @attention The same restrictions as for SSDOC_SendReadReq() apply.
+*
+* @see          SSDOC_SendReadReq()
+*
+* @param        w_sadr 				   target address of SN to be accessed (checked), valid range: EPLS_k_MIN_SADR..EPLS_k_MAX_SADR
+*
+* @param        w_reqNum               service request number to assign the request in the callback(not checked, any value allowed), valid range: UINT16
+*
+* @param        pf_respClbk            reference to a function that will be called at the end of a transfer (checked), valid range: <> NULL
+*
+* @param        dw_ct				   consecutive time (not checked, any value allowed), valid range: UINT32
+*
+* @param        ps_req                 request info of the objects to be read (checked) valid range: <> NULL, see {SSDOC_t_MULTI_REQ}
+*
+* @return
+* - TRUE                 - transmission of request successful
+* - FALSE                - transmission of request failed
+*/
+BOOLEAN SSDOC_SendMultiReadReq(UINT16 w_sadr, UINT16 w_reqNum,
+                               SSDOC_t_RESP_CLBK pf_respClbk, UINT32 dw_ct,
+                               const SSDOC_t_MULTI_REQ *ps_req)
+{
+  BOOLEAN o_return = FALSE;            /* predefined return value */
+
+  /* if reference to request information is invalid */
+  if(ps_req == NULL)
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SSDOC_k_ERR_MRD_REQ_PTR,
+                  SERR_k_NO_ADD_INFO);
+  }
+  /* else if logical target address of SN to be accessed to is NOT valid */
+  else if((w_sadr < EPLS_k_MIN_SADR) || (w_sadr > EPLS_k_MAX_SADR))
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SSDOC_k_ERR_MRD_REQ_SADR,
+                  (UINT32)(w_sadr));
+  }
+  /* else if pointer to the response buffer is invalid */
+  else if(ps_req->pb_data == NULL)
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SSDOC_k_ERR_MRD_DATA_PTR,
+                  SERR_k_NO_ADD_INFO);
+  }
+  /* else if maximum number of payload data bytes is invalid */
+  else if((ps_req->b_payloadLen > SSDOC_k_MAX_SERV_DATA_LEN) ||
+          (ps_req->b_payloadLen < SSDOC_k_MIN_SERV_DATA_LEN))
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SSDOC_k_ERR_MRD_REQ_PYLDLEN,
+                  (UINT32)(ps_req->b_payloadLen));
+  }
+  /* else if the number of objects is invalid or the request does not fit into
+     the payload data */
+  else if((ps_req->b_numEntries == 0x00u) ||
+          (ps_req->b_numEntries > SSDOC_k_MAX_MULTI_ENTRIES) ||
+          ((k_DATA_HDR_LEN + ((UINT16)(ps_req->b_numEntries - 1u) *
+                              k_MULTI_ENTRY_LEN)) >
+           (UINT16)ps_req->b_payloadLen))
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SSDOC_k_ERR_MRD_NUM_ENTRIES,
+                  (UINT32)(ps_req->b_numEntries));
+  }
+  /* else if the length of the response buffer is invalid */
+  else if(ps_req->dw_dataLen == 0x00UL)
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SSDOC_k_ERR_MRD_DATA_LEN,
+                  SERR_k_NO_ADD_INFO);
+  }
+  /* else if the ref to the callback function is invalid */
+  else if(pf_respClbk == NULL)
+  {
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SSDOC_k_ERR_MRD_REQ_CLBK_PTR,
+                  SERR_k_NO_ADD_INFO);
+  }
+  else  /* parameters are valid */
+  {
+    /* if no SSDO transfer is running with this SN */
+    if (!SSDOC_TransferRunning(w_sadr))
+    {
+      /* SSDO request is sent */
+      o_return = SSDOC_SendMultiReq(w_sadr, w_reqNum, pf_respClbk, dw_ct,
+                                    ps_req);
+    }
+    /* no else : error was already reported */
+  }
+  SCFM_TACK_PATH();
+  return o_return;
+}
+#endif
+
 
 #if(EPLS_cfg_ERROR_STRING == EPLS_k_ENABLE)
 /**
@@ -366,6 +465,66 @@ BOOLEAN SSDOC_SendReadReq(UINT16 w_sadr, UINT16 w_reqNum,
           SSDOC_k_ERR_DATA_TYPE, dw_addInfo);
         break;
       }
+      #if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+      case SSDOC_k_ERR_MRD_REQ_PTR:
+      {
+        SPRINTF1(pac_str,
+          "%#x - SSDOC_k_ERR_MRD_REQ_PTR: SSDOC_SendMultiReadReq():\n"
+          "NULL pointer passed instead of reference to "
+          "<request struct of transfer data>.\n", SSDOC_k_ERR_MRD_REQ_PTR);
+        break;
+      }
+      case SSDOC_k_ERR_MRD_REQ_SADR:
+      {
+        SPRINTF2(pac_str,
+          "%#x - SSDOC_k_ERR_MRD_REQ_SADR: SSDOC_SendMultiReadReq():\n"
+          "Function call with invalid target address (SADR) "
+          "of SSDO Service Request (%04lu).\n",
+          SSDOC_k_ERR_MRD_REQ_SADR, dw_addInfo);
+        break;
+      }
+      case SSDOC_k_ERR_MRD_DATA_PTR:
+      {
+        SPRINTF1(pac_str,
+          "%#x - SSDOC_k_ERR_MRD_DATA_PTR: SSDOC_SendMultiReadReq():\n"
+          "Reference to the response buffer is NULL.\n",
+          SSDOC_k_ERR_MRD_DATA_PTR);
+        break;
+      }
+      case SSDOC_k_ERR_MRD_REQ_PYLDLEN:
+      {
+        SPRINTF2(pac_str,
+          "%#x - SSDOC_k_ERR_MRD_REQ_PYLDLEN: SSDOC_SendMultiReadReq():\n"
+          "Function call with invalid maximum payload data length (%02lu).\n",
+          SSDOC_k_ERR_MRD_REQ_PYLDLEN, dw_addInfo);
+        break;
+      }
+      case SSDOC_k_ERR_MRD_NUM_ENTRIES:
+      {
+        SPRINTF2(pac_str,
+          "%#x - SSDOC_k_ERR_MRD_NUM_ENTRIES: SSDOC_SendMultiReadReq():\n"
+          "Function call with invalid number of objects (%02lu), the request "
+          "does not fit into the maximum payload data length.\n",
+          SSDOC_k_ERR_MRD_NUM_ENTRIES, dw_addInfo);
+        break;
+      }
+      case SSDOC_k_ERR_MRD_DATA_LEN:
+      {
+        SPRINTF1(pac_str,
+          "%#x - SSDOC_k_ERR_MRD_DATA_LEN: SSDOC_SendMultiReadReq():\n"
+          "Length of the response buffer is 0.\n",
+          SSDOC_k_ERR_MRD_DATA_LEN);
+        break;
+      }
+      case SSDOC_k_ERR_MRD_REQ_CLBK_PTR:
+      {
+        SPRINTF1(pac_str,
+          "%#x - SSDOC_k_ERR_MRD_REQ_CLBK_PTR: SSDOC_SendMultiReadReq():\n"
+          "NULL pointer passed instead of reference to "
+          "<Response callback function>.\n", SSDOC_k_ERR_MRD_REQ_CLBK_PTR);
+        break;
+      }
+      #endif
       case SSDOC_k_ERR_RESP_NOT_ASSIGNED:
       {
         SPRINTF2(pac_str,
@@ -192,6 +192,77 @@ BOOLEAN SSDOC_SendReadReq(UINT16 w_sadr, UINT16 w_reqNum,
                           SSDOC_t_RESP_CLBK pf_respClbk, UINT32 dw_ct,
                           const SSDOC_t_REQ *ps_req);
 
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+ * This symbol represents the maximum number of objects read by one multi-object read.
+ *
+ * @note The number of objects is also limited by the maximum number of payload data
+ * bytes of the request, every object after the first one needs 3 more bytes.
+*/
+#define SSDOC_k_MAX_MULTI_ENTRIES      8u
+
+/**
+ * This data structure is used to pass the request information of a multi-object read
+ * to the unit SSDOC.
+ *
+ * Every element of this data structure is part of API interface.
+*/
+typedef struct
+{
+  /**
+   * number of objects to be read (checked), valid range:
+   * 1..SSDOC_k_MAX_MULTI_ENTRIES, the request has to fit into b_payloadLen
+   */
+  UINT8 b_numEntries;
+  /** indices of the objects to be read (not checked, any value allowed) */
+  UINT16 aw_idx[SSDOC_k_MAX_MULTI_ENTRIES];
+  /** sub indices of the objects to be read (not checked, any value allowed) */
+  UINT8 ab_subIdx[SSDOC_k_MAX_MULTI_ENTRIES];
+  /**
+   * maximum number of payload data bytes to be transferred within a
+   * single frame (checked), valid range:
+   * SSDOC_k_MIN_SERV_DATA_LEN..SSDOC_k_MAX_SERV_DATA_LEN
+   */
+  UINT8 b_payloadLen;
+  /** pointer to the response buffer (pointer checked), valid range: <> NULL */
+  UINT8 *pb_data;
+  /** length of the response buffer (checked), valid range: > 0 */
+  UINT32 dw_dataLen;
+} SSDOC_t_MULTI_REQ;
+
+/**
+* @brief This function transmits a request to read several objects of a specified SSDO
+* Server at once.
+*
+* The SSDO Server answers with the data of all objects one after the other in network
+* format, the data is transferred like a DOMAIN by an expedited or segmented upload. An
+* abort of the SSDO Server refers to the first object of the request. An SSDO Server
+* which does not support the multi-object read answers with the abort code
+* SOD_ABT_CMD_ID_INVALID.
+*
+* @attention The same restrictions as for SSDOC_SendReadReq() apply.
+*
+* @see          SSDOC_SendReadReq()
+*
+* @param        w_sadr 				   target address of SN to be accessed (checked), valid range: EPLS_k_MIN_SADR..EPLS_k_MAX_SADR
+*
+* @param        w_reqNum               service request number to assign the request in the callback(not checked, any value allowed), valid range: UINT16
+*
+* @param        pf_respClbk            reference to a function that will be called at the end of a transfer (checked), valid range: <> NULL
+*
+* @param        dw_ct				   consecutive time (not checked, any value allowed), valid range: UINT32
+*
+* @param        ps_req                 request info of the objects to be read (checked) valid range: <> NULL, see {SSDOC_t_MULTI_REQ}
+*
+* @return
+* - TRUE                 - transmission of request successful
+* - FALSE                - transmission of request failed
+*/
+BOOLEAN SSDOC_SendMultiReadReq(UINT16 w_sadr, UINT16 w_reqNum,
+                               SSDOC_t_RESP_CLBK pf_respClbk, UINT32 dw_ct,
+                               const SSDOC_t_MULTI_REQ *ps_req);
+#endif
+
 /**
 * @brief This function checks whether one FSM is available to process SSDO data transfer.
 *
@@ -210,8 +281,9 @@ BOOLEAN SSDOC_CheckFsmAvailable(void);
 * service request was not responded by the specified SSDO Server in time or not
 * responded at all.
 *
-* Generally this function checks every SSDOC Client service FSM pausing in state
-* "wait for response" for response timeout.
+* Generally this function checks the SSDOC Client service FSMs pausing in state
+* "wait for response" whose response timer has elapsed, the FSM with the earliest
+* response timeout first.
 *
 * @attention This function must not be called in SNMTS_k_ST_INITIALIZATION
 * state. This function must be called at least once within the  SSDO timeout (SOD index
@@ -55,6 +55,14 @@
 /* TypeLenValid() */
 #define SSDOC_k_ERR_DATA_LEN             SSDOC_ERR_FATAL(12)
 #define SSDOC_k_ERR_DATA_TYPE            SSDOC_ERR_FATAL(13)
+/* SSDOC_SendMultiReadReq() */
+#define SSDOC_k_ERR_MRD_REQ_PTR          SSDOC_ERR_FATAL(43)
+#define SSDOC_k_ERR_MRD_REQ_SADR         SSDOC_ERR_FATAL(44)
+#define SSDOC_k_ERR_MRD_DATA_PTR         SSDOC_ERR_FATAL(45)
+#define SSDOC_k_ERR_MRD_REQ_PYLDLEN      SSDOC_ERR_FATAL(46)
+#define SSDOC_k_ERR_MRD_NUM_ENTRIES      SSDOC_ERR_FATAL(47)
+#define SSDOC_k_ERR_MRD_DATA_LEN         SSDOC_ERR_FATAL(48)
+#define SSDOC_k_ERR_MRD_REQ_CLBK_PTR     SSDOC_ERR_FATAL(49)
 /** @} */
 
 /**
@@ -139,6 +139,37 @@ BOOLEAN SSDOC_SendReq(UINT16 w_sadr, UINT16 w_reqNum,
                       const SSDOC_t_REQ *ps_req, BOOLEAN o_downloadReq,
                       BOOLEAN const o_fastDld);
 
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function reserves a free protocol FSM, stores the request information
+* for the FSM, sends a multi-object upload request and sets the FSM into the "wait for
+* upload init response" state.
+*
+* @param        w_sadr                 target address of SN to be accessed (not checked,
+* 	checked in SSDOC_SendMultiReadReq()), valid range: EPLS_k_MIN_SADR..EPLS_k_MAX_SADR
+*
+* @param        w_reqNum               service request number (handle)(not checked, any
+* 	value allowed), valid range: UINT16
+*
+* @param        pf_respClbk            reference to a function that will be called at the
+* 	end of a transfer (not checked checked in SSDOC_SendMultiReadReq()),
+* 	valid range: <> NULL
+*
+* @param        dw_ct                  consecutive time (not checked, any value allowed),
+* 	valid range: UINT32
+*
+* @param        ps_req                 request info of the objects to be read (not
+* 	checked, checked in SSDOC_SendMultiReadReq()), valid range: see SSDOC_t_MULTI_REQ
+*
+* @return
+* - TRUE                 - success
+* - FALSE                - failure
+*/
+BOOLEAN SSDOC_SendMultiReq(UINT16 w_sadr, UINT16 w_reqNum,
+                           SSDOC_t_RESP_CLBK pf_respClbk, UINT32 dw_ct,
+                           const SSDOC_t_MULTI_REQ *ps_req);
+#endif
+
 
 /**
 * @brief This function initiates the SSDOC Service Layer.
@@ -222,6 +253,27 @@ BOOLEAN SSDOC_ServiceDwnldSeg(UINT16 w_fsmNum, UINT32 dw_ct, UINT8 b_saCmd,
 BOOLEAN SSDOC_ServiceUpldInit(UINT16 w_fsmNum, UINT32 dw_ct, UINT16 w_sadr,
                               const SSDOC_t_REQ *ps_data);
 
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function initiates the SSDOC Service Request "SSDO Initiate Multi-Object
+* Upload" to read several objects of a specific SN (SOD) inside the Safety Domain.
+*
+* @param        w_fsmNum        FSM number (not checked, checked in SSDOC_SendMultiReq() and getProtocolFsmFree()), valid range: 0 .. SSDOC_cfg_MAX_NUM_FSM-1
+*
+* @param        dw_ct           consecutive time (not checked, any value allowed), valid range: any 32 bit value
+*
+* @param        w_sadr          logical address of SN to be accessed (not checked, checked in SSDOC_SendMultiReadReq()), valid range: EPLS_k_MIN_SADR..EPLS_k_MAX_SADR
+*
+* @param        ps_req          ref to the objects to be read (not checked, checked in SSDOC_SendMultiReadReq()), valid range: <> NULL
+*
+* @return
+* - TRUE          - req transmission successfully
+* - FALSE         - req transmission failed
+*/
+BOOLEAN SSDOC_ServiceUpldMultiInit(UINT16 w_fsmNum, UINT32 dw_ct, UINT16 w_sadr,
+                                   const SSDOC_t_MULTI_REQ *ps_req);
+#endif
+
 /**
 * @brief This function initiates the SSDOC Service Request "SSDO Segment Upload" to
 * continue the Upload transfer.
@@ -412,6 +464,31 @@ BOOLEAN SSDOC_TimerStart(UINT16 w_fsmNum, UINT32 dw_ct);
 */
 void SSDOC_TimerReStart(UINT16 w_fsmNum, UINT32 dw_ct);
 
+/**
+* @brief This function stops the given response timer.
+*
+* The function may also be called for a timer which is not running.
+*
+* @param        w_fsmNum        FSM number (not checked, checked in
+* 	SSDOC_ServiceResponseAssign() and SSDOC_ProcessResponse() or SSDOC_BuildRequest()
+* 	or SSDOC_SendReq() and getProtocolFsmFree() or SSDOC_ServiceFsmInit()),
+* 	valid range: 0 .. SSDOC_cfg_MAX_NUM_FSM - 1
+*/
+void SSDOC_TimerStop(UINT16 w_fsmNum);
+
+/**
+* @brief This function returns the FSM with the earliest running response timer, if
+* this timer has elapsed.
+*
+* @param        dw_ct           consecutive time (not checked, any value allowed),
+* 	valid range: any 32 bit value
+*
+* @return
+* - 0 .. SSDOC_cfg_MAX_NUM_FSM - 1 - FSM number
+* - k_INVALID_FSM_NUM              - no response timer elapsed
+*/
+UINT16 SSDOC_TimerExpired(UINT32 dw_ct);
+
 /**
 * @brief This function checks the given response timer.
 *
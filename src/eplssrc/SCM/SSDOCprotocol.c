@@ -109,7 +109,8 @@ typedef struct
 static t_PROT_FSM as_ProtFsm[SSDOC_cfg_MAX_NUM_FSM] SAFE_NO_INIT_SEKTOR;
 
 static BOOLEAN checkExpUploadRespLen(UINT8 b_respDataLen,
-                                     EPLS_t_DATATYPE e_dataType);
+                                     EPLS_t_DATATYPE e_dataType,
+                                     UINT32 dw_dataLen);
 static BOOLEAN checkResponse(UINT16 w_fsmNum, UINT8 *pb_saCmd,
                              const UINT8 *pb_respData, UINT8 b_respDataLen);
 static UINT16 getProtocolFsmFree(void);
@@ -152,8 +153,9 @@ BOOLEAN SSDOC_ProtocolLayerInit(void)
 * service request was not responded by the specified SSDO Server in time or not
 * responded at all.
 *
-* Generally this function checks every SSDOC Client service FSM pausing in state
-* "wait for response" for response timeout.
+* Generally this function checks the SSDOC Client service FSMs pausing in state
+* "wait for response" whose response timer has elapsed, the FSM with the earliest
+* response timeout first.
 *
 * @attention This function must not be called in SNMTS_k_ST_INITIALIZATION
 * state. This function must be called at least once within the  SSDO timeout (SOD index
@@ -171,8 +173,8 @@ void SSDOC_BuildRequest(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
   BOOLEAN o_break = FALSE;    /* flag to break the while loop */
   t_PROT_FSM *ps_protFsm;     /* pointer to the actual protocol FSM */
   BOOLEAN o_abort;            /* flag to signal an abort */
-  UINT16 w_fsmNum = 0x0000u;  /* start value of loop counter through
-                                 the list of FSM */
+  UINT16 w_fsmNum = 0x0000u;  /* FSM with elapsed response timer */
+  UINT16 w_numChk = 0x0000u;  /* number of checked FSM */
 
   /* if reference to number of free frames is invalid */
   if(pb_numFreeFrms == NULL)
@@ -183,12 +185,21 @@ void SSDOC_BuildRequest(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
   }
   else  /* parameter from outside the stack are valid */
   {
-    /* linear search through the list, scanning for SSDO Client FSM waiting for
-      resp */
-    do
+    /* only the FSMs whose response timer has elapsed are processed, in the
+       order of their response timeout. An FSM either repeats the request and
+       restarts its timer or the timer is stopped. */
+    while((!o_break) && ((*pb_numFreeFrms) > 0U) &&
+          (w_numChk < (UINT16)SSDOC_cfg_MAX_NUM_FSM))
     {
-      /* if timeout checking succeeded */
-      if (SSDOC_CheckTimeout(dw_ct, pb_numFreeFrms, w_fsmNum, &o_abort))
+      w_fsmNum = SSDOC_TimerExpired(dw_ct);
+
+      /* if no further response timer has elapsed */
+      if (w_fsmNum == k_INVALID_FSM_NUM)
+      {
+        o_break = TRUE;  /* leave while loop */
+      }
+      /* else if timeout checking succeeded */
+      else if (SSDOC_CheckTimeout(dw_ct, pb_numFreeFrms, w_fsmNum, &o_abort))
       {
         /* if abort frame has to be sent */
         if (o_abort)
@@ -216,7 +227,7 @@ void SSDOC_BuildRequest(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
         }
         /* no else no abort frame has to be sent */
 
-        w_fsmNum++; /* increment loop counter */
+        w_numChk++; /* increment loop counter */
       }
       else /* the timeout checking failed */
       {
@@ -226,9 +237,8 @@ void SSDOC_BuildRequest(UINT32 dw_ct, UINT8 *pb_numFreeFrms)
         o_break = TRUE;  /* leave while loop ahead of time */
       }
     }
-    while((w_fsmNum < (UINT16)SSDOC_cfg_MAX_NUM_FSM) && !o_break);
-      /* (loop, while loop counter is less max. number of busy FSM)  AND
-        (loop, while no error occurs) */
+      /* (loop, while no error occurs and free frames are available)  AND
+        (loop, while less FSM than the max. number of FSM were checked) */
   }
 
   SCFM_TACK_PATH();
@@ -368,7 +378,8 @@ BOOLEAN SSDOC_ProtocolFsmProcess(UINT32 dw_ct, UINT16 w_fsmNum,
         if (b_saCmd == k_UPLD_INIT_EXP)
         {
           /* if the response data length is OK */
-          if (checkExpUploadRespLen(b_respDataLen, ps_fsm->s_data.e_dataType))
+          if (checkExpUploadRespLen(b_respDataLen, ps_fsm->s_data.e_dataType,
+                                    ps_fsm->s_data.dw_dataLen))
           {
             b_rawDataLen = (UINT8)(b_respDataLen - k_DATA_HDR_LEN);
             /* if read data is copied into memory block of application */
@@ -910,6 +921,91 @@ BOOLEAN SSDOC_SendReq(UINT16 w_sadr, UINT16 w_reqNum,
   return o_return;
 }
 
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function reserves a free protocol FSM, stores the request information
+* for the FSM, sends a multi-object upload request and sets the FSM into the "wait for
+* upload init response" state.
+*
+* The response is processed like the upload of a DOMAIN with the index and sub-index of
+* the first object.
+*
+* @param        w_sadr                 target address of SN to be accessed (not checked,
+* 	checked in SSDOC_SendMultiReadReq()), valid range: EPLS_k_MIN_SADR..EPLS_k_MAX_SADR
+*
+* @param        w_reqNum               service request number (handle)(not checked, any
+* 	value allowed), valid range: UINT16
+*
+* @param        pf_respClbk            reference to a function that will be called at the
+* 	end of a transfer (not checked checked in SSDOC_SendMultiReadReq()),
+* 	valid range: <> NULL
+*
+* @param        dw_ct                  consecutive time (not checked, any value allowed),
+* 	valid range: UINT32
+*
+* @param        ps_req                 request info of the objects to be read (not
+* 	checked, checked in SSDOC_SendMultiReadReq()), valid range: see SSDOC_t_MULTI_REQ
+*
+* @return
+* - TRUE                 - success
+* - FALSE                - failure
+*/
+BOOLEAN SSDOC_SendMultiReq(UINT16 w_sadr, UINT16 w_reqNum,
+                           SSDOC_t_RESP_CLBK pf_respClbk, UINT32 dw_ct,
+                           const SSDOC_t_MULTI_REQ *ps_req)
+{
+  BOOLEAN o_return = FALSE;    /* predefine return value */
+  t_PROT_FSM *ps_protFsm; /* pointer to the actual protocol FSM */
+  UINT16 w_fsmNum;  /* index of the free protocol FSM */
+
+  /* get a free protocol FSM */
+  w_fsmNum = getProtocolFsmFree();
+
+  /* if no free protocol FSM is available */
+  if(w_fsmNum == k_INVALID_FSM_NUM)
+  {
+    /* error: no free protocol FSM */
+    SERR_SetError(EPLS_k_SCM_INST_NUM_ SSDOC_k_ERR_NO_PROT_FSM,
+                  SERR_k_NO_ADD_INFO);
+  }
+  else  /* protocol FSM is available */
+  {
+    ps_protFsm = &as_ProtFsm[w_fsmNum];
+
+    /* store data to call the API callback function */
+    ps_protFsm->w_reqNum = w_reqNum;
+    ps_protFsm->pf_respClbk = pf_respClbk;
+
+    /* reset internal toggle bit at the beginning of a transfer */
+    ps_protFsm->s_segm.o_toggleBit = FALSE;
+
+    /* the response refers to the first object and contains a DOMAIN */
+    ps_protFsm->s_data.w_idx = ps_req->aw_idx[0];
+    ps_protFsm->s_data.b_subIdx = ps_req->ab_subIdx[0];
+    ps_protFsm->s_data.e_dataType = EPLS_k_DOMAIN;
+    ps_protFsm->s_data.b_payloadLen = ps_req->b_payloadLen;
+    ps_protFsm->s_data.pb_data = ps_req->pb_data;
+    ps_protFsm->s_data.dw_dataLen = ps_req->dw_dataLen;
+
+    /* if initialization of the multi-object upload succeeded */
+    if(SSDOC_ServiceUpldMultiInit(w_fsmNum, dw_ct, w_sadr, ps_req))
+    {
+      /* wait for resp of initiate transfer */
+      ps_protFsm->e_actState = k_ST_WF_UPLD_INIT_RESP;
+      o_return = TRUE;
+    }
+    else /* error, is already reported */
+    {
+      /* init Protocol FSM in case of a SW error is returned to the SCM */
+      protocolFsmInit(w_fsmNum);
+    }
+  }
+
+  SCFM_TACK_PATH();
+  return o_return;
+}
+#endif
+
 /**
 * @brief This function checks the SSDO expedited upload response length.
 *
@@ -917,13 +1013,16 @@ BOOLEAN SSDOC_SendReq(UINT16 w_sadr, UINT16 w_reqNum,
 * 	additional checked in checkRxDataLength())
 * @param   e_dataType                data type of the transferred object (not checked,
 * 	checked in TypeLenValid())
+* @param   dw_dataLen                length of the response buffer (not checked,
+* 	checked in TypeLenReadValid() or SSDOC_SendMultiReadReq())
 *
 * @return
 * - TRUE               - success
 * - FALSE              - failure
 */
 static BOOLEAN checkExpUploadRespLen(UINT8 b_respDataLen,
-                                     EPLS_t_DATATYPE e_dataType)
+                                     EPLS_t_DATATYPE e_dataType,
+                                     UINT32 dw_dataLen)
 {
   BOOLEAN o_return = FALSE;  /* return value of sub functions */
   UINT8 b_rawDataLen; /* length of the raw data */
@@ -987,10 +1086,15 @@ static BOOLEAN checkExpUploadRespLen(UINT8 b_respDataLen,
       }
     }
   }
-  else /* response data length is OK */
+  /* else if the raw data fits into the response buffer */
+  else if ((UINT32)(b_respDataLen - k_DATA_HDR_LEN) <= dw_dataLen)
   {
     o_return = TRUE;
   }
+  else /* response data is larger than the response buffer */
+  {
+    /* invalid response data length */
+  }
 
   SCFM_TACK_PATH();
   return o_return;
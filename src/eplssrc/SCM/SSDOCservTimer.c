@@ -30,6 +30,7 @@
 #include "SERR.h"
 #include "SODapi.h"
 #include "SOD.h"
+#include "SCM.h"
 #include "SSDOCapi.h"
 #include "SSDOCint.h"
 
@@ -59,6 +60,18 @@ typedef struct
 */
 static t_TIMER_CHECK as_ServTimer[SSDOC_cfg_MAX_NUM_FSM] SAFE_NO_INIT_SEKTOR;
 
+/**
+ * Running service response timers, ordered by the point of time of the response timeout.
+ * The heap, the heap positions and the response timeouts are stored in the arrays below.
+*/
+static SCM_t_DEADLINE_QUEUE s_TimerQueue SAFE_NO_INIT_SEKTOR;
+/** heap of the service response timer queue */
+static UINT16 aw_TimerHeap[SSDOC_cfg_MAX_NUM_FSM] SAFE_NO_INIT_SEKTOR;
+/** heap positions of the service response timer queue */
+static UINT16 aw_TimerPos[SSDOC_cfg_MAX_NUM_FSM] SAFE_NO_INIT_SEKTOR;
+/** response timeouts of the service response timer queue */
+static UINT32 adw_TimerTimeout[SSDOC_cfg_MAX_NUM_FSM] SAFE_NO_INIT_SEKTOR;
+
 
 /**
 * @brief This function initializes the SOD access structures and
@@ -103,6 +116,9 @@ BOOLEAN SSDOC_TimerInit(void)
         as_ServTimer[i].dw_respTimeout = 0x00UL; /* no timeout set */
         as_ServTimer[i].b_retries = 0x00u;       /* no repetitions */
       }
+      /* no timer is running */
+      SCM_DeadlineInit(&s_TimerQueue, aw_TimerHeap, aw_TimerPos,
+                       adw_TimerTimeout, (UINT16)SSDOC_cfg_MAX_NUM_FSM);
       o_return = TRUE;
     }
     else /* else : SOD entry not available */
@@ -159,6 +175,8 @@ BOOLEAN SSDOC_TimerStart(UINT16 w_fsmNum, UINT32 dw_ct)
     as_ServTimer[w_fsmNum].dw_respTimeout = dw_ct + *pdw_respTimeout;
     /* Timeout value in the SOD is stored for the retransmission */
     as_ServTimer[w_fsmNum].dw_sodRespTimeout = *pdw_respTimeout;
+    SCM_DeadlineSet(&s_TimerQueue, w_fsmNum,
+                    as_ServTimer[w_fsmNum].dw_respTimeout);
 
     /* get response timeout value from SOD */
     pb_reqRetries = (UINT8 *)SOD_Read(EPLS_k_SCM_INST_NUM_
@@ -206,10 +224,47 @@ void SSDOC_TimerReStart(UINT16 w_fsmNum, UINT32 dw_ct)
   /* set response timeout for the retransmission */
   as_ServTimer[w_fsmNum].dw_respTimeout = 
       dw_ct + as_ServTimer[w_fsmNum].dw_sodRespTimeout;
+  SCM_DeadlineSet(&s_TimerQueue, w_fsmNum,
+                  as_ServTimer[w_fsmNum].dw_respTimeout);
 
   SCFM_TACK_PATH();
 }
 
+/**
+* @brief This function stops the given response timer.
+*
+* The function may also be called for a timer which is not running.
+*
+* @param        w_fsmNum        FSM number (not checked, checked in
+* 	SSDOC_ServiceResponseAssign() and SSDOC_ProcessResponse() or SSDOC_BuildRequest()
+* 	or SSDOC_SendReq() and getProtocolFsmFree() or SSDOC_ServiceFsmInit()),
+* 	valid range: 0 .. SSDOC_cfg_MAX_NUM_FSM - 1
+*/
+void SSDOC_TimerStop(UINT16 w_fsmNum)
+{
+  SCM_DeadlineRemove(&s_TimerQueue, w_fsmNum);
+
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function returns the FSM with the earliest running response timer, if
+* this timer has elapsed.
+*
+* @param        dw_ct           consecutive time (not checked, any value allowed),
+* 	valid range: any 32 bit value
+*
+* @return
+* - 0 .. SSDOC_cfg_MAX_NUM_FSM - 1 - FSM number
+* - k_INVALID_FSM_NUM              - no response timer elapsed
+*/
+UINT16 SSDOC_TimerExpired(UINT32 dw_ct)
+{
+  /* SCM_k_NO_DEADLINE is equal to k_INVALID_FSM_NUM */
+  SCFM_TACK_PATH();
+  return SCM_DeadlineExpired(&s_TimerQueue, dw_ct);
+}
+
 /**
 * @brief This function checks the given response timer.
 *
@@ -310,6 +310,7 @@ BOOLEAN SSDOC_ServiceFsmProcess(UINT32 dw_ct, UINT16 w_fsmNum,
       {
         /* switch to "wait for request" state */
         as_ServFsm[w_fsmNum].o_waitForReq = TRUE;
+        SSDOC_TimerStop(w_fsmNum);
 
         o_return = TRUE;
       }
@@ -339,6 +340,7 @@ BOOLEAN SSDOC_ServiceFsmProcess(UINT32 dw_ct, UINT16 w_fsmNum,
       {
         /* switch to WF_REQUEST state */
         as_ServFsm[w_fsmNum].o_waitForReq = TRUE;
+        SSDOC_TimerStop(w_fsmNum);
         o_return = TRUE;
       }
       else /* transmission failed, FATAL error was reported by the SFS */
@@ -494,6 +496,7 @@ static void serviceFsmInit(UINT16 w_fsmNum)
 
   /* initialize control parameter */
   as_ServFsm[w_fsmNum].o_waitForReq = TRUE;  /* wait for request */
+  SSDOC_TimerStop(w_fsmNum);                 /* no response expected */
 
   /* initialize array of payload data */
   for(b_index = 0U ; b_index < SSDOC_k_MAX_SERV_DATA_LEN ; b_index++)
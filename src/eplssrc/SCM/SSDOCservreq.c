@@ -349,6 +349,82 @@ BOOLEAN SSDOC_ServiceUpldInit(UINT16 w_fsmNum, UINT32 dw_ct, UINT16 w_sadr,
   return o_return;
 }
 
+#if (SSDOC_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function initiates the SSDOC Service Request "SSDO Initiate Multi-Object
+* Upload" to read several objects of a specific SN (SOD) inside the Safety Domain.
+*
+* The first object is stored into the data header like in SSDOC_ServiceUpldInit(), every
+* further object is appended with index and sub-index.
+*
+* @param        w_fsmNum        FSM number (not checked, checked in SSDOC_SendMultiReq() and getProtocolFsmFree()), valid range: 0 .. SSDOC_cfg_MAX_NUM_FSM-1
+*
+* @param        dw_ct           consecutive time (not checked, any value allowed), valid range: any 32 bit value
+*
+* @param        w_sadr          logical address of SN to be accessed (not checked, checked in SSDOC_SendMultiReadReq()), valid range: EPLS_k_MIN_SADR..EPLS_k_MAX_SADR
+*
+* @param        ps_req          ref to the objects to be read (not checked, checked in SSDOC_SendMultiReadReq()), valid range: <> NULL
+*
+* @return
+* - TRUE          - req transmission successfully
+* - FALSE         - req transmission failed
+*/
+BOOLEAN SSDOC_ServiceUpldMultiInit(UINT16 w_fsmNum, UINT32 dw_ct, UINT16 w_sadr,
+                                   const SSDOC_t_MULTI_REQ *ps_req)
+{
+  BOOLEAN o_return = FALSE ;  /* predefined return value */
+  UINT16 w_scmSadr;  /* main SADR in SOD, only valid after SOD read access */
+  t_REQ_BUFFER *ps_reqBuf; /* pointer to the request buffer */
+  UINT8 b_saCmd = k_UPLD_INIT_MULTI; /* SOD access command byte */
+  UINT8 b_entry; /* loop counter for the objects */
+  UINT8 b_ofs = k_OFS_IDX; /* offset of the current object in the data */
+
+  /* if SADR of SCM or SDN or both are NOT available */
+  if(!getScmSadrSdn(&w_scmSadr))
+  {
+    /* error: SADR of SCM or SDN or both are NOT available,
+              error already reported */
+  }
+  else  /* SADR of SCM and SDN available */
+  {
+    ps_reqBuf = SSDOC_GetReqBuffer(w_fsmNum);
+
+    /* collect header info and store it into module global data structure */
+    /* store target address into ADR field  */
+    ps_reqBuf->s_hdr.w_adr = w_sadr;
+    /* store Safety Domain Number */
+    ps_reqBuf->s_hdr.w_sdn = SDN_GetSdn(EPLS_k_SCM_INST_NUM);
+    /* telegram type is SSDO service req */
+    ps_reqBuf->s_hdr.b_id = k_SERVICE_REQ;
+    /* increment SANo */
+    incCt(&ps_reqBuf->s_hdr.w_ct);
+    /* store source address into TADR field */
+    ps_reqBuf->s_hdr.w_tadr = w_scmSadr;
+    /* time req destinctive number not used */
+    ps_reqBuf->s_hdr.b_tr = EPLS_k_TR_NOT_USED;
+
+    /* store SOD access command byte */
+    SFS_NET_CPY8(&ps_reqBuf->ab_data[k_OFS_SACMD], &b_saCmd);
+
+    /* store index and sub index of all objects */
+    for (b_entry = 0x00u; b_entry < ps_req->b_numEntries; b_entry++)
+    {
+      SFS_NET_CPY16(&ps_reqBuf->ab_data[b_ofs], &(ps_req->aw_idx[b_entry]));
+      SFS_NET_CPY8(&ps_reqBuf->ab_data[b_ofs + (k_OFS_SIDX - k_OFS_IDX)],
+                   &(ps_req->ab_subIdx[b_entry]));
+      b_ofs = (UINT8)(b_ofs + k_MULTI_ENTRY_LEN);
+    }
+
+    /* store payload data length (SOD access command and all objects) */
+    ps_reqBuf->s_hdr.b_le = b_ofs;
+
+    o_return = SSDOC_ServiceFsmProcess(dw_ct, w_fsmNum, k_EVT_REQ, 0U, 0U);
+  }
+  SCFM_TACK_PATH();
+  return o_return;
+}
+#endif
+
 /**
 * @brief This function initiates the SSDOC Service Request "SSDO Segment Upload" to
 * continue the Upload transfer.
@@ -370,9 +446,12 @@ BOOLEAN SSDOC_ServiceUpldSeg(UINT16 w_fsmNum, UINT32 dw_ct, UINT8 b_saCmd)
 
   ps_reqBuf = SSDOC_GetReqBuffer(w_fsmNum);
 
-  /* w_adr, w_sdn, b_id, b_le, w_tadr, b_tr were already set in
+  /* w_adr, w_sdn, b_id, w_tadr, b_tr were already set in
      SSDOC_ServiceUpldInit() */
 
+  /* store payload data length, the init request may have been a multi-object
+     upload with a longer request */
+  ps_reqBuf->s_hdr.b_le = k_DATA_HDR_LEN;
   /* increment SANo */
   incCt(&ps_reqBuf->s_hdr.w_ct);
 
@@ -164,6 +164,30 @@
   #error number of SDG SPDOs is not correct, must be set to >= 1
 #endif
 
+#ifndef EPLS_cfg_FRAME_ROUTER
+  #error EPLS_cfg_FRAME_ROUTER is not defined
+#endif
+#if ((EPLS_cfg_FRAME_ROUTER != EPLS_k_DISABLE) && \
+     (EPLS_cfg_FRAME_ROUTER != EPLS_k_ENABLE))
+  #error EPLS_cfg_FRAME_ROUTER is invalid
+#endif
+
+#ifndef EPLS_cfg_RUNTIME_ARENA
+  #error EPLS_cfg_RUNTIME_ARENA is not defined
+#endif
+#if ((EPLS_cfg_RUNTIME_ARENA != EPLS_k_DISABLE) && \
+     (EPLS_cfg_RUNTIME_ARENA != EPLS_k_ENABLE))
+  #error EPLS_cfg_RUNTIME_ARENA is invalid
+#endif
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  #ifndef EPLS_cfg_ARENA_SIZE
+    #error EPLS_cfg_ARENA_SIZE is not defined
+  #endif
+  #if ((EPLS_cfg_ARENA_SIZE < 64) || (EPLS_cfg_ARENA_SIZE > 16777216))
+    #error EPLS_cfg_ARENA_SIZE is invalid
+  #endif
+#endif
+
 #ifndef EPLS_cfg_ERROR_STRING
   #error EPLS_cfg_ERROR_STRING is not defined
 #endif
@@ -180,6 +204,87 @@
   #error EPLS_cfg_ERROR_STATISTIC is invalid
 #endif
 
+#ifndef EPLS_cfg_ERROR_STAT_SNAPSHOT
+  #error EPLS_cfg_ERROR_STAT_SNAPSHOT is not defined
+#endif
+#if ((EPLS_cfg_ERROR_STAT_SNAPSHOT != EPLS_k_DISABLE) && \
+     (EPLS_cfg_ERROR_STAT_SNAPSHOT != EPLS_k_ENABLE))
+  #error EPLS_cfg_ERROR_STAT_SNAPSHOT is invalid
+#endif
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+  #ifndef EPLS_cfg_CACHE_LINE_SIZE
+    #error EPLS_cfg_CACHE_LINE_SIZE is not defined
+  #endif
+  #if ((EPLS_cfg_CACHE_LINE_SIZE < 16) || \
+       (EPLS_cfg_CACHE_LINE_SIZE > 256) || \
+       ((EPLS_cfg_CACHE_LINE_SIZE & (EPLS_cfg_CACHE_LINE_SIZE - 1)) != 0))
+    #error EPLS_cfg_CACHE_LINE_SIZE is invalid
+  #endif
+  #ifndef MEMORY_BARRIER
+    #error MEMORY_BARRIER is not defined
+  #endif
+  #ifndef CACHE_LINE_ALIGNED
+    #error CACHE_LINE_ALIGNED is not defined
+  #endif
+#endif
+
+#ifndef EPLS_cfg_ERROR_QUEUE
+  #error EPLS_cfg_ERROR_QUEUE is not defined
+#endif
+#if ((EPLS_cfg_ERROR_QUEUE != EPLS_k_DISABLE) && \
+     (EPLS_cfg_ERROR_QUEUE != EPLS_k_ENABLE))
+  #error EPLS_cfg_ERROR_QUEUE is invalid
+#endif
+#if (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE)
+  #ifndef EPLS_cfg_ERROR_QUEUE_SIZE
+    #error EPLS_cfg_ERROR_QUEUE_SIZE is not defined
+  #endif
+  #if ((EPLS_cfg_ERROR_QUEUE_SIZE < 4) || \
+       (EPLS_cfg_ERROR_QUEUE_SIZE > 1024) || \
+       ((EPLS_cfg_ERROR_QUEUE_SIZE & (EPLS_cfg_ERROR_QUEUE_SIZE - 1)) != 0))
+    #error EPLS_cfg_ERROR_QUEUE_SIZE is invalid
+  #endif
+  #ifndef EPLS_cfg_ERROR_QUEUE_COALESCE
+    #error EPLS_cfg_ERROR_QUEUE_COALESCE is not defined
+  #endif
+  #if ((EPLS_cfg_ERROR_QUEUE_COALESCE != EPLS_k_DISABLE) && \
+       (EPLS_cfg_ERROR_QUEUE_COALESCE != EPLS_k_ENABLE))
+    #error EPLS_cfg_ERROR_QUEUE_COALESCE is invalid
+  #endif
+  #ifndef MEMORY_BARRIER
+    #error MEMORY_BARRIER is not defined
+  #endif
+#endif
+
+#ifndef SCFM_cfg_PROFILING
+  #error SCFM_cfg_PROFILING is not defined
+#endif
+#if ((SCFM_cfg_PROFILING != EPLS_k_DISABLE) && \
+     (SCFM_cfg_PROFILING != EPLS_k_ENABLE))
+  #error SCFM_cfg_PROFILING is invalid
+#endif
+#if (SCFM_cfg_PROFILING == EPLS_k_ENABLE)
+  #ifndef SCFM_cfg_PROF_MAX_SITES
+    #error SCFM_cfg_PROF_MAX_SITES is not defined
+  #endif
+  #if ((SCFM_cfg_PROF_MAX_SITES < 64) || \
+       (SCFM_cfg_PROF_MAX_SITES > 2048) || \
+       ((SCFM_cfg_PROF_MAX_SITES & (SCFM_cfg_PROF_MAX_SITES - 1)) != 0))
+    #error SCFM_cfg_PROF_MAX_SITES is invalid
+  #endif
+  #ifndef SCFM_PROF_GET_TIME
+    #error SCFM_PROF_GET_TIME is not defined
+  #endif
+#endif
+
+#ifndef SNMTS_cfg_RESP_CACHE
+  #error SNMTS_cfg_RESP_CACHE is not defined
+#endif
+#if ((SNMTS_cfg_RESP_CACHE != EPLS_k_DISABLE) && \
+     (SNMTS_cfg_RESP_CACHE != EPLS_k_ENABLE))
+  #error SNMTS_cfg_RESP_CACHE is invalid
+#endif
+
 #ifndef EPLS_cfg_SCM
   #error EPLS_cfg_SCM is not defined
 #endif
@@ -213,6 +318,14 @@
   #error SCM_cfg_MAX_SADR_VALUE is not defined
 #endif
 
+#ifndef SCM_cfg_STAGGERED_GUARDING
+  #error SCM_cfg_STAGGERED_GUARDING is not defined
+#endif
+#if ((SCM_cfg_STAGGERED_GUARDING != EPLS_k_ENABLE) && \
+     (SCM_cfg_STAGGERED_GUARDING != EPLS_k_DISABLE))
+  #error SCM_cfg_STAGGERED_GUARDING is invalid
+#endif
+
 
 #if (EPLS_cfg_SCM  == EPLS_k_ENABLE)
   #if ((SCM_cfg_MAX_NUM_OF_NODES < 2) || \
@@ -264,6 +377,31 @@
   #error SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE is invalid
 #endif
 
+#ifndef SPDO_cfg_SPDO_NUM_SORTED_TABLE
+  #error SPDO_cfg_SPDO_NUM_SORTED_TABLE is not defined
+#endif
+#if ((SPDO_cfg_SPDO_NUM_SORTED_TABLE != EPLS_k_ENABLE) && \
+     (SPDO_cfg_SPDO_NUM_SORTED_TABLE != EPLS_k_DISABLE))
+  #error SPDO_cfg_SPDO_NUM_SORTED_TABLE is invalid
+#endif
+#if ((SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE) && \
+     (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_ENABLE))
+  #error SPDO_cfg_SPDO_NUM_SORTED_TABLE requires SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE
+#endif
+
+#ifndef SPDO_cfg_PROCESS_IMAGE
+  #error SPDO_cfg_PROCESS_IMAGE is not defined
+#endif
+#if ((SPDO_cfg_PROCESS_IMAGE != EPLS_k_ENABLE) && \
+     (SPDO_cfg_PROCESS_IMAGE != EPLS_k_DISABLE))
+  #error SPDO_cfg_PROCESS_IMAGE is invalid
+#endif
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+  #ifndef MEMORY_BARRIER
+    #error MEMORY_BARRIER is not defined
+  #endif
+#endif
+
 #ifndef SPDO_cfg_MAX_NO_TX_SPDO
   #error SPDO_cfg_MAX_NO_TX_SPDO is not defined
 #endif
@@ -320,6 +458,38 @@
   #error SPDO_cfg_NO_NOT_ANSWERED_TR is not defined
 #endif
 
+#ifndef SPDO_cfg_ACTIVATION_CACHE
+  #error SPDO_cfg_ACTIVATION_CACHE is not defined
+#endif
+#if ((SPDO_cfg_ACTIVATION_CACHE != EPLS_k_ENABLE) && \
+     (SPDO_cfg_ACTIVATION_CACHE != EPLS_k_DISABLE))
+  #error SPDO_cfg_ACTIVATION_CACHE is invalid
+#endif
+
+#ifndef SPDO_cfg_TX_DELTA_CRC
+  #error SPDO_cfg_TX_DELTA_CRC is not defined
+#endif
+#if ((SPDO_cfg_TX_DELTA_CRC != EPLS_k_ENABLE) && \
+     (SPDO_cfg_TX_DELTA_CRC != EPLS_k_DISABLE))
+  #error SPDO_cfg_TX_DELTA_CRC is invalid
+#endif
+
+#ifndef SPDO_cfg_TX_CHANGE_DETECT
+  #error SPDO_cfg_TX_CHANGE_DETECT is not defined
+#endif
+#if ((SPDO_cfg_TX_CHANGE_DETECT != EPLS_k_ENABLE) && \
+     (SPDO_cfg_TX_CHANGE_DETECT != EPLS_k_DISABLE))
+  #error SPDO_cfg_TX_CHANGE_DETECT is invalid
+#endif
+
+#ifndef SPDO_cfg_TSYNC_STATISTIC
+  #error SPDO_cfg_TSYNC_STATISTIC is not defined
+#endif
+#if ((SPDO_cfg_TSYNC_STATISTIC != EPLS_k_ENABLE) && \
+     (SPDO_cfg_TSYNC_STATISTIC != EPLS_k_DISABLE))
+  #error SPDO_cfg_TSYNC_STATISTIC is invalid
+#endif
+
 #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
   #if ((SPDO_cfg_MAX_NO_RX_SPDO < 0) || \
        (SPDO_cfg_MAX_NO_RX_SPDO > 1023))
@@ -364,6 +534,10 @@
     #error SPDO_cfg_CONNECTION_VALID_STATISTIC is not disabled
   #endif
 
+  #if (SPDO_cfg_TSYNC_STATISTIC != EPLS_k_DISABLE)
+    #error SPDO_cfg_TSYNC_STATISTIC is not disabled
+  #endif
+
   #if (SPDO_cfg_MAX_RX_SPDO_MAPP_ENTRIES != EPLS_k_NOT_APPLICABLE)
     #error SPDO_cfg_MAX_RX_SPDO_MAPP_ENTRIES is not EPLS_k_NOT_APPLICABLE
   #endif
@@ -379,6 +553,33 @@
 
 
 
+/***
+*    Checking of the SSDO configuration (see EPLScfg.h)
+***/
+#ifndef SSDOS_cfg_MULTI_READ
+  #error SSDOS_cfg_MULTI_READ is not defined
+#endif
+#if ((SSDOS_cfg_MULTI_READ != EPLS_k_ENABLE) && \
+     (SSDOS_cfg_MULTI_READ != EPLS_k_DISABLE))
+  #error SSDOS_cfg_MULTI_READ is invalid
+#endif
+
+#ifndef SSDOS_cfg_MULTI_READ_LEN
+  #error SSDOS_cfg_MULTI_READ_LEN is not defined
+#endif
+#if ((SSDOS_cfg_MULTI_READ_LEN < 1) || (SSDOS_cfg_MULTI_READ_LEN > 1024))
+  #error SSDOS_cfg_MULTI_READ_LEN is invalid
+#endif
+
+#ifndef SSDOC_cfg_MULTI_READ
+  #error SSDOC_cfg_MULTI_READ is not defined
+#endif
+#if ((SSDOC_cfg_MULTI_READ != EPLS_k_ENABLE) && \
+     (SSDOC_cfg_MULTI_READ != EPLS_k_DISABLE))
+  #error SSDOC_cfg_MULTI_READ is invalid
+#endif
+
+
 /***
 *    Checking of the SOD configuration (see EPLScfg.h)
 ***/
@@ -389,6 +590,62 @@
      (SOD_cfg_APPLICATION_OBJ != EPLS_k_DISABLE))
   #error SOD_cfg_APPLICATION_OBJ is invalid
 #endif
+#ifndef SOD_cfg_SEG_WRITE_SESSION
+  #error SOD_cfg_SEG_WRITE_SESSION is not defined
+#endif
+#if ((SOD_cfg_SEG_WRITE_SESSION != EPLS_k_ENABLE) && \
+     (SOD_cfg_SEG_WRITE_SESSION != EPLS_k_DISABLE))
+  #error SOD_cfg_SEG_WRITE_SESSION is invalid
+#endif
+
+#ifndef SOD_cfg_STREAM_OBJ
+  #error SOD_cfg_STREAM_OBJ is not defined
+#endif
+#if ((SOD_cfg_STREAM_OBJ != EPLS_k_ENABLE) && \
+     (SOD_cfg_STREAM_OBJ != EPLS_k_DISABLE))
+  #error SOD_cfg_STREAM_OBJ is invalid
+#endif
+#if ((SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE) && \
+     (SOD_cfg_APPLICATION_OBJ != EPLS_k_ENABLE))
+  #error SOD_cfg_STREAM_OBJ requires SOD_cfg_APPLICATION_OBJ
+#endif
+
+#ifndef SOD_cfg_CHANGE_FEED
+  #error SOD_cfg_CHANGE_FEED is not defined
+#endif
+#if ((SOD_cfg_CHANGE_FEED != EPLS_k_ENABLE) && \
+     (SOD_cfg_CHANGE_FEED != EPLS_k_DISABLE))
+  #error SOD_cfg_CHANGE_FEED is invalid
+#endif
+#if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+  #ifndef SOD_cfg_MAX_CHANGE_ENTRIES
+    #error SOD_cfg_MAX_CHANGE_ENTRIES is not defined
+  #endif
+  #if ((SOD_cfg_MAX_CHANGE_ENTRIES < 32) || \
+       (SOD_cfg_MAX_CHANGE_ENTRIES > 65504) || \
+       ((SOD_cfg_MAX_CHANGE_ENTRIES % 32) != 0))
+    #error SOD_cfg_MAX_CHANGE_ENTRIES is invalid
+  #endif
+  #ifndef BIT_SCAN_FORWARD
+    #error BIT_SCAN_FORWARD is not defined
+  #endif
+#endif
+
+#ifndef SOD_cfg_SNAPSHOT
+  #error SOD_cfg_SNAPSHOT is not defined
+#endif
+#if ((SOD_cfg_SNAPSHOT != EPLS_k_ENABLE) && \
+     (SOD_cfg_SNAPSHOT != EPLS_k_DISABLE))
+  #error SOD_cfg_SNAPSHOT is invalid
+#endif
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+  #ifndef SOD_cfg_SNAPSHOT_LEN
+    #error SOD_cfg_SNAPSHOT_LEN is not defined
+  #endif
+  #if ((SOD_cfg_SNAPSHOT_LEN < 1) || (SOD_cfg_SNAPSHOT_LEN > 65535))
+    #error SOD_cfg_SNAPSHOT_LEN is invalid
+  #endif
+#endif
 
 
 #endif
@@ -38,10 +38,113 @@ extern UINT32 SCFM_dw_PathProgress SAFE_NO_INIT_SEKTOR;
 UINT32 SCFM_GetResetPath(void);
 
 
+#if (SCFM_cfg_PROFILING == EPLS_k_ENABLE)
+/**
+ * @struct SCFM_t_PROF_SITE
+ * Structure for the profiling data of one call site of SCFM_TACK_PATH().
+ */
+typedef struct
+{
+  /** source file of the call site */
+  const CHAR *pc_file;
+  /** source line of the call site */
+  UINT32 dw_line;
+  /** number of tacks */
+  UINT32 dw_count;
+  /** sum of the times since the previous tack */
+  UINT64 qw_totalTime;
+  /** maximum time since the previous tack */
+  UINT32 dw_maxTime;
+} SCFM_t_PROF_SITE;
+
+/**
+ * Maximum length of a line generated by SCFM_ProfDumpSite() including the null termination.
+ */
+#define SCFM_k_PROF_STR_LEN                       256u
+
+/**
+ * @brief This function records the time since the previous tack for the given call site.
+ *
+ * @note This function is called by SCFM_TACK_PATH() only.
+ *
+ * @param        pc_file          source file of the call site (not checked, only called with __FILE__) valid range: <> NULL
+ *
+ * @param        dw_line          source line of the call site (not checked, only called with __LINE__) valid range: UINT32
+ */
+void SCFM_ProfTack(const CHAR *pc_file, UINT32 dw_line);
+
+/**
+ * @brief This function selects the profiling table of the given instance and restarts the time measurement.
+ *
+ * The function has to be called before the application calls a function of the openSAFETY Stack,
+ * otherwise the time spent in the application is added to the first call site.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SCFM_ProfSelect(BYTE_B_INSTNUM);
+
+/**
+ * @brief This function clears the profiling table of the given instance.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SCFM_ProfReset(BYTE_B_INSTNUM);
+
+/**
+ * @brief This function reads the profiling data of one call site.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_siteIdx        index of the call site (checked) valid range: 0..(SCFM_cfg_PROF_MAX_SITES-1)
+ *
+ * @retval       ps_site          profiling data (checked) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - call site was tacked
+ * - FALSE            - invalid parameter or call site not used
+ */
+BOOLEAN SCFM_ProfGetSite(BYTE_B_INSTNUM_ UINT16 w_siteIdx,
+                         SCFM_t_PROF_SITE *ps_site);
+
+/**
+ * @brief This function writes the profiling data of one call site as a text line which is read by the osprofreport tool.
+ *
+ * The line has the format "SCFM;<instance>;<file>;<line>;<count>;<total time>;<max time>\n".
+ * The total time is written with 16 hex digits, all other numbers are decimal. File names longer
+ * than 180 characters are cut.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_siteIdx        index of the call site (checked) valid range: 0..(SCFM_cfg_PROF_MAX_SITES-1)
+ *
+ * @retval       pac_str          buffer of SCFM_k_PROF_STR_LEN characters (checked) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - line written
+ * - FALSE            - invalid parameter or call site not used
+ */
+BOOLEAN SCFM_ProfDumpSite(BYTE_B_INSTNUM_ UINT16 w_siteIdx, CHAR *pac_str);
+
+/**
+ * @brief This function returns the number of tacks which were not recorded because the profiling table was full.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @return       number of lost tacks
+ */
+UINT32 SCFM_ProfGetLost(BYTE_B_INSTNUM);
+
+/**
+ * @brief This macro registers a sub function call or a significant branch in the program flow and records the time since the previous one.
+ */
+#define SCFM_TACK_PATH()                          (SCFM_dw_PathProgress++, \
+                                    SCFM_ProfTack(__FILE__, (UINT32)__LINE__))
+#else
 /**
  * @brief This macro registers a sub function call or a significant branch in the program flow.
  */
 #define SCFM_TACK_PATH()                          (SCFM_dw_PathProgress++)
+#endif /* (SCFM_cfg_PROFILING == EPLS_k_ENABLE) */
 
 
 #endif
@@ -16,11 +16,45 @@
  */
 
 #include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
 #include "SCFMapi.h"
 #include "SCFM.h"
 
 UINT32 SCFM_dw_PathProgress SAFE_NO_INIT_SEKTOR;
 
+#if (SCFM_cfg_PROFILING == EPLS_k_ENABLE)
+/**
+ * Mask to get the table entry of a hash value.
+ */
+#define k_PROF_SITE_MASK    ((UINT32)SCFM_cfg_PROF_MAX_SITES - 1UL)
+
+/**
+ * Length of the count, total and maximum time written by SCFM_ProfDumpSite() including the null termination.
+ */
+#define k_PROF_TIMES_LEN    40u
+
+/**
+ * Structure for the profiling table of one instance.
+ */
+typedef struct
+{
+  /** call sites, a call site is searched by the hash of its line number */
+  SCFM_t_PROF_SITE as_site[SCFM_cfg_PROF_MAX_SITES];
+  /** number of tacks not recorded because the table was full */
+  UINT32 dw_lost;
+} t_PROF_TABLE;
+
+/** profiling tables of all instances */
+static t_PROF_TABLE as_ProfTable[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+/** profiling table selected by SCFM_ProfSelect() */
+static t_PROF_TABLE *ps_ProfActTable SAFE_NO_INIT_SEKTOR;
+
+/** time of the previous tack */
+static UINT32 dw_ProfLastTack SAFE_NO_INIT_SEKTOR;
+#endif /* (SCFM_cfg_PROFILING == EPLS_k_ENABLE) */
+
 /**
 * @brief This function initializes all module global and global variables defined in the unit SCFM.
 */
@@ -28,6 +62,12 @@ void SCFM_Init(void)
 {
   SCFM_dw_PathProgress = 0x00UL;  /* reset 32 bit counter to zero */
 
+#if (SCFM_cfg_PROFILING == EPLS_k_ENABLE)
+  MEMSET(as_ProfTable, 0, sizeof(as_ProfTable));
+  ps_ProfActTable = &as_ProfTable[0];
+  dw_ProfLastTack = SCFM_PROF_GET_TIME();
+#endif
+
   return;
 }
 
@@ -47,4 +87,190 @@ UINT32 SCFM_GetResetPath(void)
 }
 
 
+#if (SCFM_cfg_PROFILING == EPLS_k_ENABLE)
+/**
+ * @brief This function records the time since the previous tack for the given call site.
+ *
+ * The call sites are stored in a hash table with linear probing. The time needed by this
+ * function is not added to the next call site.
+ *
+ * @note This function is called by SCFM_TACK_PATH() only, so it must not tack itself.
+ *
+ * @param        pc_file          source file of the call site (not checked, only called with __FILE__) valid range: <> NULL
+ *
+ * @param        dw_line          source line of the call site (not checked, only called with __LINE__) valid range: UINT32
+ */
+void SCFM_ProfTack(const CHAR *pc_file, UINT32 dw_line)
+{
+  UINT32 dw_time = SCFM_PROF_GET_TIME() - dw_ProfLastTack; /* time since the
+                                                               previous tack */
+  UINT32 dw_idx = (dw_line * 2654435761UL) & k_PROF_SITE_MASK; /* first
+                                                        entry to be searched */
+  UINT32 i = 0UL; /* loop counter */
+  SCFM_t_PROF_SITE *ps_site = (SCFM_t_PROF_SITE *)NULL; /* found entry */
+
+  /* search the call site or a free entry, the same line number is found in
+     different files, so the file reference is compared too */
+  while ((ps_site == NULL) && (i < (UINT32)SCFM_cfg_PROF_MAX_SITES))
+  {
+    ps_site = &ps_ProfActTable->as_site[(dw_idx + i) & k_PROF_SITE_MASK];
+    /* if free entry */
+    if (ps_site->pc_file == NULL)
+    {
+      ps_site->pc_file = pc_file;
+      ps_site->dw_line = dw_line;
+    }
+    /* else if other call site */
+    else if ((ps_site->dw_line != dw_line) || (ps_site->pc_file != pc_file))
+    {
+      ps_site = (SCFM_t_PROF_SITE *)NULL;
+    }
+    /* no else : call site found */
+    i++;
+  }
+
+  /* if the call site is recorded */
+  if (ps_site != NULL)
+  {
+    ps_site->dw_count++;
+    ps_site->qw_totalTime += (UINT64)dw_time;
+    /* if new maximum time */
+    if (dw_time > ps_site->dw_maxTime)
+    {
+      ps_site->dw_maxTime = dw_time;
+    }
+  }
+  else /* table is full */
+  {
+    ps_ProfActTable->dw_lost++;
+  }
+
+  dw_ProfLastTack = SCFM_PROF_GET_TIME();
+}
+
+/**
+ * @brief This function selects the profiling table of the given instance and restarts the time measurement.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SCFM_ProfSelect(BYTE_B_INSTNUM)
+{
+  /* if the instance number is valid */
+  if (B_INSTNUMidx < (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    ps_ProfActTable = &as_ProfTable[B_INSTNUMidx];
+  }
+  /* no else : the previous table is still used */
+
+  dw_ProfLastTack = SCFM_PROF_GET_TIME();
+}
+
+/**
+ * @brief This function clears the profiling table of the given instance.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SCFM_ProfReset(BYTE_B_INSTNUM)
+{
+  /* if the instance number is valid */
+  if (B_INSTNUMidx < (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    MEMSET(&as_ProfTable[B_INSTNUMidx], 0, sizeof(t_PROF_TABLE));
+  }
+  /* no else : invalid instance */
+}
+
+/**
+ * @brief This function reads the profiling data of one call site.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_siteIdx        index of the call site (checked) valid range: 0..(SCFM_cfg_PROF_MAX_SITES-1)
+ *
+ * @retval       ps_site          profiling data (checked) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - call site was tacked
+ * - FALSE            - invalid parameter or call site not used
+ */
+BOOLEAN SCFM_ProfGetSite(BYTE_B_INSTNUM_ UINT16 w_siteIdx,
+                         SCFM_t_PROF_SITE *ps_site)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+
+  /* if all parameters are valid and the entry is used */
+  if ((B_INSTNUMidx < (UINT8)EPLS_cfg_MAX_INSTANCES) &&
+      (w_siteIdx < (UINT16)SCFM_cfg_PROF_MAX_SITES) &&
+      (ps_site != NULL) &&
+      (as_ProfTable[B_INSTNUMidx].as_site[w_siteIdx].pc_file != NULL))
+  {
+    *ps_site = as_ProfTable[B_INSTNUMidx].as_site[w_siteIdx];
+    o_ret = TRUE;
+  }
+  /* no else : invalid parameter or entry not used */
+
+  return o_ret;
+}
+
+/**
+ * @brief This function writes the profiling data of one call site as a text line which is read by the osprofreport tool.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_siteIdx        index of the call site (checked) valid range: 0..(SCFM_cfg_PROF_MAX_SITES-1)
+ *
+ * @retval       pac_str          buffer of SCFM_k_PROF_STR_LEN characters (checked) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - line written
+ * - FALSE            - invalid parameter or call site not used
+ */
+BOOLEAN SCFM_ProfDumpSite(BYTE_B_INSTNUM_ UINT16 w_siteIdx, CHAR *pac_str)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  SCFM_t_PROF_SITE s_site; /* copy of the call site */
+  CHAR ac_times[k_PROF_TIMES_LEN]; /* count, total and maximum time */
+
+  /* if the call site was read */
+  if ((pac_str != NULL) && SCFM_ProfGetSite(B_INSTNUM_ w_siteIdx, &s_site))
+  {
+    /* the 64 bit total time is written as two 32 bit halves in hex */
+    SPRINTF4(ac_times, "%lu;%08lX%08lX;%lu",
+             (unsigned long)s_site.dw_count,
+             (unsigned long)(UINT32)(s_site.qw_totalTime >> 32),
+             (unsigned long)(UINT32)s_site.qw_totalTime,
+             (unsigned long)s_site.dw_maxTime);
+    /* the file name is cut to fit into SCFM_k_PROF_STR_LEN characters */
+    SPRINTF4(pac_str, "SCFM;%u;%.180s;%lu;%s\n", (unsigned)B_INSTNUMidx,
+             s_site.pc_file, (unsigned long)s_site.dw_line, ac_times);
+    o_ret = TRUE;
+  }
+  /* no else : invalid parameter or entry not used */
+
+  return o_ret;
+}
+
+/**
+ * @brief This function returns the number of tacks which were not recorded because the profiling table was full.
+ *
+ * @param        b_instNum        instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @return       number of lost tacks
+ */
+UINT32 SCFM_ProfGetLost(BYTE_B_INSTNUM)
+{
+  UINT32 dw_ret = 0UL; /* return value */
+
+  /* if the instance number is valid */
+  if (B_INSTNUMidx < (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    dw_ret = as_ProfTable[B_INSTNUMidx].dw_lost;
+  }
+  /* no else : invalid instance */
+
+  return dw_ret;
+}
+#endif /* (SCFM_cfg_PROFILING == EPLS_k_ENABLE) */
+
+
 /** @} */
@@ -69,6 +69,18 @@
  */
 void SERR_Init(void);
 
+#if ((EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE) && \
+     (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) && (0 != SPDO_cfg_MAX_NO_RX_SPDO))
+/**
+ * @brief This function allocates the SPDO statistic error counters of an instance from its arena.
+ *
+ * @param       b_instNum          instance number (not checked, checked in SSC_InitAll()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param       w_noRxSpdo         number of Rx SPDOs of the instance (not checked, counted in SPDO_InitAll()), valid range: (UINT16)
+ */
+void SERR_InitSpdoCtr(BYTE_B_INSTNUM_ UINT16 w_noRxSpdo);
+#endif
+
 
 /**
 * @brief This function stores an internal error that occurred inside the EPLS Stack and calls the application callback
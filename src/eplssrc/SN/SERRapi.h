@@ -190,11 +190,35 @@ typedef enum
 
 /** @} */
 
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_DISABLE)
 /**
  * @var SERR_aadwCommonEvtCtr
  * This module global variable array contains the common statistic error counters.
  */
 extern UINT32 SERR_aadwCommonEvtCtr[EPLS_cfg_MAX_INSTANCES][SERR_k_NO_COMMON_CTR];
+#else
+/**
+ * @struct SERR_t_STAT_SNAPSHOT
+ * Structure for the statistic counters of an instance read with SERR_GetStatSnapshot().
+ */
+typedef struct
+{
+    /** common counters, indexed by SERR_t_STATEVT_COMMON */
+    UINT32 adw_commonCtr[SERR_k_NO_COMMON_CTR];
+#if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+#if (0 != SPDO_cfg_MAX_NO_RX_SPDO)
+    /** number of valid entries in aadw_spdoCtr */
+    UINT16 w_noRxSpdo;
+    /** counters per Rx SPDO index, indexed by SERR_t_STATEVT_SPDO */
+    UINT32 aadw_spdoCtr[SPDO_cfg_MAX_NO_RX_SPDO][SERR_k_NO_SPDO_CTR];
+#endif
+    /** number of valid entries in aadw_acycCtr, the acyclic counters belong to instance 0 */
+    UINT16 w_noSn;
+    /** acyclic counters per SN index, indexed by SERR_t_STATEVT_ACYC */
+    UINT32 aadw_acycCtr[SCM_cfg_MAX_NUM_OF_NODES][SERR_k_NO_ACYC_CTR];
+#endif
+} SERR_t_STAT_SNAPSHOT;
+#endif
 
 /**
  * @brief This function is a callback function which is provided by the EPLS Application. The function is called by the EPLS Stack (unit SERR) to signal an internal error of the EPLS Stack.
@@ -207,6 +231,53 @@ extern UINT32 SERR_aadwCommonEvtCtr[EPLS_cfg_MAX_INSTANCES][SERR_k_NO_COMMON_CTR
 void SAPL_SERR_SignalErrorClbk(BYTE_B_INSTNUM_ UINT16 w_errorCode,
         UINT32 dw_addInfo);
 
+#if (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE)
+/**
+ * @struct SERR_t_ERROR_EVT
+ * Structure for an error stored in the error queue.
+ */
+typedef struct
+{
+    /** time stamp of the first occurrence, see SAPL_SERR_GetErrorTimeClbk() */
+    UINT32 dw_time;
+    /** additional error information */
+    UINT32 dw_addInfo;
+    /** number of occurrences (always 1 if EPLS_cfg_ERROR_QUEUE_COALESCE is disabled) */
+    UINT32 dw_repeat;
+    /** 16 bit value that holds Error Class, Error ID and the error itselves */
+    UINT16 w_errorCode;
+    /** instance number */
+    UINT8 b_instNum;
+} SERR_t_ERROR_EVT;
+
+/**
+ * @brief This function is a callback function which is provided by the EPLS Application. The function is called by the EPLS Stack (unit SERR) to get the time stamp of an error stored in the error queue.
+ *
+ * @return       actual time, the resolution is defined by the application
+ */
+UINT32 SAPL_SERR_GetErrorTimeClbk(void);
+
+/**
+ * @brief This function reads the oldest error from the error queue.
+ *
+ * The function may be called by another task than the EPLS Stack, but only by one task at a time.
+ *
+ * @retval       ps_evt             reference to the read error (checked), valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - error read
+ * - FALSE            - error queue is empty or ps_evt is NULL
+ */
+BOOLEAN SERR_GetErrorEvt(SERR_t_ERROR_EVT *ps_evt);
+
+/**
+ * @brief This function returns the number of errors which were not stored because the error queue was full.
+ *
+ * @return       number of lost errors since SERR_Init()
+ */
+UINT32 SERR_GetErrorEvtOverflow(void);
+#endif /* (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE) */
+
 /**
  * @brief This function returns a reference to an error string which describes the error exactly. Every unit stores its error strings and returns a reference to them if requested.
  *
@@ -296,6 +367,29 @@ BOOLEAN SERR_GetAcycStatCtr(UINT16 const us_snIdx,
  * - FALSE the counter is not available
  */
 BOOLEAN SERR_GetCommonStatCtr(BYTE_B_INSTNUM_ SERR_t_STATEVT_COMMON const e_evt,UINT32 * const pdw_statCtr);
+
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+/**
+ * @brief This function copies all statistic counters of an instance consistently.
+ *
+ * The function may be called by another task than the EPLS Stack, but only by one task at a time.
+ * The copied values are the counts since the last snapshot with o_reset set, or since SERR_Init().
+ * The single counters returned by SERR_GetCommonStatCtr(), SERR_GetSpdoStatCtr() and
+ * SERR_GetAcycStatCtr() are not restarted.
+ *
+ * @param       b_instNum          instance number (checked), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param       o_reset            TRUE if the counters restart from zero for the next snapshot (not checked, any value allowed)
+ *
+ * @retval      ps_snapshot        copied counters (checked), valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - counters copied
+ * - FALSE            - invalid parameter or the counters changed during every copy attempt
+ */
+BOOLEAN SERR_GetStatSnapshot(BYTE_B_INSTNUM_ BOOLEAN const o_reset,
+        SERR_t_STAT_SNAPSHOT * const ps_snapshot);
+#endif
 #endif
 
 /** @} */
@@ -32,6 +32,9 @@
 #include "SERRapi.h"
 #include "SERR.h"
 #include "SCFMapi.h"
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+#include "SSC.h"
+#endif
 
 #if(EPLS_cfg_ERROR_STRING == EPLS_k_ENABLE)
 #if(EPLS_cfg_SCM == EPLS_k_ENABLE)
@@ -72,11 +75,107 @@ static CHAR ac_DynErrorStr[SERR_k_ERROR_STR_LEN] SAFE_NO_INIT_SEKTOR;
  */
 static UINT32 dw_AddErrorInfo SAFE_NO_INIT_SEKTOR;
 
+#if (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE)
+/**
+ * Mask to get the queue entry of a queue counter.
+ */
+#define k_ERR_QUEUE_MASK           ((UINT32)EPLS_cfg_ERROR_QUEUE_SIZE - 1UL)
+
+/**
+ * Structure for the error queue.
+ *
+ * The queue is written by SERR_SetError() and read by SERR_GetErrorEvt(). Each counter is
+ * only written by one side. The reader increments the read counter before it copies an entry,
+ * so the writer never writes or coalesces an entry which is being read.
+ */
+typedef struct
+{
+    /** number of written errors, only written by SERR_SetError() */
+    volatile UINT32 dw_wrCtr;
+    /** number of read errors, only written by SERR_GetErrorEvt() */
+    volatile UINT32 dw_rdCtr;
+    /** number of lost errors, only written by SERR_SetError() */
+    volatile UINT32 dw_overflowCtr;
+    /** queue entries */
+    SERR_t_ERROR_EVT as_evt[EPLS_cfg_ERROR_QUEUE_SIZE];
+} t_ERROR_QUEUE;
+
+/**
+ * @var s_ErrQueue
+ * This module global variable contains the error queue.
+ */
+static t_ERROR_QUEUE s_ErrQueue SAFE_NO_INIT_SEKTOR;
+
+static void PushErrorEvt(BYTE_B_INSTNUM_ UINT16 w_error, UINT32 dw_addInfo);
+#endif /* (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE) */
+
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+/**
+ * Number of data cache lines for the given number of bytes.
+ */
+#define k_NO_LINES(size) \
+    (((size) + ((UINT32)EPLS_cfg_CACHE_LINE_SIZE - 1UL)) / (UINT32)EPLS_cfg_CACHE_LINE_SIZE)
+
+/**
+ * Maximum number of attempts to take a consistent snapshot.
+ */
+#define k_STAT_MAX_COPY_ATTEMPTS 4U
+
+/**
+ * One data cache line of statistic counters.
+ */
+typedef struct
+{
+    UINT32 adw_ctr[EPLS_cfg_CACHE_LINE_SIZE / sizeof(UINT32)];
+} t_CTR_LINE;
+
+/**
+ * Common statistic counters of an instance.
+ *
+ * The counters of an instance are only written by the EPLS Stack of this instance. The
+ * update counter is incremented before and after each update, so SERR_GetStatSnapshot()
+ * detects a copy taken during an update.
+ */
+typedef struct
+{
+    /** update counter, odd while the counters of the instance are updated */
+    volatile UINT32 dw_seq;
+    /** common counters */
+    UINT32 adw_commonCtr[SERR_k_NO_COMMON_CTR];
+} t_STAT_CTR;
+
+/**
+ * Common statistic counters of an instance, padded to whole data cache lines.
+ */
+typedef union
+{
+    /** counters */
+    t_STAT_CTR s_ctr;
+    /** padding */
+    t_CTR_LINE as_line[k_NO_LINES(sizeof(t_STAT_CTR))];
+} t_STAT_BLOCK;
+
+/**
+ * @var as_StatBlock
+ * This module global variable array contains the common statistic error counters, every
+ * instance in its own data cache lines.
+ */
+static t_STAT_BLOCK as_StatBlock[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR CACHE_LINE_ALIGNED;
+
+/**
+ * @var aadw_CommonBase
+ * This module global variable array contains the common counters of the last snapshot with reset.
+ */
+static UINT32 aadw_CommonBase[EPLS_cfg_MAX_INSTANCES][SERR_k_NO_COMMON_CTR] SAFE_NO_INIT_SEKTOR;
+
+static void StatDelta(UINT32 *pdw_ctr, UINT32 *pdw_base, UINT32 dw_noCtr, BOOLEAN o_reset);
+#else
 /**
  * @var SERR_aadwCommonEvtCtr
  * This module global variable array contains the common statistic error counters.
  */
 UINT32 SERR_aadwCommonEvtCtr[EPLS_cfg_MAX_INSTANCES][SERR_k_NO_COMMON_CTR] SAFE_NO_INIT_SEKTOR;
+#endif
 
 #if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
 #if (0 != SPDO_cfg_MAX_NO_RX_SPDO)
@@ -88,23 +187,89 @@ typedef struct
     UINT32 adw_spdoEvtCtr[SERR_k_NO_SPDO_CTR];
 } SERR_t_SPDO_EVT_CTR;
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_DISABLE)
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+/**
+ * Number of data cache lines for the spdo specific counters of the given number of RxSPDOs.
+ */
+#define k_SPDO_CTR_LINES(noSpdo) \
+    k_NO_LINES((UINT32)(noSpdo) * (UINT32)sizeof(SERR_t_SPDO_EVT_CTR))
+
+/**
+ * @var as_SpdoCtrLine
+ * This module global variable array contains the spdo specific statistic error counters, every
+ * instance in its own data cache lines.
+ */
+static t_CTR_LINE as_SpdoCtrLine[k_SPDO_CTR_LINES(SPDO_cfg_MAX_NO_RX_SPDO) +
+    ((EPLS_cfg_MAX_INSTANCES - 1) * k_SPDO_CTR_LINES(SPDO_cfg_MAX_NO_RX_SPDO_SDG))]
+    SAFE_NO_INIT_SEKTOR CACHE_LINE_ALIGNED;
+
+/**
+ * @var ao_spdoEvtBase
+ * This module global variable array contains the spdo specific counters of the last snapshot with reset.
+ */
+static SERR_t_SPDO_EVT_CTR ao_spdoEvtBase[(EPLS_cfg_MAX_INSTANCES - 1)*SPDO_cfg_MAX_NO_RX_SPDO_SDG + SPDO_cfg_MAX_NO_RX_SPDO] SAFE_NO_INIT_SEKTOR;
+#else
 /**
  * @var ao_spdoEvtCtr
  * This module global variable array contains the spdo specific statistic error counters.
  */
 SERR_t_SPDO_EVT_CTR ao_spdoEvtCtr[(EPLS_cfg_MAX_INSTANCES - 1)*SPDO_cfg_MAX_NO_RX_SPDO_SDG + SPDO_cfg_MAX_NO_RX_SPDO] SAFE_NO_INIT_SEKTOR;
+#endif
+#else
+/**
+ * @var aw_NoSpdoEvtCtr
+ * This module global array contains the number of spdo specific statistic error counters of each instance.
+ */
+static UINT16 aw_NoSpdoEvtCtr[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+#endif
 /**
  * @var apo_SpdoEvtCtr
  * This module global pointer array contains the pointer to the first SPDO counter of each instance.
  */
 SERR_t_SPDO_EVT_CTR* apo_SpdoEvtCtr[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+/**
+ * @var apo_SpdoEvtBase
+ * This module global pointer array contains the pointer to the first SPDO counter of the last snapshot with reset of each instance.
+ */
+static SERR_t_SPDO_EVT_CTR* apo_SpdoEvtBase[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+#endif
+
+static UINT16 NoSpdoEvtCtr(BYTE_B_INSTNUM);
 #endif /* (0 != SPDO_cfg_MAX_NO_RX_SPDO) */
 
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+/**
+ * Acyclic statistic counters, padded to whole data cache lines.
+ */
+typedef union
+{
+    /** counters */
+    UINT32 aadw_ctr[SCM_cfg_MAX_NUM_OF_NODES][SERR_k_NO_ACYC_CTR];
+    /** padding */
+    t_CTR_LINE as_line[k_NO_LINES(sizeof(UINT32) * SCM_cfg_MAX_NUM_OF_NODES * SERR_k_NO_ACYC_CTR)];
+} t_ACYC_BLOCK;
+
+/**
+ * @var s_AcycEvtCtr
+ * This module global variable contains the acyclic statistic error counters, they are counted
+ * by instance 0.
+ */
+static t_ACYC_BLOCK s_AcycEvtCtr SAFE_NO_INIT_SEKTOR CACHE_LINE_ALIGNED;
+
+/**
+ * @var aadw_AcycBase
+ * This module global variable array contains the acyclic counters of the last snapshot with reset.
+ */
+static UINT32 aadw_AcycBase[SCM_cfg_MAX_NUM_OF_NODES][SERR_k_NO_ACYC_CTR] SAFE_NO_INIT_SEKTOR;
+#else
 /**
  * @var aadw_AcycEvtCtr
  * This module global variable array contains the acyclic statistic error counters.
  */
 UINT32 aadw_AcycEvtCtr[SCM_cfg_MAX_NUM_OF_NODES][SERR_k_NO_COMMON_CTR] SAFE_NO_INIT_SEKTOR;
+#endif
 #endif /* (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) */
 
 /**
@@ -117,8 +282,48 @@ void SERR_Init(void)
 #endif
     /* reset module global error code and additional info */
     dw_AddErrorInfo = 0x00UL;
+#if (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE)
+    /* error queue is empty */
+    s_ErrQueue.dw_wrCtr = 0x00UL;
+    s_ErrQueue.dw_rdCtr = 0x00UL;
+    s_ErrQueue.dw_overflowCtr = 0x00UL;
+#endif
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+    /* the snapshots count from now on */
+    MEMSET(as_StatBlock, 0, sizeof(as_StatBlock));
+    MEMSET(aadw_CommonBase, 0, sizeof(aadw_CommonBase));
+#if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+    MEMSET(&s_AcycEvtCtr, 0, sizeof(s_AcycEvtCtr));
+    MEMSET(aadw_AcycBase, 0, sizeof(aadw_AcycBase));
+#endif
+#endif
 #if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
 #if (0 != SPDO_cfg_MAX_NO_RX_SPDO)
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+    /* the counters are allocated by SERR_InitSpdoCtr() */
+    for ( i = 0; i < EPLS_cfg_MAX_INSTANCES; i++)
+    {
+        apo_SpdoEvtCtr[i] = NULL;
+        aw_NoSpdoEvtCtr[i] = 0U;
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+        apo_SpdoEvtBase[i] = NULL;
+#endif
+    }
+#elif (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+    /* every instance starts at a data cache line */
+    MEMSET(as_SpdoCtrLine, 0, sizeof(as_SpdoCtrLine));
+    MEMSET(ao_spdoEvtBase, 0, sizeof(ao_spdoEvtBase));
+    apo_SpdoEvtCtr[0] = (SERR_t_SPDO_EVT_CTR *)&as_SpdoCtrLine[0];
+    apo_SpdoEvtBase[0] = &ao_spdoEvtBase[0];
+    for ( i = 1; i < EPLS_cfg_MAX_INSTANCES; i++)
+    {
+        /* i starts with one  therefore subtracting one never produces an overflow */
+        apo_SpdoEvtCtr[i] = (SERR_t_SPDO_EVT_CTR *)&as_SpdoCtrLine[
+                k_SPDO_CTR_LINES(SPDO_cfg_MAX_NO_RX_SPDO) +
+                ((i-1) * k_SPDO_CTR_LINES(SPDO_cfg_MAX_NO_RX_SPDO_SDG))];
+        apo_SpdoEvtBase[i] = &ao_spdoEvtBase[SPDO_cfg_MAX_NO_RX_SPDO + ((i-1) * SPDO_cfg_MAX_NO_RX_SPDO_SDG)];
+    }
+#else
     /* initialize the spdo specific error counters */
     /* first instance */
     apo_SpdoEvtCtr[0] = &ao_spdoEvtCtr[0];
@@ -128,11 +333,39 @@ void SERR_Init(void)
         /* i starts with one  therefore subtracting one never produces an overflow */
 	  apo_SpdoEvtCtr[i] = &ao_spdoEvtCtr[SPDO_cfg_MAX_NO_RX_SPDO + ((i-1) * SPDO_cfg_MAX_NO_RX_SPDO_SDG)];
     }
+#endif
 #endif /* (0 != SPDO_cfg_MAX_NO_RX_SPDO) */
 #endif /* (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) */
     SCFM_TACK_PATH();
 }
 
+#if ((EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE) && \
+     (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) && (0 != SPDO_cfg_MAX_NO_RX_SPDO))
+/**
+ * @brief This function allocates the SPDO statistic error counters of an instance from its arena.
+ *
+ * @param       b_instNum          instance number (not checked, checked in SSC_InitAll()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param       w_noRxSpdo         number of Rx SPDOs of the instance (not checked, counted in SPDO_InitAll()), valid range: (UINT16)
+ */
+void SERR_InitSpdoCtr(BYTE_B_INSTNUM_ UINT16 w_noRxSpdo)
+{
+    apo_SpdoEvtCtr[B_INSTNUMidx] = (SERR_t_SPDO_EVT_CTR *)SSC_ArenaAlloc(B_INSTNUM_
+            (UINT32)w_noRxSpdo * (UINT32)sizeof(SERR_t_SPDO_EVT_CTR));
+    /* if the allocation failed, SSC_InitAll() fails and no counter is available */
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+    apo_SpdoEvtBase[B_INSTNUMidx] = (SERR_t_SPDO_EVT_CTR *)SSC_ArenaAlloc(B_INSTNUM_
+            (UINT32)w_noRxSpdo * (UINT32)sizeof(SERR_t_SPDO_EVT_CTR));
+    aw_NoSpdoEvtCtr[B_INSTNUMidx] = ((NULL == apo_SpdoEvtCtr[B_INSTNUMidx]) ||
+                                     (NULL == apo_SpdoEvtBase[B_INSTNUMidx])) ? 0U : w_noRxSpdo;
+#else
+    aw_NoSpdoEvtCtr[B_INSTNUMidx] =
+            (NULL == apo_SpdoEvtCtr[B_INSTNUMidx]) ? 0U : w_noRxSpdo;
+#endif
+    SCFM_TACK_PATH();
+}
+#endif
+
 /**
 * @brief This function stores an internal error that occurred inside the EPLS Stack and calls the application callback
 * function SAPL_SERR_SignalErrorClbk.
@@ -151,10 +384,63 @@ void SERR_SetError(BYTE_B_INSTNUM_ UINT16 w_error, UINT32 dw_addInfo)
     /* store the last additional error information */
     dw_AddErrorInfo = dw_addInfo;
 
-    /* report error to application */
-    SAPL_SERR_SignalErrorClbk(B_INSTNUM_ w_error, dw_addInfo);
+#if (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE)
+    /* if the error is not fail safe relevant */
+    if (SERR_GET_ERROR_TYPE(w_error) == SERR_TYPE_NOT_FS)
+    {
+        /* the error is reported by the error queue */
+        PushErrorEvt(B_INSTNUM_ w_error, dw_addInfo);
+    }
+    else
+#endif
+    {
+        /* report error to application */
+        SAPL_SERR_SignalErrorClbk(B_INSTNUM_ w_error, dw_addInfo);
+    }
+    SCFM_TACK_PATH();
+}
+
+#if (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE)
+/**
+ * @brief This function reads the oldest error from the error queue.
+ *
+ * The function may be called by another task than the EPLS Stack, but only by one task at a time.
+ *
+ * @retval       ps_evt             reference to the read error (checked), valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - error read
+ * - FALSE            - error queue is empty or ps_evt is NULL
+ */
+BOOLEAN SERR_GetErrorEvt(SERR_t_ERROR_EVT *ps_evt)
+{
+    BOOLEAN o_ret = FALSE;
+    UINT32 dw_rdCtr = s_ErrQueue.dw_rdCtr;
+
+    /* if the queue is not empty */
+    if ((ps_evt != NULL) && (dw_rdCtr != s_ErrQueue.dw_wrCtr))
+    {
+        /* the entry is taken before it is copied, so it is not coalesced anymore */
+        s_ErrQueue.dw_rdCtr = dw_rdCtr + 1UL;
+        MEMORY_BARRIER();
+        *ps_evt = s_ErrQueue.as_evt[dw_rdCtr & k_ERR_QUEUE_MASK];
+        o_ret = TRUE;
+    }
+    SCFM_TACK_PATH();
+    return o_ret;
+}
+
+/**
+ * @brief This function returns the number of errors which were not stored because the error queue was full.
+ *
+ * @return       number of lost errors since SERR_Init()
+ */
+UINT32 SERR_GetErrorEvtOverflow(void)
+{
     SCFM_TACK_PATH();
+    return s_ErrQueue.dw_overflowCtr;
 }
+#endif /* (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE) */
 
 /**
 * @brief This function returns the last additional error info that occurred in the openSAFETY stack that was set by SERR_SetError.
@@ -259,7 +545,18 @@ CHAR * SERR_GetErrorStr(UINT16 w_errorCode, UINT32 dw_addInfo)
  */
 void SERR_CountCommonEvt(BYTE_B_INSTNUM_ SERR_t_STATEVT_COMMON const e_evt) 
 {
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+    t_STAT_CTR *ps_ctr = &as_StatBlock[B_INSTNUMidx].s_ctr;
+
+    /* the update counter is odd during the update */
+    ps_ctr->dw_seq++;
+    MEMORY_BARRIER();
+    ps_ctr->adw_commonCtr[e_evt]++;
+    MEMORY_BARRIER();
+    ps_ctr->dw_seq++;
+#else
     SERR_aadwCommonEvtCtr[B_INSTNUMidx][e_evt]++;
+#endif
     return;
 }
 
@@ -277,11 +574,28 @@ void SERR_CountSpdoEvt(BYTE_B_INSTNUM_ UINT16 const w_spdoIdx, SERR_t_STATEVT_SP
 #if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
 #if (0 != SPDO_cfg_MAX_NO_RX_SPDO)
     SERR_t_SPDO_EVT_CTR* po_spdoEvtCtr = NULL;
+#endif /* (0 != SPDO_cfg_MAX_NO_RX_SPDO) */
+#endif /* (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) */
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+    t_STAT_CTR *ps_ctr = &as_StatBlock[B_INSTNUMidx].s_ctr;
+
+    /* the update counter is odd during the update */
+    ps_ctr->dw_seq++;
+    MEMORY_BARRIER();
+#endif
+#if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+#if (0 != SPDO_cfg_MAX_NO_RX_SPDO)
     po_spdoEvtCtr = apo_SpdoEvtCtr[B_INSTNUMidx] + w_spdoIdx;
     po_spdoEvtCtr->adw_spdoEvtCtr[e_evt]++;
 #endif /* (0 != SPDO_cfg_MAX_NO_RX_SPDO) */
 #endif /* (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) */
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+    ps_ctr->adw_commonCtr[SERR_k_CYC_ERROR]++;
+    MEMORY_BARRIER();
+    ps_ctr->dw_seq++;
+#else
     SERR_aadwCommonEvtCtr[B_INSTNUMidx][SERR_k_CYC_ERROR]++;
+#endif
     return;
 }
 /**
@@ -293,11 +607,26 @@ void SERR_CountSpdoEvt(BYTE_B_INSTNUM_ UINT16 const w_spdoIdx, SERR_t_STATEVT_SP
  */
 void SERR_CountAcycEvt(UINT16 const w_fsmNum, SERR_t_STATEVT_ACYC const e_evt) 
 {
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+    /* those errors only occur at instance 0 at the moment */
+    t_STAT_CTR *ps_ctr = &as_StatBlock[0].s_ctr;
+
+    /* the update counter is odd during the update */
+    ps_ctr->dw_seq++;
+    MEMORY_BARRIER();
+#if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+    s_AcycEvtCtr.aadw_ctr[w_fsmNum][e_evt]++;
+#endif /* (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) */
+    ps_ctr->adw_commonCtr[SERR_k_ACYC_RETRY]++;
+    MEMORY_BARRIER();
+    ps_ctr->dw_seq++;
+#else
 #if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
     aadw_AcycEvtCtr[w_fsmNum][e_evt]++;
 #endif /* (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) */
     /* those errors only occur at instance 0 at the moment */
     SERR_aadwCommonEvtCtr[0][SERR_k_ACYC_RETRY]++;
+#endif
     return;
 }
 /**
@@ -330,10 +659,7 @@ BOOLEAN SERR_GetSpdoStatCtr(BYTE_B_INSTNUM_ UINT16 const w_spdoIdx, SERR_t_STATE
   if ((B_INSTNUMidx < (UINT8)EPLS_cfg_MAX_INSTANCES) &&
       ((UINT32)SERR_k_NO_SPDO_CTR > (UINT32)e_evt) &&
       (NULL != pdw_statCtr) &&
-      (((SPDO_cfg_MAX_NO_RX_SPDO > w_spdoIdx) &&
-    	(0 == B_INSTNUMidx)) ||
-       ((SPDO_cfg_MAX_NO_RX_SPDO_SDG > w_spdoIdx) &&
-    	(0 != B_INSTNUMidx))))
+      (NoSpdoEvtCtr(B_INSTNUM) > w_spdoIdx))
   {
         /* only read the statistic counter value if the parameters are checked */
         po_spdoEvtCtr = apo_SpdoEvtCtr[B_INSTNUMidx] + w_spdoIdx;
@@ -365,7 +691,11 @@ BOOLEAN SERR_GetAcycStatCtr(UINT16 const us_snIdx, SERR_t_STATEVT_ACYC const e_e
       ((UINT32)SERR_k_NO_ACYC_CTR > (UINT32)e_evt) &&
       (NULL != pdw_statCtr))
   {
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+        *pdw_statCtr = s_AcycEvtCtr.aadw_ctr[us_snIdx][e_evt];
+#else
         *pdw_statCtr = aadw_AcycEvtCtr[us_snIdx][e_evt];
+#endif
         b_RetVal = TRUE;
     }
     return b_RetVal;
@@ -393,10 +723,231 @@ BOOLEAN SERR_GetCommonStatCtr(BYTE_B_INSTNUM_ SERR_t_STATEVT_COMMON const e_evt,
       ((UINT32)SERR_k_NO_COMMON_CTR > (UINT32)e_evt) &&
       (NULL != pdw_statCtr))
   {
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+        *pdw_statCtr = as_StatBlock[B_INSTNUMidx].s_ctr.adw_commonCtr[e_evt];
+#else
         *pdw_statCtr = SERR_aadwCommonEvtCtr[B_INSTNUMidx][e_evt];
+#endif
         b_RetVal = TRUE;
     }
     return b_RetVal;
 }
 
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+/**
+ * @brief This function copies all statistic counters of an instance consistently.
+ *
+ * The function may be called by another task than the EPLS Stack, but only by one task at a time.
+ * The copied values are the counts since the last snapshot with o_reset set, or since SERR_Init().
+ * The single counters returned by SERR_GetCommonStatCtr(), SERR_GetSpdoStatCtr() and
+ * SERR_GetAcycStatCtr() are not restarted.
+ *
+ * @param       b_instNum          instance number (checked), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param       o_reset            TRUE if the counters restart from zero for the next snapshot (not checked, any value allowed)
+ *
+ * @retval      ps_snapshot        copied counters (checked), valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - counters copied
+ * - FALSE            - invalid parameter or the counters changed during every copy attempt
+ */
+BOOLEAN SERR_GetStatSnapshot(BYTE_B_INSTNUM_ BOOLEAN const o_reset,
+        SERR_t_STAT_SNAPSHOT * const ps_snapshot)
+{
+    BOOLEAN o_ret = FALSE; /* return value */
+    UINT8 b_attempt = 0U; /* number of copy attempts */
+    UINT32 dw_seq; /* update counter before the copy */
+    t_STAT_CTR *ps_ctr; /* counters of the instance */
+#if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+    UINT32 i; /* loop counter */
+#endif
+
+    /* check parameters */
+    if ((B_INSTNUMidx < (UINT8)EPLS_cfg_MAX_INSTANCES) &&
+        (NULL != ps_snapshot))
+    {
+        ps_ctr = &as_StatBlock[B_INSTNUMidx].s_ctr;
+#if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+#if (0 != SPDO_cfg_MAX_NO_RX_SPDO)
+        ps_snapshot->w_noRxSpdo = NoSpdoEvtCtr(B_INSTNUM);
+#endif
+        ps_snapshot->w_noSn = (0U == B_INSTNUMidx) ? (UINT16)SCM_cfg_MAX_NUM_OF_NODES : 0U;
+#endif
+
+        while ((!o_ret) && (b_attempt < k_STAT_MAX_COPY_ATTEMPTS))
+        {
+            dw_seq = ps_ctr->dw_seq;
+            MEMORY_BARRIER();
+            /* if the counters are not updated at the moment */
+            if ((dw_seq & 1UL) == 0UL)
+            {
+                MEMCOPY(ps_snapshot->adw_commonCtr, ps_ctr->adw_commonCtr,
+                        sizeof(ps_snapshot->adw_commonCtr));
+#if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+#if (0 != SPDO_cfg_MAX_NO_RX_SPDO)
+                for (i = 0UL; i < (UINT32)ps_snapshot->w_noRxSpdo; i++)
+                {
+                    MEMCOPY(ps_snapshot->aadw_spdoCtr[i],
+                            apo_SpdoEvtCtr[B_INSTNUMidx][i].adw_spdoEvtCtr,
+                            sizeof(ps_snapshot->aadw_spdoCtr[i]));
+                }
+#endif
+                /* if instance 0, the acyclic counters are copied */
+                if (0U != ps_snapshot->w_noSn)
+                {
+                    MEMCOPY(ps_snapshot->aadw_acycCtr, s_AcycEvtCtr.aadw_ctr,
+                            sizeof(ps_snapshot->aadw_acycCtr));
+                }
+#endif
+                MEMORY_BARRIER();
+                /* if the counters were not updated during the copy */
+                o_ret = (BOOLEAN)(dw_seq == ps_ctr->dw_seq);
+            }
+            b_attempt++;
+        }
+
+        /* if a consistent copy was taken */
+        if (o_ret)
+        {
+            StatDelta(ps_snapshot->adw_commonCtr, aadw_CommonBase[B_INSTNUMidx],
+                      (UINT32)SERR_k_NO_COMMON_CTR, o_reset);
+#if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+#if (0 != SPDO_cfg_MAX_NO_RX_SPDO)
+            for (i = 0UL; i < (UINT32)ps_snapshot->w_noRxSpdo; i++)
+            {
+                StatDelta(ps_snapshot->aadw_spdoCtr[i],
+                          apo_SpdoEvtBase[B_INSTNUMidx][i].adw_spdoEvtCtr,
+                          (UINT32)SERR_k_NO_SPDO_CTR, o_reset);
+            }
+#endif
+            for (i = 0UL; i < (UINT32)ps_snapshot->w_noSn; i++)
+            {
+                StatDelta(ps_snapshot->aadw_acycCtr[i], aadw_AcycBase[i],
+                          (UINT32)SERR_k_NO_ACYC_CTR, o_reset);
+            }
+#endif
+        }
+    }
+    SCFM_TACK_PATH();
+    return o_ret;
+}
+#endif /* (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE) */
+
+#if ((EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE) && (0 != SPDO_cfg_MAX_NO_RX_SPDO))
+/**
+ * @brief This function returns the number of spdo specific statistic counters of an instance.
+ *
+ * @param       b_instNum          instance number (not checked, checked by the caller), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @return      number of Rx SPDOs with counters
+ */
+static UINT16 NoSpdoEvtCtr(BYTE_B_INSTNUM)
+{
+    UINT16 w_noRxSpdo; /* return value */
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+    w_noRxSpdo = aw_NoSpdoEvtCtr[B_INSTNUMidx];
+#else
+    w_noRxSpdo = (0U == B_INSTNUMidx) ? (UINT16)SPDO_cfg_MAX_NO_RX_SPDO :
+                                        (UINT16)SPDO_cfg_MAX_NO_RX_SPDO_SDG;
+#endif
+    return w_noRxSpdo;
+}
+#endif
+
+#if (EPLS_cfg_ERROR_STAT_SNAPSHOT == EPLS_k_ENABLE)
+/**
+ * @brief This function converts copied counters into the counts since the last snapshot with reset.
+ *
+ * @param       pdw_ctr            copied counters, converted in place (not checked, only called with reference to array) valid range: <> NULL
+ *
+ * @param       pdw_base           counters of the last snapshot with reset (not checked, only called with reference to array) valid range: <> NULL
+ *
+ * @param       dw_noCtr           number of counters (not checked, only called with define) valid range: UINT32
+ *
+ * @param       o_reset            TRUE if the copied counters become the new base (not checked, any value allowed)
+ */
+static void StatDelta(UINT32 *pdw_ctr, UINT32 *pdw_base, UINT32 dw_noCtr, BOOLEAN o_reset)
+{
+    UINT32 i; /* loop counter */
+    UINT32 dw_ctr; /* copied counter */
+
+    for (i = 0UL; i < dw_noCtr; i++)
+    {
+        dw_ctr = pdw_ctr[i];
+        /* the difference is also valid after an overflow of the counter */
+        pdw_ctr[i] = dw_ctr - pdw_base[i];
+        if (o_reset)
+        {
+            pdw_base[i] = dw_ctr;
+        }
+    }
+}
+#endif
+
+#if (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE)
+/**
+ * @brief This function stores an error in the error queue or counts it as lost if the queue is full.
+ *
+ * If EPLS_cfg_ERROR_QUEUE_COALESCE is enabled and the error is equal to the last queued error
+ * which is not yet taken by SERR_GetErrorEvt(), only the repeat counter of the queued error is
+ * incremented. If the reader takes the queued error at the same time, the error is stored in a
+ * new entry and may be counted twice.
+ *
+ * @param       b_instNum          instance number (not checked, checked by the API), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param       w_error            error that occurred in the EPLS stack (not checked, only called with define), valid range: any UINT16 value
+ *
+ * @param       dw_addInfo         additional error information (not checked, any value allowed) valid range: any UINT32 value
+ */
+static void PushErrorEvt(BYTE_B_INSTNUM_ UINT16 w_error, UINT32 dw_addInfo)
+{
+    UINT32 dw_wrCtr = s_ErrQueue.dw_wrCtr;
+    SERR_t_ERROR_EVT *ps_evt;
+    BOOLEAN o_done = FALSE;
+#if (EPLS_cfg_ERROR_QUEUE_COALESCE == EPLS_k_ENABLE)
+    /* last queued error */
+    ps_evt = &s_ErrQueue.as_evt[(dw_wrCtr - 1UL) & k_ERR_QUEUE_MASK];
+
+    /* if the last queued error is not taken and equal to the new one */
+    if ((s_ErrQueue.dw_rdCtr != dw_wrCtr) &&
+        (ps_evt->b_instNum == (UINT8)B_INSTNUMidx) &&
+        (ps_evt->w_errorCode == w_error) &&
+        (ps_evt->dw_addInfo == dw_addInfo))
+    {
+        ps_evt->dw_repeat++;
+        MEMORY_BARRIER();
+        /* if the error was not taken meanwhile, the reader gets the
+           incremented repeat counter */
+        o_done = (BOOLEAN)(s_ErrQueue.dw_rdCtr != dw_wrCtr);
+    }
+#endif
+
+    /* if the error was not coalesced */
+    if (!o_done)
+    {
+        /* if the queue is full (one entry is kept free for the reader) */
+        if ((dw_wrCtr - s_ErrQueue.dw_rdCtr) >=
+            ((UINT32)EPLS_cfg_ERROR_QUEUE_SIZE - 1UL))
+        {
+            s_ErrQueue.dw_overflowCtr++;
+        }
+        else
+        {
+            ps_evt = &s_ErrQueue.as_evt[dw_wrCtr & k_ERR_QUEUE_MASK];
+            ps_evt->dw_time = SAPL_SERR_GetErrorTimeClbk();
+            ps_evt->dw_addInfo = dw_addInfo;
+            ps_evt->dw_repeat = 1UL;
+            ps_evt->w_errorCode = w_error;
+            ps_evt->b_instNum = (UINT8)B_INSTNUMidx;
+            /* the entry has to be completely written before it is queued */
+            MEMORY_BARRIER();
+            s_ErrQueue.dw_wrCtr = dw_wrCtr + 1UL;
+        }
+    }
+    SCFM_TACK_PATH();
+}
+#endif /* (EPLS_cfg_ERROR_QUEUE == EPLS_k_ENABLE) */
+
 /** @} */
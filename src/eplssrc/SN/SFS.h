@@ -69,6 +69,61 @@
 
 /** @} */
 
+#if (EPLS_cfg_FRAME_ROUTER == EPLS_k_ENABLE)
+/**
+ * @def SFS_k_PEEK_HDR_LEN
+ * @brief Number of raw header bytes provided by SFS_FrmHdrPeek() (ADR and ID of sub frame ONE,
+ * ADR, ID, CT, TADR, TR and the first byte after the header of sub frame TWO).
+ */
+#define SFS_k_PEEK_HDR_LEN             8u
+#endif
+
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+/**
+ * @def SFS_k_TX_CRC_CONST_HDR_LEN
+ * @brief Number of header bytes of both sub frames which are compared with the cached frame
+ * (ADR, ID and LE of sub frame ONE, ADR, ID and TADR of sub frame TWO).
+ */
+#define SFS_k_TX_CRC_CONST_HDR_LEN     6u
+
+/**
+ * @brief Cached CRC state of the last transmitted frame of a Tx SPDO.
+ *
+ * The CRC of a sub frame is affine in the bytes of the sub frame. If a frame only differs from
+ * the cached frame in the CT and TR bytes then its CRC is the cached CRC XOR the contributions of
+ * the changed bits. The contributions only depend on the payload length.
+ */
+typedef struct
+{
+  /** TRUE if ab_constHdr, ab_data and the CRC values describe the last transmitted frame */
+  BOOLEAN o_frmValid;
+  /** TRUE if the bit contributions are calculated for the payload length b_deltaLe */
+  BOOLEAN o_deltaValid;
+  /** payload length the bit contributions are calculated for */
+  UINT8 b_deltaLe;
+  /** CT byte of sub frame ONE of the cached frame */
+  UINT8 b_ct1;
+  /** CT byte of sub frame TWO of the cached frame */
+  UINT8 b_ct2;
+  /** TR byte of sub frame TWO of the cached frame */
+  UINT8 b_tr;
+  /** constant header bytes of the cached frame */
+  UINT8 ab_constHdr[SFS_k_TX_CRC_CONST_HDR_LEN];
+  /** CRC of sub frame ONE of the cached frame */
+  UINT16 w_crc1;
+  /** CRC of sub frame TWO of the cached frame */
+  UINT16 w_crc2;
+  /** contribution of every bit of the CT byte of sub frame ONE to its CRC */
+  UINT16 aw_ct1Delta[8];
+  /** contribution of every bit of the CT byte of sub frame TWO to its CRC */
+  UINT16 aw_ct2Delta[8];
+  /** contribution of every bit of the TR byte of sub frame TWO to its CRC */
+  UINT16 aw_trDelta[8];
+  /** payload data of the cached frame */
+  UINT8 ab_data[SPDO_cfg_MAX_LEN_OF_TX_SPDO];
+} SFS_t_TX_CRC_CACHE;
+#endif
+
 /**
  * @brief This function initializes the read pointer for the UDID of the SCM SOD object with index 0x1200 and sub-index 0x04.
  *
@@ -140,6 +195,80 @@ UINT8 * SFS_GetMemBlock(BYTE_B_INSTNUM_ SHNF_t_TEL_TYPE e_telType,
 BOOLEAN SFS_FrmSerialize(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
         UINT8 *pb_frame);
 
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+/**
+ * @brief This function invalidates the cached CRC state of a Tx SPDO.
+ *
+ * @param        ps_crcCache       reference to the cached CRC state (not checked, only called with reference to
+ *                    struct), valid range: <> NULL
+ */
+void SFS_TxCrcCacheInit(SFS_t_TX_CRC_CACHE *ps_crcCache);
+
+/**
+ * @brief This function builds an openSAFETY frame like SFS_FrmSerialize() and uses the cached CRC state of the Tx SPDO.
+ *
+ * If the constant header bytes and the payload data are the same as in the cached frame then the CRCs are
+ * updated by the contributions of the changed CT and TR bits only. Otherwise the CRCs are calculated over
+ * the whole sub frames and the frame is stored in the cache.
+ *
+ * @see          SFS_FrmSerialize()
+ *
+ * @param        b_instNum         instance number (not checked, checked in SPDO_BuildTxSpdo() or
+ *                    SPDO_ProcessRxSpdo()) valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @param        ps_hdrInfo        reference to header info (not checked, only called with reference to struct),
+ *                    valid range: <> NULL
+ *
+ * @param        pb_frame          reference to an openSAFETY frame (not checked, checked in SendTxSpdo()),
+ *                    valid range: <> NULL
+ *
+ * @param        ps_crcCache       reference to the cached CRC state of the Tx SPDO (not checked, only called with
+ *                    reference to struct), valid range: <> NULL
+ *
+ * @return
+ * - TRUE            - openSAFETY frame serialized and passed to the SHNF successfully
+ * - FALSE           - error during marking the memory block openSAFETY frame passing failed
+ */
+BOOLEAN SFS_FrmSerializeCached(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
+        UINT8 *pb_frame, SFS_t_TX_CRC_CACHE *ps_crcCache);
+#endif
+
+#if (SNMTS_cfg_RESP_CACHE == EPLS_k_ENABLE)
+/**
+ * @brief This function invalidates the cached SNMT Slave responses of an instance.
+ *
+ * @param        b_instNum         instance number (not checked, checked in SSC_InitAll()) valid range:
+ *                    0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ */
+void SFS_SnmtRespCacheInit(BYTE_B_INSTNUM);
+
+/**
+ * @brief This function builds an openSAFETY frame like SFS_FrmSerialize() and uses the cached SNMT Slave response
+ * of the same type.
+ *
+ * If the header bytes are the same as in the cached response then the CRCs are calculated over the payload data
+ * only, starting with the cached CRCs of the headers. If also the payload data is the same then the cached CRCs
+ * are used. Frames which are no SNMT Slave responses are serialized by SFS_FrmSerialize().
+ *
+ * @see          SFS_FrmSerialize()
+ *
+ * @param        b_instNum         instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range:
+ *                    0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @param        ps_hdrInfo        reference to header info (not checked, only called with reference to struct),
+ *                    valid range: <> NULL
+ *
+ * @param        pb_frame          reference to an openSAFETY frame (not checked, checked in
+ *                    SNMTS_TxRespRstGuardScm() or processStateSer()), valid range: <> NULL
+ *
+ * @return
+ * - TRUE            - openSAFETY frame serialized and passed to the SHNF successfully
+ * - FALSE           - error during marking the memory block openSAFETY frame passing failed
+ */
+BOOLEAN SFS_FrmSerializeSnmtResp(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
+        UINT8 *pb_frame);
+#endif
+
 /**
  * @brief This function provides frame header info and payload data of a received openSAFETY frame.
  *
@@ -166,6 +295,44 @@ BOOLEAN SFS_FrmSerialize(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
 const UINT8 * SFS_FrmDeSerialize(BYTE_B_INSTNUM_ UINT8 *pb_frame,
         UINT16 w_frmLen, EPLS_t_FRM_HDR *ps_hdrInfo);
 
+#if (EPLS_cfg_FRAME_ROUTER == EPLS_k_ENABLE)
+/**
+ * @brief This function checks the length of a received openSAFETY frame and provides its raw header bytes.
+ *
+ * Neither the CRCs nor the header info are checked and the frame is not modified. The header bytes of
+ * sub frame TWO are still encoded with the UDID of the SCM, see SFS_FrmPeekSdn().
+ *
+ * @param        pb_frame           reference to a received openSAFETY frame (not checked, checked in
+ *                    SSC_RouteFrame()) valid range: <> NULL
+ *
+ * @param        w_frmLen           received openSAFETY frame length (checked) valid range:
+ *                    k_MIN_TEL_LEN_SHORT .. k_MAX_TEL_LEN_SHORT k_MIN_TEL_LEN_LONG .. k_MAX_TEL_LEN_LONG
+ *
+ * @retval       pb_hdr             raw header bytes, SFS_k_PEEK_HDR_LEN bytes (not checked, only called with
+ *                    reference to array) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - frame length matches the LE field, header bytes provided
+ * - FALSE            - frame length is invalid
+ */
+BOOLEAN SFS_FrmHdrPeek(const UINT8 *pb_frame, UINT16 w_frmLen, UINT8 *pb_hdr);
+
+/**
+ * @brief This function decodes the SDN of a frame from the raw header bytes with the UDID of the SCM of an instance.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_RouteNextInst()) valid range:
+ *                    0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @param        pb_hdr             raw header bytes provided by SFS_FrmHdrPeek() (not checked, only called
+ *                    with reference to array) valid range: <> NULL
+ *
+ * @return
+ * - == 0x0000        - frame ID of sub frame TWO does not match with the UDID of the SCM of this instance
+ * - <> 0x0000        - SDN of the frame
+ */
+UINT16 SFS_FrmPeekSdn(BYTE_B_INSTNUM_ const UINT8 *pb_hdr);
+#endif
+
 /**
  * @brief This function swaps the data if it is necessary and copies.
  *
@@ -362,4 +362,106 @@ const UINT8 * SFS_FrmDeSerialize(BYTE_B_INSTNUM_ UINT8 *pb_frame,
   return pb_frmData;
 }
 
+#if (EPLS_cfg_FRAME_ROUTER == EPLS_k_ENABLE)
+/**
+ * @brief This function checks the length of a received openSAFETY frame and provides its raw header bytes.
+ *
+ * Neither the CRCs nor the header info are checked and the frame is not modified. The header bytes of
+ * sub frame TWO are still encoded with the UDID of the SCM, see SFS_FrmPeekSdn().
+ *
+ * @param        pb_frame           reference to a received openSAFETY frame (not checked, checked in
+ *                    SSC_RouteFrame()) valid range: <> NULL
+ *
+ * @param        w_frmLen           received openSAFETY frame length (checked) valid range:
+ *                    k_MIN_TEL_LEN_SHORT .. k_MAX_TEL_LEN_SHORT k_MIN_TEL_LEN_LONG .. k_MAX_TEL_LEN_LONG
+ *
+ * @retval       pb_hdr             raw header bytes, SFS_k_PEEK_HDR_LEN bytes (not checked, only called with
+ *                    reference to array) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - frame length matches the LE field, header bytes provided
+ * - FALSE            - frame length is invalid
+ */
+BOOLEAN SFS_FrmHdrPeek(const UINT8 *pb_frame, UINT16 w_frmLen, UINT8 *pb_hdr)
+{
+  BOOLEAN o_return = FALSE;     /* predefined return value */
+  UINT8 b_id1;                  /* frame ID of sub frame ONE */
+  UINT8 b_le;                   /* payload data length */
+  UINT16 w_crcLen;              /* length of one CRC field */
+  UINT16 w_calcFrameLength;     /* frame length calculated from the LE field */
+  const UINT8 *pb_sub2;         /* reference to sub frame TWO */
+
+  /* the LE field is checked before it is used to address sub frame TWO */
+  if (w_frmLen >= k_MIN_TEL_LEN_SHORT)
+  {
+    b_le = pb_frame[k_SFRM1_HDR_LE];
+    b_id1 = (UINT8)(pb_frame[k_SFRM1_HDR_ID] >> 2u);
+
+    w_crcLen = (k_MAX_DATA_LEN_SHORT >= b_le) ? k_CRC_LEN_SHORT : k_CRC_LEN_LONG;
+    w_calcFrameLength = (UINT16)(k_SFRM1_HDR_LEN + k_SFRM2_HDR_LEN +
+                                 (2u * w_crcLen) + b_le);
+    /* payload data twice */
+    if ((k_SERVICE_REQ_FAST != b_id1) && (k_SERVICE_RES_FAST != b_id1))
+    {
+      w_calcFrameLength = (UINT16)(w_calcFrameLength + b_le);
+    }
+    /* no else : payload data only once */
+
+    /* if the frame length matches the LE field */
+    if ((w_frmLen == w_calcFrameLength) && (k_MAX_DATA_LEN >= b_le))
+    {
+      pb_sub2 = &pb_frame[(UINT16)(k_SFRM1_HDR_LEN + b_le + w_crcLen)];
+
+      pb_hdr[0] = pb_frame[k_SFRM1_HDR_ADR];
+      pb_hdr[1] = pb_frame[k_SFRM1_HDR_ID];
+      /* sub frame TWO has at least SFS_k_PEEK_HDR_LEN - 2 bytes (header and CRC) */
+      MEMCOPY(&pb_hdr[2], pb_sub2, SFS_k_PEEK_HDR_LEN - 2u);
+      o_return = TRUE;
+    }
+    /* no else : frame length is invalid */
+  }
+  /* no else : frame is too short */
+
+  SCFM_TACK_PATH();
+  return o_return;
+}
+
+/**
+ * @brief This function decodes the SDN of a frame from the raw header bytes with the UDID of the SCM of an instance.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_RouteNextInst()) valid range:
+ *                    0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @param        pb_hdr             raw header bytes provided by SFS_FrmHdrPeek() (not checked, only called
+ *                    with reference to array) valid range: <> NULL
+ *
+ * @return
+ * - == 0x0000        - frame ID of sub frame TWO does not match with the UDID of the SCM of this instance
+ * - <> 0x0000        - SDN of the frame
+ */
+UINT16 SFS_FrmPeekSdn(BYTE_B_INSTNUM_ const UINT8 *pb_hdr)
+{
+  UINT16 w_sdn = 0x0000u;       /* predefined return value */
+  UINT8 b_id1 = (UINT8)(pb_hdr[1] >> 2u); /* frame ID of sub frame ONE */
+  UINT8 ab_sub2[SFS_k_PEEK_HDR_LEN - 2u]; /* decoded header of sub frame TWO */
+
+  /* the UDID of the SCM is decoded on a copy, the frame is not modified */
+  MEMCOPY(ab_sub2, &pb_hdr[2], SFS_k_PEEK_HDR_LEN - 2u);
+  SFS_ScmUdidCode(B_INSTNUM_ b_id1, ab_sub2);
+
+  /* if the frame IDs of sub frame ONE and TWO match */
+  if ((UINT8)(ab_sub2[k_SFRM2_HDR_ID] >> 2u) == b_id1)
+  {
+    /* SDN = ADR and ID of sub frame TWO XOR ADR of sub frame ONE */
+    w_sdn = (UINT16)((UINT16)((UINT8)((ab_sub2[k_SFRM2_HDR_ID] ^ pb_hdr[1]) &
+                                      k_SDN_HB_MASK_AND)) << 8u);
+    w_sdn = (UINT16)(w_sdn | (UINT8)(ab_sub2[k_SFRM2_HDR_ADR] ^ pb_hdr[0]));
+  }
+  /* no else : frame is not encoded with the UDID of the SCM of this instance */
+
+  SCFM_TACK_PATH();
+  return w_sdn;
+}
+#endif
+
 /** @} */
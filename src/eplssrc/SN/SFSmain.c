@@ -65,6 +65,9 @@ BOOLEAN SFS_Init(BYTE_B_INSTNUM)
   SOD_t_ACCESS s_acsScmUdid; /* SOD access structure for the UDID of the SCM */
   SOD_t_ERROR_RESULT s_errRes; /* SOD error result */
 
+#if (SNMTS_cfg_RESP_CACHE == EPLS_k_ENABLE)
+  SFS_SnmtRespCacheInit(B_INSTNUM);
+#endif
 
   /* get the attribute of the SCM UDID */
   s_acsScmUdid.ps_attr = SOD_AttrGet(B_INSTNUM_ EPLS_k_IDX_COMMON_COM_PARAM,
@@ -81,8 +81,89 @@ static const BOOLEAN ao_LookUpFrmId[k_NUM_OF_POSSIBLE_IDS] =
 */
 #define k_SERVICE_REQ_FAST            0x3Au  /* frame type service req */
 
+/**
+ * References to the sub frames of an openSAFETY frame to be transmitted.
+ *
+ * NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in tx dir. !!!
+ */
+typedef struct
+{
+  UINT8 *pb_subFrm1;      /* reference to sub frame ONE within the openSAFETY frame */
+  UINT8 *pb_subFrm1Crc;   /* pointer to CRC in sub frame ONE */
+  UINT8 *pb_subFrm2Crc;   /* pointer to CRC in sub frame TWO */
+  UINT16 w_subFrm1Len;    /* number of bytes of sub frame ONE */
+  UINT16 w_subFrm2Len;    /* number of bytes of sub frame TWO */
+  UINT16 w_crc1;          /* CRC of sub frame ONE, 8 bit CRC in the low byte */
+  UINT16 w_crc2;          /* CRC of sub frame TWO, 8 bit CRC in the low byte */
+} t_TX_SUB_FRM;
+
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+/* ab_CrcScratch:
+    Zeroed sub frame to calculate the contribution of single CT and TR bits to
+    the CRC of a sub frame. */
+static UINT8 ab_CrcScratch[k_SFRM2_HDR_LEN + SPDO_cfg_MAX_LEN_OF_TX_SPDO]
+  SAFE_NO_INIT_SEKTOR;
+#endif
+
+#if (SNMTS_cfg_RESP_CACHE == EPLS_k_ENABLE)
+/** number of SNMT Slave response types (frame ID 0x29, 0x2B, 0x2D and 0x2F) */
+#define k_NUM_SNMT_RESP       4u
+/** bit of the frame ID which is set for SNMT responses */
+#define k_SNMT_RESP_BIT       0x01u
+/** bits of the frame ID which select the SNMT service */
+#define k_SNMT_SERV_MASK      0x07u
+/** number of header bytes of sub frame ONE and TWO */
+#define k_RESP_HDR_LEN        (k_SFRM1_HDR_LEN + k_SFRM2_HDR_LEN)
+
+/**
+ * @brief Cached SNMT Slave response.
+ *
+ * The header bytes of sub frame ONE are stored before the header bytes of sub frame TWO.
+ * SNMT responses have payload data of 8 bytes or less and use the 8 bit CRC.
+ */
+typedef struct
+{
+  /** TRUE if ab_hdr and the CRCs of the headers are valid */
+  BOOLEAN o_hdrValid;
+  /** TRUE if ab_data and the CRCs of the sub frames are valid */
+  BOOLEAN o_frmValid;
+  /** header bytes of the cached response */
+  UINT8 ab_hdr[k_RESP_HDR_LEN];
+  /** CRC of the header of sub frame ONE */
+  UINT8 b_hdrCrc1;
+  /** CRC of the header of sub frame TWO */
+  UINT8 b_hdrCrc2;
+  /** payload data of the cached response */
+  UINT8 ab_data[k_MAX_DATA_LEN_SHORT];
+  /** CRC of sub frame ONE of the cached response */
+  UINT8 b_crc1;
+  /** CRC of sub frame TWO of the cached response */
+  UINT8 b_crc2;
+} t_RESP_CACHE;
+
+/* aas_RespCache:
+    Last transmitted response of every SNMT Slave response type per instance. */
+static t_RESP_CACHE aas_RespCache[EPLS_cfg_MAX_INSTANCES][k_NUM_SNMT_RESP]
+  SAFE_NO_INIT_SEKTOR;
+#endif
+
 static BOOLEAN checkTxFrameHeader(BYTE_B_INSTNUM_
                                   const EPLS_t_FRM_HDR *ps_frmHdr);
+static void frmAssemble(const EPLS_t_FRM_HDR *ps_hdrInfo, UINT8 *pb_frame,
+                        t_TX_SUB_FRM *ps_subFrm);
+static UINT16 subFrmCrcCalc(const EPLS_t_FRM_HDR *ps_hdrInfo, UINT16 w_len,
+                            const UINT8 *pb_subFrm);
+static void frmCrcSet(const EPLS_t_FRM_HDR *ps_hdrInfo,
+                      const t_TX_SUB_FRM *ps_subFrm);
+static BOOLEAN frmTransmit(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
+                           UINT8 *pb_frame);
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+static void txCrcDeltaInit(const EPLS_t_FRM_HDR *ps_hdrInfo,
+                           SFS_t_TX_CRC_CACHE *ps_crcCache);
+static UINT16 txCrcDeltaAdd(UINT16 w_crc, UINT8 b_change,
+                            const UINT16 *pw_delta);
+#endif
+
 /**
  * @brief This function builds an openSAFETY frame and provides it to the HNF, which is in charge of transmission.
  *
@@ -116,197 +197,608 @@ BOOLEAN SFS_FrmSerialize(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
                          UINT8 *pb_frame)
 {
   BOOLEAN o_return = FALSE;     /* predefined return value */
-  UINT8 b_subFrm1Id = 0u;       /* variable to build the value of the ID field
-                                   in sub frame 1 */
-  UINT8 b_subFrm2Id = 0u;       /* variable to build the value of the ID field
-                                   in sub frame 2 */
-  UINT8 b_subFrm2Adr = 0u;      /* variable to build the value of ADR field */
-  UINT8 b_subFrm2Tr = 0u;       /* variable to build the value of TR field */
+  t_TX_SUB_FRM s_subFrm;        /* references to the sub frames */
 
-  UINT8 b_calcCrc1Short = 0u;   /* calculated 8 bit CRC, provided by SHNF */
-  UINT8 b_calcCrc2Short = 0u;   /* calculated 8 bit CRC, provided by SHNF */
-  UINT16 w_calcCrc1Long = 0u;   /* calculated 16 bit CRC, provided by SHNF */
-  UINT16 w_calcCrc2Long = 0u;   /* calculated 16 bit CRC, provided by SHNF */
+  /* if the header info provided by the calling function is correct */
+  if(checkTxFrameHeader(B_INSTNUM_ ps_hdrInfo))
+  {
+    frmAssemble(ps_hdrInfo, pb_frame, &s_subFrm);
 
-  UINT16 w_subFrm1Len = 0u;     /* number of bytes of sub frame ONE */
-  UINT16 w_subFrm2Len = 0u;     /* number of bytes of sub frame ONE */
-  UINT8 *pb_subFrm1Crc = 0u;    /* pointer to CRC in sub frame ONE */
-  UINT8 *pb_subFrm2Crc = 0u;    /* pointer to CRC in sub frame TWO */
+    /* get CRC as reference for sub frame TWO/ONE from unit SHNF */
+    s_subFrm.w_crc1 = subFrmCrcCalc(ps_hdrInfo, s_subFrm.w_subFrm1Len,
+                                    s_subFrm.pb_subFrm1);
+    s_subFrm.w_crc2 = subFrmCrcCalc(ps_hdrInfo, s_subFrm.w_subFrm2Len,
+                                    pb_frame);
+    frmCrcSet(ps_hdrInfo, &s_subFrm);
 
-  /* reference to sub frame ONE within received openSAFETY frame
-     NOTE:
-     sub frame ONE and TWO are twisted within the openSAFETY frame in tx dir. !!! */
-  UINT8 *pb_subFrm1 = (UINT8 *)NULL;
+    o_return = frmTransmit(B_INSTNUM_ ps_hdrInfo, pb_frame);
+  }
+  /* else the header info provided by the calling function is incorrect */
+  SCFM_TACK_PATH();
+  return o_return;
+}
 
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+/**
+ * @brief This function invalidates the cached CRC state of a Tx SPDO.
+ *
+ * @param        ps_crcCache       reference to the cached CRC state (not checked, only called with reference to
+ *                    struct), valid range: <> NULL
+ */
+void SFS_TxCrcCacheInit(SFS_t_TX_CRC_CACHE *ps_crcCache)
+{
+  ps_crcCache->o_frmValid = FALSE;
+  ps_crcCache->o_deltaValid = FALSE;
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function builds an openSAFETY frame like SFS_FrmSerialize() and uses the cached CRC state of the Tx SPDO.
+ *
+ * If the constant header bytes and the payload data are the same as in the cached frame then the CRCs are
+ * updated by the contributions of the changed CT and TR bits only. Otherwise the CRCs are calculated over
+ * the whole sub frames and the frame is stored in the cache.
+ *
+ * @see          SFS_FrmSerialize()
+ *
+ * @param        b_instNum         instance number (not checked, checked in SPDO_BuildTxSpdo() or
+ *                    SPDO_ProcessRxSpdo()) valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @param        ps_hdrInfo        reference to header info (not checked, only called with reference to struct),
+ *                    valid range: <> NULL
+ *
+ * @param        pb_frame          reference to an openSAFETY frame (not checked, checked in SendTxSpdo()),
+ *                    valid range: <> NULL
+ *
+ * @param        ps_crcCache       reference to the cached CRC state of the Tx SPDO (not checked, only called with
+ *                    reference to struct), valid range: <> NULL
+ *
+ * @return
+ * - TRUE            - openSAFETY frame serialized and passed to the SHNF successfully
+ * - FALSE           - error during marking the memory block openSAFETY frame passing failed
+ */
+BOOLEAN SFS_FrmSerializeCached(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
+                               UINT8 *pb_frame, SFS_t_TX_CRC_CACHE *ps_crcCache)
+{
+  BOOLEAN o_return = FALSE;     /* predefined return value */
+  t_TX_SUB_FRM s_subFrm;        /* references to the sub frames */
+  /* header bytes which have to be the same as in the cached frame */
+  UINT8 ab_constHdr[SFS_k_TX_CRC_CONST_HDR_LEN];
 
   /* if the header info provided by the calling function is correct */
   if(checkTxFrameHeader(B_INSTNUM_ ps_hdrInfo))
   {
-    /* Build 8 bit value of openSAFETY frame ID field in sub frame ONE */
-    b_subFrm1Id = ps_hdrInfo->b_id;                            /* 00XX|XXXX */
-    b_subFrm1Id = (UINT8)(b_subFrm1Id << 2u);                  /* XXXX|XX00 */
-    b_subFrm1Id = (UINT8)(b_subFrm1Id |
-                  (HIGH8(ps_hdrInfo->w_adr) & k_ADR_MASK_AND)); /* XXXX|XXYY */
-
-    /* Build 8 bit value of openSAFETY frame ADR field in sub frame TWO */
-    b_subFrm2Adr = LOW8(ps_hdrInfo->w_adr);
-    b_subFrm2Adr = (UINT8)(b_subFrm2Adr ^ LOW8(ps_hdrInfo->w_sdn));
-
-    /* Build 8 bit value of openSAFETY frame ID field in sub frame TWO,
-    *     ID field = 6bit frame ID, ((2bit sadr) XOR (2bit domain number))
-    *
-    *       HIGH8(w_sdn) : SSSS|SSZZ
-    * AND  k_ID_MASK_AND : 0000|0011
-    * -------------------> 0000|00ZZ
-    * XOR    b_subFrm1Id : XXXX|XXYY
-    * -------------------> XXXX|XXQQ   ( Q = Y xor Z )
-    */
-    b_subFrm2Id  = (UINT8)(b_subFrm1Id ^
-                    (HIGH8(ps_hdrInfo->w_sdn) & k_SDN_HB_MASK_AND));
-
-    /* Build 8 bit value of openSAFETY frame TR field in sub frame TWO */
-    b_subFrm2Tr = ps_hdrInfo->b_tr;                            /* 00XX|XXXX */
-    b_subFrm2Tr = (UINT8)(b_subFrm2Tr << 2u);                  /* XXXX|XX00 */
-    b_subFrm2Tr = (UINT8)(b_subFrm2Tr | (HIGH8(ps_hdrInfo->w_tadr)
-                    & k_TADR_MASK_AND));                        /* XXXX|XXYY */
-
-    /* check if payload data is doubled */
-    if ( k_SERVICE_REQ_FAST == (ps_hdrInfo->b_id & k_SERVICE_REQ_FAST))
+    frmAssemble(ps_hdrInfo, pb_frame, &s_subFrm);
+
+    /* if the frame can not be cached (slim frame or payload too long) */
+    if ((k_SERVICE_REQ_FAST == (ps_hdrInfo->b_id & k_SERVICE_REQ_FAST)) ||
+        (ps_hdrInfo->b_le > (UINT8)SPDO_cfg_MAX_LEN_OF_TX_SPDO))
     {
-      /* no double payload data */
-        /* if payload data length is larger than 8 bytes, 2 byte CRC is used */
-        if(ps_hdrInfo->b_le > k_MAX_DATA_LEN_SHORT)
-        {
-          /* calculate reference to start of sub frame ONE header (2 byte CRC)
-              NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in
-                    tx dir. !!! */
-          pb_subFrm1 =
-            &pb_frame[(k_SFRM2_HDR_LEN + k_CRC_LEN_LONG)];
-        }
-        else  /* payload data length is 8 byte or less and 1 byte CRC is used */
-        {
-          /* calculate reference to start of sub frame ONE header (1 byte CRC)
-              NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in
-                    tx dir. !!! */
-          pb_subFrm1 =
-            &pb_frame[(k_SFRM2_HDR_LEN + k_CRC_LEN_SHORT)];
-        }
-        /* calculate length of sub frames and
-            calculate reference to CRC field of sub frames TWO and sub frame ONE */
-        w_subFrm1Len  = (UINT16)(k_SFRM1_HDR_LEN + ps_hdrInfo->b_le);
-        w_subFrm2Len  = (UINT16)(k_SFRM2_HDR_LEN);
-    
-        pb_subFrm1Crc = &pb_subFrm1[k_SFRM1_DATA + ps_hdrInfo->b_le];
-        pb_subFrm2Crc = &pb_frame[k_SFRM2_DATA];
+      s_subFrm.w_crc1 = subFrmCrcCalc(ps_hdrInfo, s_subFrm.w_subFrm1Len,
+                                      s_subFrm.pb_subFrm1);
+      s_subFrm.w_crc2 = subFrmCrcCalc(ps_hdrInfo, s_subFrm.w_subFrm2Len,
+                                      pb_frame);
     }
     else
     {
-        /* if payload data length is larger than 8 bytes, 2 byte CRC is used */
-        if(ps_hdrInfo->b_le > k_MAX_DATA_LEN_SHORT)
-        {
-          /* calculate reference to start of sub frame ONE header (2 byte CRC)
-              NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in
-                    tx dir. !!! */
-          pb_subFrm1 =
-            &pb_frame[(k_SFRM2_HDR_LEN + ps_hdrInfo->b_le + k_CRC_LEN_LONG)];
-        }
-        else  /* payload data length is 8 byte or less and 1 byte CRC is used */
+      ab_constHdr[0] = s_subFrm.pb_subFrm1[k_SFRM1_HDR_ADR];
+      ab_constHdr[1] = s_subFrm.pb_subFrm1[k_SFRM1_HDR_ID];
+      ab_constHdr[2] = s_subFrm.pb_subFrm1[k_SFRM1_HDR_LE];
+      ab_constHdr[3] = pb_frame[k_SFRM2_HDR_ADR];
+      ab_constHdr[4] = pb_frame[k_SFRM2_HDR_ID];
+      ab_constHdr[5] = pb_frame[k_SFRM2_HDR_TADR];
+
+      /* if only CT and TR differ from the cached frame */
+      if ((ps_crcCache->o_frmValid) &&
+          (MEMCMP_IDENT == MEMCOMP(ab_constHdr, ps_crcCache->ab_constHdr,
+                                   SFS_k_TX_CRC_CONST_HDR_LEN)) &&
+          (MEMCMP_IDENT == MEMCOMP(&pb_frame[k_SFRM2_DATA],
+                                   ps_crcCache->ab_data, ps_hdrInfo->b_le)))
+      {
+        /* the CRCs are updated by the contributions of the changed bits */
+        s_subFrm.w_crc1 = txCrcDeltaAdd(ps_crcCache->w_crc1,
+            (UINT8)(s_subFrm.pb_subFrm1[k_SFRM1_HDR_CT] ^ ps_crcCache->b_ct1),
+            ps_crcCache->aw_ct1Delta);
+        s_subFrm.w_crc2 = txCrcDeltaAdd(ps_crcCache->w_crc2,
+            (UINT8)(pb_frame[k_SFRM2_HDR_CT] ^ ps_crcCache->b_ct2),
+            ps_crcCache->aw_ct2Delta);
+        s_subFrm.w_crc2 = txCrcDeltaAdd(s_subFrm.w_crc2,
+            (UINT8)(pb_frame[k_SFRM2_HDR_TR] ^ ps_crcCache->b_tr),
+            ps_crcCache->aw_trDelta);
+      }
+      else  /* header or payload changed, CRC over the whole sub frames */
+      {
+        s_subFrm.w_crc1 = subFrmCrcCalc(ps_hdrInfo, s_subFrm.w_subFrm1Len,
+                                        s_subFrm.pb_subFrm1);
+        s_subFrm.w_crc2 = subFrmCrcCalc(ps_hdrInfo, s_subFrm.w_subFrm2Len,
+                                        pb_frame);
+
+        /* if the bit contributions are not available for this payload length */
+        if ((!ps_crcCache->o_deltaValid) ||
+            (ps_crcCache->b_deltaLe != ps_hdrInfo->b_le))
         {
-          /* calculate reference to start of sub frame ONE header (1 byte CRC)
-              NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in
-                    tx dir. !!! */
-          pb_subFrm1 =
-            &pb_frame[(k_SFRM2_HDR_LEN + ps_hdrInfo->b_le + k_CRC_LEN_SHORT)];
+          txCrcDeltaInit(ps_hdrInfo, ps_crcCache);
         }
-        /* calculate length of sub frames and
-            calculate reference to CRC field of sub frames TWO and sub frame ONE */
-        w_subFrm1Len  = (UINT16)(k_SFRM1_HDR_LEN + ps_hdrInfo->b_le);
-        w_subFrm2Len  = (UINT16)(k_SFRM2_HDR_LEN + ps_hdrInfo->b_le);
-    
-        pb_subFrm1Crc = &pb_subFrm1[k_SFRM1_DATA + ps_hdrInfo->b_le];
-        pb_subFrm2Crc = &pb_frame[k_SFRM2_DATA + ps_hdrInfo->b_le];
+        /* no else : bit contributions are valid */
+
+        (void)MEMCOPY(ps_crcCache->ab_constHdr, ab_constHdr,
+                      SFS_k_TX_CRC_CONST_HDR_LEN);
+        (void)MEMCOPY(ps_crcCache->ab_data, &pb_frame[k_SFRM2_DATA],
+                      ps_hdrInfo->b_le);
+        ps_crcCache->o_frmValid = TRUE;
+      }
+
+      /* the frame is the reference for the next one */
+      ps_crcCache->b_ct1 = s_subFrm.pb_subFrm1[k_SFRM1_HDR_CT];
+      ps_crcCache->b_ct2 = pb_frame[k_SFRM2_HDR_CT];
+      ps_crcCache->b_tr = pb_frame[k_SFRM2_HDR_TR];
+      ps_crcCache->w_crc1 = s_subFrm.w_crc1;
+      ps_crcCache->w_crc2 = s_subFrm.w_crc2;
     }
+    frmCrcSet(ps_hdrInfo, &s_subFrm);
 
-    /* copy payload data from sub frame TWO into sub frame ONE */
-    /*lint -save -e119 -e746 -i830: the prototype is not really missing but there is a problem with the
-     * standard lib*/
-    (void)MEMMOVE(&pb_subFrm1[k_SFRM1_DATA], &pb_frame[k_SFRM2_DATA],
-            (UINT32)ps_hdrInfo->b_le);
-    /*lint -restore */
-
-    /* fill header bytes and data bytes of sub frame ONE into the memory
-        block of serialized openSAFETY frame. */
-    SFS_NET_CPY8(&(pb_subFrm1[k_SFRM1_HDR_ADR]),&LOW8(ps_hdrInfo->w_adr));
-    SFS_NET_CPY8(&(pb_subFrm1[k_SFRM1_HDR_ID]), &b_subFrm1Id);
-    SFS_NET_CPY8(&(pb_subFrm1[k_SFRM1_HDR_LE]), &ps_hdrInfo->b_le);
-    SFS_NET_CPY8(&(pb_subFrm1[k_SFRM1_HDR_CT]), &LOW8(ps_hdrInfo->w_ct));
-
-    /* fill header bytes and data bytes of sub frame TWO into the memory
-        block of serialized openSAFETY frame. */
-    SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_ADR]), &b_subFrm2Adr);
-    SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_ID]), &b_subFrm2Id);
-    SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_CT]), &(HIGH8(ps_hdrInfo->w_ct)));
-    SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_TADR]), &(LOW8(ps_hdrInfo->w_tadr)));
-    SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_TR]), &b_subFrm2Tr);
-
-    /* NOTE: payload data is already written into sub frame TWO
-        by the calling function and for special frame types already overwritten */
-
-
-    /* if payload data length is larger than 8 bytes */
-    if(ps_hdrInfo->b_le > k_MAX_DATA_LEN_SHORT)
-    {
-        if ( k_SERVICE_REQ_FAST == (ps_hdrInfo->b_id & k_SERVICE_REQ_FAST))
-        {
-   		 /* get 16 bit CRC as reference for sub frame TWO/ONE from unit SHNF */
-   		  w_calcCrc1Long = SHNF_Crc16CalcSlim(0U, (INT32)w_subFrm1Len,
-   											   (void *)pb_subFrm1);
-   		  w_calcCrc2Long = SHNF_Crc16CalcSlim(0U, (INT32)w_subFrm2Len,
-   											   (void *)pb_frame);
-        }
-        else
-        {
-		 /* get 16 bit CRC as reference for sub frame TWO/ONE from unit SHNF */
-		  w_calcCrc1Long = SHNF_Crc16Calc(0U, (INT32)w_subFrm1Len,
-											   (void *)pb_subFrm1);
-		  w_calcCrc2Long = SHNF_Crc16Calc(0U, (INT32)w_subFrm2Len,
-											   (void *)pb_frame);
-        }
+    o_return = frmTransmit(B_INSTNUM_ ps_hdrInfo, pb_frame);
+  }
+  /* else the header info provided by the calling function is incorrect */
+  SCFM_TACK_PATH();
+  return o_return;
+}
+#endif
+
+#if (SNMTS_cfg_RESP_CACHE == EPLS_k_ENABLE)
+/**
+ * @brief This function invalidates the cached SNMT Slave responses of an instance.
+ *
+ * @param        b_instNum         instance number (not checked, checked in SSC_InitAll()) valid range:
+ *                    0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ */
+void SFS_SnmtRespCacheInit(BYTE_B_INSTNUM)
+{
+  UINT8 b_resp;                 /* loop counter */
+
+  for (b_resp = 0u; b_resp < k_NUM_SNMT_RESP; b_resp++)
+  {
+    aas_RespCache[B_INSTNUMidx][b_resp].o_hdrValid = FALSE;
+    aas_RespCache[B_INSTNUMidx][b_resp].o_frmValid = FALSE;
+  }
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function builds an openSAFETY frame like SFS_FrmSerialize() and uses the cached SNMT Slave response
+ * of the same type.
+ *
+ * The CRC is continued over the payload data, starting with the cached CRCs of the headers, if the header bytes
+ * are the same as in the cached response. If also the payload data is the same, e.g. for the response to the
+ * node guarding, the cached CRCs are used. Frames which are no SNMT Slave responses are not cached.
+ *
+ * @see          SFS_FrmSerialize()
+ *
+ * @param        b_instNum         instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range:
+ *                    0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @param        ps_hdrInfo        reference to header info (not checked, only called with reference to struct),
+ *                    valid range: <> NULL
+ *
+ * @param        pb_frame          reference to an openSAFETY frame (not checked, checked in
+ *                    SNMTS_TxRespRstGuardScm() or processStateSer()), valid range: <> NULL
+ *
+ * @return
+ * - TRUE            - openSAFETY frame serialized and passed to the SHNF successfully
+ * - FALSE           - error during marking the memory block openSAFETY frame passing failed
+ */
+BOOLEAN SFS_FrmSerializeSnmtResp(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
+                                 UINT8 *pb_frame)
+{
+  BOOLEAN o_return = FALSE;     /* predefined return value */
+  t_TX_SUB_FRM s_subFrm;        /* references to the sub frames */
+  t_RESP_CACHE *ps_cache = (t_RESP_CACHE *)NULL; /* cached response */
+  UINT8 ab_hdr[k_RESP_HDR_LEN]; /* header bytes of both sub frames */
+
+  /* if the header info provided by the calling function is correct */
+  if(checkTxFrameHeader(B_INSTNUM_ ps_hdrInfo))
+  {
+    frmAssemble(ps_hdrInfo, pb_frame, &s_subFrm);
 
-      SFS_NET_CPY16(pb_subFrm1Crc, &w_calcCrc1Long);
-      SFS_NET_CPY16(pb_subFrm2Crc, &w_calcCrc2Long);
+    /* if the frame is no SNMT response with 8 bit CRC */
+    if (((ps_hdrInfo->b_id & k_FRAME_ID_MASK) != k_SNMT_FRAME_ID) ||
+        ((ps_hdrInfo->b_id & k_SNMT_RESP_BIT) == 0u) ||
+        (ps_hdrInfo->b_le > k_MAX_DATA_LEN_SHORT))
+    {
+      s_subFrm.w_crc1 = subFrmCrcCalc(ps_hdrInfo, s_subFrm.w_subFrm1Len,
+                                      s_subFrm.pb_subFrm1);
+      s_subFrm.w_crc2 = subFrmCrcCalc(ps_hdrInfo, s_subFrm.w_subFrm2Len,
+                                      pb_frame);
     }
-    else  /* payload data length is 8 byte or less */
+    else
     {
-      /* get 8 bit CRC as reference for sub frame TWO/ONE from unit SHNF */
-      b_calcCrc1Short = SHNF_Crc8Calc(0U, (INT32)w_subFrm1Len,
-                                           (void *)pb_subFrm1);
-      b_calcCrc2Short = SHNF_Crc8Calc(0U, (INT32)w_subFrm2Len,
-                                           (void *)pb_frame);
-      SFS_NET_CPY8(pb_subFrm1Crc, &b_calcCrc1Short);
-      SFS_NET_CPY8(pb_subFrm2Crc, &b_calcCrc2Short);
+      ps_cache = &aas_RespCache[B_INSTNUMidx]
+          [(ps_hdrInfo->b_id & k_SNMT_SERV_MASK) >> 1u];
+
+      (void)MEMCOPY(ab_hdr, s_subFrm.pb_subFrm1, (UINT32)k_SFRM1_HDR_LEN);
+      (void)MEMCOPY(&ab_hdr[k_SFRM1_HDR_LEN], pb_frame,
+                    (UINT32)k_SFRM2_HDR_LEN);
+
+      /* if the header bytes differ from the cached response */
+      if ((!ps_cache->o_hdrValid) ||
+          (MEMCMP_IDENT != MEMCOMP(ab_hdr, ps_cache->ab_hdr, k_RESP_HDR_LEN)))
+      {
+        ps_cache->b_hdrCrc1 = SHNF_Crc8Calc(0U, (INT32)k_SFRM1_HDR_LEN,
+                                            (const void *)s_subFrm.pb_subFrm1);
+        ps_cache->b_hdrCrc2 = SHNF_Crc8Calc(0U, (INT32)k_SFRM2_HDR_LEN,
+                                            (const void *)pb_frame);
+        (void)MEMCOPY(ps_cache->ab_hdr, ab_hdr, k_RESP_HDR_LEN);
+        ps_cache->o_hdrValid = TRUE;
+        ps_cache->o_frmValid = FALSE;
+      }
+      /* no else : CRCs of the headers are valid */
+
+      /* if the payload data differs from the cached response */
+      if ((!ps_cache->o_frmValid) ||
+          (MEMCMP_IDENT != MEMCOMP(&pb_frame[k_SFRM2_DATA], ps_cache->ab_data,
+                                   ps_hdrInfo->b_le)))
+      {
+        /* the CRCs are continued over the payload data */
+        ps_cache->b_crc1 = SHNF_Crc8Calc(ps_cache->b_hdrCrc1,
+            (INT32)ps_hdrInfo->b_le,
+            (const void *)&s_subFrm.pb_subFrm1[k_SFRM1_DATA]);
+        ps_cache->b_crc2 = SHNF_Crc8Calc(ps_cache->b_hdrCrc2,
+            (INT32)ps_hdrInfo->b_le,
+            (const void *)&pb_frame[k_SFRM2_DATA]);
+        (void)MEMCOPY(ps_cache->ab_data, &pb_frame[k_SFRM2_DATA],
+                      ps_hdrInfo->b_le);
+        ps_cache->o_frmValid = TRUE;
+      }
+      /* no else : the response is the same as the cached one */
+
+      s_subFrm.w_crc1 = (UINT16)ps_cache->b_crc1;
+      s_subFrm.w_crc2 = (UINT16)ps_cache->b_crc2;
     }
+    frmCrcSet(ps_hdrInfo, &s_subFrm);
 
-    /* the UDID of the SCM encoding */
-    SFS_ScmUdidCode(B_INSTNUM_ ps_hdrInfo->b_id, pb_frame);
+    o_return = frmTransmit(B_INSTNUM_ ps_hdrInfo, pb_frame);
+  }
+  /* else the header info provided by the calling function is incorrect */
+  SCFM_TACK_PATH();
+  return o_return;
+}
+#endif
+
+/**
+ * @brief This function puts the header info and the payload data into sub frame ONE and TWO.
+ *
+ * The CRC fields are not written.
+ *
+ * @param        ps_hdrInfo        reference to header info (not checked, checked in checkTxFrameHeader()),
+ *                    valid range: <> NULL
+ *
+ * @param        pb_frame          reference to an openSAFETY frame (payload data is already stored in sub frame
+ *                    TWO) (not checked, checked in SFS_FrmSerialize()), valid range: <> NULL
+ *
+ * @retval       ps_subFrm         references to the sub frames (not checked, only called with reference to
+ *                    struct), valid range: <> NULL
+ */
+static void frmAssemble(const EPLS_t_FRM_HDR *ps_hdrInfo, UINT8 *pb_frame,
+                        t_TX_SUB_FRM *ps_subFrm)
+{
+  UINT8 b_subFrm1Id = 0u;       /* variable to build the value of the ID field
+                                   in sub frame 1 */
+  UINT8 b_subFrm2Id = 0u;       /* variable to build the value of the ID field
+                                   in sub frame 2 */
+  UINT8 b_subFrm2Adr = 0u;      /* variable to build the value of ADR field */
+  UINT8 b_subFrm2Tr = 0u;       /* variable to build the value of TR field */
+  UINT8 *pb_subFrm1 = (UINT8 *)NULL; /* reference to sub frame ONE */
+
+  /* Build 8 bit value of openSAFETY frame ID field in sub frame ONE */
+  b_subFrm1Id = ps_hdrInfo->b_id;                            /* 00XX|XXXX */
+  b_subFrm1Id = (UINT8)(b_subFrm1Id << 2u);                  /* XXXX|XX00 */
+  b_subFrm1Id = (UINT8)(b_subFrm1Id |
+                (HIGH8(ps_hdrInfo->w_adr) & k_ADR_MASK_AND)); /* XXXX|XXYY */
+
+  /* Build 8 bit value of openSAFETY frame ADR field in sub frame TWO */
+  b_subFrm2Adr = LOW8(ps_hdrInfo->w_adr);
+  b_subFrm2Adr = (UINT8)(b_subFrm2Adr ^ LOW8(ps_hdrInfo->w_sdn));
+
+  /* Build 8 bit value of openSAFETY frame ID field in sub frame TWO,
+  *     ID field = 6bit frame ID, ((2bit sadr) XOR (2bit domain number))
+  *
+  *       HIGH8(w_sdn) : SSSS|SSZZ
+  * AND  k_ID_MASK_AND : 0000|0011
+  * -------------------> 0000|00ZZ
+  * XOR    b_subFrm1Id : XXXX|XXYY
+  * -------------------> XXXX|XXQQ   ( Q = Y xor Z )
+  */
+  b_subFrm2Id  = (UINT8)(b_subFrm1Id ^
+                  (HIGH8(ps_hdrInfo->w_sdn) & k_SDN_HB_MASK_AND));
+
+  /* Build 8 bit value of openSAFETY frame TR field in sub frame TWO */
+  b_subFrm2Tr = ps_hdrInfo->b_tr;                            /* 00XX|XXXX */
+  b_subFrm2Tr = (UINT8)(b_subFrm2Tr << 2u);                  /* XXXX|XX00 */
+  b_subFrm2Tr = (UINT8)(b_subFrm2Tr | (HIGH8(ps_hdrInfo->w_tadr)
+                  & k_TADR_MASK_AND));                        /* XXXX|XXYY */
+
+  /* check if payload data is doubled */
+  if ( k_SERVICE_REQ_FAST == (ps_hdrInfo->b_id & k_SERVICE_REQ_FAST))
+  {
+    /* no double payload data */
+      /* if payload data length is larger than 8 bytes, 2 byte CRC is used */
+      if(ps_hdrInfo->b_le > k_MAX_DATA_LEN_SHORT)
+      {
+        /* calculate reference to start of sub frame ONE header (2 byte CRC)
+            NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in
+                  tx dir. !!! */
+        pb_subFrm1 =
+          &pb_frame[(k_SFRM2_HDR_LEN + k_CRC_LEN_LONG)];
+      }
+      else  /* payload data length is 8 byte or less and 1 byte CRC is used */
+      {
+        /* calculate reference to start of sub frame ONE header (1 byte CRC)
+            NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in
+                  tx dir. !!! */
+        pb_subFrm1 =
+          &pb_frame[(k_SFRM2_HDR_LEN + k_CRC_LEN_SHORT)];
+      }
+      /* calculate length of sub frames and
+          calculate reference to CRC field of sub frames TWO and sub frame ONE */
+      ps_subFrm->w_subFrm1Len  = (UINT16)(k_SFRM1_HDR_LEN + ps_hdrInfo->b_le);
+      ps_subFrm->w_subFrm2Len  = (UINT16)(k_SFRM2_HDR_LEN);
+
+      ps_subFrm->pb_subFrm1Crc = &pb_subFrm1[k_SFRM1_DATA + ps_hdrInfo->b_le];
+      ps_subFrm->pb_subFrm2Crc = &pb_frame[k_SFRM2_DATA];
+  }
+  else
+  {
+      /* if payload data length is larger than 8 bytes, 2 byte CRC is used */
+      if(ps_hdrInfo->b_le > k_MAX_DATA_LEN_SHORT)
+      {
+        /* calculate reference to start of sub frame ONE header (2 byte CRC)
+            NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in
+                  tx dir. !!! */
+        pb_subFrm1 =
+          &pb_frame[(k_SFRM2_HDR_LEN + ps_hdrInfo->b_le + k_CRC_LEN_LONG)];
+      }
+      else  /* payload data length is 8 byte or less and 1 byte CRC is used */
+      {
+        /* calculate reference to start of sub frame ONE header (1 byte CRC)
+            NOTE: sub frame ONE and TWO are twisted within the openSAFETY frame in
+                  tx dir. !!! */
+        pb_subFrm1 =
+          &pb_frame[(k_SFRM2_HDR_LEN + ps_hdrInfo->b_le + k_CRC_LEN_SHORT)];
+      }
+      /* calculate length of sub frames and
+          calculate reference to CRC field of sub frames TWO and sub frame ONE */
+      ps_subFrm->w_subFrm1Len  = (UINT16)(k_SFRM1_HDR_LEN + ps_hdrInfo->b_le);
+      ps_subFrm->w_subFrm2Len  = (UINT16)(k_SFRM2_HDR_LEN + ps_hdrInfo->b_le);
+
+      ps_subFrm->pb_subFrm1Crc = &pb_subFrm1[k_SFRM1_DATA + ps_hdrInfo->b_le];
+      ps_subFrm->pb_subFrm2Crc = &pb_frame[k_SFRM2_DATA + ps_hdrInfo->b_le];
+  }
+  ps_subFrm->pb_subFrm1 = pb_subFrm1;
+
+  /* copy payload data from sub frame TWO into sub frame ONE */
+  /*lint -save -e119 -e746 -i830: the prototype is not really missing but there is a problem with the
+   * standard lib*/
+  (void)MEMMOVE(&pb_subFrm1[k_SFRM1_DATA], &pb_frame[k_SFRM2_DATA],
+          (UINT32)ps_hdrInfo->b_le);
+  /*lint -restore */
+
+  /* fill header bytes and data bytes of sub frame ONE into the memory
+      block of serialized openSAFETY frame. */
+  SFS_NET_CPY8(&(pb_subFrm1[k_SFRM1_HDR_ADR]),&LOW8(ps_hdrInfo->w_adr));
+  SFS_NET_CPY8(&(pb_subFrm1[k_SFRM1_HDR_ID]), &b_subFrm1Id);
+  SFS_NET_CPY8(&(pb_subFrm1[k_SFRM1_HDR_LE]), &ps_hdrInfo->b_le);
+  SFS_NET_CPY8(&(pb_subFrm1[k_SFRM1_HDR_CT]), &LOW8(ps_hdrInfo->w_ct));
+
+  /* fill header bytes and data bytes of sub frame TWO into the memory
+      block of serialized openSAFETY frame. */
+  SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_ADR]), &b_subFrm2Adr);
+  SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_ID]), &b_subFrm2Id);
+  SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_CT]), &(HIGH8(ps_hdrInfo->w_ct)));
+  SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_TADR]), &(LOW8(ps_hdrInfo->w_tadr)));
+  SFS_NET_CPY8(&(pb_frame[k_SFRM2_HDR_TR]), &b_subFrm2Tr);
 
-    /* if openSAFETY frame cannot be passed to SHNF */
-    if(!(SHNF_MarkTxMemBlock(B_INSTNUM_ pb_frame)))
+  /* NOTE: payload data is already written into sub frame TWO
+      by the calling function and for special frame types already overwritten */
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function calculates the CRC of a sub frame by the SHNF.
+ *
+ * @param        ps_hdrInfo        reference to header info, selects the CRC (not checked, checked in
+ *                    checkTxFrameHeader()), valid range: <> NULL
+ *
+ * @param        w_len             number of bytes of the sub frame (not checked, calculated in frmAssemble()),
+ *                    valid range: any 16 bit value
+ *
+ * @param        pb_subFrm         reference to the sub frame (not checked, only called with reference to
+ *                    sub frame), valid range: <> NULL
+ *
+ * @return       CRC of the sub frame, 8 bit CRC in the low byte
+ */
+static UINT16 subFrmCrcCalc(const EPLS_t_FRM_HDR *ps_hdrInfo, UINT16 w_len,
+                            const UINT8 *pb_subFrm)
+{
+  UINT16 w_crc = 0u;            /* calculated CRC, provided by SHNF */
+
+  /* if payload data length is larger than 8 bytes */
+  if(ps_hdrInfo->b_le > k_MAX_DATA_LEN_SHORT)
+  {
+    if ( k_SERVICE_REQ_FAST == (ps_hdrInfo->b_id & k_SERVICE_REQ_FAST))
     {
-      /* error: SHNF cannot mark openSAFETY frame as "ready to process" */
-      SERR_SetError(B_INSTNUM_ SFS_k_ERR_SHNF_CANNOT_MARK_MEM_BLK,
-                    SERR_k_NO_ADD_INFO);
+      /* get 16 bit CRC as reference for the sub frame from unit SHNF */
+      w_crc = SHNF_Crc16CalcSlim(0U, (INT32)w_len, (const void *)pb_subFrm);
     }
-    else  /* openSAFETY frame processed successfully from SHNF */
+    else
     {
-      o_return = TRUE;
+      /* get 16 bit CRC as reference for the sub frame from unit SHNF */
+      w_crc = SHNF_Crc16Calc(0U, (INT32)w_len, (const void *)pb_subFrm);
     }
   }
-  /* else the header info provided by the calling function is incorrect */
+  else  /* payload data length is 8 byte or less */
+  {
+    /* get 8 bit CRC as reference for the sub frame from unit SHNF */
+    w_crc = (UINT16)SHNF_Crc8Calc(0U, (INT32)w_len, (const void *)pb_subFrm);
+  }
+  SCFM_TACK_PATH();
+  return w_crc;
+}
+
+/**
+ * @brief This function writes the CRCs into sub frame ONE and TWO.
+ *
+ * @param        ps_hdrInfo        reference to header info (not checked, checked in checkTxFrameHeader()),
+ *                    valid range: <> NULL
+ *
+ * @param        ps_subFrm         references to the sub frames and their CRCs (not checked, only called with
+ *                    reference to struct), valid range: <> NULL
+ */
+static void frmCrcSet(const EPLS_t_FRM_HDR *ps_hdrInfo,
+                      const t_TX_SUB_FRM *ps_subFrm)
+{
+  UINT16 w_calcCrc1Long = ps_subFrm->w_crc1;          /* 16 bit CRC sub frame ONE */
+  UINT16 w_calcCrc2Long = ps_subFrm->w_crc2;          /* 16 bit CRC sub frame TWO */
+  UINT8 b_calcCrc1Short = (UINT8)ps_subFrm->w_crc1;   /* 8 bit CRC sub frame ONE */
+  UINT8 b_calcCrc2Short = (UINT8)ps_subFrm->w_crc2;   /* 8 bit CRC sub frame TWO */
+
+  /* if payload data length is larger than 8 bytes */
+  if(ps_hdrInfo->b_le > k_MAX_DATA_LEN_SHORT)
+  {
+    SFS_NET_CPY16(ps_subFrm->pb_subFrm1Crc, &w_calcCrc1Long);
+    SFS_NET_CPY16(ps_subFrm->pb_subFrm2Crc, &w_calcCrc2Long);
+  }
+  else  /* payload data length is 8 byte or less */
+  {
+    SFS_NET_CPY8(ps_subFrm->pb_subFrm1Crc, &b_calcCrc1Short);
+    SFS_NET_CPY8(ps_subFrm->pb_subFrm2Crc, &b_calcCrc2Short);
+  }
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function encodes the UDID of the SCM and passes the openSAFETY frame to the SHNF.
+ *
+ * @param        b_instNum         instance number (not checked, checked in SFS_FrmSerialize())
+ *                    valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @param        ps_hdrInfo        reference to header info (not checked, checked in checkTxFrameHeader()),
+ *                    valid range: <> NULL
+ *
+ * @param        pb_frame          reference to the openSAFETY frame (not checked, checked in
+ *                    SFS_FrmSerialize()), valid range: <> NULL
+ *
+ * @return
+ * - TRUE            - openSAFETY frame passed to the SHNF successfully
+ * - FALSE           - error during marking the memory block openSAFETY frame passing failed
+ */
+static BOOLEAN frmTransmit(BYTE_B_INSTNUM_ const EPLS_t_FRM_HDR *ps_hdrInfo,
+                           UINT8 *pb_frame)
+{
+  BOOLEAN o_return = FALSE;     /* predefined return value */
+
+  /* the UDID of the SCM encoding */
+  SFS_ScmUdidCode(B_INSTNUM_ ps_hdrInfo->b_id, pb_frame);
+
+  /* if openSAFETY frame cannot be passed to SHNF */
+  if(!(SHNF_MarkTxMemBlock(B_INSTNUM_ pb_frame)))
+  {
+    /* error: SHNF cannot mark openSAFETY frame as "ready to process" */
+    SERR_SetError(B_INSTNUM_ SFS_k_ERR_SHNF_CANNOT_MARK_MEM_BLK,
+                  SERR_k_NO_ADD_INFO);
+  }
+  else  /* openSAFETY frame processed successfully from SHNF */
+  {
+    o_return = TRUE;
+  }
   SCFM_TACK_PATH();
   return o_return;
 }
 
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+/**
+ * @brief This function calculates the contribution of every CT and TR bit to the CRCs of the sub frames.
+ *
+ * The CRC is affine in the bytes of a sub frame, the contribution of a bit is the CRC of a zeroed sub
+ * frame with only this bit set XOR the CRC of the zeroed sub frame. It only depends on the payload length.
+ *
+ * @param        ps_hdrInfo        reference to header info (not checked, checked in checkTxFrameHeader()),
+ *                    valid range: <> NULL
+ *
+ * @retval       ps_crcCache       reference to the cached CRC state (not checked, only called with reference
+ *                    to struct), valid range: <> NULL
+ */
+static void txCrcDeltaInit(const EPLS_t_FRM_HDR *ps_hdrInfo,
+                           SFS_t_TX_CRC_CACHE *ps_crcCache)
+{
+  UINT16 w_len1 = (UINT16)(k_SFRM1_HDR_LEN + ps_hdrInfo->b_le); /* length of sub frame ONE */
+  UINT16 w_len2 = (UINT16)(k_SFRM2_HDR_LEN + ps_hdrInfo->b_le); /* length of sub frame TWO */
+  UINT16 w_zeroCrc1;            /* CRC of the zeroed sub frame ONE */
+  UINT16 w_zeroCrc2;            /* CRC of the zeroed sub frame TWO */
+  UINT8 b_bit;                  /* loop counter */
+
+  (void)MEMSET(ab_CrcScratch, 0, (UINT32)w_len2);
+  w_zeroCrc1 = subFrmCrcCalc(ps_hdrInfo, w_len1, ab_CrcScratch);
+  w_zeroCrc2 = subFrmCrcCalc(ps_hdrInfo, w_len2, ab_CrcScratch);
+
+  for (b_bit = 0u; b_bit < 8u; b_bit++)
+  {
+    ab_CrcScratch[k_SFRM1_HDR_CT] = (UINT8)(1u << b_bit);
+    ps_crcCache->aw_ct1Delta[b_bit] = (UINT16)(w_zeroCrc1 ^
+        subFrmCrcCalc(ps_hdrInfo, w_len1, ab_CrcScratch));
+    ab_CrcScratch[k_SFRM1_HDR_CT] = 0u;
+
+    ab_CrcScratch[k_SFRM2_HDR_CT] = (UINT8)(1u << b_bit);
+    ps_crcCache->aw_ct2Delta[b_bit] = (UINT16)(w_zeroCrc2 ^
+        subFrmCrcCalc(ps_hdrInfo, w_len2, ab_CrcScratch));
+    ab_CrcScratch[k_SFRM2_HDR_CT] = 0u;
+
+    ab_CrcScratch[k_SFRM2_HDR_TR] = (UINT8)(1u << b_bit);
+    ps_crcCache->aw_trDelta[b_bit] = (UINT16)(w_zeroCrc2 ^
+        subFrmCrcCalc(ps_hdrInfo, w_len2, ab_CrcScratch));
+    ab_CrcScratch[k_SFRM2_HDR_TR] = 0u;
+  }
+  ps_crcCache->b_deltaLe = ps_hdrInfo->b_le;
+  ps_crcCache->o_deltaValid = TRUE;
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function adds the contributions of the changed bits of a header byte to a CRC.
+ *
+ * @param        w_crc             CRC of the cached frame (not checked, any value allowed),
+ *                    valid range: any 16 bit value
+ *
+ * @param        b_change          changed bits of the header byte (not checked, any value allowed),
+ *                    valid range: any 8 bit value
+ *
+ * @param        pw_delta          contributions of the bits of the header byte (not checked, only called with
+ *                    reference to array), valid range: <> NULL
+ *
+ * @return       CRC of the frame with the changed header byte
+ */
+static UINT16 txCrcDeltaAdd(UINT16 w_crc, UINT8 b_change,
+                            const UINT16 *pw_delta)
+{
+  UINT16 w_ret = w_crc;         /* return value */
+  UINT8 b_bits = b_change;      /* changed bits not yet added */
+  UINT8 b_bit = 0u;             /* bit number */
+
+  while (b_bits != 0u)
+  {
+    /* if the bit changed */
+    if ((b_bits & 0x01u) != 0u)
+    {
+      w_ret = (UINT16)(w_ret ^ pw_delta[b_bit]);
+    }
+    /* no else : bit unchanged */
+    b_bits = (UINT8)(b_bits >> 1u);
+    b_bit++;
+  }
+  SCFM_TACK_PATH();
+  return w_ret;
+}
+#endif
+
 /**
 * @brief This function checks header information of an openSAFETY frame to be transmitted.
 *
@@ -137,7 +137,8 @@ extern BOOLEAN SHNF_MarkTxMemBlock(BYTE_B_INSTNUM_ const UINT8 *pb_memBlock);
 /**
  * @brief This function returns a CRC checksum over a sub frame with payload data of maximum 8 bytes. The result is a 8 bit CRC.
  *
- * @param        b_initCrc               initial CRC (always called with 0 by the openSAFETY software)
+ * @param        b_initCrc               initial CRC, 0 or the CRC of the preceding bytes of the sub frame
+ *                                       if the calculation is continued (see SNMTS_cfg_RESP_CACHE)
  *
  * @param        l_subFrameLength        subframe length in bytes
  *
@@ -31,6 +31,7 @@
 #include "SODapi.h"
 #include "SOD.h"
 #include "SDN.h"
+#include "SPDO.h"
 #include "SNMTSapi.h"
 #include "SNMT.h"
 #include "SNMTS.h"
@@ -172,6 +173,16 @@ UINT16 SNMTS_MainSadrGet(BYTE_B_INSTNUM)
  */
 BOOLEAN SNMTS_MainSadrSet(BYTE_B_INSTNUM_ UINT16 w_mainSadr) 
 {
+#if ((0 != SPDO_cfg_MAX_NO_TX_SPDO) && \
+     (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE))
+    /* if the main SADR is changed */
+    if (*(apw_MainSadr[B_INSTNUMidx]) != w_mainSadr)
+    {
+        /* the SPDOs have to be activated with the new SADR */
+        SPDO_ActivateCacheClear(B_INSTNUM);
+    }
+#endif
+
     SCFM_TACK_PATH();
     return SOD_Write(B_INSTNUM_ s_AcsMainSadr[B_INSTNUMidx].dw_hdl,
             s_AcsMainSadr[B_INSTNUMidx].o_applObj, &w_mainSadr,
@@ -464,7 +475,11 @@ BOOLEAN SNMTS_TxRespRstGuardScm(BYTE_B_INSTNUM)
     else  /* memory allocation succeeded */
     {
         /* serialize and transmit service to reset the SCMs node guarding time */
+#if (SNMTS_cfg_RESP_CACHE == EPLS_k_ENABLE)
+        o_return = SFS_FrmSerializeSnmtResp(B_INSTNUM_ &s_txBufHdr, pb_txFrame);
+#else
         o_return = SFS_FrmSerialize(B_INSTNUM_ &s_txBufHdr, pb_txFrame);
+#endif
     }
     SCFM_TACK_PATH();
     return o_return;
@@ -723,6 +723,10 @@ static BOOLEAN WfSetToOp1Step1State(BYTE_B_INSTNUM_ t_SN_EVENT e_evtSn,
 									EPLS_t_FRM *ps_txBuf, BOOLEAN *po_busy) 
 {
     BOOLEAN o_return = FALSE; /* predefined return value */
+#if ((0 != SPDO_cfg_MAX_NO_TX_SPDO) && \
+     (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE))
+    UINT32 dw_rxTs; /* received parameter timestamp */
+#endif
 
     *po_busy = FALSE;
 
@@ -734,14 +738,32 @@ static BOOLEAN WfSetToOp1Step1State(BYTE_B_INSTNUM_ t_SN_EVENT e_evtSn,
 		{
 /* no SPDO active at all */
 #if (0 != SPDO_cfg_MAX_NO_TX_SPDO)
+  #if (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE)
+            /* get the received parameter timestamp */
+            SFS_NET_CPY32(&dw_rxTs, &(ps_rxBuf->ab_frmData[SNMT_k_OFS_TSTMP]));
+
+            /* if the SPDOs are still activated for this parameter set */
+            if (SPDO_ActivateCached(B_INSTNUM_ dw_rxTs))
+            {
+                /* no SPDO activation necessary - calculate the checksum */
+                SAPL_SNMTS_CalcParamChkSumClbk(B_INSTNUM);
+
+                ae_ActFsmState[B_INSTNUMidx] = k_ST_WF_API_CHKSUM;
+            }
+            else /* activation of SPDO mapping is started */
+            {
+                ae_ActFsmState[B_INSTNUMidx] = k_ST_WF_SET_TO_OP1_STEP2;
+            }
+  #else
             /* activation of SPDO mapping is started */
             SPDO_ActivateStart(B_INSTNUM);
 
+            ae_ActFsmState[B_INSTNUMidx] = k_ST_WF_SET_TO_OP1_STEP2; 
+  #endif
+
             /* collect header info and transmit response with status BUSY */
             SNMTS_TxRespExtService(B_INSTNUM_ ps_rxBuf, ps_txBuf, SNMTS_k_SN_STS_BUSY, 
                     0U, 0U, (UINT8 *) NULL );
-
-            ae_ActFsmState[B_INSTNUMidx] = k_ST_WF_SET_TO_OP1_STEP2; 
 #else /* (0 != SPDO_cfg_MAX_NO_TX_SPDO) */
       /* no SPDOs to be activated - calculate the checksum */
       SAPL_SNMTS_CalcParamChkSumClbk(B_INSTNUM);
@@ -1161,6 +1183,12 @@ static BOOLEAN WfSetToOp2State(BYTE_B_INSTNUM_ t_SN_EVENT e_evtSn,
                                    SNMTS_k_FAIL_GRP_STK, SNMTS_k_FAIL_ERR_CRC_CHKSUM, 
                                    (UINT8 *) NULL );
 
+#if ((0 != SPDO_cfg_MAX_NO_TX_SPDO) && \
+     (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE))
+            /* the SPDOs are activated again with the next parameter set */
+            SPDO_ActivateCacheClear(B_INSTNUM);
+#endif
+
             ae_ActFsmState[B_INSTNUMidx] = k_ST_WF_SET_TO_OP1_STEP1; 
 		} 
 		else /* received parameter checksum is valid */
@@ -1398,6 +1426,10 @@ static BOOLEAN WfSetToOp3State(BYTE_B_INSTNUM_ UINT32 dw_ct, t_SN_EVENT e_evtSn,
 							   BOOLEAN *po_busy) 
 {
     BOOLEAN o_return = FALSE; /* predefined return value */
+#if ((0 != SPDO_cfg_MAX_NO_TX_SPDO) && \
+     (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE))
+    UINT32 dw_rxTs; /* received parameter timestamp */
+#endif
 
     *po_busy = FALSE;
 
@@ -1418,6 +1450,11 @@ static BOOLEAN WfSetToOp3State(BYTE_B_INSTNUM_ UINT32 dw_ct, t_SN_EVENT e_evtSn,
 /* no SPDO active at all */
 #if (0 != SPDO_cfg_MAX_NO_TX_SPDO)
         SPDO_SetToOp(B_INSTNUM_ dw_ct);
+  #if (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE)
+        /* the activated SPDOs are kept for this parameter timestamp */
+        SFS_NET_CPY32(&dw_rxTs, &(ps_rxBuf->ab_frmData[SNMT_k_OFS_TSTMP]));
+        SPDO_ActivateCacheSet(B_INSTNUM_ dw_rxTs);
+  #endif
 #endif /* (0 != SPDO_cfg_MAX_NO_TX_SPDO) */
 
                 ae_ActFsmState[B_INSTNUMidx] = k_ST_OPERATIONAL_STEP1;
@@ -1835,6 +1872,10 @@ static void enterAddSadr(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf)
     UINT16 w_txSpdoNo = 0U; /* tx SPDO number */
     UINT16 w_addSadr = 0U; /* additional SADR */
     SOD_t_ERROR_RESULT s_errRes; /* SOD access error */
+#if ((0 != SPDO_cfg_MAX_NO_TX_SPDO) && \
+     (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE))
+    const UINT16 *pw_oldSadr; /* additional SADR stored in the SOD */
+#endif
 
     /* get the add. SADR from the openSAFETY frame */
     SFS_NET_CPY16(&w_addSadr, &ps_rxBuf->ab_frmData[SNMT_k_OFS_SADR]);
@@ -1883,6 +1924,18 @@ static void enterAddSadr(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf)
         }
         else /* TxSPDO Number can be used */
         {
+#if ((0 != SPDO_cfg_MAX_NO_TX_SPDO) && \
+     (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE))
+            pw_oldSadr = (UINT16 *)SOD_Read(B_INSTNUM_ dw_sodHdl, o_sodAppObj,
+                                            SOD_k_NO_OFFSET,
+                                            SOD_k_LEN_NOT_NEEDED, &s_errRes);
+            /* if the additional SADR is changed or cannot be read */
+            if ((pw_oldSadr == NULL) || (*pw_oldSadr != w_addSadr))
+            {
+                /* the SPDOs have to be activated with the new SADR */
+                SPDO_ActivateCacheClear(B_INSTNUM);
+            }
+#endif
             /* if additional SADR cannot be assigned */
             if(!(SOD_Write(B_INSTNUM_ dw_sodHdl, o_sodAppObj, &w_addSadr,
                                     SOD_k_NO_OVERWRITE, SOD_k_NO_OFFSET,
@@ -100,6 +100,178 @@ BOOLEAN SOD_WriteAccess(BYTE_B_INSTNUM);
  */
 BOOLEAN SOD_IsLocked(BYTE_B_INSTNUM);
 
+#if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+/**
+ * @brief This function opens a segmented write session for the given object.
+ *
+ * The object is checked once, afterwards the segments are written with SOD_SegWrite() directly
+ * from the received frame into the object.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry got by SOD_AttrGet() (checked) valid range: (UINT32)
+ *
+ * @param        o_appObj           application object flag got by SOD_AttrGet() (checked) valid range: TRUE, FALSE
+ *
+ * @return
+ * - TRUE             - session is open, the segments have to be written with SOD_SegWrite()
+ * - FALSE            - no session is open, the segments have to be written with SOD_Write()
+ */
+BOOLEAN SOD_SegWriteOpen(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj);
+
+/**
+ * @brief This function writes a segment of the object of the open segmented write session.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        pb_data            reference to the segment in the received frame (pointer not checked, only called with reference to array in SSDOS_SodAcsWrite()) valid range: <> NULL
+ *
+ * @param        dw_offset          start offset in bytes of the segment within the data block (checked) valid range: (UINT32)
+ *
+ * @param        dw_size            size in bytes of the segment (checked) valid range: (UINT32)
+ *
+ * @return
+ * - TRUE             - success
+ * - FALSE            - failure
+ */
+BOOLEAN SOD_SegWrite(BYTE_B_INSTNUM_ const UINT8 *pb_data, UINT32 dw_offset,
+                     UINT32 dw_size);
+
+/**
+ * @brief This function closes the segmented write session.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SOD_SegWriteClose(BYTE_B_INSTNUM);
+#endif
+
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+/**
+ * @brief This function opens the snapshot for the segmented upload of the given object.
+ *
+ * The snapshot is only opened for objects with the attribute SOD_k_ATTR_SNAPSHOT, otherwise
+ * SOD_SnapRead() reads the object like SOD_Read(). A snapshot which is still open is closed.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry got by SOD_AttrGet() (not checked, checked in SOD_AttrGet()) valid range: (UINT32)
+ *
+ * @param        o_appObj           application object flag got by SOD_AttrGet(), no snapshot is opened for application objects (not checked, any value allowed) valid range: TRUE, FALSE
+ */
+void SOD_SnapOpen(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj);
+
+/**
+ * @brief This function reads a segment of the uploaded object, from the snapshot buffer if the object was written since SOD_SnapOpen().
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry, see SOD_Read()
+ *
+ * @param        o_appObj           application object flag, see SOD_Read()
+ *
+ * @param        dw_offset          start offset in bytes of the segment within the data block, see SOD_Read()
+ *
+ * @param        dw_size            size in bytes of the segment, see SOD_Read()
+ *
+ * @retval       ps_errRes          error result, see SOD_Read()
+ *
+ * @return
+ * - <> NULL          - pointer to the segment
+ * - == NULL          - failure, see ps_errRes
+ */
+void *SOD_SnapRead(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
+                   UINT32 dw_offset, UINT32 dw_size,
+                   SOD_t_ERROR_RESULT *ps_errRes);
+
+/**
+ * @brief This function closes the snapshot at the end or the abort of the upload.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SOD_SnapClose(BYTE_B_INSTNUM);
+#endif
+
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+/**
+ * @brief This function starts the streamed transfer of an application object, see SAPL_SOD_StreamBeginClbk().
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        o_download
+ * - TRUE  : the object is written
+ * - FALSE : the object is read (not checked, any value allowed) valid range: TRUE, FALSE
+ *
+ * @param        dw_totalSize       declared total size in bytes, 0 if unknown (not checked, any value allowed) valid range: (UINT32)
+ *
+ * @return       see SOD_t_STREAM_RESULT, in case of SOD_k_STREAM_ABORT the error is already reported with the abort code as additional info
+ */
+SOD_t_STREAM_RESULT SOD_StreamBegin(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+                                    BOOLEAN o_download, UINT32 dw_totalSize);
+
+/**
+ * @brief This function passes a chunk of a streamed download to the application, see SAPL_SOD_StreamWriteClbk().
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        pb_data            reference to the chunk (pointer not checked, only called with reference to array in SSDOS_SodAcsWrite()) valid range: <> NULL
+ *
+ * @param        dw_offset          start offset in bytes of the chunk within the object (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        dw_size            size in bytes of the chunk (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @return       see SOD_t_STREAM_RESULT, in case of SOD_k_STREAM_ABORT the error is already reported with the abort code as additional info
+ */
+SOD_t_STREAM_RESULT SOD_StreamWrite(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+                                    const UINT8 *pb_data, UINT32 dw_offset,
+                                    UINT32 dw_size);
+
+/**
+ * @brief This function fetches a chunk of a streamed upload from the application, see SAPL_SOD_StreamReadClbk().
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @retval       pb_data            buffer for the chunk (pointer not checked, only called with reference to array in SSDOS_SodAcsRead()) valid range: <> NULL
+ *
+ * @param        dw_offset          start offset in bytes of the chunk within the object (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        dw_size            size in bytes of the chunk (not checked, checked in SSDOS_SodAcsRead()) valid range: 1..EPLS_cfg_MAX_PYLD_LEN
+ *
+ * @return       see SOD_t_STREAM_RESULT, in case of SOD_k_STREAM_ABORT the error is already reported with the abort code as additional info
+ */
+SOD_t_STREAM_RESULT SOD_StreamRead(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+                                   UINT8 *pb_data, UINT32 dw_offset,
+                                   UINT32 dw_size);
+
+/**
+ * @brief This function finishes a streamed transfer successfully, see SAPL_SOD_StreamCommitClbk().
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        dw_size            number of transferred bytes (not checked, any value allowed) valid range: (UINT32)
+ *
+ * @return       see SOD_t_STREAM_RESULT, in case of SOD_k_STREAM_ABORT the error is already reported with the abort code as additional info
+ */
+SOD_t_STREAM_RESULT SOD_StreamCommit(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+                                     UINT32 dw_size);
+
+/**
+ * @brief This function signals the abort of a started streamed transfer to the application, see SAPL_SOD_StreamAbortClbk().
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ */
+void SOD_StreamAbort(BYTE_B_INSTNUM_ UINT32 dw_hdl);
+#endif
+
 #endif
 
 /** @} */
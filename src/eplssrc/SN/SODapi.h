@@ -50,6 +50,14 @@
 #define SOD_k_ATTR_P2P     ((UINT16)(0x0800))
 /** No SPDO mapping length ckecking: the length checking at the SPDO mapping is decativated. */
 #define SOD_k_ATTR_NO_LEN_CHK ((UINT16)(0x1000))
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+/** Streamed object: the segmented SSDO transfers of this application object are passed to the SAPL_SOD_Stream...Clbk() functions. Only valid for application objects. */
+#define SOD_k_ATTR_STREAM     ((UINT16)(0x2000))
+#endif
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+/** Snapshot object: a segmented SSDO upload reads the data of the object as it was at the start of the upload, see SOD_cfg_SNAPSHOT. Only valid for DOMAIN, VISIBLE STRING and OCTET STRING objects with a length up to SOD_cfg_SNAPSHOT_LEN. */
+#define SOD_k_ATTR_SNAPSHOT   ((UINT16)(0x4000))
+#endif
 
 /** Low byte */
 
@@ -150,6 +158,21 @@ typedef enum
     SOD_ABT_OBJ_IS_BUSY = 0x08000023
 } SOD_t_ABORT_CODES;
 
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+/**
+ * Enumeration of the results of the SAPL_SOD_Stream...Clbk() functions.
+ */
+typedef enum
+{
+    /** The step of the transfer is done */
+    SOD_k_STREAM_DONE,
+    /** The application is not ready, the same step is called again in the next cycle */
+    SOD_k_STREAM_NOT_READY,
+    /** The transfer has to be aborted with the abort code set by the application */
+    SOD_k_STREAM_ABORT
+} SOD_t_STREAM_RESULT;
+#endif
+
 /**
  * @brief Structure definition for the SOD objects with actual length and pointer to the data.
  *
@@ -549,6 +572,25 @@ BOOLEAN SOD_EnableSodWrite(BYTE_B_INSTNUM);
  */
 BOOLEAN SOD_DisableSodWrite(BYTE_B_INSTNUM);
 
+#if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+/**
+ * @brief This function returns the handles of the SOD entries written since the last call and clears their change marks.
+ *
+ * The handles are returned in the order of the SOD. If more entries are marked than fit into
+ * the buffer, the remaining marks are kept for the next call. Objects managed by the
+ * application are not marked.
+ *
+ * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @retval       adw_hdl            buffer for the handles of the changed SOD entries, the handles can be used for SOD_Read() with o_appObj == FALSE (pointer checked) valid range: <> NULL
+ *
+ * @param        w_maxNoHdl         number of handles which fit into adw_hdl (not checked, any value allowed) valid range: (UINT16)
+ *
+ * @return       number of handles written into adw_hdl, 0 in case of an error
+ */
+UINT16 SOD_ChangedGet(BYTE_B_INSTNUM_ UINT32 *adw_hdl, UINT16 w_maxNoHdl);
+#endif
+
 /**
  * @brief This function sets the default values for the application objects.
  *
@@ -734,6 +776,125 @@ SOD_t_ABORT_CODES SAPL_SOD_ActualLenGet(BYTE_B_INSTNUM_ UINT32 dw_hdl,
         UINT32 *pdw_objLen);
 #endif
 
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+/**
+ * @brief This function starts the streamed transfer of an application object with the attribute SOD_k_ATTR_STREAM.
+ *
+ * The function is called once per segmented SSDO transfer, after the object was locked. A streamed transfer is
+ * finished by SAPL_SOD_StreamCommitClbk() or SAPL_SOD_StreamAbortClbk(). Expedited transfers of the object are still
+ * processed by SAPL_SOD_ReadClbk() and SAPL_SOD_WriteClbk().
+ *
+ * @attention This is the prototype of a callback function, which will be called by the SOD module. The function must
+ * be provided by the application, if SOD_cfg_STREAM_OBJ is enabled.
+ *
+ * @param        b_instNum          instance number
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry
+ *
+ * @param        o_download
+ * - TRUE  : the object is written (download)
+ * - FALSE : the object is read (upload)
+ *
+ * @param        dw_totalSize       declared total size of the transfer in bytes, 0 if the client did not declare the size of a download
+ *
+ * @retval       pe_saplError       abort code to be sent, if SOD_k_STREAM_ABORT is returned
+ *
+ * @return       see SOD_t_STREAM_RESULT
+ */
+SOD_t_STREAM_RESULT SAPL_SOD_StreamBeginClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+        BOOLEAN o_download, UINT32 dw_totalSize,
+        SOD_t_ABORT_CODES *pe_saplError);
+
+/**
+ * @brief This function passes the next chunk of a streamed download to the application.
+ *
+ * The chunks are passed in order without gaps. If SOD_k_STREAM_NOT_READY is returned, the same chunk is passed again.
+ *
+ * @attention This is the prototype of a callback function, which will be called by the SOD module. The function must
+ * be provided by the application, if SOD_cfg_STREAM_OBJ is enabled.
+ *
+ * @param        b_instNum          instance number
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry
+ *
+ * @param        pb_data            reference to the chunk, only valid during the call
+ *
+ * @param        dw_offset          start offset in bytes of the chunk within the object
+ *
+ * @param        dw_size            size in bytes of the chunk
+ *
+ * @retval       pe_saplError       abort code to be sent, if SOD_k_STREAM_ABORT is returned
+ *
+ * @return       see SOD_t_STREAM_RESULT
+ */
+SOD_t_STREAM_RESULT SAPL_SOD_StreamWriteClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+        const UINT8 *pb_data, UINT32 dw_offset, UINT32 dw_size,
+        SOD_t_ABORT_CODES *pe_saplError);
+
+/**
+ * @brief This function fetches the next chunk of a streamed upload from the application.
+ *
+ * The chunks are fetched in order without gaps. If SOD_k_STREAM_NOT_READY is returned, the same chunk is fetched
+ * again.
+ *
+ * @attention This is the prototype of a callback function, which will be called by the SOD module. The function must
+ * be provided by the application, if SOD_cfg_STREAM_OBJ is enabled.
+ *
+ * @param        b_instNum          instance number
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry
+ *
+ * @retval       pb_data            buffer for the chunk, dw_size bytes
+ *
+ * @param        dw_offset          start offset in bytes of the chunk within the object
+ *
+ * @param        dw_size            size in bytes of the chunk
+ *
+ * @retval       pe_saplError       abort code to be sent, if SOD_k_STREAM_ABORT is returned
+ *
+ * @return       see SOD_t_STREAM_RESULT
+ */
+SOD_t_STREAM_RESULT SAPL_SOD_StreamReadClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+        UINT8 *pb_data, UINT32 dw_offset, UINT32 dw_size,
+        SOD_t_ABORT_CODES *pe_saplError);
+
+/**
+ * @brief This function finishes a streamed transfer successfully.
+ *
+ * For a download the function is called after the last chunk, before the last response is sent. For an upload the
+ * function is called before the last segment is sent.
+ *
+ * @attention This is the prototype of a callback function, which will be called by the SOD module. The function must
+ * be provided by the application, if SOD_cfg_STREAM_OBJ is enabled.
+ *
+ * @param        b_instNum          instance number
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry
+ *
+ * @param        dw_size            number of transferred bytes
+ *
+ * @retval       pe_saplError       abort code to be sent, if SOD_k_STREAM_ABORT is returned
+ *
+ * @return       see SOD_t_STREAM_RESULT
+ */
+SOD_t_STREAM_RESULT SAPL_SOD_StreamCommitClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+        UINT32 dw_size, SOD_t_ABORT_CODES *pe_saplError);
+
+/**
+ * @brief This function signals that a started streamed transfer was aborted.
+ *
+ * The application has to discard the data of a download.
+ *
+ * @attention This is the prototype of a callback function, which will be called by the SOD module. The function must
+ * be provided by the application, if SOD_cfg_STREAM_OBJ is enabled.
+ *
+ * @param        b_instNum          instance number
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry
+ */
+void SAPL_SOD_StreamAbortClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl);
+#endif
+
 /**
  * @brief This function sets the actual length of the given SOD object.
  *
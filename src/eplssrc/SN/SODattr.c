@@ -437,6 +437,22 @@ const SOD_t_OBJECT *SOD_GetSodStartAddr(BYTE_B_INSTNUM)
     return po_this->ps_startOdAddr;
 }
 
+#if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+/**
+* @brief This function gets the number of SOD entries.
+*
+* @param      b_instNum      instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return     Number of SOD entries, calculated by SOD_InitAddr().
+*/
+UINT16 SOD_GetNoOdEntries(BYTE_B_INSTNUM)
+{
+    /* call the Control Flow Monitoring */SCFM_TACK_PATH();
+
+    return as_Obj[B_INSTNUMidx].w_noOdEntries;
+}
+#endif
+
 
 /**
  * @brief This function searches a via index/sub-index specified object in the SOD and returns a pointer to the object.
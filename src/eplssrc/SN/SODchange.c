@@ -0,0 +1,196 @@
+/**
+ * @addtogroup SOD
+ * @{
+ *
+ * @file SODchange.c
+ *
+ * This file contains the change feed of the SOD.
+ *
+ * Every SOD entry written by SOD_Write() or SOD_SegWrite() is marked in a bitmap of the
+ * instance, one bit per SOD entry in the order of the SOD. SOD_ChangedGet() returns the
+ * handles of the marked entries and clears their marks, so the application only has to
+ * process the entries which were written since the last call instead of polling all objects.
+ * Empty 32 bit words of the bitmap are skipped and the marks within a word are found with
+ * BIT_SCAN_FORWARD().
+ *
+ * @copyright Copyright (c) 2009,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H and IXXAT Automation GmbH
+ * @copyright All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * @copyright This source code is free software; you can redistribute it and/or modify it under the terms of the BSD license (according to License.txt).
+ *
+ */
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SERRapi.h"
+#include "SERR.h"
+
+#include "SCFMapi.h"
+
+#include "SODerr.h"
+#include "SODapi.h"
+#include "SODint.h"
+
+#if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+
+/**
+ * Number of 32 bit words of the change bitmap.
+*/
+#define k_NO_CHANGE_WORDS  (SOD_cfg_MAX_CHANGE_ENTRIES / 32)
+
+/**
+ * Structure of the change feed of an instance.
+*/
+typedef struct
+{
+  /** start address of the object dictionary */
+  const SOD_t_OBJECT *ps_startOdAddr;
+  /** number of bitmap words covering the SOD entries */
+  UINT16 w_noWords;
+  /** change bitmap, bit (i MOD 32) of word (i / 32) marks the SOD entry i */
+  UINT32 adw_changed[k_NO_CHANGE_WORDS];
+} t_SOD_CHANGE_OBJ;
+
+/**
+ * Change feed of every instance.
+*/
+static t_SOD_CHANGE_OBJ as_Change[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+/**
+* @brief This function clears the change marks of all SOD entries.
+*
+* @param        b_instNum         instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return
+* - TRUE            - success
+* - FALSE           - failure, the SOD has more entries than SOD_cfg_MAX_CHANGE_ENTRIES
+*/
+BOOLEAN SOD_ChangeInit(BYTE_B_INSTNUM)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  t_SOD_CHANGE_OBJ *po_this = &as_Change[B_INSTNUMidx]; /* instance pointer */
+  UINT16 w_noOdEntries = SOD_GetNoOdEntries(B_INSTNUM); /* number of SOD
+                                                           entries */
+  UINT16 w_word; /* loop counter */
+
+  /* if the SOD has more entries than the bitmap covers */
+  if (w_noOdEntries > (UINT16)SOD_cfg_MAX_CHANGE_ENTRIES)
+  {
+    SERR_SetError(B_INSTNUM_ SOD_k_ERR_CHANGE_FEED_SIZE,
+                  (UINT32)w_noOdEntries);
+  }
+  /* else the bitmap covers the SOD */
+  else
+  {
+    po_this->ps_startOdAddr = SOD_GetSodStartAddr(B_INSTNUM);
+    po_this->w_noWords = (UINT16)((w_noOdEntries + 31U) >> 5);
+
+    for (w_word = 0U; w_word < (UINT16)k_NO_CHANGE_WORDS; w_word++)
+    {
+      po_this->adw_changed[w_word] = 0UL;
+    }
+
+    o_ret = TRUE;
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+
+/**
+* @brief This function marks a written SOD entry as changed.
+*
+* @param        b_instNum         instance number (not checked, checked in SOD_Write() or SOD_SegWrite()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        ps_object         reference to the written SOD entry (not checked, checked in SOD_Write() or SOD_SegWriteOpen()) valid range: <> NULL
+*/
+void SOD_ChangeMark(BYTE_B_INSTNUM_ const SOD_t_OBJECT *ps_object)
+{
+  t_SOD_CHANGE_OBJ *po_this = &as_Change[B_INSTNUMidx]; /* instance pointer */
+  UINT16 w_entry; /* index of the SOD entry */
+
+  w_entry = (UINT16)(ps_object - po_this->ps_startOdAddr);
+  po_this->adw_changed[w_entry >> 5] |= (UINT32)(1UL << (w_entry & 0x1FU));
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function returns the handles of the SOD entries written since the last call and clears their change marks.
+ *
+ * The handles are returned in the order of the SOD. If more entries are marked than fit into
+ * the buffer, the remaining marks are kept for the next call. Objects managed by the
+ * application are not marked.
+ *
+ * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @retval       adw_hdl            buffer for the handles of the changed SOD entries, the handles can be used for SOD_Read() with o_appObj == FALSE (pointer checked) valid range: <> NULL
+ *
+ * @param        w_maxNoHdl         number of handles which fit into adw_hdl (not checked, any value allowed) valid range: (UINT16)
+ *
+ * @return       number of handles written into adw_hdl, 0 in case of an error
+ */
+UINT16 SOD_ChangedGet(BYTE_B_INSTNUM_ UINT32 *adw_hdl, UINT16 w_maxNoHdl)
+{
+  UINT16 w_noHdl = 0U; /* return value */
+  t_SOD_CHANGE_OBJ *po_this; /* instance pointer */
+  UINT16 w_word; /* index of the bitmap word */
+  UINT32 dw_marks; /* not fetched marks of the bitmap word */
+  UINT8 b_bit; /* index of the mark within the bitmap word */
+
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+  /* if b_instNum is wrong */
+  if (b_instNum >= (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    SERR_SetError(EPLS_k_NO_INSTANCE, SOD_k_ERR_INST_NUM_11,
+                  (UINT32)SOD_ABT_GENERAL_ERROR);
+  }
+  else
+#endif
+  /* else if the reference to the handle buffer is invalid */
+  if (adw_hdl == NULL)
+  {
+    SERR_SetError(B_INSTNUM_ SOD_k_ERR_CHANGE_BUF_INVALID, SERR_k_NO_ADD_INFO);
+  }
+  /* else all parameter ok */
+  else
+  {
+    po_this = &as_Change[B_INSTNUMidx];
+
+    for (w_word = 0U;
+         (w_word < po_this->w_noWords) && (w_noHdl < w_maxNoHdl); w_word++)
+    {
+      dw_marks = po_this->adw_changed[w_word];
+
+      while ((dw_marks != 0UL) && (w_noHdl < w_maxNoHdl))
+      {
+        b_bit = BIT_SCAN_FORWARD(dw_marks);
+        /* the lowest mark is fetched */
+        dw_marks &= (dw_marks - 1UL);
+
+        adw_hdl[w_noHdl] =
+          (UINT32)(&po_this->ps_startOdAddr[(w_word << 5) + b_bit]); /*lint !e923
+                                  Note 923: cast from pointer to
+                                  unsigned long [MISRA 2004 Rule 11.3] */
+        w_noHdl++;
+      }
+
+      /* the marks which did not fit into the buffer are kept */
+      po_this->adw_changed[w_word] = dw_marks;
+    }
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return w_noHdl;
+}
+
+#endif
+
+/** @} */
@@ -59,7 +59,13 @@
  *      - SOD_k_ATTR_NO_LEN_CHK
  *      - SOD_k_ATTR_SHARED
  *
+ * SOD_k_ATTR_SNAPSHOT is valid in both cases, if SOD_cfg_SNAPSHOT is enabled.
 */
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+  #define k_ATTR_SNAPSHOT SOD_k_ATTR_SNAPSHOT
+#else
+  #define k_ATTR_SNAPSHOT ((UINT16)0x0000)
+#endif
 #if (EPLS_cfg_MAX_INSTANCES > 1)
   #define k_ATTR_INVALID ((UINT16)(~(UINT16)(SOD_k_ATTR_P2P|\
                                              SOD_k_ATTR_AFT_WR|\
@@ -71,7 +77,8 @@
                                              SOD_k_ATTR_WO|\
                                              SOD_k_ATTR_CRC|\
                                              SOD_k_ATTR_NO_LEN_CHK|\
-                                             SOD_k_ATTR_SHARED)))
+                                             SOD_k_ATTR_SHARED|\
+                                             k_ATTR_SNAPSHOT)))
 #else                               
   #define k_ATTR_INVALID ((UINT16)(~(UINT16)(SOD_k_ATTR_P2P|\
                                              SOD_k_ATTR_AFT_WR|\
@@ -82,7 +89,8 @@
                                              SOD_k_ATTR_RO|\
                                              SOD_k_ATTR_WO|\
                                              SOD_k_ATTR_NO_LEN_CHK|\
-                                             SOD_k_ATTR_CRC)))
+                                             SOD_k_ATTR_CRC|\
+                                             k_ATTR_SNAPSHOT)))
 #endif
 
 /**
@@ -296,6 +304,20 @@ static BOOLEAN AttrCheck(BYTE_B_INSTNUM_ const SOD_t_OBJECT *ps_obj)
     SERR_SetError(B_INSTNUM_ SOD_k_ERR_OBJ_CLBK_2,
                   ((UINT32)(ps_obj->w_index)<<16)+ps_obj->b_subIndex);
   }
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+  /* else if SOD_k_ATTR_SNAPSHOT is set and the object is not a DOMAIN,
+     VISIBLE STRING or OCTET STRING or does not fit into the snapshot
+     buffer */
+  else if (EPLS_IS_BIT_SET(ps_obj->s_attr.w_attr, SOD_k_ATTR_SNAPSHOT) &&
+           (((ps_obj->s_attr.e_dataType != EPLS_k_DOMAIN) &&
+             (ps_obj->s_attr.e_dataType != EPLS_k_VISIBLE_STRING) &&
+             (ps_obj->s_attr.e_dataType != EPLS_k_OCTET_STRING)) ||
+            (ps_obj->s_attr.dw_objLen > (UINT32)SOD_cfg_SNAPSHOT_LEN)))
+  {
+    SERR_SetError(B_INSTNUM_ SOD_k_ERR_ATTR_SNAPSHOT,
+                  ((UINT32)(ps_obj->w_index)<<16)+ps_obj->b_subIndex);
+  }
+#endif
   /* else attribute is ok */
   else
   {
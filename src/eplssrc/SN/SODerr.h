@@ -144,6 +144,32 @@
 #define SOD_k_ERR_TYPE_LEN_5            SOD_ERR_FATAL(64)
 #define SOD_k_ERR_TYPE_NOT_SUPPORTED    SOD_ERR_FATAL(65)
 
+/** SOD_SegWrite */
+#define SOD_k_ERR_OFFSET_SIZE_3         SOD_ERR_FATAL(66) /* (0607 0012h) */
+#define SOD_k_ERR_NO_SEG_WRITE_SESSION  SOD_ERR_FATAL(67) /* (0800 0000h) */
+
+/** SODstream.c **/
+#define SOD_k_ERR_SAPL_STREAM_BEGIN     SOD_ERR_MINOR(68) /* Abort code
+                                                             provided by the
+                                                             application */
+#define SOD_k_ERR_SAPL_STREAM_WRITE     SOD_ERR_MINOR(69) /* Abort code
+                                                             provided by the
+                                                             application */
+#define SOD_k_ERR_SAPL_STREAM_READ      SOD_ERR_MINOR(70) /* Abort code
+                                                             provided by the
+                                                             application */
+#define SOD_k_ERR_SAPL_STREAM_COMMIT    SOD_ERR_MINOR(71) /* Abort code
+                                                             provided by the
+                                                             application */
+
+/** SODchange.c **/
+#define SOD_k_ERR_CHANGE_FEED_SIZE      SOD_ERR_FATAL(72)
+#define SOD_k_ERR_INST_NUM_11           SOD_ERR_FATAL(73)
+#define SOD_k_ERR_CHANGE_BUF_INVALID    SOD_ERR_FATAL(74)
+
+/** SODcheck.c, SOD_cfg_SNAPSHOT **/
+#define SOD_k_ERR_ATTR_SNAPSHOT         SOD_ERR_FATAL(75)
+
 /** @} */
 
 /**
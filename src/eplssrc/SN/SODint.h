@@ -76,6 +76,55 @@ BOOLEAN SOD_HdlValid(BYTE_B_INSTNUM_ UINT32 dw_hdl,
 */
 const SOD_t_OBJECT *SOD_GetSodStartAddr(BYTE_B_INSTNUM);
 
+#if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+/**
+* @brief This function gets the number of SOD entries.
+*
+* @param      b_instNum      instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return     Number of SOD entries, calculated by SOD_InitAddr().
+*/
+UINT16 SOD_GetNoOdEntries(BYTE_B_INSTNUM);
+
+/**
+* @brief This function clears the change marks of all SOD entries.
+*
+* @param        b_instNum         instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return
+* - TRUE            - success
+* - FALSE           - failure, the SOD has more entries than SOD_cfg_MAX_CHANGE_ENTRIES
+*/
+BOOLEAN SOD_ChangeInit(BYTE_B_INSTNUM);
+
+/**
+* @brief This function marks a written SOD entry as changed.
+*
+* @param        b_instNum         instance number (not checked, checked in SOD_Write() or SOD_SegWrite()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        ps_object         reference to the written SOD entry (not checked, checked in SOD_Write() or SOD_SegWriteOpen()) valid range: <> NULL
+*/
+void SOD_ChangeMark(BYTE_B_INSTNUM_ const SOD_t_OBJECT *ps_object);
+#endif
+
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+/**
+* @brief This function initializes the upload snapshot, no snapshot is open.
+*
+* @param        b_instNum         instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*/
+void SOD_SnapInit(BYTE_B_INSTNUM);
+
+/**
+* @brief This function copies the data of the uploaded object into the snapshot buffer before the first write during the upload.
+*
+* @param        b_instNum         instance number (not checked, checked in SOD_Write() or SOD_SegWrite()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        ps_object         reference to the SOD entry to be written (not checked, checked in SOD_Write() or SOD_SegWriteOpen()) valid range: <> NULL
+*/
+void SOD_SnapCopyOnWrite(BYTE_B_INSTNUM_ const SOD_t_OBJECT *ps_object);
+#endif
+
 /**
 * @brief This function checks the openSAFETY Object Dictionary (SOD), calculates and sets the length of the SOD.
 *
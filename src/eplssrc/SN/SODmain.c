@@ -108,6 +108,24 @@ static BOOLEAN CallAfterWriteClbk(BYTE_B_INSTNUM_
 static void DataCpy(const void *pv_data, const SOD_t_OBJECT *ps_object,
                     UINT32 dw_offset, UINT32 dw_size);
 
+#if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+/**
+ * Structured data type of a segmented write session, see SOD_SegWriteOpen().
+*/
+typedef struct
+{
+  /** object written in the session, NULL if no session is open */
+  const SOD_t_OBJECT *ps_object;
+  /** object data the segments are copied into */
+  UINT8 *pb_dst;
+} t_SEG_WRITE;
+
+/**
+ * Array of the segmented write sessions of every instance.
+*/
+static t_SEG_WRITE as_SegWrite[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+#endif
+
 /**
  * @brief This function initializes all module global and global variables defined in the unit SOD and checks the SOD.
  *
@@ -134,10 +152,26 @@ BOOLEAN SOD_Init(BYTE_B_INSTNUM)
   #endif
     {
       SOD_InitFlags(B_INSTNUM);
+      #if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+        SOD_SnapInit(B_INSTNUM);
+      #endif
+      #if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+        /* no segmented write session is open */
+        as_SegWrite[B_INSTNUMidx].ps_object = (const SOD_t_OBJECT *)NULL;
+        as_SegWrite[B_INSTNUMidx].pb_dst = (UINT8 *)NULL;
+      #endif
 
       /* if the initialization function finished successfully */
       if (SOD_InitAddr(B_INSTNUM))
       {
+        #if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+          /* if the change marks could not be initialized */
+          if (!SOD_ChangeInit(B_INSTNUM))
+          {
+            /* error has already been signaled */
+          }
+          else
+        #endif
         /* if SOD checking was successful */
         if (SOD_Check(B_INSTNUM))
         {
@@ -467,8 +501,15 @@ BOOLEAN SOD_Write(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
                                               exceeds the defined limit of 10 */
                         {
                         /* RSM_IGNORE_QUALITY_END */
+                          #if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+                            /* the data of a running upload is kept */
+                            SOD_SnapCopyOnWrite(B_INSTNUM_ ps_object);
+                          #endif
                           /* data is copied */
                           DataCpy(pv_data, ps_object, dw_offset, dw_size);
+                          #if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+                            SOD_ChangeMark(B_INSTNUM_ ps_object);
+                          #endif
 
                           /* the segmented object callback will be called with 
                              SOD_k_SRV_AFTER_WRITE service*/
@@ -506,6 +547,200 @@ BOOLEAN SOD_Write(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
 }
   /* RSM_IGNORE_QUALITY_END */
 
+#if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+/**
+ * @brief This function opens a segmented write session for the given object.
+ *
+ * The checks of SOD_Write() which do not depend on the segment are done once here: the SOD must be
+ * locked, the SOD write access enabled, the object must not be an application object, the data type
+ * must be DOMAIN, VISIBLE STRING or OCTET STRING and the object must be writeable. The reference to
+ * the object data is also resolved once. Afterwards the segments are written with SOD_SegWrite()
+ * directly from the received frame into the object. The session is closed with SOD_SegWriteClose()
+ * before the SOD is unlocked.
+ *
+ * @note If the session cannot be opened, no error is signaled. The caller has to write the
+ * segments via SOD_Write(), which signals the error of the failed check.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry got by SOD_AttrGet() (checked) valid range: (UINT32)
+ *
+ * @param        o_appObj           application object flag got by SOD_AttrGet() if (SOD_cfg_APPLICATION_OBJ == EPLS_k_ENABLE) (checked) if (SOD_cfg_APPLICATION_OBJ == EPLS_k_DISABLE) (not used) (not checked, any value allowed) valid range: TRUE, FALSE
+ *
+ * @return
+ * - TRUE             - session is open, the segments have to be written with SOD_SegWrite()
+ * - FALSE            - no session is open, the segments have to be written with SOD_Write()
+ */
+BOOLEAN SOD_SegWriteOpen(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  t_SEG_WRITE *ps_seg = &as_SegWrite[B_INSTNUMidx]; /* pointer to the session */
+  const SOD_t_OBJECT *ps_object; /* pointer to an object in the OD */
+  void *pv_objData; /* pointer to the object data */
+  #if (SOD_cfg_APPLICATION_OBJ == EPLS_k_DISABLE)
+    o_appObj = o_appObj; /* to avoid compiler warning */
+  #endif
+
+  ps_seg->ps_object = (const SOD_t_OBJECT *)NULL;
+  ps_seg->pb_dst = (UINT8 *)NULL;
+
+  /* if the SOD is locked, the SOD write access is enabled and the object is
+        not managed by the application */
+  if (SOD_IsLocked(B_INSTNUM) && SOD_WriteAccess(B_INSTNUM)
+  #if (SOD_cfg_APPLICATION_OBJ == EPLS_k_ENABLE)
+      && (!o_appObj)
+  #endif
+     )
+  {
+    /* if dw_hdl is valid */
+    if (SOD_HdlValid(B_INSTNUM_ dw_hdl, (SOD_t_ERROR_RESULT *)NULL))
+    {
+      /* set a pointer to the object */
+      ps_object = (const SOD_t_OBJECT *)(dw_hdl); /*lint !e923
+                                Note 923: cast from unsigned long to
+                                pointer [MISRA 2004 Rule 11.3] */
+
+      /* if the object is a writeable DOMAIN, VISIBLE STRING or OCTET STRING */
+      if (((ps_object->s_attr.e_dataType == EPLS_k_DOMAIN) ||
+           (ps_object->s_attr.e_dataType == EPLS_k_VISIBLE_STRING) ||
+           (ps_object->s_attr.e_dataType == EPLS_k_OCTET_STRING)) &&
+          (EPLS_IS_BIT_SET(ps_object->s_attr.w_attr, SOD_k_ATTR_WO)))
+      {
+        pv_objData =
+            ((SOD_t_ACT_LEN_PTR_DATA *)(ps_object->pv_objData))->pv_objData;
+
+        /* if SOD_k_ATTR_P2P is set */
+        if (EPLS_IS_BIT_SET(ps_object->s_attr.w_attr, SOD_k_ATTR_P2P))
+        {
+          /* pointer to the data is solved */
+          ps_seg->pb_dst = (UINT8 *)(*((PTR_TYPE *)(pv_objData))); /*lint !e923
+                                          Note 923: cast from unsigned long to
+                                          pointer [MISRA 2004 Rule 11.3] */
+        }
+        /* else SOD_k_ATTR_P2P is not set */
+        else
+        {
+          ps_seg->pb_dst = (UINT8 *)pv_objData;
+        }
+
+        ps_seg->ps_object = ps_object;
+        o_ret = TRUE;
+      }
+      /* no else : the segments are written with SOD_Write() */
+    }
+    /* no else : dw_hdl is invalid, error has already been signaled */
+  }
+  /* no else : the segments are written with SOD_Write() */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+
+/**
+ * @brief This function writes a segment of the object of the open segmented write session.
+ *
+ * The segment is copied directly from pv_data into the object. Only the checks which depend on the
+ * segment are done: the offset and size, the characters of a VISIBLE STRING and the before write
+ * callback of the object. The SOD write access is checked again, because it may be disabled by the
+ * application while the session is open. As in SOD_Write(), the after write callback is only called, if
+ * (dw_offset+dw_size) equal the actual length of the object.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        pb_data            reference to the segment in the received frame (pointer not checked, only called with reference to array in SSDOS_SodAcsWrite()) valid range: <> NULL
+ *
+ * @param        dw_offset          start offset in bytes of the segment within the data block (checked) valid range: (UINT32)
+ *
+ * @param        dw_size            size in bytes of the segment (checked) valid range: (UINT32)
+ *
+ * @return
+ * - TRUE             - success
+ * - FALSE            - failure
+ */
+BOOLEAN SOD_SegWrite(BYTE_B_INSTNUM_ const UINT8 *pb_data, UINT32 dw_offset,
+                     UINT32 dw_size)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  const t_SEG_WRITE *ps_seg = &as_SegWrite[B_INSTNUMidx]; /* pointer to the
+                                                             session */
+  const SOD_t_OBJECT *ps_object = ps_seg->ps_object; /* written object */
+
+  /* if no session is open */
+  if (ps_object == NULL)
+  {
+    SERR_SetError(B_INSTNUM_ SOD_k_ERR_NO_SEG_WRITE_SESSION,
+                  (UINT32)SOD_ABT_GENERAL_ERROR);
+  }
+  /* else if the SOD write access was disabled after the session was opened */
+  else if (!SOD_WriteAccess(B_INSTNUM))
+  {
+    SERR_SetError(B_INSTNUM_ SOD_k_ERR_SOD_WRITE_DISABLED,
+                  (UINT32)SOD_ABT_PRESENT_DEVICE_STATE);
+  }
+  /* else if offset or/and size are invalid, (dw_offset + dw_size) <=
+          dw_objLen does not work because of UINT32 overflow */
+  else if ((dw_offset >= ps_object->s_attr.dw_objLen) ||
+           (dw_size > (ps_object->s_attr.dw_objLen-dw_offset)))
+  {
+    SERR_SetError(B_INSTNUM_ SOD_k_ERR_OFFSET_SIZE_3,
+                  (UINT32)SOD_ABT_LEN_IS_TOO_HIGH);
+  }
+  /* else if the segment of a visible string is invalid */
+  else if ((ps_object->s_attr.e_dataType == EPLS_k_VISIBLE_STRING) &&
+           (!VisibleStringCheck(B_INSTNUM_ pb_data, dw_size)))
+  {
+    /* error has already been signaled */
+  }
+  /* else if the object callback with SOD_k_SRV_BEFORE_WRITE service
+          failed */
+  else if (!CallBeforeWriteClbk(B_INSTNUM_ pb_data, ps_object, dw_offset,
+                                dw_size))
+  {
+    /* error has already been signaled */
+  }
+  else /* segment is valid */
+  {
+    #if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+      /* the data of a running upload is kept */
+      SOD_SnapCopyOnWrite(B_INSTNUM_ ps_object);
+    #endif
+    /* the segment is copied into the object dictionary */
+    (void)MEMCOPY((void *)(ADD_OFFSET(ps_seg->pb_dst, dw_offset)), pb_data,
+                  dw_size);
+    #if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+      SOD_ChangeMark(B_INSTNUM_ ps_object);
+    #endif
+
+    /* the segmented object callback will be called with
+       SOD_k_SRV_AFTER_WRITE service */
+    o_ret = CallAfterWriteClbk(B_INSTNUM_ ps_object, dw_offset, dw_size);
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+
+/**
+ * @brief This function closes the segmented write session.
+ *
+ * The function may also be called, if no session is open.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SOD_SegWriteClose(BYTE_B_INSTNUM)
+{
+  as_SegWrite[B_INSTNUMidx].ps_object = (const SOD_t_OBJECT *)NULL;
+  as_SegWrite[B_INSTNUMidx].pb_dst = (UINT8 *)NULL;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+#endif
+
 #if (EPLS_cfg_ERROR_STRING == EPLS_k_ENABLE)
 /**
 * @brief This function returns a description of every available errors of the assigned unit.
@@ -605,6 +840,25 @@ BOOLEAN SOD_Write(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
                 SOD_k_ERR_OFFSET_SIZE_2, dw_addInfo);
         break;
       }
+      #if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+        case SOD_k_ERR_OFFSET_SIZE_3:
+        {
+          SPRINTF2(pac_str, "%#x - SOD_k_ERR_OFFSET_SIZE_3: SOD_SegWrite():\n"
+                          "The byte position is outside of the object "
+                          "data range (offset or/and size are wrong). "
+                          "SSDO abort code : %#lx\n",
+                  SOD_k_ERR_OFFSET_SIZE_3, dw_addInfo);
+          break;
+        }
+        case SOD_k_ERR_NO_SEG_WRITE_SESSION:
+        {
+          SPRINTF1(pac_str, "%#x - SOD_k_ERR_NO_SEG_WRITE_SESSION: "
+                          "SOD_SegWrite():\n"
+                          "No segmented write session is open.\n",
+                  SOD_k_ERR_NO_SEG_WRITE_SESSION);
+          break;
+        }
+      #endif
       case SOD_k_ERR_SAPL_WRITE:
       {
         SPRINTF2(pac_str, "%#x - SOD_k_ERR_SAPL_WRITE: SOD_Write():\n"
@@ -1149,6 +1403,84 @@ BOOLEAN SOD_Write(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
                 HIGH16(dw_addInfo), (UINT8)(dw_addInfo));
         break;
       }
+      #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+        case SOD_k_ERR_SAPL_STREAM_BEGIN:
+        {
+          SPRINTF2(pac_str, "%#x - SOD_k_ERR_SAPL_STREAM_BEGIN: SOD_StreamBegin():\n"
+                          "The SAPL_SOD_StreamBeginClbk() application callback "
+                          "function has aborted the transfer. "
+                          "SSDO abort code : %#lx\n",
+                  SOD_k_ERR_SAPL_STREAM_BEGIN, dw_addInfo);
+          break;
+        }
+        case SOD_k_ERR_SAPL_STREAM_WRITE:
+        {
+          SPRINTF2(pac_str, "%#x - SOD_k_ERR_SAPL_STREAM_WRITE: SOD_StreamWrite():\n"
+                          "The SAPL_SOD_StreamWriteClbk() application callback "
+                          "function has aborted the transfer. "
+                          "SSDO abort code : %#lx\n",
+                  SOD_k_ERR_SAPL_STREAM_WRITE, dw_addInfo);
+          break;
+        }
+        case SOD_k_ERR_SAPL_STREAM_READ:
+        {
+          SPRINTF2(pac_str, "%#x - SOD_k_ERR_SAPL_STREAM_READ: SOD_StreamRead():\n"
+                          "The SAPL_SOD_StreamReadClbk() application callback "
+                          "function has aborted the transfer. "
+                          "SSDO abort code : %#lx\n",
+                  SOD_k_ERR_SAPL_STREAM_READ, dw_addInfo);
+          break;
+        }
+        case SOD_k_ERR_SAPL_STREAM_COMMIT:
+        {
+          SPRINTF2(pac_str, "%#x - SOD_k_ERR_SAPL_STREAM_COMMIT: SOD_StreamCommit():\n"
+                          "The SAPL_SOD_StreamCommitClbk() application callback "
+                          "function has aborted the transfer. "
+                          "SSDO abort code : %#lx\n",
+                  SOD_k_ERR_SAPL_STREAM_COMMIT, dw_addInfo);
+          break;
+        }
+      #endif
+      #if (SOD_cfg_CHANGE_FEED == EPLS_k_ENABLE)
+        /** SODchange.c **/
+        case SOD_k_ERR_CHANGE_FEED_SIZE:
+        {
+          SPRINTF2(pac_str, "%#x - SOD_k_ERR_CHANGE_FEED_SIZE: SOD_ChangeInit():\n"
+                          "The SOD has more entries (%lu) than "
+                          "SOD_cfg_MAX_CHANGE_ENTRIES.\n",
+                  SOD_k_ERR_CHANGE_FEED_SIZE, dw_addInfo);
+          break;
+        }
+        case SOD_k_ERR_INST_NUM_11:
+        {
+          SPRINTF2(pac_str, "%#x - SOD_k_ERR_INST_NUM_11: SOD_ChangedGet():\n"
+                          "Instance number is invalid. "
+                          "SSDO abort code : %#lx\n",
+                  SOD_k_ERR_INST_NUM_11, dw_addInfo);
+          break;
+        }
+        case SOD_k_ERR_CHANGE_BUF_INVALID:
+        {
+          SPRINTF1(pac_str, "%#x - SOD_k_ERR_CHANGE_BUF_INVALID: SOD_ChangedGet():\n"
+                          "The reference to the handle buffer is NULL.\n",
+                  SOD_k_ERR_CHANGE_BUF_INVALID);
+          break;
+        }
+      #endif
+      #if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+        /** SODcheck.c **/
+        case SOD_k_ERR_ATTR_SNAPSHOT:
+        {
+          SPRINTF3(pac_str, "%#x - SOD_k_ERR_ATTR_SNAPSHOT: AttrCheck():\n"
+                          "SOD_k_ATTR_SNAPSHOT is set for the object "
+                          "with SOD index (%#x) sub-index (%#x), but the "
+                          "object is not a DOMAIN, VISIBLE STRING or OCTET "
+                          "STRING or longer than SOD_cfg_SNAPSHOT_LEN.\n",
+                  SOD_k_ERR_ATTR_SNAPSHOT,
+                  HIGH16(dw_addInfo),(UINT8)dw_addInfo);
+          break;
+        }
+      #endif
       default:
       {
         SPRINTF(pac_str, "Unknown error code was generated by the SOD\n");
@@ -0,0 +1,219 @@
+/**
+ * @addtogroup SOD
+ * @{
+ *
+ * @file SODsnap.c
+ *
+ * This file contains the upload snapshots of the SOD.
+ *
+ * A segmented SSDO upload of an object with the attribute SOD_k_ATTR_SNAPSHOT opens the snapshot
+ * of the instance with SOD_SnapOpen() and reads the segments with SOD_SnapRead(). As long as the
+ * object is not written, the segments are read directly from the object. The first write via
+ * SOD_Write() or SOD_SegWrite() copies the data of the object into the snapshot buffer before it
+ * is overwritten (copy on write), all further segments of the upload are read from the buffer.
+ * So the upload gets the data as it was at the start of the upload, while the writes go to the
+ * object without waiting for the end of the upload. SOD_SnapClose() ends the snapshot.
+ *
+ * @copyright Copyright (c) 2009,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H and IXXAT Automation GmbH
+ * @copyright All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * @copyright This source code is free software; you can redistribute it and/or modify it under the terms of the BSD license (according to License.txt).
+ *
+ */
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SERRapi.h"
+#include "SERR.h"
+
+#include "SCFMapi.h"
+
+#include "SODerr.h"
+#include "SODapi.h"
+#include "SOD.h"
+#include "SODint.h"
+
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+
+/**
+ * Structure of the upload snapshot of an instance.
+*/
+typedef struct
+{
+  /** object of the running upload, NULL if no snapshot is open */
+  const SOD_t_OBJECT *ps_object;
+  /** TRUE if the object was written and the upload reads from ab_data */
+  BOOLEAN o_copied;
+  /** data of the object at the start of the upload */
+  UINT8 ab_data[SOD_cfg_SNAPSHOT_LEN];
+} t_SOD_SNAP_OBJ;
+
+/**
+ * Upload snapshot of every instance.
+*/
+static t_SOD_SNAP_OBJ as_Snap[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+/**
+* @brief This function initializes the upload snapshot, no snapshot is open.
+*
+* @param        b_instNum         instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*/
+void SOD_SnapInit(BYTE_B_INSTNUM)
+{
+  as_Snap[B_INSTNUMidx].ps_object = (const SOD_t_OBJECT *)NULL;
+  as_Snap[B_INSTNUMidx].o_copied = FALSE;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function opens the snapshot for the segmented upload of the given object.
+ *
+ * The snapshot is only opened for objects with the attribute SOD_k_ATTR_SNAPSHOT, otherwise
+ * SOD_SnapRead() reads the object like SOD_Read(). A snapshot which is still open is closed.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry got by SOD_AttrGet() (not checked, checked in SOD_AttrGet()) valid range: (UINT32)
+ *
+ * @param        o_appObj           application object flag got by SOD_AttrGet(), no snapshot is opened for application objects (not checked, any value allowed) valid range: TRUE, FALSE
+ */
+void SOD_SnapOpen(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj)
+{
+  t_SOD_SNAP_OBJ *po_this = &as_Snap[B_INSTNUMidx]; /* instance pointer */
+  const SOD_t_OBJECT *ps_object; /* pointer to the object in the OD */
+
+  po_this->ps_object = (const SOD_t_OBJECT *)NULL;
+  po_this->o_copied = FALSE;
+
+  /* if the object is in the OD */
+  if (!o_appObj)
+  {
+    ps_object = (const SOD_t_OBJECT *)(dw_hdl); /*lint !e923
+                                    Note 923: cast from unsigned long to
+                                    pointer [MISRA 2004 Rule 11.3] */
+
+    /* if the object is uploaded from a snapshot */
+    if (EPLS_IS_BIT_SET(ps_object->s_attr.w_attr, SOD_k_ATTR_SNAPSHOT))
+    {
+      po_this->ps_object = ps_object;
+    }
+    /* no else : the object is read directly */
+  }
+  /* no else : application objects are read via SAPL_SOD_ReadClbk() */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function reads a segment of the uploaded object.
+ *
+ * The segment is read via SOD_Read(), so all checks and the object callback with the
+ * SOD_k_SRV_BEFORE_READ service are done as for a direct read. If the object was written
+ * since SOD_SnapOpen(), the segment is taken from the snapshot buffer.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the SOD entry, see SOD_Read()
+ *
+ * @param        o_appObj           application object flag, see SOD_Read()
+ *
+ * @param        dw_offset          start offset in bytes of the segment within the data block, see SOD_Read()
+ *
+ * @param        dw_size            size in bytes of the segment, see SOD_Read()
+ *
+ * @retval       ps_errRes          error result, see SOD_Read()
+ *
+ * @return
+ * - <> NULL          - pointer to the segment
+ * - == NULL          - failure, see ps_errRes
+ */
+void *SOD_SnapRead(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
+                   UINT32 dw_offset, UINT32 dw_size,
+                   SOD_t_ERROR_RESULT *ps_errRes)
+{
+  void *pv_ret; /* return value */
+  const t_SOD_SNAP_OBJ *po_this = &as_Snap[B_INSTNUMidx]; /* instance
+                                                             pointer */
+
+  pv_ret = SOD_Read(B_INSTNUM_ dw_hdl, o_appObj, dw_offset, dw_size, ps_errRes);
+
+  /* if the segment was read and the object was written during the upload */
+  if ((pv_ret != NULL) && (po_this->o_copied) && (!o_appObj) &&
+      (dw_hdl == (UINT32)(po_this->ps_object))) /*lint !e923
+                                    Note 923: cast from pointer to
+                                    unsigned long [MISRA 2004 Rule 11.3] */
+  {
+    /* offset and size were checked by SOD_Read() */
+    pv_ret = (void *)&(po_this->ab_data[dw_offset]);
+  }
+  /* no else : the segment is read from the object */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return pv_ret;
+}
+
+/**
+ * @brief This function closes the snapshot at the end or the abort of the upload.
+ *
+ * The function may also be called, if no snapshot is open.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SOD_SnapClose(BYTE_B_INSTNUM)
+{
+  as_Snap[B_INSTNUMidx].ps_object = (const SOD_t_OBJECT *)NULL;
+  as_Snap[B_INSTNUMidx].o_copied = FALSE;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function copies the data of the uploaded object into the snapshot buffer before the first write during the upload.
+*
+* @param        b_instNum         instance number (not checked, checked in SOD_Write() or SOD_SegWrite()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        ps_object         reference to the SOD entry to be written (not checked, checked in SOD_Write() or SOD_SegWriteOpen()) valid range: <> NULL
+*/
+void SOD_SnapCopyOnWrite(BYTE_B_INSTNUM_ const SOD_t_OBJECT *ps_object)
+{
+  t_SOD_SNAP_OBJ *po_this = &as_Snap[B_INSTNUMidx]; /* instance pointer */
+  void *pv_objData; /* pointer to the object data */
+
+  /* if the uploaded object is written the first time */
+  if ((ps_object == po_this->ps_object) && (!po_this->o_copied))
+  {
+    /* only DOMAIN, VISIBLE STRING and OCTET STRING objects are allowed,
+       see AttrCheck() */
+    pv_objData = ((SOD_t_ACT_LEN_PTR_DATA *)(ps_object->pv_objData))->pv_objData;
+
+    /* if SOD_k_ATTR_P2P is set */
+    if (EPLS_IS_BIT_SET(ps_object->s_attr.w_attr, SOD_k_ATTR_P2P))
+    {
+      /* pointer to the data is solved */
+      pv_objData = (void *)(*((PTR_TYPE *)(pv_objData))); /*lint !e923
+                                     Note 923: cast from unsigned long to
+                                     pointer [MISRA 2004 Rule 11.3] */
+    }
+    /* no else : SOD_k_ATTR_P2P is not set */
+
+    /* the length was checked against SOD_cfg_SNAPSHOT_LEN in AttrCheck() */
+    MEMCOPY(po_this->ab_data, pv_objData, ps_object->s_attr.dw_objLen);
+    po_this->o_copied = TRUE;
+  }
+  /* no else : no upload of this object or the data is already kept */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+#endif
+
+/** @} */
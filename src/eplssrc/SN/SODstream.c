@@ -0,0 +1,234 @@
+/**
+ * @addtogroup SOD
+ * @{
+ *
+ * @file SODstream.c
+ *
+ * This file passes the streamed transfers of the application objects with the attribute
+ * SOD_k_ATTR_STREAM to the application.
+ *
+ * A streamed transfer is started by SOD_StreamBegin(), the object data is passed chunk by
+ * chunk via SOD_StreamWrite() or SOD_StreamRead() and the transfer is finished by
+ * SOD_StreamCommit() or SOD_StreamAbort(). Every step except the abort may be answered by
+ * the application with SOD_k_STREAM_NOT_READY, then the caller has to repeat the same step
+ * later.
+ *
+ * @copyright Copyright (c) 2009,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H and IXXAT Automation GmbH
+ * @copyright All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * @copyright This source code is free software; you can redistribute it and/or modify it under the terms of the BSD license (according to License.txt).
+ *
+ */
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SERRapi.h"
+#include "SERR.h"
+
+#include "SCFMapi.h"
+
+#include "SODerr.h"
+#include "SODapi.h"
+#include "SOD.h"
+
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+
+static SOD_t_STREAM_RESULT StreamResult(BYTE_B_INSTNUM_
+                                        SOD_t_STREAM_RESULT e_result,
+                                        SOD_t_ABORT_CODES e_saplError,
+                                        UINT16 w_errorCode);
+
+/**
+ * @brief This function starts the streamed transfer of an application object.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        o_download
+ * - TRUE  : the object is written
+ * - FALSE : the object is read (not checked, any value allowed) valid range: TRUE, FALSE
+ *
+ * @param        dw_totalSize       declared total size in bytes, 0 if unknown (not checked, any value allowed) valid range: (UINT32)
+ *
+ * @return       see SOD_t_STREAM_RESULT, in case of SOD_k_STREAM_ABORT the error is already reported with the abort code as additional info
+ */
+SOD_t_STREAM_RESULT SOD_StreamBegin(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+                                    BOOLEAN o_download, UINT32 dw_totalSize)
+{
+  SOD_t_STREAM_RESULT e_result; /* result of the SAPL callback */
+  SOD_t_ABORT_CODES e_saplError = SOD_ABT_GENERAL_ERROR; /* abort code of the
+                                                            SAPL callback */
+
+  e_result = SAPL_SOD_StreamBeginClbk(B_INSTNUM_ dw_hdl, o_download,
+                                      dw_totalSize, &e_saplError);
+
+  e_result = StreamResult(B_INSTNUM_ e_result, e_saplError,
+                          SOD_k_ERR_SAPL_STREAM_BEGIN);
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return e_result;
+}
+
+/**
+ * @brief This function passes a chunk of a streamed download to the application.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        pb_data            reference to the chunk (pointer not checked, only called with reference to array in SSDOS_SodAcsWrite()) valid range: <> NULL
+ *
+ * @param        dw_offset          start offset in bytes of the chunk within the object (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        dw_size            size in bytes of the chunk (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @return       see SOD_t_STREAM_RESULT, in case of SOD_k_STREAM_ABORT the error is already reported with the abort code as additional info
+ */
+SOD_t_STREAM_RESULT SOD_StreamWrite(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+                                    const UINT8 *pb_data, UINT32 dw_offset,
+                                    UINT32 dw_size)
+{
+  SOD_t_STREAM_RESULT e_result; /* result of the SAPL callback */
+  SOD_t_ABORT_CODES e_saplError = SOD_ABT_GENERAL_ERROR; /* abort code of the
+                                                            SAPL callback */
+
+  e_result = SAPL_SOD_StreamWriteClbk(B_INSTNUM_ dw_hdl, pb_data, dw_offset,
+                                      dw_size, &e_saplError);
+
+  e_result = StreamResult(B_INSTNUM_ e_result, e_saplError,
+                          SOD_k_ERR_SAPL_STREAM_WRITE);
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return e_result;
+}
+
+/**
+ * @brief This function fetches a chunk of a streamed upload from the application.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @retval       pb_data            buffer for the chunk (pointer not checked, only called with reference to array in SSDOS_SodAcsRead()) valid range: <> NULL
+ *
+ * @param        dw_offset          start offset in bytes of the chunk within the object (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        dw_size            size in bytes of the chunk (not checked, checked in SSDOS_SodAcsRead()) valid range: 1..EPLS_cfg_MAX_PYLD_LEN
+ *
+ * @return       see SOD_t_STREAM_RESULT, in case of SOD_k_STREAM_ABORT the error is already reported with the abort code as additional info
+ */
+SOD_t_STREAM_RESULT SOD_StreamRead(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+                                   UINT8 *pb_data, UINT32 dw_offset,
+                                   UINT32 dw_size)
+{
+  SOD_t_STREAM_RESULT e_result; /* result of the SAPL callback */
+  SOD_t_ABORT_CODES e_saplError = SOD_ABT_GENERAL_ERROR; /* abort code of the
+                                                            SAPL callback */
+
+  e_result = SAPL_SOD_StreamReadClbk(B_INSTNUM_ dw_hdl, pb_data, dw_offset,
+                                     dw_size, &e_saplError);
+
+  e_result = StreamResult(B_INSTNUM_ e_result, e_saplError,
+                          SOD_k_ERR_SAPL_STREAM_READ);
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return e_result;
+}
+
+/**
+ * @brief This function finishes a streamed transfer successfully.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ *
+ * @param        dw_size            number of transferred bytes (not checked, any value allowed) valid range: (UINT32)
+ *
+ * @return       see SOD_t_STREAM_RESULT, in case of SOD_k_STREAM_ABORT the error is already reported with the abort code as additional info
+ */
+SOD_t_STREAM_RESULT SOD_StreamCommit(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+                                     UINT32 dw_size)
+{
+  SOD_t_STREAM_RESULT e_result; /* result of the SAPL callback */
+  SOD_t_ABORT_CODES e_saplError = SOD_ABT_GENERAL_ERROR; /* abort code of the
+                                                            SAPL callback */
+
+  e_result = SAPL_SOD_StreamCommitClbk(B_INSTNUM_ dw_hdl, dw_size,
+                                       &e_saplError);
+
+  e_result = StreamResult(B_INSTNUM_ e_result, e_saplError,
+                          SOD_k_ERR_SAPL_STREAM_COMMIT);
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return e_result;
+}
+
+/**
+ * @brief This function signals the abort of a started streamed transfer to the application.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        dw_hdl             handle/reference to the application object got by SOD_AttrGet() (not checked, checked by the application) valid range: (UINT32)
+ */
+void SOD_StreamAbort(BYTE_B_INSTNUM_ UINT32 dw_hdl)
+{
+  SAPL_SOD_StreamAbortClbk(B_INSTNUM_ dw_hdl);
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function reports the abort of a SAPL stream callback.
+ *
+ * An undefined result of the application is handled as SOD_k_STREAM_ABORT.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        e_result           result of the SAPL callback (checked) valid range: see SOD_t_STREAM_RESULT
+ *
+ * @param        e_saplError        abort code of the SAPL callback (not checked, any value allowed) valid range: see SOD_t_ABORT_CODES
+ *
+ * @param        w_errorCode        error code to be reported (not checked, only called with define) valid range: SOD_k_ERR_SAPL_STREAM_...
+ *
+ * @return       see SOD_t_STREAM_RESULT
+ */
+static SOD_t_STREAM_RESULT StreamResult(BYTE_B_INSTNUM_
+                                        SOD_t_STREAM_RESULT e_result,
+                                        SOD_t_ABORT_CODES e_saplError,
+                                        UINT16 w_errorCode)
+{
+  SOD_t_STREAM_RESULT e_ret = SOD_k_STREAM_ABORT; /* return value */
+
+  /* if the step is done or has to be repeated */
+  if ((e_result == SOD_k_STREAM_DONE) || (e_result == SOD_k_STREAM_NOT_READY))
+  {
+    e_ret = e_result;
+  }
+  else /* the transfer has to be aborted */
+  {
+    /* if the application did not set an abort code */
+    if (e_saplError == SOD_ABT_NO_ERROR)
+    {
+      e_saplError = SOD_ABT_GENERAL_ERROR;
+    }
+    /* no else : abort code of the application is reported */
+
+    SERR_SetError(B_INSTNUM_ w_errorCode, (UINT32)e_saplError);
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+  return e_ret;
+}
+
+#endif
+
+/** @} */
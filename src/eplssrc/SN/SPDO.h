@@ -105,6 +105,37 @@ void SPDO_SetToPreOp(BYTE_B_INSTNUM);
 */
 void SPDO_ActivateStart(BYTE_B_INSTNUM);
 
+#if (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE)
+/**
+* @brief This function is called by the SNMTS instead of SPDO_ActivateStart() to check whether the last SPDO activation can be reused.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        dw_paramTs       parameter timestamp of the received SNMTS_SN_set_to_op command (not checked, any value allowed), valid range: (UINT32)
+*
+* @return
+* - TRUE           - SPDOs are still activated for this parameter timestamp, no activation necessary
+* - FALSE          - SPDOs have to be activated
+*/
+BOOLEAN SPDO_ActivateCached(BYTE_B_INSTNUM_ UINT32 dw_paramTs);
+
+/**
+* @brief This function is called by the SNMTS at the transition to Operational to store the parameter timestamp of the activated SPDOs.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        dw_paramTs       parameter timestamp of the received SNMTS_SN_set_to_op command (not checked, any value allowed), valid range: (UINT32)
+*/
+void SPDO_ActivateCacheSet(BYTE_B_INSTNUM_ UINT32 dw_paramTs);
+
+/**
+* @brief This function is called by the SNMTS if a SADR was changed or the parameter checksum is wrong, the SPDOs are activated at the next transition to Operational.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*/
+void SPDO_ActivateCacheClear(BYTE_B_INSTNUM);
+#endif
+
 #endif
 
 /** @} */
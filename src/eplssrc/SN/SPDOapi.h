@@ -89,12 +89,14 @@ void SPDO_ProcessRxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT8 *pb_rxFrm,
 * data for the given Tx SPDO has changed.
 *
 * This Tx SPDO is immediately sent by the SPDO_BuildTxSpdo() before the refresh prescale timeout.
+* If SPDO_cfg_TX_CHANGE_DETECT is enabled, the changes of the mapped data are detected by the
+* openSAFETY Stack and the call is not necessary.
 *
 * @see          SPDO_BuildTxSpdo()
 *
 * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
 *
-* @param        w_txSpdoNum        Tx SPDO number (checked) valid range: 1..SPDO_cfg_MAX_NO_TX_SPDO
+* @param        w_txSpdoNum        Tx SPDO number (checked) valid range: 1..SPDO_cfg_MAX_NO_TX_SPDO, 1..SPDO_GetTxSpdoCap() if EPLS_cfg_RUNTIME_ARENA is enabled
 */
 void SPDO_TxDataChanged(BYTE_B_INSTNUM_ UINT16 w_txSpdoNum);
 
@@ -136,6 +138,169 @@ void SPDO_TxDataChanged(BYTE_B_INSTNUM_ UINT16 w_txSpdoNum);
 BOOLEAN SPDO_GetRxSpdoStatus(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx, UINT32 const dw_ct,
 	UINT16 * const pw_dCt, UINT32 * const pdw_ageSpdo, UINT16 * const pw_propDel);
 #endif
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+ * Number of 32 bit words of a bit field with one bit per Rx SPDO.
+ */
+#define SPDO_k_RX_SPDO_BIT_WORDS    ((SPDO_cfg_MAX_NO_RX_SPDO + 31) / 32)
+
+/**
+ * Age of a Rx SPDO returned by SPDO_GetRxSpdoStatusBulk() if the data of the Rx SPDO is not valid.
+ */
+#define SPDO_k_AGE_INVALID          0xFFFFFFFFUL
+
+/**
+ * @struct SPDO_t_RX_STATUS_BULK
+ * Structure for the status of all Rx SPDOs of an instance. Bit (i % 32) of word (i / 32)
+ * belongs to the Rx SPDO with the index i.
+ */
+typedef struct
+{
+  /** number of Rx SPDOs defined in the SOD of the instance, the other Rx SPDOs are reported as not valid */
+  UINT16 w_noRxSpdo;
+  /** bit set if the data of the Rx SPDO is valid (see SPDO_GetRxSpdoStatus()) */
+  UINT32 adw_dataValid[SPDO_k_RX_SPDO_BIT_WORDS];
+  /** bit set if the data valid bit changed since the previous call */
+  UINT32 adw_dataValidChanged[SPDO_k_RX_SPDO_BIT_WORDS];
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+  /** copy of the connection valid bit field */
+  UINT32 adw_connValid[SPDO_k_RX_SPDO_BIT_WORDS];
+  /** bit set if the connection valid bit changed since the previous call */
+  UINT32 adw_connValidChanged[SPDO_k_RX_SPDO_BIT_WORDS];
+#endif
+  /** age of the current data, SPDO_k_AGE_INVALID if the data is not valid */
+  UINT32 adw_ageSpdo[SPDO_cfg_MAX_NO_RX_SPDO];
+} SPDO_t_RX_STATUS_BULK;
+
+/**
+* @brief This function reads the status of all Rx SPDOs of an instance.
+*
+* The changed bits are related to the previous call of this function for the same instance.
+*
+* @param       b_instNum           instance number (checked), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param       dw_ct               actual consecutive time, any value allowed, valid range: UINT32
+*
+* @retval      ps_status           status of all Rx SPDOs (checked), valid range: <> NULL
+*
+* @return
+* - TRUE             - status read
+* - FALSE            - invalid parameter
+*/
+BOOLEAN SPDO_GetRxSpdoStatusBulk(BYTE_B_INSTNUM_ UINT32 const dw_ct,
+	SPDO_t_RX_STATUS_BULK * const ps_status);
+#endif
+
+#if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+/**
+ * Number of buckets of the time synchronization propagation delay histogram.
+ *
+ * Bucket 0 counts the delay 0, bucket i counts the delays 2^(i-1)..2^i-1 and the
+ * last bucket counts all delays from 2^(SPDO_k_TSYNC_HIST_BUCKETS-2) on. The delay
+ * is given in ticks of the consecutive time.
+ */
+#define SPDO_k_TSYNC_HIST_BUCKETS   16
+
+/**
+ * @struct SPDO_t_TSYNC_STAT
+ * Structure for the time synchronization statistic of a Rx SPDO.
+ */
+typedef struct
+{
+  /** number of received TRes with a valid TR, i.e. number of measured propagation delays */
+  UINT32 dw_noTRes;
+  /** minimum measured propagation delay, 0xFFFFFFFF if no delay was measured */
+  UINT32 dw_minDelay;
+  /** maximum measured propagation delay */
+  UINT32 dw_maxDelay;
+  /** mean of the measured propagation delays */
+  UINT32 dw_meanDelay;
+  /** histogram of the measured propagation delays (see SPDO_k_TSYNC_HIST_BUCKETS) */
+  UINT32 adw_hist[SPDO_k_TSYNC_HIST_BUCKETS];
+  /** number of time synchronization failures because SPDO_cfg_NO_NOT_ANSWERED_TR TReqs were not answered */
+  UINT32 dw_noNotAnsweredExp;
+  /** maximum number of not answered TReqs before a time synchronization succeeded or failed */
+  UINT16 w_maxNotAnsweredTReq;
+  /** current number of not answered TReqs */
+  UINT16 w_noNotAnsweredTReq;
+} SPDO_t_TSYNC_STAT;
+
+/**
+* @brief This function reads the time synchronization statistic of a Rx SPDO.
+*
+* The statistic is reset if the Rx SPDO communication parameters are initialized
+* or if o_reset is TRUE. It is kept over the transitions between Pre-operational and Operational.
+*
+* @param       b_instNum           instance number (checked), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param       w_rxSpdoIdx         Rx SPDO index (checked), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+*
+* @param       o_reset             TRUE if the statistic is reset after it was read (not checked, any value allowed)
+*
+* @retval      ps_stat             time synchronization statistic (checked), valid range: <> NULL
+*
+* @return
+* - TRUE             - statistic read
+* - FALSE            - invalid parameter
+*/
+BOOLEAN SPDO_GetTSyncStat(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx,
+	BOOLEAN const o_reset, SPDO_t_TSYNC_STAT * const ps_stat);
+#endif
+
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+/**
+* @brief This function returns the buffer of the Tx process image the application has to write the next payload into.
+*
+* The payload is written in the byte order of the openSAFETY frame. The buffer is not read by the
+* openSAFETY Stack until SPDO_TxPiPublish() is called. Only one application task may write the
+* process image of a Tx SPDO.
+*
+* @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_txSpdoIdx        Tx SPDO index (checked) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+*
+* @return
+* - == NULL          - invalid parameter
+* - <> NULL          - reference to the payload buffer (SPDO_cfg_MAX_LEN_OF_TX_SPDO bytes)
+*/
+UINT8 *SPDO_TxPiGetBuf(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx);
+
+/**
+* @brief This function publishes the payload written into the buffer returned by SPDO_TxPiGetBuf().
+*
+* @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_txSpdoIdx        Tx SPDO index (checked) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+*/
+void SPDO_TxPiPublish(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx);
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+* @brief This function copies the last payload of a Rx SPDO the openSAFETY Stack has published.
+*
+* The payload is either the received process data or the default values of the mapped objects
+* (safe state) in the byte order of the openSAFETY frame. If no consistent copy could be taken,
+* FALSE is returned and the call has to be repeated.
+*
+* @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_rxSpdoIdx        Rx SPDO index (checked) valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+*
+* @retval       pb_data            reference to a buffer of SPDO_cfg_MAX_LEN_OF_RX_SPDO bytes (checked) valid range: <> NULL
+*
+* @retval       pb_len             length of the copied payload (checked) valid range: <> NULL
+*
+* @retval       pdw_seq            publication counter of the copied payload (checked) valid range: <> NULL
+*
+* @return
+* - TRUE             - consistent payload copied
+* - FALSE            - invalid parameter or no consistent copy taken
+*/
+BOOLEAN SPDO_RxPiRead(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT8 *pb_data,
+                      UINT8 *pb_len, UINT32 *pdw_seq);
+#endif
+#endif
 /**
  * This is a callback function ro rx & tx mapping parameter entries sub-indicex 0-253
 *
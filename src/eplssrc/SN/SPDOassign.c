@@ -72,6 +72,14 @@ typedef struct
     #endif
     /** TADR to Tx SPDO index table */
     t_ADR_TO_SPDO_NUM as_tAdrToTxSpdoIdx[SPDO_cfg_MAX_NO_TX_SPDO];
+    #if (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE)
+      #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+        /** number of entries in the sorted SADR to Rx SPDO index table */
+        UINT16 w_noSAdr;
+      #endif
+      /** number of entries in the sorted TADR to Tx SPDO index table */
+      UINT16 w_noTAdr;
+    #endif
   #else
     #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
       /** SADR to Rx SPDO index table */
@@ -91,6 +99,14 @@ typedef struct
 
 static t_ASSIGN_OBJ as_Obj[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
 
+#if (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE)
+static BOOLEAN InsertSortedAdr(t_ADR_TO_SPDO_NUM *ps_table,
+                               UINT16 *pw_noEntries, UINT16 w_maxEntries,
+                               UINT16 w_adr, UINT16 w_spdoIdx);
+static UINT16 SearchSortedAdr(const t_ADR_TO_SPDO_NUM *ps_table,
+                              UINT16 w_noEntries, UINT16 w_adr);
+#endif
+
 /**
  * @brief This function initializes the assignment tables for the SPDOs.
  *
@@ -117,6 +133,13 @@ void SPDO_InitAssign(BYTE_B_INSTNUM)
       po_this->as_tAdrToTxSpdoIdx[i].w_spdoIdx = k_INVALID_SPDO_NUM;
       po_this->as_tAdrToTxSpdoIdx[i].w_adr = k_NOT_USED_ADR;
     }
+
+    #if (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE)
+      #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+        po_this->w_noSAdr = 0U;
+      #endif
+      po_this->w_noTAdr = 0U;
+    #endif
   #else
     /* The TADR to Tx SPDO index table and the SADR to Rx SPDO index
        lookup tables are initialized (k_LOOKUP_TABLE_SIZE is divisible by 4
@@ -182,7 +205,8 @@ void SPDO_InitAssign(BYTE_B_INSTNUM)
     BOOLEAN o_ret = FALSE; /* return value */
     t_ASSIGN_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
     UINT16 w_spdoIdx; /* temporary variable for SPDO index */
-    #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+    #if ((SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE) && \
+         (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_DISABLE))
       BOOLEAN o_break = FALSE; /* flag for breaking the for cycle */
       UINT32 rx; /* loop counter */
       t_ADR_TO_SPDO_NUM *ps_rxTableEntry; /* pointer to access the rx SPDO
@@ -208,7 +232,21 @@ void SPDO_InitAssign(BYTE_B_INSTNUM)
       /* if source address was not found in the target address table */
       if (w_spdoIdx == k_INVALID_SPDO_NUM)
       {
-        #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+        #if (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE)
+          /* SADR to Rx SPDO number is inserted at its sorted position */
+          if (InsertSortedAdr(po_this->as_sAdrToRxSpdoIdx,
+                              &po_this->w_noSAdr,
+                              (UINT16)SPDO_cfg_MAX_NO_RX_SPDO,
+                              w_sAdr, w_rxSpdoIdx))
+          {
+            /* the last and the largest SPDO index is stored */
+            po_this->w_noProcRxSpdo = (UINT16)(w_rxSpdoIdx + 1U);
+
+            o_ret = TRUE;
+          }
+          /* no else : address has been already inserted or table is full
+             error happened (See Returnvalue) */
+        #elif (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
           rx = 0U;
           /* SADR to Rx SPDO number is inserted */
           while ((rx < (UINT32)SPDO_cfg_MAX_NO_RX_SPDO) && (!o_break))
@@ -284,7 +322,8 @@ BOOLEAN SPDO_AddTAdr(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT16 w_tAdr)
   #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
     UINT16 w_spdoIdx; /* temporary variable for SPDO index */
   #endif
-  #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+  #if ((SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE) && \
+       (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_DISABLE))
     BOOLEAN o_break = FALSE; /* flag for breaking the for cycle */
     UINT32 tx; /* loop counter */
     t_ADR_TO_SPDO_NUM *ps_txTableEntry; /* pointer to access the tx SPDO number
@@ -316,7 +355,21 @@ BOOLEAN SPDO_AddTAdr(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT16 w_tAdr)
     {
     /* RSM_IGNORE_QUALITY_END */
 
-      #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+      #if (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE)
+        /* TADR to Tx SPDO index is inserted at its sorted position */
+        if (InsertSortedAdr(po_this->as_tAdrToTxSpdoIdx,
+                            &po_this->w_noTAdr,
+                            (UINT16)SPDO_cfg_MAX_NO_TX_SPDO,
+                            w_tAdr, w_txSpdoIdx))
+        {
+          /* the last and the largest SPDO index is stored */
+          po_this->w_noProcTxSpdo = (UINT16)(w_txSpdoIdx + 1U);
+
+          o_ret = TRUE;
+        }
+        /* no else : address is not free or table is full
+           error happened (See Returnvalue) */
+      #elif (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
         tx = 0U;
         /* TADR to Tx SPDO index is inserted */
         while ((tx < (UINT32)SPDO_cfg_MAX_NO_TX_SPDO) && (!o_break))
@@ -386,12 +439,17 @@ BOOLEAN SPDO_AddTAdr(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT16 w_tAdr)
   {
     UINT16 w_ret = k_INVALID_SPDO_NUM; /* return value */
     t_ASSIGN_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
-    #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+    #if ((SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE) && \
+         (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_DISABLE))
       BOOLEAN o_break = FALSE; /* flag for breaking the for cycle */
       UINT32 i; /* loop counter */
     #endif
 
-    #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+    #if (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE)
+      /* binary search of the SADR */
+      w_ret = SearchSortedAdr(po_this->as_sAdrToRxSpdoIdx, po_this->w_noSAdr,
+                              w_sAdr);
+    #elif (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
       i = 0U;
       /* search SADR */
       while ((i < (UINT32)SPDO_cfg_MAX_NO_RX_SPDO) && (!o_break))
@@ -438,12 +496,17 @@ UINT16 SPDO_GetSpdoIdxForTAdr(BYTE_B_INSTNUM_ UINT16 w_tAdr)
 {
   UINT16 w_ret = k_INVALID_SPDO_NUM; /* return value */
   t_ASSIGN_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
-  #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+  #if ((SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE) && \
+       (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_DISABLE))
     BOOLEAN o_break = FALSE; /* flag for breaking the for cycle */
     UINT32 i; /* loop counter */
   #endif
 
-  #if (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
+  #if (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE)
+    /* binary search of the TADR */
+    w_ret = SearchSortedAdr(po_this->as_tAdrToTxSpdoIdx, po_this->w_noTAdr,
+                            w_tAdr);
+  #elif (SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE == EPLS_k_DISABLE)
     i = 0U;
     /* search SADR */
     while ((i < (UINT32)SPDO_cfg_MAX_NO_TX_SPDO) && (!o_break))
@@ -509,4 +572,108 @@ UINT16 SPDO_GetNoProcTxSpdo(BYTE_B_INSTNUM)
   return as_Obj[B_INSTNUMidx].w_noProcTxSpdo;
 }
 
+#if (SPDO_cfg_SPDO_NUM_SORTED_TABLE == EPLS_k_ENABLE)
+/**
+ * @brief This function inserts an address into a table sorted by the SN address.
+ *
+ * The entries behind the insert position are shifted by one. This is only done
+ * during the SPDO mapping activation, so the costs are not relevant for the
+ * SPDO filtering.
+ *
+ * @param        ps_table         pointer to the sorted table (not checked, only called with reference to array) valid range: <> NULL
+ *
+ * @param        pw_noEntries     pointer to the number of used entries (not checked, only called with reference to variable) valid range: <> NULL
+ *
+ * @param        w_maxEntries     size of the table (not checked, only called with define) valid range: any 16 bit value
+ *
+ * @param        w_adr            SN address (not checked, checked in SPDO_AddSAdr() or SPDO_AddTAdr()) valid range: 1..(EPLS_k_MAX_SADR)
+ *
+ * @param        w_spdoIdx        SPDO index (not checked, checked in SPDO_ActivateRxSpdoMapping() or SPDO_ActivateTxSpdoMapping()) valid range: any 16 bit value
+ *
+ * @return
+ * - TRUE             - success
+ * - FALSE            - address has been already inserted or table is full
+ */
+static BOOLEAN InsertSortedAdr(t_ADR_TO_SPDO_NUM *ps_table,
+                               UINT16 *pw_noEntries, UINT16 w_maxEntries,
+                               UINT16 w_adr, UINT16 w_spdoIdx)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  UINT16 w_pos = *pw_noEntries; /* insert position */
+
+  /* if table is not full and address has not been inserted yet */
+  if ((*pw_noEntries < w_maxEntries) &&
+      (SearchSortedAdr(ps_table, *pw_noEntries, w_adr) == k_INVALID_SPDO_NUM))
+  {
+    /* entries with larger address are shifted to make room */
+    while ((w_pos > 0U) && (ps_table[w_pos - 1U].w_adr > w_adr))
+    {
+      ps_table[w_pos] = ps_table[w_pos - 1U];
+      w_pos--;
+    }
+
+    ps_table[w_pos].w_adr = w_adr;
+    ps_table[w_pos].w_spdoIdx = w_spdoIdx;
+    (*pw_noEntries)++;
+
+    o_ret = TRUE;
+  }
+  /* no else : table is full or address has been already inserted
+     error happened (See Returnvalue) */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+
+/**
+ * @brief This function searches an address in a table sorted by the SN address.
+ *
+ * The search halves the remaining range by a conditional pointer move, so the
+ * loop has a fixed number of iterations for a given table size and no data
+ * dependent branches that the processor would have to predict.
+ *
+ * @param        ps_table         pointer to the sorted table (not checked, only called with reference to array) valid range: <> NULL
+ *
+ * @param        w_noEntries      number of used entries (not checked, maintained by InsertSortedAdr()) valid range: 0..size of the table
+ *
+ * @param        w_adr            SN address (not checked, checked in SPDO_AddSAdr() or SPDO_AddTAdr() or checkRxAddrInfo()) valid range: 0..(EPLS_k_MAX_SADR)
+ *
+ * @return       SPDO index of the address or k_INVALID_SPDO_NUM if the address was not found
+ */
+static UINT16 SearchSortedAdr(const t_ADR_TO_SPDO_NUM *ps_table,
+                              UINT16 w_noEntries, UINT16 w_adr)
+{
+  UINT16 w_ret = k_INVALID_SPDO_NUM; /* return value */
+  const t_ADR_TO_SPDO_NUM *ps_base = ps_table; /* start of the search range */
+  UINT16 w_len = w_noEntries; /* length of the search range */
+  UINT16 w_half; /* half of the search range */
+
+  /* if table is not empty */
+  if (w_len > 0U)
+  {
+    while (w_len > 1U)
+    {
+      w_half = (UINT16)(w_len >> 1U);
+      ps_base = (ps_base[w_half].w_adr <= w_adr) ? &ps_base[w_half] : ps_base;
+      w_len = (UINT16)(w_len - w_half);
+    }
+
+    /* if address is found */
+    if (ps_base->w_adr == w_adr)
+    {
+      w_ret = ps_base->w_spdoIdx;
+    }
+    /* no else : address is not found */
+  }
+  /* no else : table is empty */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return w_ret;
+}
+#endif
+
 /** @} */
@@ -154,11 +154,20 @@
 /* SPDO_SyncOkConnect */
 #define SPDO_k_ERR_TX_NO_RX_CONN_1       SPDO_ERR_FATAL(60)
 
-/* SPDO_GetRxSpdoStatus */
+/* SPDO_GetRxSpdoStatus, SPDO_GetRxSpdoStatusBulk, SPDO_GetTSyncStat */
 #define SPDO_k_ERR_INST_INV            SPDO_ERR_FATAL(61)
 #define SPDO_k_ERR_RX_SPDO_IDX         SPDO_ERR_FATAL(62)
 #define SPDO_k_ERR_PTR_INV             SPDO_ERR_FATAL(63)
 
+/* SPDO_TxPiGetBuf, SPDO_TxPiPublish, SPDO_RxPiRead */
+#define SPDO_k_ERR_PI_INST_NUM         SPDO_ERR_FATAL(64)
+#define SPDO_k_ERR_PI_TX_SPDO_IDX      SPDO_ERR_FATAL(65)
+#define SPDO_k_ERR_PI_RX_SPDO_IDX      SPDO_ERR_FATAL(66)
+#define SPDO_k_ERR_PI_PTR_INV          SPDO_ERR_FATAL(67)
+
+/* SPDO_TxMappingProcess */
+#define SPDO_k_ERR_PI_TX_INCONS        SPDO_ERR_MINOR(68)
+
 /***
 *    data types
 ***/
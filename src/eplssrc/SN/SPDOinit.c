@@ -36,6 +36,19 @@
 
 #include "SPDOint.h"
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  #include "SSC.h"
+
+  /** number of Tx SPDOs the storage of each instance is sized for */
+  static UINT16 aw_TxSpdoCap[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+  #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    /** number of Rx SPDOs the storage of each instance is sized for */
+    static UINT16 aw_RxSpdoCap[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+  #endif
+
+  static UINT16 CountSpdo(BYTE_B_INSTNUM_ UINT16 w_commIdx, UINT16 w_maxNoSpdo);
+#endif
+
 static BOOLEAN InitTxSpdo(BYTE_B_INSTNUM_ UINT16 *pw_noTxSpdo);
 static BOOLEAN TxMappCommInit(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx,
                               UINT16 w_txCommIdx, UINT16 w_txMappIdx);
@@ -68,15 +81,53 @@ BOOLEAN SPDO_InitAll(BYTE_B_INSTNUM_ UINT16 *pw_noTxSpdo, UINT16 *pw_noRxSpdo)
 {
   BOOLEAN o_ret = FALSE; /* return value */
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  /* the storage is sized for the SPDOs defined in the SOD, limited to the
+     configured maximum so that the index checks report too many SPDOs */
+  #if (EPLS_cfg_MAX_INSTANCES > 1)
+    aw_TxSpdoCap[B_INSTNUMidx] = CountSpdo(B_INSTNUM_ k_TX_COMM_START_IDX,
+        (0U == B_INSTNUMidx) ? (UINT16)SPDO_cfg_MAX_NO_TX_SPDO :
+                               (UINT16)SPDO_cfg_MAX_NO_TX_SPDO_SDG);
+  #else
+    aw_TxSpdoCap[B_INSTNUMidx] = CountSpdo(B_INSTNUM_ k_TX_COMM_START_IDX,
+                                           (UINT16)SPDO_cfg_MAX_NO_TX_SPDO);
+  #endif
+  #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    #if (EPLS_cfg_MAX_INSTANCES > 1)
+      aw_RxSpdoCap[B_INSTNUMidx] = CountSpdo(B_INSTNUM_ k_RX_COMM_START_IDX,
+          (0U == B_INSTNUMidx) ? (UINT16)SPDO_cfg_MAX_NO_RX_SPDO :
+                                 (UINT16)SPDO_cfg_MAX_NO_RX_SPDO_SDG);
+    #else
+      aw_RxSpdoCap[B_INSTNUMidx] = CountSpdo(B_INSTNUM_ k_RX_COMM_START_IDX,
+                                             (UINT16)SPDO_cfg_MAX_NO_RX_SPDO);
+    #endif
+    #if (EPLS_cfg_ERROR_STATISTIC == EPLS_k_ENABLE)
+      SERR_InitSpdoCtr(B_INSTNUM_ aw_RxSpdoCap[B_INSTNUMidx]);
+    #endif
+  #endif
+#endif
+
   SPDO_InitTxSm(B_INSTNUM);
   SPDO_InitTxMapp(B_INSTNUM);
   #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
     SPDO_InitRxMapp(B_INSTNUM);
     SPDO_InitRxSyncCons(B_INSTNUM);
+    SPDO_InitRxConsSm(B_INSTNUM);
   #endif
 
   SPDO_InitAssign(B_INSTNUM);
+  #if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+    SPDO_InitPi(B_INSTNUM);
+  #endif
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  /* if the arena is too small for the SPDOs of the SOD */
+  if (SSC_ArenaOverflow(B_INSTNUM))
+  {
+    /* error is already reported */
+  }
+  else
+#endif
   /* if the initialization of the Tx SPDOs was successful */
   if (InitTxSpdo(B_INSTNUM_ pw_noTxSpdo))
   {
@@ -96,9 +147,78 @@ BOOLEAN SPDO_InitAll(BYTE_B_INSTNUM_ UINT16 *pw_noTxSpdo, UINT16 *pw_noRxSpdo)
   return o_ret;
 }
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+/**
+* @brief This function returns the number of Tx SPDOs the storage of an instance is sized for.
+*
+* @param        b_instNum           instance number (not checked, checked in SSC_InitAll() or by the API)
+* 	valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return       number of Tx SPDOs counted in SPDO_InitAll()
+*/
+UINT16 SPDO_GetTxSpdoCap(BYTE_B_INSTNUM)
+{
+  SCFM_TACK_PATH();
+  return aw_TxSpdoCap[B_INSTNUMidx];
+}
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+* @brief This function returns the number of Rx SPDOs the storage of an instance is sized for.
+*
+* @param        b_instNum           instance number (not checked, checked in SSC_InitAll() or by the API)
+* 	valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return       number of Rx SPDOs counted in SPDO_InitAll()
+*/
+UINT16 SPDO_GetRxSpdoCap(BYTE_B_INSTNUM)
+{
+  SCFM_TACK_PATH();
+  return aw_RxSpdoCap[B_INSTNUMidx];
+}
+#endif
+#endif
+
 /***
 *    static functions
 ***/
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+/**
+* @brief This function counts the SPDO communication parameter objects defined in the SOD.
+*
+* The objects are counted from the first index up to the first missing object. Gaps and SOD
+* access errors are reported afterwards by InitTxSpdo() and InitRxSpdo().
+*
+* @param        b_instNum           instance number (not checked, checked in SSC_InitAll())
+* 	valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        w_commIdx           index of the first SPDO communication parameter object (not checked, only called with define)
+* 	valid range: k_TX_COMM_START_IDX, k_RX_COMM_START_IDX
+*
+* @param        w_maxNoSpdo         maximum number of SPDOs (not checked, only called with define) valid range: (UINT16)
+*
+* @return       number of SPDOs, at most w_maxNoSpdo
+*/
+static UINT16 CountSpdo(BYTE_B_INSTNUM_ UINT16 w_commIdx, UINT16 w_maxNoSpdo)
+{
+  UINT16 w_noSpdo = 0U; /* number of SPDOs */
+  UINT32 dw_sodHdl; /* handle for SOD access */
+  BOOLEAN o_appObj; /* application object flag for SOD access */
+  SOD_t_ERROR_RESULT s_errRes; /* SOD access error */
+
+  /* as long as the next SPDO communication parameter exists */
+  while ((w_noSpdo < w_maxNoSpdo) &&
+         (SOD_AttrGet(B_INSTNUM_ (UINT16)(w_commIdx + w_noSpdo), 0U,
+                      &dw_sodHdl, &o_appObj, &s_errRes) != NULL))
+  {
+    w_noSpdo++;
+  }
+
+  SCFM_TACK_PATH();
+  return w_noSpdo;
+}
+#endif
+
 /**
 * @brief This function checks if Tx SPDO mapping parameter exist for every Tx SPDO communication parameter
 * and Tx SPDO communication parameter exists for every Tx SPDO mapping  parameter.
@@ -364,6 +364,10 @@ typedef struct
 	 * Array of ptrs to the consume state machine of the RxSPDOs to be syncronized over the TxSPDO */
 	t_RX_CONS_SM const * aps_consSm[SPDO_cfg_MAX_SYNC_RX_SPDO];
 #endif
+#if (SPDO_cfg_TX_CHANGE_DETECT == EPLS_k_ENABLE)
+	/** payload of the last transmitted SPDO, word aligned for the comparison */
+	UINT32 adw_lastPayload[(SPDO_cfg_MAX_LEN_OF_TX_SPDO + 3) / 4];
+#endif
 } t_VARIABLE_FOR_TX_SPDO;
 
 /**
@@ -384,8 +388,8 @@ typedef struct
  */
 typedef struct
 {
-	/** Tx SPDO structure */
-	t_TX_SPDO as_txSpdo[SPDO_cfg_MAX_NO_TX_SPDO];
+	/** Tx SPDO structures of this instance */
+	t_TX_SPDO *ps_txSpdo;
 } t_TXSM_OBJ;
 
 /**
@@ -406,6 +410,13 @@ typedef struct
 	/** Tx SPDO index to be activated, counter for the SPDO activation */
 	UINT16 w_actTxSpdoIdx;
 
+#if (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE)
+	/** TRUE if the activated SPDOs are valid for dw_actParamTs */
+	BOOLEAN o_actCacheValid;
+	/** parameter timestamp of the last transition to Operational */
+	UINT32 dw_actParamTs;
+#endif
+
 #if (SPDO_cfg_MAX_SYNC_RX_SPDO == 1)
 	/**
 	 * @todo only simple implementation up to now
@@ -441,6 +452,42 @@ typedef struct
  * - FALSE             - failure
  */
 BOOLEAN SPDO_InitAll(BYTE_B_INSTNUM_ UINT16 *pw_noTxSpdo, UINT16 *pw_noRxSpdo);
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+ * @brief This function returns the number of the Rx SPDOs defined in the SOD.
+ *
+ * @param        b_instNum           instance number (not checked, checked by the API)
+ * 	valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @return       number of the Rx SPDOs counted in SPDO_Init()
+ */
+UINT16 SPDO_GetNoRxSpdo(BYTE_B_INSTNUM);
+#endif
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+/**
+* @brief This function returns the number of Tx SPDOs the storage of an instance is sized for.
+*
+* @param        b_instNum           instance number (not checked, checked in SSC_InitAll() or by the API)
+* 	valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return       number of Tx SPDOs counted in SPDO_InitAll()
+*/
+UINT16 SPDO_GetTxSpdoCap(BYTE_B_INSTNUM);
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+* @brief This function returns the number of Rx SPDOs the storage of an instance is sized for.
+*
+* @param        b_instNum           instance number (not checked, checked in SSC_InitAll() or by the API)
+* 	valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return       number of Rx SPDOs counted in SPDO_InitAll()
+*/
+UINT16 SPDO_GetRxSpdoCap(BYTE_B_INSTNUM);
+#endif
+#endif
 /** @} */
 
 /**
@@ -648,6 +695,14 @@ void SPDO_TimeSyncProdSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
  * @name Function prototypes for the SPDOrxConsSm.c
  * @{
  */
+/**
+ * @brief This function initializes the pointer to the Rx SPDO Consumer State Machines of the given instance.
+ *
+ * @param        b_instNum                  instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+void SPDO_InitRxConsSm(BYTE_B_INSTNUM);
+#endif
 /**
  * @brief This function connects a RxSPDO to the TxSPDO in which the synchronization request is sent.
  *
@@ -911,6 +966,22 @@ BOOLEAN SPDO_SetTxMapp(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT16 w_index,
 */
 UINT8 *SPDO_TxMappingProcess(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 *pb_len);
 
+#if (SPDO_cfg_TX_CHANGE_DETECT == EPLS_k_ENABLE)
+/**
+* @brief This function gathers the mapped SPDO data and compares it with the payload of the last transmitted SPDO.
+*
+* @param    b_instNum              instance number (not checked, checked in SPDO_BuildTxSpdo() or SPDO_ProcessRxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+* @param    w_txSpdoIdx            Tx SPDO index (not checked, checked in SPDO_BuildTxSpdo() or SPDO_TxSpdoIdxExists() or ProcessTReq() and SPDO_GetSpdoIdxForTAdr()) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+* @param    adw_lastPayload        payload of the last transmitted SPDO (pointer not checked, only called with reference to array), valid range: <> NULL
+*
+* @return
+* - TRUE             - the mapped data differs from the last transmitted payload
+* - FALSE            - the mapped data is unchanged or no consistent copy of the process image is available
+*/
+BOOLEAN SPDO_TxMappingChanged(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx,
+                              const UINT32 *adw_lastPayload);
+#endif
+
 /**
  * @brief This function activates the SPDO mapping, assembles the byte pointer array for the
  * mapped objects and checks the length of the SPDO mapping.
@@ -1011,6 +1082,62 @@ BOOLEAN SPDO_RxMappActivate(BYTE_B_INSTNUM_ UINT16 w_spdoIdx,
 		UINT8 b_noEntries);
 /** @} */
 
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+/**
+ * @name Function prototypes for the SPDOprocImg.c
+ * @{
+ */
+/**
+ * @brief This function initializes the process image of the given instance.
+ *
+ * @param        b_instNum        instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SPDO_InitPi(BYTE_B_INSTNUM);
+
+/**
+ * @brief This function copies the last published payload of a Tx SPDO.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_BuildTxSpdo() or SPDO_ProcessRxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_txSpdoIdx        Tx SPDO index (not checked, checked in SPDO_BuildTxSpdo() or SPDO_TxSpdoIdxExists() or ProcessTReq() and SPDO_GetSpdoIdxForTAdr()) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+ *
+ * @param        b_len              length of the Tx SPDO payload (not checked, checked in SPDO_TxMappActivate()) valid range: 0..SPDO_cfg_MAX_LEN_OF_TX_SPDO
+ *
+ * @retval       pb_dst             reference to the payload buffer (pointer not checked, only called with reference to array in SPDO_TxMappingProcess()) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - consistent copy taken
+ * - FALSE            - the application published too often during the copy, no consistent copy taken
+ */
+BOOLEAN SPDO_TxPiSnapshot(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 b_len,
+		UINT8 *pb_dst);
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+ * @brief This function returns the buffer of the Rx process image the stack writes the next payload into.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_CheckRxTimeout() or SPDO_BuildTxSpdo() and SPDO_ProcessRxSpdo()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_rxSpdoIdx        Rx SPDO index (not checked, checked in SPDO_GetSpdoIdxForSAdr() or SPDO_ResetRxSm()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+ *
+ * @return       reference to the payload buffer (SPDO_cfg_MAX_LEN_OF_RX_SPDO bytes)
+ */
+UINT8 *SPDO_RxPiGetBuf(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx);
+
+/**
+ * @brief This function publishes the payload written into the buffer returned by SPDO_RxPiGetBuf().
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_CheckRxTimeout() or SPDO_BuildTxSpdo() and SPDO_ProcessRxSpdo()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_rxSpdoIdx        Rx SPDO index (not checked, checked in SPDO_GetSpdoIdxForSAdr() or SPDO_ResetRxSm()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+ *
+ * @param        b_len              length of the written payload (not checked, checked in SPDO_RxMappActivate()), valid range: 0..SPDO_cfg_MAX_LEN_OF_RX_SPDO
+ */
+void SPDO_RxPiPublish(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT8 b_len);
+#endif
+/** @} */
+#endif
+
 /**
  * @name Function prototypes for the SPDOassign.c
  * @{
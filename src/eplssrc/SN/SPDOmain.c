@@ -106,6 +106,12 @@ BOOLEAN SPDO_Init(BYTE_B_INSTNUM)
   ps_spdoObj->w_actRxSpdoIdx = 0U;
   ps_spdoObj->w_actTxSpdoIdx = 0U;
 
+  #if (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE)
+    /* no SPDO activation available */
+    ps_spdoObj->o_actCacheValid = FALSE;
+    ps_spdoObj->dw_actParamTs = 0UL;
+  #endif
+
   /* call the Control Flow Monitoring */
   SCFM_TACK_PATH();
 
@@ -113,6 +119,23 @@ BOOLEAN SPDO_Init(BYTE_B_INSTNUM)
                       &(ps_spdoObj->w_noRxSpdo));
 }
 
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+* @brief This function returns the number of the Rx SPDOs defined in the SOD.
+*
+* @param        b_instNum        instance number (not checked, checked by the API) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @return       number of the Rx SPDOs counted in SPDO_Init()
+*/
+UINT16 SPDO_GetNoRxSpdo(BYTE_B_INSTNUM)
+{
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return as_Obj[B_INSTNUMidx].w_noRxSpdo;
+}
+#endif
+
 #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
   /**
   * @brief This function checks the SCT timeout for every RxSPDO.
@@ -507,12 +530,14 @@ void SPDO_ProcessRxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT8 *pb_rxFrm,
 * data for the given Tx SPDO has changed.
 *
 * This Tx SPDO is immediately sent by the SPDO_BuildTxSpdo() before the refresh prescale timeout.
+* If SPDO_cfg_TX_CHANGE_DETECT is enabled, the changes of the mapped data are detected by the
+* openSAFETY Stack and the call is not necessary.
 *
 * @see          SPDO_BuildTxSpdo()
 *
 * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
 *
-* @param        w_txSpdoNum        Tx SPDO number (checked) valid range: 1..SPDO_cfg_MAX_NO_TX_SPDO
+* @param        w_txSpdoNum        Tx SPDO number (checked) valid range: 1..SPDO_cfg_MAX_NO_TX_SPDO, 1..SPDO_GetTxSpdoCap() if EPLS_cfg_RUNTIME_ARENA is enabled
 */
 void SPDO_TxDataChanged(BYTE_B_INSTNUM_ UINT16 w_txSpdoNum)
 {
@@ -526,7 +551,11 @@ void SPDO_TxDataChanged(BYTE_B_INSTNUM_ UINT16 w_txSpdoNum)
     else  /* else Instance number is ok */
   #endif
     /* if Tx SPDO number is ok */
+  #if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+    if ((w_txSpdoNum > 0U) && (w_txSpdoNum <= SPDO_GetTxSpdoCap(B_INSTNUM)))
+  #else
     if ((w_txSpdoNum > 0U) && (w_txSpdoNum <= (UINT16)SPDO_cfg_MAX_NO_TX_SPDO))
+  #endif
     {
       SPDO_NewData(B_INSTNUM_ SPDO_NUM_TO_INTERNAL_SPDO_IDX(w_txSpdoNum));
     }
@@ -557,8 +586,90 @@ void SPDO_ActivateStart(BYTE_B_INSTNUM)
   /* SPDO index counters are reset */
   ps_spdoObj->w_actRxSpdoIdx = 0U;
   ps_spdoObj->w_actTxSpdoIdx = 0U;
+
+  #if (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE)
+    /* the last activation is lost */
+    ps_spdoObj->o_actCacheValid = FALSE;
+  #endif
+}
+
+#if (SPDO_cfg_ACTIVATION_CACHE == EPLS_k_ENABLE)
+/**
+* @brief This function is called by the SNMTS instead of SPDO_ActivateStart() to check whether the last SPDO activation can be reused.
+*
+* The assign tables, the mapping and the communication parameter pointers of the last activation are
+* kept over Pre-operational. They are reused if the parameter timestamp is the same as at the last transition
+* to Operational. The SPDO state machines are reset in SPDO_SetToOp() anyway.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        dw_paramTs       parameter timestamp of the received SNMTS_SN_set_to_op command (not checked, any value allowed), valid range: (UINT32)
+*
+* @return
+* - TRUE           - SPDOs are still activated for this parameter timestamp, no activation necessary
+* - FALSE          - SPDOs have to be activated
+*/
+BOOLEAN SPDO_ActivateCached(BYTE_B_INSTNUM_ UINT32 dw_paramTs)
+{
+  BOOLEAN o_ret = FALSE;       /* return value */
+  t_SPDO_OBJ *ps_spdoObj = &as_Obj[B_INSTNUMidx]; /* pointer the SPDO object
+                                                     structure */
+
+  /* if the last activation was done with the same parameter set */
+  if ((ps_spdoObj->o_actCacheValid) &&
+      (ps_spdoObj->dw_actParamTs == dw_paramTs) &&
+      (ps_spdoObj->w_actTxSpdoIdx == ps_spdoObj->w_noTxSpdo)
+  #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+      && (ps_spdoObj->w_actRxSpdoIdx == ps_spdoObj->w_noRxSpdo)
+  #endif
+     )
+  {
+    o_ret = TRUE;
+  }
+  else /* SPDOs have to be activated */
+  {
+    SPDO_ActivateStart(B_INSTNUM);
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+
+/**
+* @brief This function is called by the SNMTS at the transition to Operational to store the parameter timestamp of the activated SPDOs.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param        dw_paramTs       parameter timestamp of the received SNMTS_SN_set_to_op command (not checked, any value allowed), valid range: (UINT32)
+*/
+void SPDO_ActivateCacheSet(BYTE_B_INSTNUM_ UINT32 dw_paramTs)
+{
+  t_SPDO_OBJ *ps_spdoObj = &as_Obj[B_INSTNUMidx]; /* pointer the SPDO object
+                                                     structure */
+
+  ps_spdoObj->dw_actParamTs = dw_paramTs;
+  ps_spdoObj->o_actCacheValid = TRUE;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
 }
 
+/**
+* @brief This function is called by the SNMTS if a SADR was changed or the parameter checksum is wrong, the SPDOs are activated at the next transition to Operational.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*/
+void SPDO_ActivateCacheClear(BYTE_B_INSTNUM)
+{
+  as_Obj[B_INSTNUMidx].o_actCacheValid = FALSE;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+#endif
+
 /**
 * @brief This function activates the mapping of all Tx SPDO.
 *
@@ -1441,6 +1552,51 @@ void SPDO_SetToPreOp(BYTE_B_INSTNUM)
                         dw_addInfo);
         break;
       }
+    #if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+      case SPDO_k_ERR_PI_INST_NUM:
+      {
+        SPRINTF2(pac_str, "%#x - SPDO_k_ERR_PI_INST_NUM: "
+                        "SPDO_TxPiGetBuf() or SPDO_TxPiPublish() or "
+                        "SPDO_RxPiRead():\n"
+                        "Instance number (%lu) is invalid.\n",
+                        SPDO_k_ERR_PI_INST_NUM, dw_addInfo);
+        break;
+      }
+      case SPDO_k_ERR_PI_TX_SPDO_IDX:
+      {
+        SPRINTF2(pac_str, "%#x - SPDO_k_ERR_PI_TX_SPDO_IDX: "
+                        "SPDO_TxPiGetBuf() or SPDO_TxPiPublish():\n"
+                        "Tx SPDO index (%lu) is invalid.\n",
+                        SPDO_k_ERR_PI_TX_SPDO_IDX, dw_addInfo);
+        break;
+      }
+      case SPDO_k_ERR_PI_RX_SPDO_IDX:
+      {
+        SPRINTF2(pac_str, "%#x - SPDO_k_ERR_PI_RX_SPDO_IDX: "
+                        "SPDO_RxPiRead():\n"
+                        "Rx SPDO index (%lu) is invalid.\n",
+                        SPDO_k_ERR_PI_RX_SPDO_IDX, dw_addInfo);
+        break;
+      }
+      case SPDO_k_ERR_PI_PTR_INV:
+      {
+        SPRINTF1(pac_str, "%#x - SPDO_k_ERR_PI_PTR_INV: "
+                        "SPDO_RxPiRead():\n"
+                        "Reference to the data, the length or the publication "
+                        "counter is invalid.\n",
+                        SPDO_k_ERR_PI_PTR_INV);
+        break;
+      }
+      case SPDO_k_ERR_PI_TX_INCONS:
+      {
+        SPRINTF2(pac_str, "%#x - SPDO_k_ERR_PI_TX_INCONS: "
+                        "SPDO_TxMappingProcess():\n"
+                        "No consistent copy of the process image of the "
+                        "Tx SPDO (%lu) was taken, the Tx SPDO is not sent.\n",
+                        SPDO_k_ERR_PI_TX_INCONS, dw_addInfo);
+        break;
+      }
+    #endif
 
       default:
       {
@@ -0,0 +1,476 @@
+/**
+ * @addtogroup SPDO
+ * @{
+ *
+ * @file SPDOprocImg.c
+ *
+ * This file contains the double buffered process image between the openSAFETY Stack and the
+ * application.
+ *
+ * @copyright Copyright (c) 2009,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H and IXXAT Automation GmbH
+ * @copyright All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * @copyright This source code is free software; you can redistribute it and/or modify it under the terms of the BSD license (according to License.txt).
+ *
+ * @details
+ * Every Tx and Rx SPDO owns two payload buffers and a publication counter. The writer always
+ * fills the buffer which is not addressed by the counter and increments the counter afterwards,
+ * the reader copies the buffer addressed by the counter and repeats the copy if the counter
+ * changed meanwhile. The writer never waits, so the communication task and the application task
+ * may run on different cores and with different cycle times without a lock.
+ *
+ * - Tx SPDO: the application is the writer (SPDO_TxPiGetBuf(), SPDO_TxPiPublish()), the stack
+ *   takes a snapshot in SPDO_TxMappingProcess().
+ * - Rx SPDO: the stack is the writer (SPDO_RxMappingProcess(), SPDO_RxSpdoToSafeState()), the
+ *   application reads with SPDO_RxPiRead().
+ *
+ * The payload is stored in the byte order of the openSAFETY frame.
+ */
+
+#include "EPLScfg.h"
+
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+
+#include "EPLStarget.h"
+#include "EPLStypes.h"
+
+#include "SCFMapi.h"
+
+#include "SODapi.h"
+
+#include "SERRapi.h"
+#include "SERR.h"
+#include "SPDOerr.h"
+
+#include "SPDOapi.h"
+#include "SPDOint.h"
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  #include "SSC.h"
+#endif
+
+/**
+ * Number of attempts to take a consistent copy of a process image buffer
+ * before the copy is given up.
+ */
+#define k_PI_MAX_COPY_ATTEMPTS 3U
+
+/**
+ * Structure for the process image of one Tx SPDO.
+ */
+typedef struct
+{
+  /** publication counter, the buffer (dw_seq & 1) holds the last published data */
+  volatile UINT32 dw_seq;
+  /** payload buffers */
+  UINT8 aab_buf[2][SPDO_cfg_MAX_LEN_OF_TX_SPDO];
+} t_PI_TX_SPDO;
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+ * Structure for the process image of one Rx SPDO.
+ */
+typedef struct
+{
+  /** publication counter, the buffer (dw_seq & 1) holds the last published data */
+  volatile UINT32 dw_seq;
+  /** payload lengths of the buffers */
+  UINT8 ab_len[2];
+  /** payload buffers */
+  UINT8 aab_buf[2][SPDO_cfg_MAX_LEN_OF_RX_SPDO];
+} t_PI_RX_SPDO;
+#endif
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_DISABLE)
+/** process image of all Tx SPDOs */
+static t_PI_TX_SPDO as_TxPi[SPDO_cfg_MAX_NO_TX_SPDO +
+    (EPLS_cfg_MAX_INSTANCES - 1)*SPDO_cfg_MAX_NO_TX_SPDO_SDG] SAFE_NO_INIT_SEKTOR;
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/** process image of all Rx SPDOs */
+static t_PI_RX_SPDO as_RxPi[SPDO_cfg_MAX_NO_RX_SPDO +
+    (EPLS_cfg_MAX_INSTANCES - 1)*SPDO_cfg_MAX_NO_RX_SPDO_SDG] SAFE_NO_INIT_SEKTOR;
+#endif
+#endif
+
+/**
+ * Object structure for the process image.
+ */
+typedef struct
+{
+  /** process image of the first Tx SPDO of this instance */
+  t_PI_TX_SPDO *ps_txPi;
+  /** number of Tx SPDOs of this instance */
+  UINT16 w_noTxSpdo;
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+  /** process image of the first Rx SPDO of this instance */
+  t_PI_RX_SPDO *ps_rxPi;
+  /** number of Rx SPDOs of this instance */
+  UINT16 w_noRxSpdo;
+#endif
+} t_PI_OBJ;
+
+static t_PI_OBJ as_Obj[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+static BOOLEAN CopyPiBuffer(volatile const UINT32 *pdw_seq,
+                            const UINT8 *pb_buf, UINT32 dw_bufSize,
+                            const UINT8 *pb_bufLen, UINT8 *pb_dst,
+                            UINT8 *pb_len, UINT32 *pdw_pubSeq);
+
+/**
+ * @brief This function initializes the process image of the given instance.
+ *
+ * @param        b_instNum        instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SPDO_InitPi(BYTE_B_INSTNUM)
+{
+  t_PI_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  /* the process image of the SPDOs defined in the SOD,
+     if the arena is too small, SPDO_InitAll() fails */
+  po_this->ps_txPi = (t_PI_TX_SPDO *)SSC_ArenaAlloc(B_INSTNUM_
+      (UINT32)SPDO_GetTxSpdoCap(B_INSTNUM) * (UINT32)sizeof(t_PI_TX_SPDO));
+  po_this->w_noTxSpdo = (NULL == po_this->ps_txPi) ? 0U : SPDO_GetTxSpdoCap(B_INSTNUM);
+  #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    po_this->ps_rxPi = (t_PI_RX_SPDO *)SSC_ArenaAlloc(B_INSTNUM_
+        (UINT32)SPDO_GetRxSpdoCap(B_INSTNUM) * (UINT32)sizeof(t_PI_RX_SPDO));
+    po_this->w_noRxSpdo = (NULL == po_this->ps_rxPi) ? 0U : SPDO_GetRxSpdoCap(B_INSTNUM);
+  #endif
+#elif (EPLS_cfg_MAX_INSTANCES > 1)
+  /* if main instance */
+  if (0U == B_INSTNUMidx)
+  {
+    po_this->ps_txPi = &as_TxPi[0];
+    po_this->w_noTxSpdo = SPDO_cfg_MAX_NO_TX_SPDO;
+  #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    po_this->ps_rxPi = &as_RxPi[0];
+    po_this->w_noRxSpdo = SPDO_cfg_MAX_NO_RX_SPDO;
+  #endif
+  }
+  else /* SDG instance */
+  {
+    po_this->ps_txPi = &as_TxPi[SPDO_cfg_MAX_NO_TX_SPDO +
+                                ((B_INSTNUMidx - 1U) * SPDO_cfg_MAX_NO_TX_SPDO_SDG)];
+    po_this->w_noTxSpdo = SPDO_cfg_MAX_NO_TX_SPDO_SDG;
+  #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    po_this->ps_rxPi = &as_RxPi[SPDO_cfg_MAX_NO_RX_SPDO +
+                                ((B_INSTNUMidx - 1U) * SPDO_cfg_MAX_NO_RX_SPDO_SDG)];
+    po_this->w_noRxSpdo = SPDO_cfg_MAX_NO_RX_SPDO_SDG;
+  #endif
+  }
+#else
+  po_this->ps_txPi = &as_TxPi[0];
+  po_this->w_noTxSpdo = SPDO_cfg_MAX_NO_TX_SPDO;
+  #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+    po_this->ps_rxPi = &as_RxPi[0];
+    po_this->w_noRxSpdo = SPDO_cfg_MAX_NO_RX_SPDO;
+  #endif
+#endif
+
+  /* the process image contains zero payload (safe state) until the
+     first publication, the arena storage is already zeroed */
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_DISABLE)
+  MEMSET(po_this->ps_txPi, 0, sizeof(t_PI_TX_SPDO) * po_this->w_noTxSpdo);
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+  MEMSET(po_this->ps_rxPi, 0, sizeof(t_PI_RX_SPDO) * po_this->w_noRxSpdo);
+#endif
+#endif
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function returns the buffer of the Tx process image the application has to write the next payload into.
+ *
+ * The buffer is not read by the openSAFETY Stack until SPDO_TxPiPublish() is called. Only one
+ * application task may write the process image of a Tx SPDO.
+ *
+ * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_txSpdoIdx        Tx SPDO index (checked) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+ *
+ * @return
+ * - == NULL          - invalid parameter
+ * - <> NULL          - reference to the payload buffer (SPDO_cfg_MAX_LEN_OF_TX_SPDO bytes, frame byte order)
+ */
+UINT8 *SPDO_TxPiGetBuf(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
+{
+  UINT8 *pb_ret = (UINT8 *)NULL; /* return value */
+  t_PI_TX_SPDO *ps_pi; /* process image of the Tx SPDO */
+
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+  /* if instance number is invalid */
+  if (B_INSTNUMidx >= (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    SERR_SetError(EPLS_k_NO_INSTANCE_ SPDO_k_ERR_PI_INST_NUM,
+                  (UINT32)B_INSTNUMidx);
+  }
+  else
+#endif
+  /* if the Tx SPDO index is invalid */
+  if (w_txSpdoIdx >= as_Obj[B_INSTNUMidx].w_noTxSpdo)
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_PI_TX_SPDO_IDX, (UINT32)w_txSpdoIdx);
+  }
+  else /* all parameter ok */
+  {
+    ps_pi = as_Obj[B_INSTNUMidx].ps_txPi + w_txSpdoIdx;
+    /* the buffer not addressed by the publication counter is the back buffer */
+    pb_ret = &ps_pi->aab_buf[(ps_pi->dw_seq + 1UL) & 1UL][0];
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return pb_ret;
+}
+
+/**
+ * @brief This function publishes the payload written into the buffer returned by SPDO_TxPiGetBuf().
+ *
+ * The published payload is sent with the next Tx SPDO. SPDO_TxDataChanged() may be called
+ * afterwards to send the Tx SPDO before the refresh prescale timeout.
+ *
+ * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_txSpdoIdx        Tx SPDO index (checked) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+ */
+void SPDO_TxPiPublish(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
+{
+  t_PI_TX_SPDO *ps_pi; /* process image of the Tx SPDO */
+
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+  /* if instance number is invalid */
+  if (B_INSTNUMidx >= (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    SERR_SetError(EPLS_k_NO_INSTANCE_ SPDO_k_ERR_PI_INST_NUM,
+                  (UINT32)B_INSTNUMidx);
+  }
+  else
+#endif
+  /* if the Tx SPDO index is invalid */
+  if (w_txSpdoIdx >= as_Obj[B_INSTNUMidx].w_noTxSpdo)
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_PI_TX_SPDO_IDX, (UINT32)w_txSpdoIdx);
+  }
+  else /* all parameter ok */
+  {
+    ps_pi = as_Obj[B_INSTNUMidx].ps_txPi + w_txSpdoIdx;
+    /* the payload has to be completely written before it is published */
+    MEMORY_BARRIER();
+    ps_pi->dw_seq++;
+    /* the next payload must not be written before the publication is visible,
+       otherwise a reader copying this buffer does not detect the overwrite */
+    MEMORY_BARRIER();
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function copies the last published payload of a Tx SPDO.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_BuildTxSpdo() or SPDO_ProcessRxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_txSpdoIdx        Tx SPDO index (not checked, checked in SPDO_BuildTxSpdo() or SPDO_TxSpdoIdxExists() or ProcessTReq() and SPDO_GetSpdoIdxForTAdr()) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+ *
+ * @param        b_len              length of the Tx SPDO payload (not checked, checked in SPDO_TxMappActivate()) valid range: 0..SPDO_cfg_MAX_LEN_OF_TX_SPDO
+ *
+ * @retval       pb_dst             reference to the payload buffer (pointer not checked, only called with reference to array in SPDO_TxMappingProcess()) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - consistent copy taken
+ * - FALSE            - the application published too often during the copy, no consistent copy taken
+ */
+BOOLEAN SPDO_TxPiSnapshot(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 b_len,
+                          UINT8 *pb_dst)
+{
+  t_PI_TX_SPDO *ps_pi = as_Obj[B_INSTNUMidx].ps_txPi + w_txSpdoIdx;
+  UINT32 dw_pubSeq; /* publication counter of the copied buffer */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return CopyPiBuffer(&ps_pi->dw_seq, &ps_pi->aab_buf[0][0],
+                      (UINT32)SPDO_cfg_MAX_LEN_OF_TX_SPDO, (const UINT8 *)NULL,
+                      pb_dst, &b_len, &dw_pubSeq);
+}
+
+#if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+ * @brief This function returns the buffer of the Rx process image the stack writes the next payload into.
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_CheckRxTimeout() or SPDO_BuildTxSpdo() and SPDO_ProcessRxSpdo()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_rxSpdoIdx        Rx SPDO index (not checked, checked in SPDO_GetSpdoIdxForSAdr() or SPDO_ResetRxSm()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+ *
+ * @return       reference to the payload buffer (SPDO_cfg_MAX_LEN_OF_RX_SPDO bytes)
+ */
+UINT8 *SPDO_RxPiGetBuf(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
+{
+  t_PI_RX_SPDO *ps_pi = as_Obj[B_INSTNUMidx].ps_rxPi + w_rxSpdoIdx;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return &ps_pi->aab_buf[(ps_pi->dw_seq + 1UL) & 1UL][0];
+}
+
+/**
+ * @brief This function publishes the payload written into the buffer returned by SPDO_RxPiGetBuf().
+ *
+ * @param        b_instNum          instance number (not checked, checked in SPDO_CheckRxTimeout() or SPDO_BuildTxSpdo() and SPDO_ProcessRxSpdo()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_rxSpdoIdx        Rx SPDO index (not checked, checked in SPDO_GetSpdoIdxForSAdr() or SPDO_ResetRxSm()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+ *
+ * @param        b_len              length of the written payload (not checked, checked in SPDO_RxMappActivate()), valid range: 0..SPDO_cfg_MAX_LEN_OF_RX_SPDO
+ */
+void SPDO_RxPiPublish(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT8 b_len)
+{
+  t_PI_RX_SPDO *ps_pi = as_Obj[B_INSTNUMidx].ps_rxPi + w_rxSpdoIdx;
+
+  ps_pi->ab_len[(ps_pi->dw_seq + 1UL) & 1UL] = b_len;
+  /* the payload has to be completely written before it is published */
+  MEMORY_BARRIER();
+  ps_pi->dw_seq++;
+  /* the next payload must not be written before the publication is visible,
+     otherwise a reader copying this buffer does not detect the overwrite */
+  MEMORY_BARRIER();
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function copies the last payload of a Rx SPDO the openSAFETY Stack has published.
+ *
+ * The payload is either the received process data or the default values of the mapped objects
+ * (safe state). The function does not block the openSAFETY Stack. If the stack published a new
+ * payload several times during the copy, FALSE is returned and the call has to be repeated.
+ *
+ * @param        b_instNum          instance number (checked) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ *
+ * @param        w_rxSpdoIdx        Rx SPDO index (checked) valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+ *
+ * @retval       pb_data            reference to a buffer of SPDO_cfg_MAX_LEN_OF_RX_SPDO bytes (checked) valid range: <> NULL
+ *
+ * @retval       pb_len             length of the copied payload (checked) valid range: <> NULL
+ *
+ * @retval       pdw_seq            publication counter of the copied payload, changes with every publication (checked) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - consistent payload copied
+ * - FALSE            - invalid parameter or no consistent copy taken
+ */
+BOOLEAN SPDO_RxPiRead(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT8 *pb_data,
+                      UINT8 *pb_len, UINT32 *pdw_seq)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  t_PI_RX_SPDO *ps_pi; /* process image of the Rx SPDO */
+
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+  /* if instance number is invalid */
+  if (B_INSTNUMidx >= (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    SERR_SetError(EPLS_k_NO_INSTANCE_ SPDO_k_ERR_PI_INST_NUM,
+                  (UINT32)B_INSTNUMidx);
+  }
+  else
+#endif
+  /* if the Rx SPDO index is invalid */
+  if (w_rxSpdoIdx >= as_Obj[B_INSTNUMidx].w_noRxSpdo)
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_PI_RX_SPDO_IDX, (UINT32)w_rxSpdoIdx);
+  }
+  /* else if a reference is invalid */
+  else if ((pb_data == NULL) || (pb_len == NULL) || (pdw_seq == NULL))
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_PI_PTR_INV, SERR_k_NO_ADD_INFO);
+  }
+  else /* all parameter ok */
+  {
+    ps_pi = as_Obj[B_INSTNUMidx].ps_rxPi + w_rxSpdoIdx;
+
+    o_ret = CopyPiBuffer(&ps_pi->dw_seq, &ps_pi->aab_buf[0][0],
+                         (UINT32)SPDO_cfg_MAX_LEN_OF_RX_SPDO, ps_pi->ab_len,
+                         pb_data, pb_len, pdw_seq);
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+#endif /* (SPDO_cfg_MAX_NO_RX_SPDO != 0) */
+
+/***
+*    static functions
+***/
+/**
+ * @brief This function takes a consistent copy of the published buffer of a process image.
+ *
+ * @param        pdw_seq            reference to the publication counter (not checked, only called with reference to struct member) valid range: <> NULL
+ *
+ * @param        pb_buf             reference to the first of the two payload buffers (not checked, only called with reference to struct member) valid range: <> NULL
+ *
+ * @param        dw_bufSize         size of one payload buffer (not checked, only called with define) valid range: UINT32
+ *
+ * @param        pb_bufLen          reference to the payload lengths of the two buffers, NULL if the length is given by *pb_len (not checked, only called with reference to struct member or NULL) valid range: UINT8 *
+ *
+ * @retval       pb_dst             reference to the destination (not checked, checked in SPDO_RxPiRead() or only called with reference to array) valid range: <> NULL
+ *
+ * @retval       pb_len             number of bytes to be copied if pb_bufLen is NULL, otherwise number of copied bytes (not checked, checked in SPDO_RxPiRead() or only called with reference to variable) valid range: <> NULL
+ *
+ * @retval       pdw_pubSeq         publication counter of the copied buffer (not checked, checked in SPDO_RxPiRead() or only called with reference to variable) valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - consistent copy taken
+ * - FALSE            - no consistent copy taken
+ */
+static BOOLEAN CopyPiBuffer(volatile const UINT32 *pdw_seq,
+                            const UINT8 *pb_buf, UINT32 dw_bufSize,
+                            const UINT8 *pb_bufLen, UINT8 *pb_dst,
+                            UINT8 *pb_len, UINT32 *pdw_pubSeq)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  UINT8 b_attempt = 0U; /* number of copy attempts */
+  UINT32 dw_seq; /* publication counter before the copy */
+  UINT32 dw_bufIdx; /* index of the published buffer */
+
+  while ((!o_ret) && (b_attempt < k_PI_MAX_COPY_ATTEMPTS))
+  {
+    dw_seq = *pdw_seq;
+    MEMORY_BARRIER();
+    dw_bufIdx = dw_seq & 1UL;
+    /* if the payload length is stored with the buffer */
+    if (pb_bufLen != NULL)
+    {
+      *pb_len = pb_bufLen[dw_bufIdx];
+    }
+    MEMCOPY(pb_dst, ADD_OFFSET(pb_buf, dw_bufIdx * dw_bufSize), *pb_len);
+    MEMORY_BARRIER();
+    /* the published buffer is only rewritten after a further publication,
+       so the copy is consistent if the counter did not change */
+    if (dw_seq == *pdw_seq)
+    {
+      *pdw_pubSeq = dw_seq;
+      o_ret = TRUE;
+    }
+    b_attempt++;
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+
+#else
+  /* This file is compiled with different configuration (EPLScfg.h).
+     If SPDO_cfg_PROCESS_IMAGE is disabled then a compiler warning can be
+     generated. To avoid this warning, remove this file from the project. */
+#endif /* (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE) */
+
+/** @} */
@@ -36,11 +36,18 @@
 
 #include "SCFMapi.h"
 
+#include "SODapi.h"
+
 #include "SERRapi.h"
 #include "SERR.h"
 #include "SPDOerr.h"
+#include "SPDOapi.h"
 #include "SPDOint.h"
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  #include "SSC.h"
+#endif
+
 #include "SHNF.h"
 
 
@@ -56,11 +63,32 @@
 */
 #define CT_VALID(actCt,lastCt) (((UINT16)((actCt)-(lastCt))) < 0x8000U)
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_DISABLE)
 /**
  * Object structure to control the Rx SPDO Consumer State Machine.
 */
 static t_RX_CONS_SM as_ConsSm[EPLS_cfg_MAX_INSTANCES]
                              [SPDO_cfg_MAX_NO_RX_SPDO] SAFE_NO_INIT_SEKTOR;
+#endif
+
+/**
+ * Pointer to the Rx SPDO Consumer State Machines of the instances.
+*/
+static t_RX_CONS_SM *aps_ConsSm[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+/**
+ * Data valid bits of the previous call of SPDO_GetRxSpdoStatusBulk().
+ */
+static UINT32 aadw_LastDataValid[EPLS_cfg_MAX_INSTANCES]
+                                [SPDO_k_RX_SPDO_BIT_WORDS] SAFE_NO_INIT_SEKTOR;
+
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+/**
+ * Connection valid bits of the previous call of SPDO_GetRxSpdoStatusBulk().
+ */
+static UINT32 aadw_LastConnValid[EPLS_cfg_MAX_INSTANCES]
+                                [SPDO_k_RX_SPDO_BIT_WORDS] SAFE_NO_INIT_SEKTOR;
+#endif
 
 
 static void ProcessData(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
@@ -68,6 +96,38 @@ static void ProcessData(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
                         const UINT8 *pb_rxSpdoData);
 
 #if (SPDO_cfg_MAX_NO_RX_SPDO != 0)
+/**
+ * @brief This function initializes the pointer to the Rx SPDO Consumer State Machines of the given instance.
+ *
+ * @param        b_instNum                  instance number (not checked, checked in SSC_InitAll()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+ */
+void SPDO_InitRxConsSm(BYTE_B_INSTNUM)
+{
+  UINT16 w_idx; /* loop counter */
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  /* the state machines of the Rx SPDOs defined in the SOD,
+     if the arena is too small, SPDO_InitAll() fails */
+  aps_ConsSm[B_INSTNUMidx] = (t_RX_CONS_SM *)SSC_ArenaAlloc(B_INSTNUM_
+      (UINT32)SPDO_GetRxSpdoCap(B_INSTNUM) * (UINT32)sizeof(t_RX_CONS_SM));
+#else
+  aps_ConsSm[B_INSTNUMidx] = &as_ConsSm[B_INSTNUMidx][0];
+#endif
+
+  /* the bits of the previous SPDO_GetRxSpdoStatusBulk() call are not
+     initialized at startup, also for the Rx SPDOs not defined in the SOD */
+  for (w_idx = 0U; w_idx < (UINT16)SPDO_k_RX_SPDO_BIT_WORDS; w_idx++)
+  {
+    aadw_LastDataValid[B_INSTNUMidx][w_idx] = 0UL;
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+    aadw_LastConnValid[B_INSTNUMidx][w_idx] = 0UL;
+#endif
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
 /**
  * @brief This function connects a RxSPDO to the TxSPDO in which the synchronization request is sent.
  *
@@ -83,13 +143,17 @@ static void ProcessData(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
 BOOLEAN SPDO_ConsSmConnect(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
   UINT16 w_TxSpdoIdx;
   BOOLEAN o_retVal = TRUE;
   /* index = number - 1 */
   w_TxSpdoIdx = SPDO_GetTxSpdoNo(B_INSTNUM_ w_rxSpdoIdx) - 1;
   /* check if SPDO number is valid */
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  if ( SPDO_GetTxSpdoCap(B_INSTNUM) > w_TxSpdoIdx)
+#else
   if ( SPDO_cfg_MAX_NO_TX_SPDO > w_TxSpdoIdx)
+#endif
   {
     o_retVal = SPDO_SyncOkConnect(B_INSTNUM_ w_TxSpdoIdx, ps_consSm);
   }
@@ -118,12 +182,20 @@ void SPDO_ConsSmInit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, const UINT16 *pw_sct,
                      const UINT16 *pw_maxSPDOPropDelay)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
   ps_consSm->pw_sct = pw_sct;
   ps_consSm->pw_minSPDOPropDelay = pw_minSPDOPropDelay;
   ps_consSm->pw_maxSPDOPropDelay = pw_maxSPDOPropDelay;
 
+  /* no change is reported by SPDO_GetRxSpdoStatusBulk() for an invalid SPDO */
+  aadw_LastDataValid[B_INSTNUMidx][w_rxSpdoIdx / 32] &=
+    ~(0x00000001UL << (w_rxSpdoIdx % 32));
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+  aadw_LastConnValid[B_INSTNUMidx][w_rxSpdoIdx / 32] &=
+    ~(0x00000001UL << (w_rxSpdoIdx % 32));
+#endif
+
   SPDO_ConsSmResetRx(B_INSTNUM_ w_rxSpdoIdx);
 
   SCFM_TACK_PATH();
@@ -140,7 +212,7 @@ void SPDO_ConsSmInit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, const UINT16 *pw_sct,
 void SPDO_ConsSmResetRx(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
   ps_consSm->o_safeState = TRUE;
 
@@ -179,7 +251,7 @@ void SPDO_ConsSmTimeSyncSucceeded(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx,
                                   UINT16 w_tPropDelay)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
   /* TRefCons and TRefProd are stored */
   ps_consSm->w_tRefCons = w_tRefCons;
@@ -215,7 +287,7 @@ void SPDO_ConsSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
                  const UINT8 *pb_rxSpdoData, BOOLEAN o_timeSyncFailure)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
 #if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
   /* the "connection valid" bit field is optional and not to be created on IO Modules */
@@ -341,7 +413,7 @@ BOOLEAN SPDO_CtValid(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT16 w_rxSpdoCt)
 {
   BOOLEAN o_ret = FALSE; /* return value */
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 
   /* if CT has not to be checked or CT has changed and increased */
   if (!ps_consSm->o_lastValidRxSpdoCtChk ||
@@ -377,11 +449,11 @@ const t_RX_CONS_SM* SPDO_GetRxConsSmObj(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx)
     if(B_INSTNUMidx < (UINT8)EPLS_cfg_MAX_INSTANCES)
     {
       /* get pointer to object */
-      ps_obj = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+      ps_obj = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
     }
     /* else - do nothing */
   #else
-    ps_obj = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+    ps_obj = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
   #endif
 
   /* call the Control Flow Monitoring */
@@ -410,7 +482,7 @@ static void ProcessData(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
                         const UINT8 *pb_rxSpdoData)
 {
   /* pointer to the Consumer SM structure */
-  t_RX_CONS_SM *ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+  t_RX_CONS_SM *ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
   UINT16 w_propDelay;  /* temporary variable for the propagation delay */
   UINT16 w_deltaTCons; /* temporary variable for delta T consumer */
   UINT16 w_deltaTProd; /* temporary variable for delta T producer */
@@ -529,9 +601,20 @@ BOOLEAN SPDO_GetRxSpdoStatus(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx, UINT32 co
 		SERR_SetError(B_INSTNUM_ SPDO_k_ERR_INST_INV,
 					(UINT32)B_INSTNUMidx);
 	}
+	else
+#endif
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+	/* SPDO index too high for the SPDOs of the SOD */
+	if (SPDO_GetRxSpdoCap(B_INSTNUM) <= w_rxSpdoIdx)
+	{
+		SERR_SetError(B_INSTNUM_ SPDO_k_ERR_RX_SPDO_IDX,
+					(((UINT32)(B_INSTNUMidx))<<16) + w_rxSpdoIdx);
+	}
+#else
+#if (EPLS_cfg_MAX_INSTANCES > 1)
 	/* not main instance and SPDO index too high */
-	else if ((0 != B_INSTNUMidx) &&
-			 (SPDO_cfg_MAX_NO_RX_SPDO_SDG <= w_rxSpdoIdx))
+	if ((0 != B_INSTNUMidx) &&
+		(SPDO_cfg_MAX_NO_RX_SPDO_SDG <= w_rxSpdoIdx))
 	{
 		SERR_SetError(B_INSTNUM_ SPDO_k_ERR_RX_SPDO_IDX,
 					(((UINT32)(B_INSTNUMidx))<<16) + w_rxSpdoIdx);
@@ -545,6 +628,7 @@ BOOLEAN SPDO_GetRxSpdoStatus(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx, UINT32 co
 		SERR_SetError(B_INSTNUM_ SPDO_k_ERR_RX_SPDO_IDX,
 					(((UINT32)(B_INSTNUMidx))<<16) + w_rxSpdoIdx);
 	}
+#endif
 	/* check input data ranges and return pointers */
 	else if ((NULL == pw_dCt) ||
 			 (NULL == pdw_ageSpdo) ||
@@ -555,7 +639,7 @@ BOOLEAN SPDO_GetRxSpdoStatus(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx, UINT32 co
 	else
 	{
 		/* set the ptr to the SPDO instance */
-		ps_consSm = &as_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+		ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
 		/* check if process data is valid */
 		if ((ps_consSm->o_timeSyncOk) &&
 			(!ps_consSm->o_safeState))
@@ -571,6 +655,111 @@ BOOLEAN SPDO_GetRxSpdoStatus(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx, UINT32 co
 	return bRetVal;
 }
 
+/**
+* @brief This function reads the status of all Rx SPDOs of an instance.
+*
+* The bit fields are processed word by word. The changed bits are related to the previous call
+* of this function for the same instance.
+*
+* @param       b_instNum           instance number (checked), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param       dw_ct               actual consecutive time, any value allowed, valid range: UINT32
+*
+* @retval      ps_status           status of all Rx SPDOs (checked), valid range: <> NULL
+*
+* @return
+* - TRUE             - status read
+* - FALSE            - invalid parameter
+*/
+BOOLEAN SPDO_GetRxSpdoStatusBulk(BYTE_B_INSTNUM_ UINT32 const dw_ct,
+		SPDO_t_RX_STATUS_BULK * const ps_status)
+{
+	const t_RX_CONS_SM *ps_consSm; /* consumer SM of the actual Rx SPDO */
+	UINT32 dw_word; /* data valid bits of the actual word */
+	UINT32 dw_mask; /* mask of the used bits of the actual word */
+	UINT16 w_noWords; /* number of used words */
+	UINT16 w_rxSpdoIdx; /* Rx SPDO index */
+	UINT16 i; /* word index */
+	BOOLEAN	bRetVal = FALSE;
+
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+	/* if b_instNum is wrong */
+	if(B_INSTNUMidx >= (UINT8)EPLS_cfg_MAX_INSTANCES)
+	{
+		SERR_SetError(B_INSTNUM_ SPDO_k_ERR_INST_INV,
+					(UINT32)B_INSTNUMidx);
+	}
+	else
+#endif
+	/* check return pointer */
+	if (NULL == ps_status)
+	{
+		SERR_SetError(B_INSTNUM_ SPDO_k_ERR_PTR_INV,0UL);
+	}
+	else
+	{
+		bRetVal = TRUE;
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+		ps_status->w_noRxSpdo = SPDO_GetRxSpdoCap(B_INSTNUM);
+#else
+		/* the consumer SMs of Rx SPDOs missing in the SOD are not initialized */
+		ps_status->w_noRxSpdo = SPDO_GetNoRxSpdo(B_INSTNUM);
+#endif
+		w_noWords = (UINT16)((ps_status->w_noRxSpdo + 31U) / 32U);
+		w_rxSpdoIdx = 0U;
+
+		for (i = 0U; i < (UINT16)SPDO_k_RX_SPDO_BIT_WORDS; i++)
+		{
+			dw_word = 0UL;
+			/* if the word is used by the instance */
+			if (i < w_noWords)
+			{
+				/* collect the data valid bits and the age of the Rx SPDOs of this word */
+				for (dw_mask = 0x00000001UL;
+					 (dw_mask != 0UL) && (w_rxSpdoIdx < ps_status->w_noRxSpdo);
+					 dw_mask <<= 1)
+				{
+					ps_consSm = &aps_ConsSm[B_INSTNUMidx][w_rxSpdoIdx];
+					/* if process data is valid */
+					if ((ps_consSm->o_timeSyncOk) &&
+						(!ps_consSm->o_safeState))
+					{
+						dw_word |= dw_mask;
+						ps_status->adw_ageSpdo[w_rxSpdoIdx] =
+								dw_ct - (ps_consSm->dw_sct - (UINT32)*ps_consSm->pw_sct);
+					}
+					else
+					{
+						ps_status->adw_ageSpdo[w_rxSpdoIdx] = SPDO_k_AGE_INVALID;
+					}
+					w_rxSpdoIdx++;
+				}
+			}
+			ps_status->adw_dataValid[i] = dw_word;
+			ps_status->adw_dataValidChanged[i] = dw_word ^ aadw_LastDataValid[B_INSTNUMidx][i];
+			aadw_LastDataValid[B_INSTNUMidx][i] = dw_word;
+
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+			/* the connection valid bit field is already organized in words */
+			dw_word = (i < w_noWords) ? SHNF_aaulConnValidBit[B_INSTNUMidx][i] : 0UL;
+			ps_status->adw_connValid[i] = dw_word;
+			ps_status->adw_connValidChanged[i] = dw_word ^ aadw_LastConnValid[B_INSTNUMidx][i];
+			aadw_LastConnValid[B_INSTNUMidx][i] = dw_word;
+#endif
+		}
+		/* unused entries of the age array */
+		for (; w_rxSpdoIdx < (UINT16)SPDO_cfg_MAX_NO_RX_SPDO; w_rxSpdoIdx++)
+		{
+			ps_status->adw_ageSpdo[w_rxSpdoIdx] = SPDO_k_AGE_INVALID;
+		}
+	}
+
+	/* call the Control Flow Monitoring */
+	SCFM_TACK_PATH();
+
+	return bRetVal;
+}
+
 #else
   /* This file is compiled with different configuration (EPLScfg.h).
      If SPDO_cfg_MAX_NO_RX_SPDO is 0 then a compiler warning can be generated.
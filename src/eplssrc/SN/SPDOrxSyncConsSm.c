@@ -43,6 +43,11 @@
 #include "SERR.h"
 #include "SPDOerr.h"
 #include "SPDOint.h"
+#include "SPDOapi.h"
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  #include "SSC.h"
+#endif
 
 
 /**
@@ -77,16 +82,49 @@
 #define k_SIDX_TX_SPDO_NO            12U
 /** @} */
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_DISABLE)
 /**
  * Object containing all time synchronization state machines.
  */
 static t_RX_SYNC_CONS_SPDO as_TimeSyncConsSm[(EPLS_cfg_MAX_INSTANCES - 1)*SPDO_cfg_MAX_NO_RX_SPDO_SDG +
                                              SPDO_cfg_MAX_NO_RX_SPDO] SAFE_NO_INIT_SEKTOR;
+#endif
 /**
  * Object structure to control the Rx SPDOs.
 */
 static t_RX_SYNC_CONS_SM_OBJ as_Obj[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
 
+#if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+/**
+ * Structure for the time synchronization statistic of a Rx SPDO.
+ */
+typedef struct
+{
+  /** statistic returned by SPDO_GetTSyncStat(), dw_meanDelay is calculated there */
+  SPDO_t_TSYNC_STAT s_stat;
+  /** sum of the propagation delays for the mean value */
+  UINT32 dw_sumDelay;
+  /** number of propagation delays in dw_sumDelay */
+  UINT32 dw_noSumDelay;
+} t_TSYNC_STAT;
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_DISABLE)
+/**
+ * Time synchronization statistic of all Rx SPDOs, same layout as as_TimeSyncConsSm.
+ */
+static t_TSYNC_STAT as_TSyncStat[(EPLS_cfg_MAX_INSTANCES - 1)*SPDO_cfg_MAX_NO_RX_SPDO_SDG +
+                                 SPDO_cfg_MAX_NO_RX_SPDO] SAFE_NO_INIT_SEKTOR;
+#endif
+/**
+ * Pointer to the time synchronization statistic of the instances.
+ */
+static t_TSYNC_STAT *aps_TSyncStat[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+static void TSyncStatReset(t_TSYNC_STAT *ps_tSyncStat);
+static void TSyncStatDelay(t_TSYNC_STAT *ps_tSyncStat, UINT32 dw_propDelay,
+                           UINT16 w_noNotAnsweredTReq);
+#endif
+
 
 static void TimeSyncConsSmInit(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx);
 static BOOLEAN SetPtrToRxCommPara(BYTE_B_INSTNUM_ UINT16 w_index,
@@ -108,6 +146,21 @@ static void IncTReqCounters(UINT32 dw_ct, t_RX_SYNC_CONS_SPDO *ps_rxSpdo);
  */
 void SPDO_InitRxSyncCons(BYTE_B_INSTNUM)
 {
+#if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+	UINT16 w_rxSpdoIdx; /* loop counter */
+	UINT16 w_noRxSpdo; /* number of the statistics of the instance */
+#endif
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+	/* the state machines and statistics of the Rx SPDOs defined in the SOD,
+	   if the arena is too small, SPDO_InitAll() fails */
+	as_Obj[B_INSTNUMidx].ps_rxSpdo = (t_RX_SYNC_CONS_SPDO *)SSC_ArenaAlloc(B_INSTNUM_
+	    (UINT32)SPDO_GetRxSpdoCap(B_INSTNUM) * (UINT32)sizeof(t_RX_SYNC_CONS_SPDO));
+  #if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+	aps_TSyncStat[B_INSTNUMidx] = (t_TSYNC_STAT *)SSC_ArenaAlloc(B_INSTNUM_
+	    (UINT32)SPDO_GetRxSpdoCap(B_INSTNUM) * (UINT32)sizeof(t_TSYNC_STAT));
+  #endif
+#else /* EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE */
 #if EPLS_cfg_MAX_INSTANCES > 1 /* if more instances are configured */
 	/* initialize the pointer array */
 	if ( 0 == B_INSTNUMidx)
@@ -121,6 +174,33 @@ void SPDO_InitRxSyncCons(BYTE_B_INSTNUM)
 #else /* EPLS_cfg_MAX_INSTANCES > 1 */
 	as_Obj[B_INSTNUMidx].ps_rxSpdo	= &as_TimeSyncConsSm[0];
 #endif /* EPLS_cfg_MAX_INSTANCES > 1 */
+#if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+	/* the statistic uses the same layout as the state machines */
+	aps_TSyncStat[B_INSTNUMidx] = &as_TSyncStat[as_Obj[B_INSTNUMidx].ps_rxSpdo -
+	                                            &as_TimeSyncConsSm[0]];
+#endif
+#endif /* EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE */
+
+#if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+	w_noRxSpdo = SPDO_GetRxSpdoCap(B_INSTNUM);
+#elif (EPLS_cfg_MAX_INSTANCES > 1)
+	w_noRxSpdo = (0U == B_INSTNUMidx) ? (UINT16)SPDO_cfg_MAX_NO_RX_SPDO :
+	                                    (UINT16)SPDO_cfg_MAX_NO_RX_SPDO_SDG;
+#else
+	w_noRxSpdo = (UINT16)SPDO_cfg_MAX_NO_RX_SPDO;
+#endif
+	/* the statistics are not initialized at startup and SPDO_GetTSyncStat()
+	   may read the statistic of an Rx SPDO not defined in the SOD */
+	if (aps_TSyncStat[B_INSTNUMidx] != NULL)
+	{
+		for (w_rxSpdoIdx = 0U; w_rxSpdoIdx < w_noRxSpdo; w_rxSpdoIdx++)
+		{
+			TSyncStatReset(aps_TSyncStat[B_INSTNUMidx] + w_rxSpdoIdx);
+		}
+	}
+	/* no else : arena overflow, SPDO_InitAll() fails */
+#endif
 }
 /**
 * @brief This function gets the TxSPDO number for a RxSPDO.
@@ -253,6 +333,10 @@ BOOLEAN SPDO_SetPtrToRxCommPara(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx,
 
     TimeSyncConsSmInit(B_INSTNUM_ w_rxSpdoIdx);
 
+    #if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+      TSyncStatReset(aps_TSyncStat[B_INSTNUMidx] + w_rxSpdoIdx);
+    #endif
+
     o_ret = TRUE;
   }
 
@@ -417,6 +501,11 @@ void SPDO_TimeSyncConsSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
           {
             /* count the number of TR expired events */
             SERR_CountSpdoEvt(B_INSTNUM_ w_rxSpdoIdx,SERR_k_SPDO_TR_EXP);
+            #if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+              aps_TSyncStat[B_INSTNUMidx][w_rxSpdoIdx].s_stat.dw_noNotAnsweredExp++;
+              aps_TSyncStat[B_INSTNUMidx][w_rxSpdoIdx].s_stat.w_maxNotAnsweredTReq =
+                  ps_rxSpdo->s_rxCtr.w_noNotAnsweredTReq;
+            #endif
 
             ps_rxSpdo->s_rxCtr.w_noNotAnsweredTReq = 0U;
             SERR_SetError(B_INSTNUM_ SPDO_k_ERR_TR_EXPIRED,
@@ -796,6 +885,11 @@ static void StateWaitForTres(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_rxSpdoIdx,
       /* propagation delay = (Rx TRes CT) - (Tx TReq CT) */
       dw_propDelay = dw_ct - dw_sentTReqCtTmp;
 
+      #if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+        TSyncStatDelay(aps_TSyncStat[B_INSTNUMidx] + w_rxSpdoIdx, dw_propDelay,
+                       ps_rxSpdo->s_rxCtr.w_noNotAnsweredTReq);
+      #endif
+
       /* if the time synchronization propagation delay is OK */
       if (( *ps_rxSpdo->s_rxCommPara.pw_minTSyncPropDelay <= dw_propDelay ) &&
           ( *ps_rxSpdo->s_rxCommPara.pw_maxTSyncPropDelay >= dw_propDelay ))
@@ -962,6 +1056,181 @@ static void IncTReqCounters(UINT32 dw_ct, t_RX_SYNC_CONS_SPDO *ps_rxSpdo)
   /* call the Control Flow Monitoring */
   SCFM_TACK_PATH();
 }
+
+#if (SPDO_cfg_TSYNC_STATISTIC == EPLS_k_ENABLE)
+/**
+* @brief This function reads the time synchronization statistic of a Rx SPDO.
+*
+* The statistic is reset if the Rx SPDO communication parameters are initialized
+* or if o_reset is TRUE. It is kept over the transitions between Pre-operational and Operational.
+*
+* @param       b_instNum           instance number (checked), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+*
+* @param       w_rxSpdoIdx         Rx SPDO index (checked), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
+*
+* @param       o_reset             TRUE if the statistic is reset after it was read (not checked, any value allowed)
+*
+* @retval      ps_stat             time synchronization statistic (checked), valid range: <> NULL
+*
+* @return
+* - TRUE             - statistic read
+* - FALSE            - invalid parameter
+*/
+BOOLEAN SPDO_GetTSyncStat(BYTE_B_INSTNUM_ UINT16 const w_rxSpdoIdx,
+	BOOLEAN const o_reset, SPDO_t_TSYNC_STAT * const ps_stat)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  t_TSYNC_STAT *ps_tSyncStat; /* statistic of the Rx SPDO */
+
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+  /* if b_instNum is wrong */
+  if (B_INSTNUMidx >= (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_INST_INV, (UINT32)B_INSTNUMidx);
+  }
+  else
+#endif
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  /* if SPDO index too high for the SPDOs of the SOD */
+  if (SPDO_GetRxSpdoCap(B_INSTNUM) <= w_rxSpdoIdx)
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_RX_SPDO_IDX,
+                  (((UINT32)(B_INSTNUMidx))<<16) + w_rxSpdoIdx);
+  }
+#else
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+  /* if not main instance and SPDO index too high */
+  if ((0U != B_INSTNUMidx) &&
+      ((UINT16)SPDO_cfg_MAX_NO_RX_SPDO_SDG <= w_rxSpdoIdx))
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_RX_SPDO_IDX,
+                  (((UINT32)(B_INSTNUMidx))<<16) + w_rxSpdoIdx);
+  }
+  else
+#endif
+  /* if main instance and SPDO index too high */
+  if ((0U == B_INSTNUMidx) &&
+      ((UINT16)SPDO_cfg_MAX_NO_RX_SPDO <= w_rxSpdoIdx))
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_RX_SPDO_IDX,
+                  (((UINT32)(B_INSTNUMidx))<<16) + w_rxSpdoIdx);
+  }
+#endif
+  /* else if return pointer is invalid */
+  else if (NULL == ps_stat)
+  {
+    SERR_SetError(B_INSTNUM_ SPDO_k_ERR_PTR_INV, 0UL);
+  }
+  else
+  {
+    ps_tSyncStat = aps_TSyncStat[B_INSTNUMidx] + w_rxSpdoIdx;
+
+    *ps_stat = ps_tSyncStat->s_stat;
+    /* if a delay was measured */
+    if (ps_tSyncStat->dw_noSumDelay != 0UL)
+    {
+      ps_stat->dw_meanDelay = ps_tSyncStat->dw_sumDelay /
+                              ps_tSyncStat->dw_noSumDelay;
+    }
+    /* no else : mean is 0 */
+    ps_stat->w_noNotAnsweredTReq =
+        (as_Obj[B_INSTNUMidx].ps_rxSpdo + w_rxSpdoIdx)->s_rxCtr.w_noNotAnsweredTReq;
+
+    /* if the statistic is reset */
+    if (o_reset)
+    {
+      TSyncStatReset(ps_tSyncStat);
+    }
+    /* no else : statistic is kept */
+
+    o_ret = TRUE;
+  }
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+
+/**
+* @brief This function resets the time synchronization statistic of a Rx SPDO.
+*
+* @param    ps_tSyncStat         pointer to the statistic (pointer not checked, only called with reference to struct in SPDO_SetPtrToRxCommPara() or SPDO_GetTSyncStat())
+*/
+static void TSyncStatReset(t_TSYNC_STAT *ps_tSyncStat)
+{
+  UINT8 b_bucket; /* loop counter */
+
+  ps_tSyncStat->s_stat.dw_noTRes = 0UL;
+  ps_tSyncStat->s_stat.dw_minDelay = 0xFFFFFFFFUL;
+  ps_tSyncStat->s_stat.dw_maxDelay = 0UL;
+  ps_tSyncStat->s_stat.dw_meanDelay = 0UL;
+  for (b_bucket = 0U; b_bucket < (UINT8)SPDO_k_TSYNC_HIST_BUCKETS; b_bucket++)
+  {
+    ps_tSyncStat->s_stat.adw_hist[b_bucket] = 0UL;
+  }
+  ps_tSyncStat->s_stat.dw_noNotAnsweredExp = 0UL;
+  ps_tSyncStat->s_stat.w_maxNotAnsweredTReq = 0U;
+  ps_tSyncStat->s_stat.w_noNotAnsweredTReq = 0U;
+  ps_tSyncStat->dw_sumDelay = 0UL;
+  ps_tSyncStat->dw_noSumDelay = 0UL;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function records a measured time synchronization propagation delay.
+*
+* @param    ps_tSyncStat         pointer to the statistic (pointer not checked, only called with reference to struct in StateWaitForTres())
+*
+* @param    dw_propDelay         measured propagation delay (not checked, any value allowed) valid range: (UINT32)
+*
+* @param    w_noNotAnsweredTReq  number of not answered TReqs at the reception of the TRes (not checked, any value allowed) valid range: (UINT16)
+*/
+static void TSyncStatDelay(t_TSYNC_STAT *ps_tSyncStat, UINT32 dw_propDelay,
+                           UINT16 w_noNotAnsweredTReq)
+{
+  UINT8 b_bucket = 0U; /* histogram bucket of the delay */
+  UINT32 dw_rest = dw_propDelay; /* delay shifted to find the bucket */
+
+  ps_tSyncStat->s_stat.dw_noTRes++;
+  if (dw_propDelay < ps_tSyncStat->s_stat.dw_minDelay)
+  {
+    ps_tSyncStat->s_stat.dw_minDelay = dw_propDelay;
+  }
+  if (dw_propDelay > ps_tSyncStat->s_stat.dw_maxDelay)
+  {
+    ps_tSyncStat->s_stat.dw_maxDelay = dw_propDelay;
+  }
+  if (w_noNotAnsweredTReq > ps_tSyncStat->s_stat.w_maxNotAnsweredTReq)
+  {
+    ps_tSyncStat->s_stat.w_maxNotAnsweredTReq = w_noNotAnsweredTReq;
+  }
+
+  /* if the sum would overflow then sum and number are halved, the mean stays */
+  if (dw_propDelay > (0xFFFFFFFFUL - ps_tSyncStat->dw_sumDelay))
+  {
+    ps_tSyncStat->dw_sumDelay >>= 1;
+    ps_tSyncStat->dw_noSumDelay >>= 1;
+  }
+  ps_tSyncStat->dw_sumDelay += dw_propDelay;
+  ps_tSyncStat->dw_noSumDelay++;
+
+  /* bucket is the number of significant bits of the delay */
+  while ((dw_rest != 0UL) &&
+         (b_bucket < (UINT8)(SPDO_k_TSYNC_HIST_BUCKETS - 1)))
+  {
+    dw_rest >>= 1;
+    b_bucket++;
+  }
+  ps_tSyncStat->s_stat.adw_hist[b_bucket]++;
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+}
+#endif
+
 #else
   /* This file is compiled with different configuration (EPLScfg.h).
      If SPDO_cfg_MAX_NO_RX_SPDO is 0 then a compiler warning can be generated.
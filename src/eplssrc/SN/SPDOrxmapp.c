@@ -43,6 +43,10 @@
   #include "SPDOapi.h"
   #include "SPDOint.h"
 
+  #if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+    #include "SSC.h"
+  #endif
+
   /* Lint error 767 : (Info -- macro 'xxx' was defined differently in another
                        module) */
   /**
@@ -79,6 +83,7 @@
   #define SPDO_SetMapp                   SPDO_SetRxMapp //lint !e767
   #define SPDO_SOD_MappPara_CLBK         SPDO_SOD_RxMappPara_CLBK //lint !e767
   #define SPDO_MappActivate              SPDO_RxMappActivate //lint !e767
+  #define SPDO_GetSpdoCap                SPDO_GetRxSpdoCap //lint !e767
   /** @} */
 
 
@@ -93,9 +98,15 @@
 
   #include "SPDOmappcom.cin"
 
+  #if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+    static void DefValueToPi(UINT8 *pb_dst, const t_MAPPED_OBJECT *ps_obj);
+  #endif
+
   /**
   * @brief This function copies the SPDO data from the openSAFETY frame into the SOD.
   *
+  * If SPDO_cfg_PROCESS_IMAGE is enabled, the SPDO data is published in the process image instead of the SOD.
+  *
   * @param        b_instNum            instance number (not checked, checked in SPDO_CheckRxTimeout() or SPDO_BuildTxSpdo() and SPDO_ProcessRxSpdo()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
   *
   * @param        w_rxSpdoIdx          Rx SPDO index (not checked, checked in SPDO_CheckRxTimeout() or SPDO_BuildTxSpdo() or ProcessTReq() or ProcessTRes() or SPDO_ProcessRxSpdo() and SPDO_GetSpdoIdxForSAdr()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
@@ -115,18 +126,27 @@
     t_MAPP_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
     t_MAPP_PARAM *ps_rxSpdo = po_this->ps_mappPara + w_rxSpdoIdx; /* pointer to
                                               the Rx SPDO internal structure */
+  #if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_DISABLE)
     UINT32 i; /* loop counter */
+  #endif
 
     /* if payload size is right */
     if (ps_rxSpdo->b_lenOfSpdo == b_payloadSize)
     {
       o_ret = TRUE;
+    #if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+      /* the payload is published in the process image, the mapped objects
+         are not written */
+      MEMCOPY(SPDO_RxPiGetBuf(B_INSTNUM_ w_rxSpdoIdx), pv_data, b_payloadSize);
+      SPDO_RxPiPublish(B_INSTNUM_ w_rxSpdoIdx, b_payloadSize);
+    #else
       /* loop from 0 to length of the SPDO */
       for (i = 0U; i < ps_rxSpdo->b_lenOfSpdo; i++)
       {
         /* copy one Byte from the SPDO into the SOD */
         *(ps_rxSpdo->apb_DataForSpdo[i]) = *ADD_OFFSET(pv_data,i);
       }
+    #endif
     }
     /* else wrong payload size */
     else
@@ -146,6 +166,8 @@
   /**
   * @brief This function sets all Rx SPDO related data to the default value.
   *
+  * If SPDO_cfg_PROCESS_IMAGE is enabled, the default values are published in the process image instead of the SOD.
+  *
   * @param      b_instNum            instance number (not checked, checked in SPDO_CheckRxTimeout() or SSC_ProcessSNMTSSDOFrame() or SPDO_BuildTxSpdo() and SPDO_ProcessRxSpdo()), valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
   *
   * @param      w_rxSpdoIdx          Rx SPDO index (not checked, checked in SPDO_CheckRxTimeout() or  SPDO_BuildTxSpdo() or SPDO_ResetRxSm() ProcessTReq() or ProcessTRes() or SPDO_ProcessRxSpdo() and SPDO_GetSpdoIdxForSAdr()), valid range: 0..(SPDO_cfg_MAX_NO_RX_SPDO-1)
@@ -156,7 +178,20 @@
     t_MAPP_PARAM *ps_rxSpdo = po_this->ps_mappPara + w_rxSpdoIdx; /* pointer to
                                               the Rx SPDO internal structure */
     UINT32 i; /* loop counter */
+  #if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+    UINT8 *pb_pi = SPDO_RxPiGetBuf(B_INSTNUM_ w_rxSpdoIdx); /* back buffer of
+                                                        the process image */
+    UINT8 b_offset = 0U; /* offset of the mapped object in the payload */
 
+    /* loop from 0 to number of mapped objects */
+    for (i=0U; i < ps_rxSpdo->b_noMappedObject; i++)
+    {
+      /* the default value is written in the byte order of the frame */
+      DefValueToPi(ADD_OFFSET(pb_pi, b_offset), &ps_rxSpdo->as_mappedObject[i]);
+      b_offset = (UINT8)(b_offset + ps_rxSpdo->as_mappedObject[i].b_dataLen);
+    }
+    SPDO_RxPiPublish(B_INSTNUM_ w_rxSpdoIdx, ps_rxSpdo->b_lenOfSpdo);
+  #else
     /* loop from 0 to number of mapped objects */
     for (i=0U; i < ps_rxSpdo->b_noMappedObject; i++)
     {
@@ -165,10 +200,54 @@
              ps_rxSpdo->as_mappedObject[i].pv_defValue,
              ps_rxSpdo->as_mappedObject[i].b_dataLen);
     }
+  #endif
+
+    /* call the Control Flow Monitoring */
+    SCFM_TACK_PATH();
+  }
+
+  #if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+  /**
+  * @brief This function writes the default value of a mapped object into the process image.
+  *
+  * @param      pb_dst               reference to the object in the process image (not checked, only called with reference to array in SPDO_RxSpdoToSafeState()), valid range: <> NULL
+  *
+  * @param      ps_obj               reference to the mapped object (not checked, only called with reference to struct in SPDO_RxSpdoToSafeState()), valid range: <> NULL
+  */
+  static void DefValueToPi(UINT8 *pb_dst, const t_MAPPED_OBJECT *ps_obj)
+  {
+    #if (ENDIAN == BIG)
+      UINT32 i; /* loop counter */
+    #endif
+
+    /* if no default value is available (dummy mapping) */
+    if (ps_obj->pv_defValue == NULL)
+    {
+      MEMSET(pb_dst, 0, ps_obj->b_dataLen);
+    }
+    #if (ENDIAN == BIG)
+      /* else if no DOMAIN,Visible or Octet string */
+      else if ((ps_obj->e_dataType != EPLS_k_DOMAIN)         &&
+               (ps_obj->e_dataType != EPLS_k_VISIBLE_STRING) &&
+               (ps_obj->e_dataType != EPLS_k_OCTET_STRING))
+      {
+        /* the byte order is reversed as in AddObjToByteArray() */
+        for (i = 0U; i < ps_obj->b_dataLen; i++)
+        {
+          *ADD_OFFSET(pb_dst, i) =
+            *ADD_OFFSET(ps_obj->pv_defValue, (ps_obj->b_dataLen - i - 1U));
+        }
+      }
+    #endif
+    else
+    {
+      MEMCOPY(pb_dst, ps_obj->pv_defValue, ps_obj->b_dataLen);
+    }
 
     /* call the Control Flow Monitoring */
     SCFM_TACK_PATH();
   }
+  #endif
 
 #else
   /* This file is compiled with different configuration (EPLScfg.h).
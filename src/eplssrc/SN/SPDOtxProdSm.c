@@ -40,6 +40,10 @@
 #include "SPDOerr.h"
 #include "SPDOint.h"
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  #include "SSC.h"
+#endif
+
 /**
  * @name SPDO Tx Communication Parameters
  * @{
@@ -60,6 +64,29 @@
  */
 static t_TXSM_OBJ as_Obj[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_DISABLE)
+/**
+ * Tx SPDO structures of all instances
+ */
+static t_TX_SPDO aas_TxSpdo[EPLS_cfg_MAX_INSTANCES][SPDO_cfg_MAX_NO_TX_SPDO]
+  SAFE_NO_INIT_SEKTOR;
+#endif
+
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+/**
+ * Cached CRC state of the last transmitted frame of every Tx SPDO of the instances
+ */
+static SFS_t_TX_CRC_CACHE *aps_TxCrcCache[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+#else
+/**
+ * Cached CRC state of the last transmitted frame of every Tx SPDO
+ */
+static SFS_t_TX_CRC_CACHE aas_TxCrcCache[EPLS_cfg_MAX_INSTANCES][SPDO_cfg_MAX_NO_TX_SPDO]
+  SAFE_NO_INIT_SEKTOR;
+#endif
+#endif
+
 
 static BOOLEAN SendTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
                           UINT8 b_spdoId, UINT8 b_tr, UINT16 w_tAdr,
@@ -79,7 +106,7 @@ static BOOLEAN SetPtrToTxCommPara(BYTE_B_INSTNUM_ UINT16 w_index,
    */
 void SPDO_ClearConnectedRxSpdo(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx)
 {
-  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].as_txSpdo[w_txSpdoIdx].s_txVar;
+  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].ps_txSpdo[w_txSpdoIdx].s_txVar;
   (void)MEMSET((void*)&po_this->aps_consSm[0],0,sizeof(po_this->aps_consSm));
 }
 
@@ -96,7 +123,7 @@ void SPDO_ClearConnectedRxSpdo(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx)
  */
 BOOLEAN SPDO_SyncOkConnect(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx, t_RX_CONS_SM const * const ps_consSm)
 {
-  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].as_txSpdo[w_txSpdoIdx].s_txVar;
+  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].ps_txSpdo[w_txSpdoIdx].s_txVar;
   BOOLEAN         o_retVal = FALSE;
 #if (1 < SPDO_cfg_MAX_SYNC_RX_SPDO)
   UINT16          i;
@@ -139,11 +166,44 @@ void SPDO_InitTxSm(BYTE_B_INSTNUM)
 {
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
   UINT32 i; /* loop counter */
+  UINT32 dw_noTxSpdo; /* number of Tx SPDO structures */
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  /* the structures of the Tx SPDOs defined in the SOD,
+     if the arena is too small, SPDO_InitAll() fails */
+  dw_noTxSpdo = (UINT32)SPDO_GetTxSpdoCap(B_INSTNUM);
+  po_this->ps_txSpdo = (t_TX_SPDO *)SSC_ArenaAlloc(B_INSTNUM_
+      dw_noTxSpdo * (UINT32)sizeof(t_TX_SPDO));
+  #if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+    aps_TxCrcCache[B_INSTNUMidx] = (SFS_t_TX_CRC_CACHE *)SSC_ArenaAlloc(B_INSTNUM_
+        dw_noTxSpdo * (UINT32)sizeof(SFS_t_TX_CRC_CACHE));
+    /* if the allocation failed */
+    if (NULL == aps_TxCrcCache[B_INSTNUMidx])
+    {
+      dw_noTxSpdo = 0UL;
+    }
+  #endif
+  /* if the allocation failed */
+  if (NULL == po_this->ps_txSpdo)
+  {
+    dw_noTxSpdo = 0UL;
+  }
+#else
+  po_this->ps_txSpdo = &aas_TxSpdo[B_INSTNUMidx][0];
+  dw_noTxSpdo = (UINT32)SPDO_cfg_MAX_NO_TX_SPDO;
+#endif
 
-  for(i = 0U; i < (UINT32)SPDO_cfg_MAX_NO_TX_SPDO; i++)
+  for(i = 0U; i < dw_noTxSpdo; i++)
   {
-    po_this->as_txSpdo[i].s_txCommPara.pw_sadr = ((UINT16 *)(NULL));
-    po_this->as_txSpdo[i].s_txCommPara.pw_refreshPrescale = ((UINT16 *)(NULL));
+    po_this->ps_txSpdo[i].s_txCommPara.pw_sadr = ((UINT16 *)(NULL));
+    po_this->ps_txSpdo[i].s_txCommPara.pw_refreshPrescale = ((UINT16 *)(NULL));
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+  #if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+    SFS_TxCrcCacheInit(&aps_TxCrcCache[B_INSTNUMidx][i]);
+  #else
+    SFS_TxCrcCacheInit(&aas_TxCrcCache[B_INSTNUMidx][i]);
+  #endif
+#endif
   }
 
   /* call the Control Flow Monitoring */
@@ -173,7 +233,7 @@ BOOLEAN SPDO_SetPtrToTxCommPara(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx,
   void *pv_noTres;
 
   /* pointer to the Tx communication parameter */
-  t_TX_COMM_PARAM *ps_txComm = &po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara;
+  t_TX_COMM_PARAM *ps_txComm = &po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara;
 
   /* if SADR : 0x1C00-0x1FFE sub 1 is OK */
   if (SetPtrToTxCommPara(B_INSTNUM_ w_index, k_SIDX_TX_SADR,
@@ -217,7 +277,7 @@ void SPDO_ResetTxSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_noTxSpdo)
   /* loop for all tx SPDO state machine */
   for(w_txSpdoIdx = 0U; w_txSpdoIdx < w_noTxSpdo; w_txSpdoIdx++)
   {
-    ps_txSpdo = &po_this->as_txSpdo[w_txSpdoIdx];
+    ps_txSpdo = &po_this->ps_txSpdo[w_txSpdoIdx];
 
     ps_txSpdo->s_txVar.e_sendingReqType = k_SENDING_FREE;
 
@@ -228,6 +288,10 @@ void SPDO_ResetTxSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_noTxSpdo)
 
     ps_txSpdo->s_txVar.o_lastCtChk = FALSE;
     ps_txSpdo->s_txVar.dw_lastCt = 0UL;
+#if (SPDO_cfg_TX_CHANGE_DETECT == EPLS_k_ENABLE)
+    MEMSET(ps_txSpdo->s_txVar.adw_lastPayload, 0,
+           sizeof(ps_txSpdo->s_txVar.adw_lastPayload));
+#endif
 
     SPDO_TimeSyncProdSmReset(B_INSTNUM_ w_txSpdoIdx);
   }
@@ -252,7 +316,7 @@ BOOLEAN SPDO_CheckTxCommPara(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
   BOOLEAN o_ret = FALSE; /* return value */
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
   /* pointer to the Tx communication parameter */
-  t_TX_COMM_PARAM *ps_txComm = &po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara;
+  t_TX_COMM_PARAM *ps_txComm = &po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara;
 
   /* if target address was inserted successful */
   if (SPDO_AddTAdr(B_INSTNUM_ w_txSpdoIdx, *ps_txComm->pw_sadr))
@@ -289,7 +353,7 @@ void SPDO_ProdSm(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
 
   /* if Tx SPDO is active */
-  if (*po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != k_NOT_USED_ADR)
+  if (*po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != k_NOT_USED_ADR)
   {
     /* if the Data only sending request was accomplished */
     if (SPDO_SendTxSpdo(B_INSTNUM_ dw_ct, w_txSpdoIdx, k_SENDING_DATA_ONLY,
@@ -337,7 +401,7 @@ BOOLEAN SPDO_SendTxSpdo(BYTE_B_INSTNUM_  UINT32 dw_ct, UINT16 w_txSpdoIdx,
 {
   BOOLEAN o_ret = FALSE; /* return value */
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
-  t_TX_SPDO *ps_txSpdo = &po_this->as_txSpdo[w_txSpdoIdx]; /* pointer to
+  t_TX_SPDO *ps_txSpdo = &po_this->ps_txSpdo[w_txSpdoIdx]; /* pointer to
                                               the Tx SPDO internal structure */
   t_VARIABLE_FOR_TX_SPDO *ps_txVar = &ps_txSpdo->s_txVar;
 
@@ -370,6 +434,18 @@ BOOLEAN SPDO_SendTxSpdo(BYTE_B_INSTNUM_  UINT32 dw_ct, UINT16 w_txSpdoIdx,
             /* else other Tx SPDO transmission is request */
             else
             {
+            #if (SPDO_cfg_TX_CHANGE_DETECT == EPLS_k_ENABLE)
+              /* if neither the refresh time expired nor new data was
+                 signaled */
+              if ((!EPLS_TIMEOUT(dw_ct, ps_txVar->dw_timeoutDT)) &&
+                  (!ps_txVar->o_newData))
+              {
+                /* new data is available, if the mapped data differs from
+                   the last transmitted payload */
+                ps_txVar->o_newData = SPDO_TxMappingChanged(B_INSTNUM_
+                    w_txSpdoIdx, ps_txVar->adw_lastPayload);
+              }
+            #endif
               /* if Tx SPDO refresh time expired or new data is available */
               if ((EPLS_TIMEOUT(dw_ct, ps_txVar->dw_timeoutDT)) ||
                   (ps_txVar->o_newData))
@@ -460,7 +536,7 @@ BOOLEAN SPDO_SendTxSpdo(BYTE_B_INSTNUM_  UINT32 dw_ct, UINT16 w_txSpdoIdx,
  * @brief This function checks whether the given tx SPDO index exists or not.
  *
  * @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame() or SPDO_TxDataChanged()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
- * @param        w_txSpdoIdx        index in the internal array of the Tx SPDO structures (checked) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+ * @param        w_txSpdoIdx        index in the internal array of the Tx SPDO structures (checked) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1), 0..(SPDO_GetTxSpdoCap()-1) if EPLS_cfg_RUNTIME_ARENA is enabled
  *
  * @return
  * - TRUE             - Tx SPDO number exists
@@ -472,13 +548,17 @@ BOOLEAN SPDO_TxSpdoIdxExists(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
   t_TXSM_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
 
   /* if SPDO index is valid */
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  if (w_txSpdoIdx < SPDO_GetTxSpdoCap(B_INSTNUM))
+#else
   if (w_txSpdoIdx < (UINT16)SPDO_cfg_MAX_NO_TX_SPDO)
+#endif
   {
     /* if the Tx SPDO is defined */
-    if (po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != NULL)
+    if (po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != NULL)
     {
       /* if the Tx SPDO is configured */
-      if (*po_this->as_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != 
+      if (*po_this->ps_txSpdo[w_txSpdoIdx].s_txCommPara.pw_sadr != 
           k_NOT_USED_ADR)
       {
         o_ret = TRUE;
@@ -521,7 +601,7 @@ void SPDO_NewData(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx)
   /* if Tx Spdo exists */
   if (SPDO_TxSpdoIdxExists(B_INSTNUM_ w_txSpdoIdx))
   {
-    po_this->as_txSpdo[w_txSpdoIdx].s_txVar.o_newData = TRUE;
+    po_this->ps_txSpdo[w_txSpdoIdx].s_txVar.o_newData = TRUE;
   }
   /* no else : Tx Spdo does not exist, error was already signaled */
 
@@ -588,12 +668,17 @@ static BOOLEAN SendTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
   UINT8 *pb_eplsFrame; /* pointer to the openSAFETY frame */
   /* buffer for the tx SPDO frame header */
   static EPLS_t_FRM_HDR s_txSpdoHeaderBuffer SAFE_NO_INIT_SEKTOR;
+#if (SPDO_cfg_TX_CHANGE_DETECT == EPLS_k_ENABLE)
+  /* buffer for the payload before the serialization */
+  static UINT32 adw_payload[(SPDO_cfg_MAX_LEN_OF_TX_SPDO + 3) / 4]
+                SAFE_NO_INIT_SEKTOR;
+#endif
 
   /* SPDO frame header is initialized */
   /* openSAFETY domain number */
   s_txSpdoHeaderBuffer.w_sdn = SDN_GetSdn(B_INSTNUM);
   /* source address */
-  s_txSpdoHeaderBuffer.w_adr = *po_this->as_txSpdo[w_txSpdoIdx].
+  s_txSpdoHeaderBuffer.w_adr = *po_this->ps_txSpdo[w_txSpdoIdx].
                               s_txCommPara.pw_sadr;
   /* SPDO id is set */
   s_txSpdoHeaderBuffer.b_id = b_spdoId;
@@ -618,9 +703,28 @@ static BOOLEAN SendTxSpdo(BYTE_B_INSTNUM_ UINT32 dw_ct, UINT16 w_txSpdoIdx,
   /* if the SPDO was allocated successful */
   if (pb_eplsFrame != NULL)
   {
+#if (SPDO_cfg_TX_CHANGE_DETECT == EPLS_k_ENABLE)
+    /* the payload is copied before the frame is serialized */
+    MEMCOPY(adw_payload, ADD_OFFSET(pb_eplsFrame, SFS_k_FRM_DATA_OFFSET),
+            s_txSpdoHeaderBuffer.b_le);
+#endif
     /* if EPLS Frame to SHNF was successful */
+#if (SPDO_cfg_TX_DELTA_CRC == EPLS_k_ENABLE)
+    if (SFS_FrmSerializeCached(B_INSTNUM_ &s_txSpdoHeaderBuffer, pb_eplsFrame,
+  #if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+                               &aps_TxCrcCache[B_INSTNUMidx][w_txSpdoIdx]))
+  #else
+                               &aas_TxCrcCache[B_INSTNUMidx][w_txSpdoIdx]))
+  #endif
+#else
     if (SFS_FrmSerialize(B_INSTNUM_ &s_txSpdoHeaderBuffer, pb_eplsFrame))
+#endif
     {
+#if (SPDO_cfg_TX_CHANGE_DETECT == EPLS_k_ENABLE)
+      /* the payload of the sent SPDO is kept for the change detection */
+      MEMCOPY(po_this->ps_txSpdo[w_txSpdoIdx].s_txVar.adw_lastPayload,
+              adw_payload, s_txSpdoHeaderBuffer.b_le);
+#endif
       /* Free frame counter is decremented */
       (*pb_noFreeFrm)--;
       /* Tx SPDO was sent */
@@ -739,7 +843,7 @@ static BOOLEAN SetPtrToTxCommPara(BYTE_B_INSTNUM_ UINT16 w_index,
 */
 static BOOLEAN GetConnectionValid(BYTE_B_INSTNUM_ UINT16 const w_txSpdoIdx)
 {
-  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].as_txSpdo[w_txSpdoIdx].s_txVar;
+  t_VARIABLE_FOR_TX_SPDO  *po_this = &as_Obj[B_INSTNUMidx].ps_txSpdo[w_txSpdoIdx].s_txVar;
   BOOLEAN o_retVal = TRUE;
 #if (1 < SPDO_cfg_MAX_SYNC_RX_SPDO)
   UINT16 i;
@@ -42,6 +42,10 @@
 #include "SPDOapi.h"
 #include "SPDOint.h"
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  #include "SSC.h"
+#endif
+
 /* Lint error 767 : (Info -- macro 'xxx' was defined differently in another
                              module) */
 /**
@@ -78,6 +82,7 @@
 #define SPDO_SetMapp                   SPDO_SetTxMapp //lint !e767
 #define SPDO_SOD_MappPara_CLBK         SPDO_SOD_TxMappPara_CLBK //lint !e767
 #define SPDO_MappActivate              SPDO_TxMappActivate //lint !e767
+#define SPDO_GetSpdoCap                SPDO_GetTxSpdoCap //lint !e767
 /** @} */
 
 /**
@@ -94,6 +99,8 @@
 /**
 * @brief This function allocates an openSAFETY frame and copies the SPDO data from the SOD into the openSAFETY frame.
 *
+* If SPDO_cfg_PROCESS_IMAGE is enabled, the SPDO data is copied from the process image instead of the SOD.
+*
 * @param    b_instNum              instance number (not checked, checked in SPDO_BuildTxSpdo() or SPDO_ProcessRxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
 * @param    w_txSpdoIdx            Tx SPDO index (not checked, checked in SPDO_BuildTxSpdo() or SPDO_TxSpdoIdxExists() or ProcessTReq() and SPDO_GetSpdoIdxForTAdr()) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
 * @retval      pb_len                 reference to the length of the TxSPDO (pointer not checked, only called with reference to variable), valid range: <> NULL
@@ -109,11 +116,44 @@ UINT8 *SPDO_TxMappingProcess(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 *pb_len)
   t_MAPP_PARAM *ps_txSpdo = po_this->ps_mappPara + w_txSpdoIdx; /* pointer to
                                               the Tx SPDO internal structure */
   UINT8 *pb_payloadData; /* temporary pointer to set the payload data */
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+  UINT8 ab_payload[SPDO_cfg_MAX_LEN_OF_TX_SPDO]; /* copy of the process image */
+#else
   UINT32 i; /* loop counter */
+#endif
 
   /* if there are objects  mapped */
   if (ps_txSpdo->b_noMappedObject != 0U)
   {
+  #if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+    /* the copy is taken before the frame is allocated, so no frame is
+       allocated if the application is publishing too fast */
+    if (SPDO_TxPiSnapshot(B_INSTNUM_ w_txSpdoIdx, ps_txSpdo->b_lenOfSpdo,
+                          ab_payload))
+    {
+      /* openSAFETY frame is allocated */
+      pb_ret = SFS_GetMemBlock(B_INSTNUM_ SHNF_k_SPDO, w_txSpdoIdx,
+                               ps_txSpdo->b_lenOfSpdo);
+
+      /* if the openSAFETY frame is allocated successfully */
+      if (pb_ret != NULL)
+      {
+        /* pointer is set to the payload data */
+        pb_payloadData = ADD_OFFSET(pb_ret, SFS_k_FRM_DATA_OFFSET);
+
+        /* number of payload data */
+        *pb_len = ps_txSpdo->b_lenOfSpdo;
+
+        /* the process image is already in the byte order of the frame */
+        MEMCOPY(pb_payloadData, ab_payload, ps_txSpdo->b_lenOfSpdo);
+      }
+      /* no else : error */
+    }
+    else /* no consistent copy of the process image */
+    {
+      SERR_SetError(B_INSTNUM_ SPDO_k_ERR_PI_TX_INCONS, (UINT32)w_txSpdoIdx);
+    }
+  #else
     /* openSAFETY frame is allocated */
     pb_ret = SFS_GetMemBlock(B_INSTNUM_ SHNF_k_SPDO, w_txSpdoIdx,
                              ps_txSpdo->b_lenOfSpdo);
@@ -135,6 +175,7 @@ UINT8 *SPDO_TxMappingProcess(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 *pb_len)
       }
     }
     /* no else : error */
+  #endif
   }
   /* else mapping is not active */
   else
@@ -152,4 +193,75 @@ UINT8 *SPDO_TxMappingProcess(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx, UINT8 *pb_len)
   return pb_ret;
 }
 
+#if (SPDO_cfg_TX_CHANGE_DETECT == EPLS_k_ENABLE)
+/**
+* @brief This function gathers the mapped SPDO data and compares it with the payload of the last transmitted SPDO.
+*
+* The data is gathered like in SPDO_TxMappingProcess(), but into a word aligned buffer, so the
+* payloads are compared word by word. No openSAFETY frame is allocated.
+*
+* @param    b_instNum              instance number (not checked, checked in SPDO_BuildTxSpdo() or SPDO_ProcessRxSpdo()) valid range: 0..(EPLS_cfg_MAX_INSTANCES-1)
+* @param    w_txSpdoIdx            Tx SPDO index (not checked, checked in SPDO_BuildTxSpdo() or SPDO_TxSpdoIdxExists() or ProcessTReq() and SPDO_GetSpdoIdxForTAdr()) valid range: 0..(SPDO_cfg_MAX_NO_TX_SPDO-1)
+* @param    adw_lastPayload        payload of the last transmitted SPDO (pointer not checked, only called with reference to array), valid range: <> NULL
+*
+* @return
+* - TRUE             - the mapped data differs from the last transmitted payload
+* - FALSE            - the mapped data is unchanged or no consistent copy of the process image is available
+*/
+BOOLEAN SPDO_TxMappingChanged(BYTE_B_INSTNUM_ UINT16 w_txSpdoIdx,
+                              const UINT32 *adw_lastPayload)
+{
+  BOOLEAN o_ret = FALSE; /* return value */
+  t_MAPP_OBJ *po_this = &as_Obj[B_INSTNUMidx]; /* instance pointer */
+  t_MAPP_PARAM *ps_txSpdo = po_this->ps_mappPara + w_txSpdoIdx; /* pointer to
+                                              the Tx SPDO internal structure */
+  UINT32 adw_payload[(SPDO_cfg_MAX_LEN_OF_TX_SPDO + 3) / 4]; /* gathered
+                                                                 data */
+  UINT8 *pb_payload = (UINT8 *)adw_payload; /* byte access to the gathered
+                                               data */
+  UINT8 *pb_lastPayload = (UINT8 *)adw_lastPayload; /* byte access to the
+                                                       last payload */
+  BOOLEAN o_gathered = TRUE; /* FALSE if no consistent copy of the process
+                                image is available */
+  UINT32 i; /* loop counter */
+
+#if (SPDO_cfg_PROCESS_IMAGE == EPLS_k_ENABLE)
+  /* a consistent copy of the process image is taken */
+  o_gathered = SPDO_TxPiSnapshot(B_INSTNUM_ w_txSpdoIdx,
+                                 ps_txSpdo->b_lenOfSpdo, pb_payload);
+#else
+  /* loop from 0 to length of the SPDO */
+  for (i = 0U; i < ps_txSpdo->b_lenOfSpdo; i++)
+  {
+    /* copy one Byte from the pointer byte array into the buffer */
+    pb_payload[i] = *(ps_txSpdo->apb_DataForSpdo[i]);
+  }
+#endif
+
+  /* if the mapped data was gathered */
+  if (o_gathered)
+  {
+    /* the whole words are compared */
+    for (i = 0U; (i < ((UINT32)ps_txSpdo->b_lenOfSpdo >> 2)) && (!o_ret); i++)
+    {
+      o_ret = (BOOLEAN)(adw_payload[i] != adw_lastPayload[i]);
+    }
+
+    /* the remaining bytes are compared */
+    for (i = (UINT32)ps_txSpdo->b_lenOfSpdo & ~3UL;
+         (i < ps_txSpdo->b_lenOfSpdo) && (!o_ret); i++)
+    {
+      o_ret = (BOOLEAN)(pb_payload[i] != pb_lastPayload[i]);
+    }
+  }
+  /* no else : the SPDO is sent at the latest when the refresh prescale
+               expires */
+
+  /* call the Control Flow Monitoring */
+  SCFM_TACK_PATH();
+
+  return o_ret;
+}
+#endif
+
 /** @} */
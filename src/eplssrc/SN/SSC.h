@@ -0,0 +1,50 @@
+/**
+ * @addtogroup SSC
+ * @{
+ *
+ * @file SSC.h SSC Module Interface
+ *
+ * This file contains the interface of the unit SSC to the other units of the openSAFETY Stack.
+ *
+ * @copyright Copyright (c) 2009,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H and IXXAT Automation GmbH
+ * @copyright All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * @copyright This source code is free software; you can redistribute it and/or modify it under the terms of the BSD license (according to License.txt).
+ *
+ */
+
+#ifndef SSC_H
+#define SSC_H
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+/**
+* @brief This function allocates storage from the arena of an instance.
+*
+* The arenas are only filled during SSC_InitAll(), the instances one after the other. Thus the
+* storage of an instance is contiguous. The storage is set to zero. If the pool is exhausted,
+* an error is reported once per instance and NULL is returned.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_InitAll()) valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+*
+* @param        dw_size          size of the storage in bytes (not checked, any value allowed) valid range: (UINT32)
+*
+* @return
+* - == NULL        - pool exhausted or instance is not initialized at the moment
+* - <> NULL        - reference to the storage
+*/
+void *SSC_ArenaAlloc(BYTE_B_INSTNUM_ UINT32 dw_size);
+
+/**
+* @brief This function returns whether an allocation from the arena of an instance failed.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_InitAll()) valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+*
+* @return
+* - TRUE           - at least one allocation failed since SSC_InitAll()
+* - FALSE          - all allocations succeeded
+*/
+BOOLEAN SSC_ArenaOverflow(BYTE_B_INSTNUM);
+#endif
+
+#endif
+
+/** @} */
@@ -110,6 +110,89 @@ SSC_t_PROCESS SSC_ProcessSNMTSSDOFrame(BYTE_B_INSTNUM_ UINT32 dw_ct,
         const UINT8 *pb_rxFrm,
         UINT16 w_rxFrmLen);
 
+#if (EPLS_cfg_FRAME_ROUTER == EPLS_k_ENABLE)
+/** Number of raw header bytes stored in SSC_t_ROUTE */
+#define SSC_k_ROUTE_HDR_LEN            8u
+
+/**
+ * This enumeration is used as return value for the SSC function SSC_RouteFrame().
+ */
+typedef enum
+{
+    /** frame length or frame ID is invalid, the frame has to be discarded */
+    SSC_k_ROUTE_INVALID,
+    /** frame has to be passed to SPDO_ProcessRxSpdo() */
+    SSC_k_ROUTE_SPDO,
+    /** frame has to be passed to SSC_ProcessSNMTSSDOFrame() */
+    SSC_k_ROUTE_SNMT_SSDO
+} SSC_t_ROUTE_TARGET;
+
+/**
+ * Routing info of a received frame, filled by SSC_RouteFrame() and used by SSC_RouteNextInst().
+ */
+typedef struct
+{
+    /** unit the frame has to be passed to */
+    SSC_t_ROUTE_TARGET e_target;
+    /** next instance to be checked by SSC_RouteNextInst() */
+    UINT8 b_nextInst;
+    /** raw header bytes of sub frame ONE and TWO */
+    UINT8 ab_hdr[SSC_k_ROUTE_HDR_LEN];
+} SSC_t_ROUTE;
+
+/**
+ * @brief This function classifies a received frame for gateways running one instance per safety domain.
+ *
+ * The frame header is parsed once, the frame is not checked (CRC) and not modified. The instances
+ * the frame belongs to are provided by SSC_RouteNextInst(). The frame is verified completely by
+ * SPDO_ProcessRxSpdo() or SSC_ProcessSNMTSSDOFrame() afterwards.
+ *
+ * @param        pb_rxFrm          reference to the received frame (checked), valid range: <> NULL
+ *
+ * @param        w_rxFrmLen        length of the received frame (in bytes), (checked), valid range: &lt;SSC_k_MIN_TEL_LEN_SHORT&gt; .. &lt;SSC_k_MAX_TEL_LEN_SHORT&gt; OR &lt;SSC_k_MIN_TEL_LEN_LONG&gt; .. &lt;SSC_k_MAX_TEL_LEN_LONG&gt;
+ *
+ * @retval       ps_route          routing info of the frame (checked), valid range: <> NULL
+ *
+ * @return
+ * - SSC_k_ROUTE_INVALID   - frame is invalid and has to be discarded
+ * - SSC_k_ROUTE_SPDO      - frame has to be passed to SPDO_ProcessRxSpdo()
+ * - SSC_k_ROUTE_SNMT_SSDO - frame has to be passed to SSC_ProcessSNMTSSDOFrame()
+ */
+SSC_t_ROUTE_TARGET SSC_RouteFrame(const UINT8 *pb_rxFrm, UINT16 w_rxFrmLen,
+        SSC_t_ROUTE *ps_route);
+
+/**
+ * @brief This function provides the next instance a frame classified by SSC_RouteFrame() belongs to.
+ *
+ * An instance matches if the SDN of the frame, decoded with the UDID of the SCM of the instance, is the
+ * SDN of the instance. The SNMT requests UDID request and SADR assignment match every instance because
+ * they are also addressed to SNs without an assigned SDN.
+ *
+ * @param        ps_route          routing info filled by SSC_RouteFrame() (checked), valid range: <> NULL
+ *
+ * @retval       pb_instNum        matching instance number (checked), valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - matching instance found, the frame has to be passed to this instance
+ * - FALSE            - no further instance matches
+ */
+BOOLEAN SSC_RouteNextInst(SSC_t_ROUTE *ps_route, UINT8 *pb_instNum);
+#endif
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+/**
+ * @brief This function returns the footprint of the runtime-sized storage of an instance.
+ *
+ * The storage is sized by SSC_InitAll() from the SPDOs defined in the SOD of the instance. The sum
+ * of the footprints of all instances is the part of the pool (EPLS_cfg_ARENA_SIZE) in use.
+ *
+ * @param        b_instNum         instance number (checked), valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @return       size of the arena of the instance in bytes, 0 for an invalid instance
+ */
+UINT32 SSC_GetArenaFootprint(BYTE_B_INSTNUM);
+#endif
+
 #endif
 
 /** @} */
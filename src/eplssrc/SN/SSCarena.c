@@ -0,0 +1,210 @@
+/**
+ * @addtogroup SSC
+ * @{
+ *
+ * @file SSCarena.c
+ *
+ * This file contains the arenas for the runtime-sized storage of the instances.
+ *
+ * @copyright Copyright (c) 2009,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H and IXXAT Automation GmbH
+ * @copyright All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * @copyright This source code is free software; you can redistribute it and/or modify it under the terms of the BSD license (according to License.txt).
+ *
+ * @details
+ * The per-SPDO storage is sized during SSC_InitAll() from the SPDOs defined in the SOD of each
+ * instance. SSC_InitAll() initializes the instances one after the other, so every instance gets
+ * one contiguous arena in the pool, directly behind the arena of the previous instance. The
+ * storage is never released, except by the next call of SSC_InitAll().
+ */
+
+#include "EPLScfg.h"
+
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+
+#include "EPLStarget.h"
+#include "EPLStypes.h"
+
+#include "SCFMapi.h"
+
+#include "SERRapi.h"
+#include "SERR.h"
+#include "SSCerr.h"
+
+#include "SSC.h"
+#include "SSCapi.h"
+#include "SSCint.h"
+
+/**
+ * Allocation unit of the pool, aligned for every type stored in the arenas.
+ */
+typedef union
+{
+  /** 32 bit members */
+  UINT32 dw_align;
+  /** pointer members */
+  void *pv_align;
+} t_ARENA_UNIT;
+
+/** number of allocation units in the pool */
+#define k_ARENA_NO_UNITS \
+  ((EPLS_cfg_ARENA_SIZE + sizeof(t_ARENA_UNIT) - 1UL) / sizeof(t_ARENA_UNIT))
+
+/**
+ * Arena of one instance.
+ */
+typedef struct
+{
+  /** first allocation unit of the arena */
+  UINT32 dw_start;
+  /** number of allocation units of the arena */
+  UINT32 dw_noUnits;
+  /** at least one allocation failed */
+  BOOLEAN o_overflow;
+} t_ARENA;
+
+/** pool for the arenas of all instances */
+static t_ARENA_UNIT as_ArenaPool[k_ARENA_NO_UNITS] SAFE_NO_INIT_SEKTOR;
+
+/** number of allocation units in use */
+static UINT32 dw_ArenaUsed SAFE_NO_INIT_SEKTOR;
+
+/** instance initialized at the moment, the only one allowed to allocate */
+static UINT8 b_ArenaInst SAFE_NO_INIT_SEKTOR;
+
+/** arenas of the instances */
+static t_ARENA as_Arena[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
+
+/**
+ * @brief This function releases the arenas of all instances.
+ */
+void SSC_ArenaReset(void)
+{
+  UINT32 i; /* loop counter */
+
+  dw_ArenaUsed = 0UL;
+  b_ArenaInst = (UINT8)EPLS_cfg_MAX_INSTANCES;
+
+  for (i = 0UL; i < (UINT32)EPLS_cfg_MAX_INSTANCES; i++)
+  {
+    as_Arena[i].dw_start = 0UL;
+    as_Arena[i].dw_noUnits = 0UL;
+    as_Arena[i].o_overflow = FALSE;
+  }
+
+  SCFM_TACK_PATH();
+}
+
+/**
+ * @brief This function starts the arena of an instance at the end of the used part of the pool.
+ *
+ * @param        b_instNum        instance number (not checked, checked in SSC_InitAll()) valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ */
+void SSC_ArenaBegin(BYTE_B_INSTNUM)
+{
+  b_ArenaInst = B_INSTNUMidx;
+  as_Arena[B_INSTNUMidx].dw_start = dw_ArenaUsed;
+  as_Arena[B_INSTNUMidx].dw_noUnits = 0UL;
+  as_Arena[B_INSTNUMidx].o_overflow = FALSE;
+
+  SCFM_TACK_PATH();
+}
+
+/**
+* @brief This function allocates storage from the arena of an instance.
+*
+* The arenas are only filled during SSC_InitAll(), the instances one after the other. Thus the
+* storage of an instance is contiguous. The storage is set to zero. If the pool is exhausted,
+* an error is reported once per instance and NULL is returned.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_InitAll()) valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+*
+* @param        dw_size          size of the storage in bytes (not checked, any value allowed) valid range: (UINT32)
+*
+* @return
+* - == NULL        - pool exhausted or instance is not initialized at the moment
+* - <> NULL        - reference to the storage
+*/
+void *SSC_ArenaAlloc(BYTE_B_INSTNUM_ UINT32 dw_size)
+{
+  void *pv_return = NULL; /* predefined return value */
+  t_ARENA *ps_arena = &as_Arena[B_INSTNUMidx]; /* arena of the instance */
+  /* number of allocation units, rounded up */
+  UINT32 dw_noUnits = (dw_size / (UINT32)sizeof(t_ARENA_UNIT)) +
+                      (((dw_size % (UINT32)sizeof(t_ARENA_UNIT)) != 0UL) ? 1UL : 0UL);
+
+  /* if the instance is not initialized at the moment, its arena is closed */
+  if (B_INSTNUMidx != b_ArenaInst)
+  {
+    ps_arena->o_overflow = TRUE;
+  }
+  /* else if the pool is exhausted */
+  else if (dw_noUnits > ((UINT32)k_ARENA_NO_UNITS - dw_ArenaUsed))
+  {
+    /* if the first failed allocation of the instance */
+    if (!ps_arena->o_overflow)
+    {
+      SERR_SetError(B_INSTNUM_ SSC_k_ERR_ARENA_FULL, dw_size);
+    }
+    ps_arena->o_overflow = TRUE;
+  }
+  else /* storage available */
+  {
+    pv_return = &as_ArenaPool[dw_ArenaUsed];
+    (void)MEMSET(pv_return, 0, dw_noUnits * (UINT32)sizeof(t_ARENA_UNIT));
+    dw_ArenaUsed += dw_noUnits;
+    ps_arena->dw_noUnits += dw_noUnits;
+  }
+
+  SCFM_TACK_PATH();
+  return pv_return;
+}
+
+/**
+* @brief This function returns whether an allocation from the arena of an instance failed.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_InitAll()) valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+*
+* @return
+* - TRUE           - at least one allocation failed since SSC_InitAll()
+* - FALSE          - all allocations succeeded
+*/
+BOOLEAN SSC_ArenaOverflow(BYTE_B_INSTNUM)
+{
+  SCFM_TACK_PATH();
+  return as_Arena[B_INSTNUMidx].o_overflow;
+}
+
+/**
+ * @brief This function returns the footprint of the runtime-sized storage of an instance.
+ *
+ * The storage is sized by SSC_InitAll() from the SPDOs defined in the SOD of the instance. The sum
+ * of the footprints of all instances is the part of the pool (EPLS_cfg_ARENA_SIZE) in use.
+ *
+ * @param        b_instNum         instance number (checked), valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @return       size of the arena of the instance in bytes, 0 for an invalid instance
+ */
+UINT32 SSC_GetArenaFootprint(BYTE_B_INSTNUM)
+{
+  UINT32 dw_return = 0UL; /* predefined return value */
+
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+  /* if the instance is invalid */
+  if (B_INSTNUMidx >= (UINT8)EPLS_cfg_MAX_INSTANCES)
+  {
+    SERR_SetError(EPLS_k_NO_INSTANCE_ SSC_k_ERR_ARENA_INST_INV,
+                  (UINT32)B_INSTNUMidx);
+  }
+  else
+#endif
+  {
+    dw_return = as_Arena[B_INSTNUMidx].dw_noUnits * (UINT32)sizeof(t_ARENA_UNIT);
+  }
+
+  SCFM_TACK_PATH();
+  return dw_return;
+}
+
+#endif /* (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE) */
+
+/** @} */
@@ -83,6 +83,23 @@
 #define SSC_k_ERR_PROC_INST_INV \
         SERR_BUILD_ERROR(SERR_TYPE_FS, SERR_CLASS_FATAL, SSC_k_UNIT_ID, 9)
 
+/**
+ * This error means that SSC_RouteFrame() or SSC_RouteNextInst() was called with a NULL reference.
+*/
+#define SSC_k_ERR_ROUTE_PTR \
+        SERR_BUILD_ERROR(SERR_TYPE_NOT_FS, SERR_CLASS_MINOR, SSC_k_UNIT_ID, 10)
+/**
+ * This error means that the pool of the runtime-sized storage (EPLS_cfg_ARENA_SIZE) is too small
+ * for the SPDOs defined in the SOD.
+*/
+#define SSC_k_ERR_ARENA_FULL \
+        SERR_BUILD_ERROR(SERR_TYPE_FS, SERR_CLASS_FATAL, SSC_k_UNIT_ID, 11)
+/**
+ * This error means that SSC_GetArenaFootprint() was called with an invalid instance.
+*/
+#define SSC_k_ERR_ARENA_INST_INV \
+        SERR_BUILD_ERROR(SERR_TYPE_NOT_FS, SERR_CLASS_MINOR, SSC_k_UNIT_ID, 12)
+
 
 #if(EPLS_cfg_ERROR_STRING == EPLS_k_ENABLE)
 /**
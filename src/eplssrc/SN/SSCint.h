@@ -24,6 +24,20 @@
  */
 void SSC_InitFsm(void);
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+/**
+ * @brief This function releases the arenas of all instances.
+ */
+void SSC_ArenaReset(void);
+
+/**
+ * @brief This function starts the arena of an instance at the end of the used part of the pool.
+ *
+ * @param        b_instNum        instance number (not checked, checked in SSC_InitAll()) valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ */
+void SSC_ArenaBegin(BYTE_B_INSTNUM);
+#endif
+
 
 #endif
 
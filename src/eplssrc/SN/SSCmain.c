@@ -100,10 +100,19 @@ BOOLEAN SSC_InitAll(void)
   /* initialization of SSC FSM */
   SSC_InitFsm();
 
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+  /* the storage of all instances is sized again */
+  SSC_ArenaReset();
+#endif
+
 #if (EPLS_cfg_MAX_INSTANCES > 1)
   /* init units of specified number of instances */
   do
   {
+#endif
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+    /* the arena of the instance follows the arena of the previous instance */
+    SSC_ArenaBegin(B_INSTNUM);
 #endif
     /* initialization of an instance */
     o_return = initInst(B_INSTNUM);
@@ -235,6 +244,36 @@ BOOLEAN SSC_InitAll(void)
                 SSC_k_ERR_PROC_STATE_INV, dw_addInfo);
         break;
       }
+#if (EPLS_cfg_FRAME_ROUTER == EPLS_k_ENABLE)
+      case SSC_k_ERR_ROUTE_PTR:
+      {
+        SPRINTF2(pac_str,
+                "%#x - SSC_k_ERR_ROUTE_PTR: SSC_RouteFrame():\n"
+                "NULL reference (%lu) passed to the frame router!\n",
+                SSC_k_ERR_ROUTE_PTR, dw_addInfo);
+        break;
+      }
+#endif
+#if (EPLS_cfg_RUNTIME_ARENA == EPLS_k_ENABLE)
+      case SSC_k_ERR_ARENA_FULL:
+      {
+        SPRINTF2(pac_str,
+                "%#x - SSC_k_ERR_ARENA_FULL: SSC_ArenaAlloc():\n"
+                "<EPLS_cfg_ARENA_SIZE> is too small, (%lu) bytes "
+                "could not be allocated!\n",
+                SSC_k_ERR_ARENA_FULL, dw_addInfo);
+        break;
+      }
+      case SSC_k_ERR_ARENA_INST_INV:
+      {
+        SPRINTF2(pac_str,
+                "%#x - SSC_k_ERR_ARENA_INST_INV: SSC_GetArenaFootprint():\n"
+                "The delivered instance (%02lu) is bigger than "
+                "<EPLS_cfg_MAX_INSTANCES>!\n",
+                SSC_k_ERR_ARENA_INST_INV, dw_addInfo);
+        break;
+      }
+#endif
       default:
       {
         SPRINTF(pac_str, "Unknown error code was generated by the SSC\n");
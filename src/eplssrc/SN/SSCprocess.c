@@ -589,8 +589,19 @@ static BOOLEAN processStateSer(BYTE_B_INSTNUM_ const UINT8* pb_rxFrm)
             &(s_Fsm.s_txBuf.ab_frmData[0]), s_Fsm.s_txBuf.s_frmHdr.b_le);
 
             /* serialize and transmit frame */
-            o_return =
-            SFS_FrmSerialize(B_INSTNUM_ &(s_Fsm.s_txBuf.s_frmHdr), pb_txFrame);
+#if (SNMTS_cfg_RESP_CACHE == EPLS_k_ENABLE)
+            /* if an SNMT Slave response is to be serialized */
+            if (SHNF_k_SNMT == s_Fsm.e_telType)
+            {
+                o_return = SFS_FrmSerializeSnmtResp(B_INSTNUM_
+                    &(s_Fsm.s_txBuf.s_frmHdr), pb_txFrame);
+            }
+            else
+#endif
+            {
+                o_return =
+                SFS_FrmSerialize(B_INSTNUM_ &(s_Fsm.s_txBuf.s_frmHdr), pb_txFrame);
+            }
         }
     }
     SCFM_TACK_PATH();
@@ -0,0 +1,221 @@
+/**
+ * @addtogroup SSC
+ * @{
+ *
+ * @file SSCroute.c
+ *
+ * This file contains the frame router for gateways running one instance per safety domain.
+ *
+ * @copyright Copyright (c) 2009,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H and IXXAT Automation GmbH
+ * @copyright All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * @copyright This source code is free software; you can redistribute it and/or modify it under the terms of the BSD license (according to License.txt).
+ *
+ * @details
+ * SSC_RouteFrame() parses the header of a received frame once and selects the unit by the frame
+ * ID. SSC_RouteNextInst() then compares the SDN of the frame with the SDN of every instance
+ * (SDN_GetSdn(), i.e. the value set by SDN_SetSdn()). Sub frame TWO of SPDO and SSDO frames is
+ * encoded with the UDID of the SCM, so the SDN is decoded per instance on a copy of the header
+ * bytes. The received frame is not modified and still verified completely by the selected unit.
+ */
+
+#include "EPLScfg.h"
+
+#if (EPLS_cfg_FRAME_ROUTER == EPLS_k_ENABLE)
+
+#include "EPLStarget.h"
+#include "EPLStypes.h"
+
+#include "SCFMapi.h"
+
+#include "SERRapi.h"
+#include "SERR.h"
+#include "SSCerr.h"
+
+#include "SHNF.h"
+#include "SFS.h"
+#include "SDN.h"
+#include "SNMT.h"
+
+#include "SSCapi.h"
+
+/** Mask of the frame type in the 6 bit frame ID */
+#define k_ROUTE_TYPE_MASK     (UINT8)0x38
+/** Frame type SNMT */
+#define k_ROUTE_TYPE_SNMT     (UINT8)0x28
+/** Frame type SPDO */
+#define k_ROUTE_TYPE_SPDO     (UINT8)0x30
+/** Frame type SSDO */
+#define k_ROUTE_TYPE_SSDO     (UINT8)0x38
+
+/** Mask of the SNMT request in the 6 bit frame ID (major ID and direction bit) */
+#define k_ROUTE_SNMT_REQ_MASK (UINT8)0x39
+
+static BOOLEAN routeInstMatch(BYTE_B_INSTNUM_ const SSC_t_ROUTE *ps_route);
+
+/**
+ * @brief This function classifies a received frame for gateways running one instance per safety domain.
+ *
+ * The frame header is parsed once, the frame is not checked (CRC) and not modified. The instances
+ * the frame belongs to are provided by SSC_RouteNextInst(). The frame is verified completely by
+ * SPDO_ProcessRxSpdo() or SSC_ProcessSNMTSSDOFrame() afterwards.
+ *
+ * @param        pb_rxFrm          reference to the received frame (checked), valid range: <> NULL
+ *
+ * @param        w_rxFrmLen        length of the received frame (in bytes), (checked), valid range: &lt;SSC_k_MIN_TEL_LEN_SHORT&gt; .. &lt;SSC_k_MAX_TEL_LEN_SHORT&gt; OR &lt;SSC_k_MIN_TEL_LEN_LONG&gt; .. &lt;SSC_k_MAX_TEL_LEN_LONG&gt;
+ *
+ * @retval       ps_route          routing info of the frame (checked), valid range: <> NULL
+ *
+ * @return
+ * - SSC_k_ROUTE_INVALID   - frame is invalid and has to be discarded
+ * - SSC_k_ROUTE_SPDO      - frame has to be passed to SPDO_ProcessRxSpdo()
+ * - SSC_k_ROUTE_SNMT_SSDO - frame has to be passed to SSC_ProcessSNMTSSDOFrame()
+ */
+SSC_t_ROUTE_TARGET SSC_RouteFrame(const UINT8 *pb_rxFrm, UINT16 w_rxFrmLen,
+        SSC_t_ROUTE *ps_route)
+{
+  SSC_t_ROUTE_TARGET e_return = SSC_k_ROUTE_INVALID; /* predefined return value */
+  UINT8 b_type;                 /* frame type of the frame ID */
+
+  /* if a reference is invalid */
+  if ((pb_rxFrm == NULL) || (ps_route == NULL))
+  {
+    SERR_SetError(EPLS_k_NO_INSTANCE_ SSC_k_ERR_ROUTE_PTR, SERR_k_NO_ADD_INFO);
+  }
+  else
+  {
+    /* if the frame length matches the LE field */
+    if (SFS_FrmHdrPeek(pb_rxFrm, w_rxFrmLen, ps_route->ab_hdr))
+    {
+      b_type = (UINT8)((ps_route->ab_hdr[1] >> 2u) & k_ROUTE_TYPE_MASK);
+
+      if (b_type == k_ROUTE_TYPE_SPDO)
+      {
+        e_return = SSC_k_ROUTE_SPDO;
+      }
+      else if ((b_type == k_ROUTE_TYPE_SNMT) || (b_type == k_ROUTE_TYPE_SSDO))
+      {
+        e_return = SSC_k_ROUTE_SNMT_SSDO;
+      }
+      else
+      {
+        /* frame ID is invalid, return with predefined SSC_k_ROUTE_INVALID */
+      }
+    }
+    /* no else : frame length is invalid */
+
+    ps_route->e_target = e_return;
+    ps_route->b_nextInst = 0u;
+  }
+
+  SCFM_TACK_PATH();
+  return e_return;
+}
+
+/**
+ * @brief This function provides the next instance a frame classified by SSC_RouteFrame() belongs to.
+ *
+ * An instance matches if the SDN of the frame, decoded with the UDID of the SCM of the instance, is the
+ * SDN of the instance. The SNMT requests UDID request and SADR assignment match every instance because
+ * they are also addressed to SNs without an assigned SDN.
+ *
+ * @param        ps_route          routing info filled by SSC_RouteFrame() (checked), valid range: <> NULL
+ *
+ * @retval       pb_instNum        matching instance number (checked), valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - matching instance found, the frame has to be passed to this instance
+ * - FALSE            - no further instance matches
+ */
+BOOLEAN SSC_RouteNextInst(SSC_t_ROUTE *ps_route, UINT8 *pb_instNum)
+{
+  BOOLEAN o_return = FALSE;     /* predefined return value */
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+  UINT8 b_instNum;              /* instance to be checked */
+#endif
+
+  /* if a reference is invalid */
+  if ((ps_route == NULL) || (pb_instNum == NULL))
+  {
+    SERR_SetError(EPLS_k_NO_INSTANCE_ SSC_k_ERR_ROUTE_PTR, SERR_k_NO_ADD_INFO);
+  }
+  /* else if the frame is invalid */
+  else if (ps_route->e_target == SSC_k_ROUTE_INVALID)
+  {
+    /* no instance, return with predefined FALSE */
+  }
+  else
+  {
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    for (b_instNum = ps_route->b_nextInst;
+         (!o_return) && (b_instNum < (UINT8)EPLS_cfg_MAX_INSTANCES);
+         b_instNum++)
+    {
+      /* if the frame belongs to this instance */
+      if (routeInstMatch(B_INSTNUM_ ps_route))
+      {
+        *pb_instNum = b_instNum;
+        o_return = TRUE;
+      }
+      /* no else : check next instance */
+    }
+    /* the next call continues after the matching instance */
+    ps_route->b_nextInst = b_instNum;
+#else
+    /* if the only instance is not checked yet and the frame belongs to it */
+    if ((ps_route->b_nextInst == 0u) && (routeInstMatch(ps_route)))
+    {
+      *pb_instNum = 0u;
+      o_return = TRUE;
+    }
+    /* no else : no further instance */
+    ps_route->b_nextInst = 1u;
+#endif
+  }
+
+  SCFM_TACK_PATH();
+  return o_return;
+}
+
+/**
+ * @brief This function checks whether a frame belongs to an instance.
+ *
+ * @param        b_instNum         instance number (not checked, checked in SSC_RouteNextInst()), valid range: 0 .. &lt;EPLS_cfg_MAX_INSTANCES&gt; - 1
+ *
+ * @param        ps_route          routing info (not checked, checked in SSC_RouteNextInst()), valid range: <> NULL
+ *
+ * @return
+ * - TRUE             - frame belongs to the instance
+ * - FALSE            - frame does not belong to the instance
+ */
+static BOOLEAN routeInstMatch(BYTE_B_INSTNUM_ const SSC_t_ROUTE *ps_route)
+{
+  BOOLEAN o_return = FALSE;     /* predefined return value */
+  UINT8 b_id = (UINT8)(ps_route->ab_hdr[1] >> 2u); /* 6 bit frame ID */
+  UINT16 w_sdn;                 /* SDN of the frame decoded for this instance */
+
+  w_sdn = SFS_FrmPeekSdn(B_INSTNUM_ ps_route->ab_hdr);
+
+  /* if the frame is addressed to the domain of the instance */
+  if ((w_sdn != 0x0000u) && (w_sdn == SDN_GetSdn(B_INSTNUM)))
+  {
+    o_return = TRUE;
+  }
+  /* else if UDID request or SADR assignment, accepted by SNs without SDN */
+  else if (((b_id & k_ROUTE_SNMT_REQ_MASK) == k_ROUTE_TYPE_SNMT) &&
+           ((SFS_GET_MIN_FRM_ID(b_id) == SNMT_k_UDID_REQ) ||
+            (SFS_GET_MIN_FRM_ID(b_id) == SNMT_k_ASS_SADR)))
+  {
+    o_return = TRUE;
+  }
+  else
+  {
+    /* frame belongs to another domain, return with predefined FALSE */
+  }
+
+  SCFM_TACK_PATH();
+  return o_return;
+}
+
+#endif /* (EPLS_cfg_FRAME_ROUTER == EPLS_k_ENABLE) */
+
+/** @} */
@@ -25,6 +25,15 @@
 #ifndef SSDOSINT_H
 #define SSDOSINT_H
 
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+/**
+ * This symbol is returned instead of an abort code, if the application is not ready to process the current step of a
+ * streamed transfer. No response is sent and the step is repeated in the next call of SSDOS_ProcessRequest(). It is
+ * never sent as abort code.
+ */
+#define SSDOS_k_ABT_NOT_READY   0xFFFFFFFFUL
+#endif
+
 
 /**
  * @name Function prototypes for SSDOSupDwnLd.c
@@ -165,6 +174,30 @@ UINT32 SSDOS_DwnldEndSegReqProc(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
 UINT32 SSDOS_UpldInitReqProc(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
                              BOOLEAN *po_seg);
 
+#if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function processes a SSDO multi-object upload request.
+*
+* The data of all requested objects is collected and uploaded like the data of a single DOMAIN object.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()),
+*       valid range: 0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        ps_rxBuf         reference to received openSAFETY frame  to be distributed (pointer
+*       not checked, only called with reference to struct in processStateReqProc()), valid range: <> NULL, see EPLS_t_FRM
+*
+* @retval       po_seg           only relevant if SOD_ABT_NO_ERROR returned,
+* - TRUE : segmented upload
+* - FALSE : expedited upload (pointer not checked, only called with reference to variable in WfReqInitState()), valid range: TRUE, FALSE
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - otherwise abort response has to be sent with the returned abort code. See SOD_t_ABORT_CODES
+*/
+UINT32 SSDOS_UpldInitMultiReqProc(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
+                                  BOOLEAN *po_seg);
+#endif
+
 /**
 * @brief This function generates a SSDOS initiate expedited upload response.
 *
@@ -390,6 +423,95 @@ UINT8 *SSDOS_SodAcsRead(BYTE_B_INSTNUM_ UINT32 dw_offset, UINT32 dw_size,
 */
 UINT32 SSDOS_SodAcsLock(BYTE_B_INSTNUM);
 
+#if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+/**
+* @brief This function opens the segmented write session of the SOD for the object of the segmented download.
+*
+* If the session cannot be opened, the segments are written via SOD_Write().
+*
+* @param        b_instNum        instance number (not checked, checked in  SSC_ProcessSNMTSSDOFrame()), valid range:  0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*/
+void SSDOS_SodAcsSegWriteOpen(BYTE_B_INSTNUM);
+#endif
+
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+/**
+* @brief This function opens the snapshot of the SOD for the object of the segmented upload.
+*
+* The segments of an object with the attribute SOD_k_ATTR_SNAPSHOT are read as they were at the
+* start of the upload, even if the object is written during the upload.
+*
+* @param        b_instNum        instance number (not checked, checked in  SSC_ProcessSNMTSSDOFrame()), valid range:  0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*/
+void SSDOS_SodAcsSnapOpen(BYTE_B_INSTNUM);
+#endif
+
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+/**
+* @brief This function starts the streamed transfer, if the accessed object has the attribute SOD_k_ATTR_STREAM.
+*
+* The function has to be called after SSDOS_SodAcsLock(). Nothing is done for other objects or if the transfer is
+* already started.
+*
+* @param        b_instNum        instance number (not checked, checked in  SSC_ProcessSNMTSSDOFrame()), valid range:  0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        o_download
+* - TRUE  : segmented download
+* - FALSE : segmented upload (not checked, any value allowed), valid range: TRUE, FALSE
+*
+* @param        dw_totalSize     declared total size in bytes, 0 if unknown (not checked, any value allowed), valid range: (UINT32)
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - if SSDOS_k_ABT_NOT_READY the step has to be repeated,
+* - otherwise abort response has to be sent with the returned abort code.
+*/
+UINT32 SSDOS_SodAcsStreamBegin(BYTE_B_INSTNUM_ BOOLEAN o_download,
+                               UINT32 dw_totalSize);
+
+/**
+* @brief This function commits the started streamed transfer.
+*
+* Nothing is done, if no streamed transfer is started.
+*
+* @param        b_instNum        instance number (not checked, checked in  SSC_ProcessSNMTSSDOFrame()), valid range:  0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        dw_size          number of transferred bytes (not checked, any value allowed), valid range: (UINT32)
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - if SSDOS_k_ABT_NOT_READY the step has to be repeated,
+* - otherwise abort response has to be sent with the returned abort code.
+*/
+UINT32 SSDOS_SodAcsStreamCommit(BYTE_B_INSTNUM_ UINT32 dw_size);
+#endif
+
+#if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function reads the objects of a multi-object upload request into the multi-object buffer.
+*
+* The index and sub-index of the first object are stored for the response. The following upload reads
+* the collected data via SSDOS_SodAcsRead().
+*
+* @param        b_instNum            instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()), valid range: 0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        ps_rxPyldData        reference to the payload data in the received openSAFETY frame
+*       (pointer not checked, only called with reference to array in SSDOS_UpldInitMultiReqProc()), valid range: see EPLS_t_FRM
+*
+* @param        b_rxPyldLen          payload length of the received openSAFETY frame (not checked, checked in
+*       WfReqInitState()), valid range: k_DATA_HDR_LEN + n * k_MULTI_ENTRY_LEN
+*
+* @retval       pdw_dataLen          length of the collected data, only relevant if SOD_ABT_NO_ERROR is returned
+*       (pointer not checked, only called with reference to variable in SSDOS_UpldInitMultiReqProc()), valid range: <> NULL
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - otherwise abort response has to be sent with the returned abort code. See SOD_t_ABORT_CODES
+*/
+UINT32 SSDOS_SodAcsMultiRead(BYTE_B_INSTNUM_ const UINT8 *ps_rxPyldData,
+                             UINT8 b_rxPyldLen, UINT32 *pdw_dataLen);
+#endif
+
 /**
 * @brief This function assembles a SSDO Service Response for the SOD access except the raw data.
 *
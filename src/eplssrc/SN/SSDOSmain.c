@@ -102,7 +102,7 @@ static BOOLEAN FsmReset(BYTE_B_INSTNUM_ BOOLEAN o_abort);
 static BOOLEAN WfReqInitState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
                               BOOLEAN *po_busy);
 static BOOLEAN DwnldRespInitState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
-                                  EPLS_t_FRM *ps_txBuf);
+                                  EPLS_t_FRM *ps_txBuf, BOOLEAN *po_busy);
 static BOOLEAN DwnldWfReqSegState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
                                   EPLS_t_FRM *ps_txBuf, BOOLEAN *po_busy);
 static BOOLEAN UpldRespInitState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
@@ -211,8 +211,7 @@ BOOLEAN SSDOS_ProcessRequest(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
         }
         case k_DWNLD_RESP_INIT:
         {
-          *po_busy = FALSE;
-          o_return = DwnldRespInitState(B_INSTNUM_ ps_rxBuf, ps_txBuf);
+          o_return = DwnldRespInitState(B_INSTNUM_ ps_rxBuf, ps_txBuf, po_busy);
           break;
         }
         case k_DWNLD_WF_REQ_SEG:
@@ -696,6 +695,14 @@ static BOOLEAN WfReqInitState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
 
           ps_fsm->e_actState = k_UPLD_RESP_INIT;
         }
+      #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+        /* else if the application is not ready, the request is processed
+                again and the SSDOS stays busy */
+        else if (ps_fsm->dw_abortCode == SSDOS_k_ABT_NOT_READY)
+        {
+          ps_fsm->e_actState = k_WF_REQ_INIT;
+        }
+      #endif
         else /* error happened, abort code has to be sent */
         {
           ps_fsm->e_actState = k_RESP_ABORT;
@@ -708,6 +715,45 @@ static BOOLEAN WfReqInitState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
                       (UINT32)ps_rxBuf->s_frmHdr.b_le);
       }
     }
+  #if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+    /* else if multi-object upload initiate */
+    else if (ps_fsm->b_saCmd == k_UPLD_INIT_MULTI)
+    {
+      /* if the request payload length fits to the list of objects */
+      if (((ps_rxBuf->s_frmHdr.b_le - k_OFS_IDX) % k_MULTI_ENTRY_LEN) == 0U)
+      {
+        /* process SSDOC request */
+        ps_fsm->dw_abortCode =
+            SSDOS_UpldInitMultiReqProc(B_INSTNUM_ ps_rxBuf, &o_seg);
+
+        /* if no error happened */
+        if (ps_fsm->dw_abortCode == (UINT32)SOD_ABT_NO_ERROR)
+        {
+          /* the collected data is uploaded with the standard responses */
+          if (o_seg)
+          {
+            ps_fsm->b_saCmd = k_UPLD_INIT_SEG;
+          }
+          else
+          {
+            ps_fsm->b_saCmd = k_UPLD_INIT_EXP;
+          }
+
+          ps_fsm->e_actState = k_UPLD_RESP_INIT;
+        }
+        else /* error happened, abort code has to be sent */
+        {
+          ps_fsm->e_actState = k_RESP_ABORT;
+        }
+        o_return = TRUE;
+      }
+      else /* the multi-object upload request payload length is invalid */
+      {
+        SERR_SetError(B_INSTNUM_ SSDOS_k_ERR_UPLD_INIT_LEN,
+                      (UINT32)ps_rxBuf->s_frmHdr.b_le);
+      }
+    }
+  #endif
     /* else if abort frame received */
     else if (ps_fsm->b_saCmd == k_ABORT)
     {
@@ -768,16 +814,22 @@ static BOOLEAN WfReqInitState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
 * @param        ps_txBuf         reference to openSAFETY frame to be transmitted (pointer not checked, only called
 *       with reference to struct in processStateReqProc()), valid range: <> NULL, see EPLS_t_FRM
 *
+* @retval          po_busy          flag signals that SSDO Server is currently processing a service request, valid range: <> NULL
+* - TRUE:  Server busy
+* - FALSE: Server ready to process (pointer not checked, only called with reference to variable in processStateReqProc())
+*
 * @return
 * - TRUE           - State processed successfully
 * - FALSE          - State processing failed
 */
 static BOOLEAN DwnldRespInitState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
-                                  EPLS_t_FRM *ps_txBuf)
+                                  EPLS_t_FRM *ps_txBuf, BOOLEAN *po_busy)
 {
   BOOLEAN o_return = FALSE;  /* predefined return value */
   t_SSDOS_FSM *ps_fsm = &s_Fsm[B_INSTNUMidx]; /* pointer to the fsm structure */
 
+  *po_busy = FALSE;
+
   /* switch for the SOD access command */
   switch (ps_fsm->b_saCmd)
   {
@@ -793,6 +845,15 @@ static BOOLEAN DwnldRespInitState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
         ps_fsm->e_actState = k_DWNLD_WF_REQ_SEG;
         o_return = TRUE;
       }
+    #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+      /* else if the application is not ready, the request is processed
+            again */
+      else if (ps_fsm->dw_abortCode == SSDOS_k_ABT_NOT_READY)
+      {
+        *po_busy = TRUE;
+        o_return = TRUE;
+      }
+    #endif
       else /* error happened, abort response is sent */
       {
         o_return = FsmResetAbortSend(B_INSTNUM_ ps_rxBuf, ps_txBuf,
@@ -894,6 +955,15 @@ static BOOLEAN DwnldWfReqSegState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
         {
           o_return = TRUE;
         }
+      #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+        /* else if the application is not ready, the request is processed
+              again */
+        else if (ps_fsm->dw_abortCode == SSDOS_k_ABT_NOT_READY)
+        {
+          *po_busy = TRUE;
+          o_return = TRUE;
+        }
+      #endif
         else /* error happened, abort response is sent */
         {
           o_return = FsmResetAbortSend(B_INSTNUM_ ps_rxBuf, ps_txBuf,
@@ -918,6 +988,15 @@ static BOOLEAN DwnldWfReqSegState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
         {
           o_return = FsmReset(B_INSTNUM_ FALSE);
         }
+      #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+        /* else if the application is not ready, the request is processed
+              again */
+        else if (ps_fsm->dw_abortCode == SSDOS_k_ABT_NOT_READY)
+        {
+          *po_busy = TRUE;
+          o_return = TRUE;
+        }
+      #endif
         else /* error happened, abort response is sent */
         {
           o_return = FsmResetAbortSend(B_INSTNUM_ ps_rxBuf, ps_txBuf,
@@ -1103,6 +1182,15 @@ static BOOLEAN UpldWfReqSegState(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
               o_return = TRUE;
             }
           }
+        #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+          /* else if the application is not ready, the request is processed
+                again */
+          else if (ps_fsm->dw_abortCode == SSDOS_k_ABT_NOT_READY)
+          {
+            *po_busy = TRUE;
+            o_return = TRUE;
+          }
+        #endif
           else /* error happened, abort response is sent */
           {
             o_return = FsmResetAbortSend(B_INSTNUM_ ps_rxBuf, ps_txBuf,
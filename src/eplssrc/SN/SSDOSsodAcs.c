@@ -56,6 +56,30 @@ typedef struct
   BOOLEAN o_sodLockCalled;
   /** flag to signal the call of the SOD_Write() */
   BOOLEAN o_sodSegWriteCalled;
+#if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+  /** flag to signal the open segmented write session of the SOD */
+  BOOLEAN o_segWriteSession;
+#endif
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+  /** flag to signal the open upload snapshot of the SOD */
+  BOOLEAN o_snapshot;
+#endif
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+  /** flag to signal an application object with the attribute SOD_k_ATTR_STREAM */
+  BOOLEAN o_stream;
+  /** flag to signal the started and not yet committed streamed transfer */
+  BOOLEAN o_streamBegun;
+  /** number of bytes passed to or fetched from the application */
+  UINT32 dw_streamPos;
+  /** last chunk fetched from the application */
+  UINT8 ab_streamData[EPLS_cfg_MAX_PYLD_LEN];
+#endif
+#if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+  /** flag to signal the upload of the data collected by a multi-object read */
+  BOOLEAN o_multi;
+  /** data of the objects of the multi-object read in network format */
+  UINT8 ab_multiData[SSDOS_cfg_MULTI_READ_LEN];
+#endif
 
   /** index of SOD entry */
   UINT16 w_idx;
@@ -73,6 +97,13 @@ static t_SOD_ACCESS as_SodAcs[EPLS_cfg_MAX_INSTANCES] SAFE_NO_INIT_SEKTOR;
 
 static BOOLEAN SodAcsWriteAllowed(BYTE_B_INSTNUM_ BOOLEAN o_seg,
                                   BOOLEAN o_otherInst);
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+static UINT32 SodAcsStreamWrite(BYTE_B_INSTNUM_ const UINT8 *pb_data,
+                                UINT32 dw_offset, UINT32 dw_size,
+                                BOOLEAN o_last);
+static UINT8 *SodAcsStreamRead(BYTE_B_INSTNUM_ UINT32 dw_offset,
+                               UINT32 dw_size, UINT32 *pdw_abortCode);
+#endif
 
 /**
 * @brief This function initializes SOD access structure.
@@ -91,6 +122,20 @@ void SSDOS_SodAcsInit(BYTE_B_INSTNUM)
   ps_sodAcs->o_intToggleBit = FALSE;
   ps_sodAcs->o_sodLockCalled = FALSE;
   ps_sodAcs->o_sodSegWriteCalled = FALSE;
+#if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+  ps_sodAcs->o_segWriteSession = FALSE;
+#endif
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+  ps_sodAcs->o_snapshot = FALSE;
+#endif
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+  ps_sodAcs->o_stream = FALSE;
+  ps_sodAcs->o_streamBegun = FALSE;
+  ps_sodAcs->dw_streamPos = 0x00UL;
+#endif
+#if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+  ps_sodAcs->o_multi = FALSE;
+#endif
 
   ps_sodAcs->s_sodEntry.dw_hdl = 0x00UL;
   ps_sodAcs->s_sodEntry.o_applObj = FALSE;
@@ -118,6 +163,35 @@ BOOLEAN SSDOS_SodAcsReset(BYTE_B_INSTNUM_ BOOLEAN o_abort)
   t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
                                                          access structure */
 
+#if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+  /* the segmented write session is closed before the SOD is unlocked */
+  if (ps_sodAcs->o_segWriteSession)
+  {
+    SOD_SegWriteClose(B_INSTNUM);
+    ps_sodAcs->o_segWriteSession = FALSE;
+  }
+  /* no else : no segmented write session is open */
+#endif
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+  /* the snapshot is closed before the SOD is unlocked */
+  if (ps_sodAcs->o_snapshot)
+  {
+    SOD_SnapClose(B_INSTNUM);
+    ps_sodAcs->o_snapshot = FALSE;
+  }
+  /* no else : no snapshot is open */
+#endif
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+  /* the application discards a started streamed transfer before the object
+     is unlocked */
+  if (ps_sodAcs->o_streamBegun)
+  {
+    SOD_StreamAbort(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl);
+    ps_sodAcs->o_streamBegun = FALSE;
+  }
+  /* no else : no streamed transfer is pending */
+#endif
+
   /* if the SOD_Lock() was called */
   if (ps_sodAcs->o_sodLockCalled)
   {
@@ -226,9 +300,23 @@ EPLS_t_DATATYPE SSDOS_SodAcsDataTypeGet(BYTE_B_INSTNUM)
 {
   t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
                                                          access structure */
+  EPLS_t_DATATYPE e_dataType; /* return value */
+
+#if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+  /* if the data of a multi-object read is uploaded */
+  if (ps_sodAcs->o_multi)
+  {
+    /* the data is already in network format */
+    e_dataType = EPLS_k_DOMAIN;
+  }
+  else
+#endif
+  {
+    e_dataType = ps_sodAcs->s_sodEntry.ps_attr->e_dataType;
+  }
 
   SCFM_TACK_PATH();
-  return ps_sodAcs->s_sodEntry.ps_attr->e_dataType;
+  return e_dataType;
 }
 
 /**
@@ -279,6 +367,9 @@ UINT32 SSDOS_SodAcsAttrGet(BYTE_B_INSTNUM_ const UINT8 *ps_rxPyldData,
   SOD_t_ERROR_RESULT s_errRes; /* SOD access error */
 
   *pdw_objSize = 0UL;
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+  ps_sodAcs->o_stream = FALSE;
+#endif
 
   SSDOS_SodAcsIdxCopy(B_INSTNUM_ ps_rxPyldData);
 
@@ -311,6 +402,13 @@ UINT32 SSDOS_SodAcsAttrGet(BYTE_B_INSTNUM_ const UINT8 *ps_rxPyldData,
   }
   else /* SOD attribute is available */
   {
+  #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+    /* the attribute SOD_k_ATTR_STREAM is only valid for application objects */
+    ps_sodAcs->o_stream = (BOOLEAN)((ps_sodAcs->s_sodEntry.o_applObj) &&
+                                    (EPLS_IS_BIT_SET(
+                                       ps_sodAcs->s_sodEntry.ps_attr->w_attr,
+                                       SOD_k_ATTR_STREAM)));
+  #endif
     /* if read access was requested */
     if (o_readAcs)
     {
@@ -472,6 +570,7 @@ UINT32 SSDOS_SodAcsWrite(BYTE_B_INSTNUM_ const UINT8 *pb_data, UINT32 dw_offset,
                                         network byte order to host byte order */
   t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
                                                           access structure */
+  BOOLEAN o_written; /* flag to signal the successful write access */
 
   /* if the actual length of the SOD object has to be set */
   if (o_actLenSet)
@@ -525,15 +624,39 @@ UINT32 SSDOS_SodAcsWrite(BYTE_B_INSTNUM_ const UINT8 *pb_data, UINT32 dw_offset,
       }
       /* no else : no data has to be copied, actual length was set to 0 */
     }
-    else /* segmented access */
+  #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+    /* else if the segment belongs to a streamed transfer */
+    else if (ps_sodAcs->o_streamBegun)
     {
       /* byte order conversion */
       SFS_NET_CPY_DOMSTR(adw_tempData, pb_data, dw_size);
 
+      dw_abortCode = SodAcsStreamWrite(B_INSTNUM_ (const UINT8 *)adw_tempData,
+                                       dw_offset, dw_size, o_actLenSet);
+    }
+  #endif
+    else /* segmented access */
+    {
+    #if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+      /* if the segmented write session is open */
+      if (ps_sodAcs->o_segWriteSession)
+      {
+        /* the segment is written directly from the received frame */
+        o_written = SOD_SegWrite(B_INSTNUM_ pb_data, dw_offset, dw_size);
+      }
+      else /* the segment is written via SOD_Write() */
+    #endif
+      {
+        /* byte order conversion */
+        SFS_NET_CPY_DOMSTR(adw_tempData, pb_data, dw_size);
+
+        o_written = SOD_Write(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
+                              ps_sodAcs->s_sodEntry.o_applObj, adw_tempData,
+                              SOD_k_NO_OVERWRITE, dw_offset, dw_size);
+      }
+
       /* if write access succeeded */
-      if(SOD_Write(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
-                   ps_sodAcs->s_sodEntry.o_applObj, adw_tempData,
-                   SOD_k_NO_OVERWRITE, dw_offset, dw_size))
+      if(o_written)
       {
         /* if no expedited access or last segment was written and
               the o_sodSegWriteCalled flag was already set */
@@ -579,35 +702,71 @@ UINT8 *SSDOS_SodAcsRead(BYTE_B_INSTNUM_ UINT32 dw_offset, UINT32 dw_size,
                                                          access structure */
   SOD_t_ERROR_RESULT s_errRes; /* SOD access error */
 
-  /* if the object is readable or readable constant */
+#if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+  /* if the data of a multi-object read is uploaded */
+  if (ps_sodAcs->o_multi)
+  {
+    /* the segments never exceed the collected data, see
+       SSDOS_UpldInitMultiReqProc() and SSDOS_UpldSegReqProc() */
+    pb_return = &(ps_sodAcs->ab_multiData[dw_offset]);
+    *pdw_abortCode = (UINT32)SOD_ABT_NO_ERROR;
+  }
+  /* else if the object is readable or readable constant */
+  else
+#endif
   if ((EPLS_IS_BIT_SET(ps_sodAcs->s_sodEntry.ps_attr->w_attr, SOD_k_ATTR_RO)) ||
       (EPLS_IS_BIT_SET(ps_sodAcs->s_sodEntry.ps_attr->w_attr,
                        SOD_k_ATTR_RO_CONST)))
   {
-    /* get reference to the data to be read from the SOD */
-    pb_return = (UINT8 *)SOD_Read(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
-                                  ps_sodAcs->s_sodEntry.o_applObj, dw_offset,
-                                  dw_size, &s_errRes);
-
-    /* if the read access failed */
-    if (pb_return == NULL)
-    {
-      /* if the callback abort happened or 
-            SAPL read abort happened */
-      if ((s_errRes.w_errorCode == SOD_k_ERR_CLBK_ABORT_BR) ||
-          (s_errRes.w_errorCode == SOD_k_ERR_SAPL_READ))
+  #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+    /* if the segment belongs to a streamed transfer */
+    if (ps_sodAcs->o_streamBegun)
+    {
+      pb_return = SodAcsStreamRead(B_INSTNUM_ dw_offset, dw_size,
+                                   pdw_abortCode);
+    }
+    else /* the segment is read via SOD_Read() */
+  #endif
+    {
+    #if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+      /* if the segment belongs to an upload with open snapshot */
+      if (ps_sodAcs->o_snapshot)
       {
-        *pdw_abortCode = (UINT32)(s_errRes.e_abortCode);
+        /* get reference to the data as it was at the start of the upload */
+        pb_return = (UINT8 *)SOD_SnapRead(B_INSTNUM_
+                                          ps_sodAcs->s_sodEntry.dw_hdl,
+                                          ps_sodAcs->s_sodEntry.o_applObj,
+                                          dw_offset, dw_size, &s_errRes);
       }
-      else /* other error happened */
+      else
+    #endif
       {
-        SERR_SetError(B_INSTNUM_ s_errRes.w_errorCode,
-                      (UINT32)(s_errRes.e_abortCode));
+        /* get reference to the data to be read from the SOD */
+        pb_return = (UINT8 *)SOD_Read(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
+                                      ps_sodAcs->s_sodEntry.o_applObj,
+                                      dw_offset, dw_size, &s_errRes);
+      }
+
+      /* if the read access failed */
+      if (pb_return == NULL)
+      {
+        /* if the callback abort happened or
+              SAPL read abort happened */
+        if ((s_errRes.w_errorCode == SOD_k_ERR_CLBK_ABORT_BR) ||
+            (s_errRes.w_errorCode == SOD_k_ERR_SAPL_READ))
+        {
+          *pdw_abortCode = (UINT32)(s_errRes.e_abortCode);
+        }
+        else /* other error happened */
+        {
+          SERR_SetError(B_INSTNUM_ s_errRes.w_errorCode,
+                        (UINT32)(s_errRes.e_abortCode));
+        }
+      }
+      else /* read access succeeded */
+      {
+        *pdw_abortCode = (UINT32)SOD_ABT_NO_ERROR;
       }
-    }
-    else /* read access succeeded */
-    {
-      *pdw_abortCode = (UINT32)SOD_ABT_NO_ERROR;
     }
   }
   else /* object is not readable */
@@ -634,6 +793,15 @@ UINT32 SSDOS_SodAcsLock(BYTE_B_INSTNUM)
   t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
                                                           access structure */
 
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+  /* if the SOD is already locked because a step of a streamed transfer is
+        repeated */
+  if (ps_sodAcs->o_sodLockCalled)
+  {
+    dw_abortCode = (UINT32)SOD_ABT_NO_ERROR;
+  }
+  else
+#endif
   /* if locking of the SOD succeeded */
   if(SOD_Lock(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
               ps_sodAcs->s_sodEntry.o_applObj))
@@ -650,6 +818,280 @@ UINT32 SSDOS_SodAcsLock(BYTE_B_INSTNUM)
   return dw_abortCode;
 }
 
+#if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+/**
+* @brief This function opens the segmented write session of the SOD for the object of the segmented download.
+*
+* If the session cannot be opened, the segments are written via SOD_Write().
+*
+* @param        b_instNum        instance number (not checked, checked in  SSC_ProcessSNMTSSDOFrame()), valid range:  0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*/
+void SSDOS_SodAcsSegWriteOpen(BYTE_B_INSTNUM)
+{
+  t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
+                                                          access structure */
+
+  ps_sodAcs->o_segWriteSession =
+      SOD_SegWriteOpen(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
+                       ps_sodAcs->s_sodEntry.o_applObj);
+
+  SCFM_TACK_PATH();
+}
+#endif
+
+#if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+/**
+* @brief This function opens the snapshot of the SOD for the object of the segmented upload.
+*
+* The segments of an object with the attribute SOD_k_ATTR_SNAPSHOT are read as they were at the
+* start of the upload, even if the object is written during the upload.
+*
+* @param        b_instNum        instance number (not checked, checked in  SSC_ProcessSNMTSSDOFrame()), valid range:  0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*/
+void SSDOS_SodAcsSnapOpen(BYTE_B_INSTNUM)
+{
+  t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
+                                                          access structure */
+
+  SOD_SnapOpen(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
+               ps_sodAcs->s_sodEntry.o_applObj);
+  ps_sodAcs->o_snapshot = TRUE;
+
+  SCFM_TACK_PATH();
+}
+#endif
+
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+/**
+* @brief This function starts the streamed transfer, if the accessed object has the attribute SOD_k_ATTR_STREAM.
+*
+* The function has to be called after SSDOS_SodAcsLock(). Nothing is done for other objects or if the transfer is
+* already started.
+*
+* @param        b_instNum        instance number (not checked, checked in  SSC_ProcessSNMTSSDOFrame()), valid range:  0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        o_download
+* - TRUE  : segmented download
+* - FALSE : segmented upload (not checked, any value allowed), valid range: TRUE, FALSE
+*
+* @param        dw_totalSize     declared total size in bytes, 0 if unknown (not checked, any value allowed), valid range: (UINT32)
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - if SSDOS_k_ABT_NOT_READY the step has to be repeated,
+* - otherwise abort response has to be sent with the returned abort code.
+*/
+UINT32 SSDOS_SodAcsStreamBegin(BYTE_B_INSTNUM_ BOOLEAN o_download,
+                               UINT32 dw_totalSize)
+{
+  UINT32 dw_abortCode = (UINT32)SOD_ABT_NO_ERROR; /* return value */
+  t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
+                                                          access structure */
+  SOD_t_STREAM_RESULT e_result; /* result of the application */
+
+  /* if a streamed object is accessed and the transfer is not started yet */
+  if ((ps_sodAcs->o_stream) && (!ps_sodAcs->o_streamBegun))
+  {
+    e_result = SOD_StreamBegin(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
+                               o_download, dw_totalSize);
+
+    /* if the transfer is started */
+    if (e_result == SOD_k_STREAM_DONE)
+    {
+      ps_sodAcs->o_streamBegun = TRUE;
+      ps_sodAcs->dw_streamPos = 0x00UL;
+    }
+    /* else if the application is not ready */
+    else if (e_result == SOD_k_STREAM_NOT_READY)
+    {
+      dw_abortCode = SSDOS_k_ABT_NOT_READY;
+    }
+    else /* the application aborted the transfer */
+    {
+      dw_abortCode = SERR_GetLastAddInfo();
+    }
+  }
+  /* no else : no streamed transfer */
+
+  SCFM_TACK_PATH();
+  return dw_abortCode;
+}
+
+/**
+* @brief This function commits the started streamed transfer.
+*
+* Nothing is done, if no streamed transfer is started.
+*
+* @param        b_instNum        instance number (not checked, checked in  SSC_ProcessSNMTSSDOFrame()), valid range:  0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        dw_size          number of transferred bytes (not checked, any value allowed), valid range: (UINT32)
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - if SSDOS_k_ABT_NOT_READY the step has to be repeated,
+* - otherwise abort response has to be sent with the returned abort code.
+*/
+UINT32 SSDOS_SodAcsStreamCommit(BYTE_B_INSTNUM_ UINT32 dw_size)
+{
+  UINT32 dw_abortCode = (UINT32)SOD_ABT_NO_ERROR; /* return value */
+  t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
+                                                          access structure */
+  SOD_t_STREAM_RESULT e_result; /* result of the application */
+
+  /* if a streamed transfer is started */
+  if (ps_sodAcs->o_streamBegun)
+  {
+    e_result = SOD_StreamCommit(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
+                                dw_size);
+
+    /* if the transfer is committed */
+    if (e_result == SOD_k_STREAM_DONE)
+    {
+      ps_sodAcs->o_streamBegun = FALSE;
+    }
+    /* else if the application is not ready */
+    else if (e_result == SOD_k_STREAM_NOT_READY)
+    {
+      dw_abortCode = SSDOS_k_ABT_NOT_READY;
+    }
+    else /* the application aborted the transfer */
+    {
+      dw_abortCode = SERR_GetLastAddInfo();
+    }
+  }
+  /* no else : no streamed transfer */
+
+  SCFM_TACK_PATH();
+  return dw_abortCode;
+}
+#endif
+
+#if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function reads the objects of a multi-object upload request into the multi-object buffer.
+*
+* The objects are read one after the other and their data is stored in network format. The index
+* and sub-index of the first object are stored for the response. The following upload reads the
+* collected data via SSDOS_SodAcsRead().
+*
+* @param        b_instNum            instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()), valid range: 0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        ps_rxPyldData        reference to the payload data in the received openSAFETY frame
+*       (pointer not checked, only called with reference to array in SSDOS_UpldInitMultiReqProc()), valid range: see EPLS_t_FRM
+*
+* @param        b_rxPyldLen          payload length of the received openSAFETY frame (not checked, checked in
+*       WfReqInitState()), valid range: k_DATA_HDR_LEN + n * k_MULTI_ENTRY_LEN
+*
+* @retval       pdw_dataLen          length of the collected data, only relevant if SOD_ABT_NO_ERROR is returned
+*       (pointer not checked, only called with reference to variable in SSDOS_UpldInitMultiReqProc()), valid range: <> NULL
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - otherwise abort response has to be sent with the returned abort code. See SOD_t_ABORT_CODES
+*/
+UINT32 SSDOS_SodAcsMultiRead(BYTE_B_INSTNUM_ const UINT8 *ps_rxPyldData,
+                             UINT8 b_rxPyldLen, UINT32 *pdw_dataLen)
+{
+  UINT32 dw_abortCode = (UINT32)SOD_ABT_NO_ERROR; /* return value */
+  t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
+                                                          access structure */
+  SOD_t_ACCESS s_entry;        /* handle of the actual object */
+  SOD_t_ERROR_RESULT s_errRes; /* SOD access error */
+  UINT16 w_idx;      /* index of the actual object */
+  UINT8 b_subIdx;    /* sub-index of the actual object */
+  UINT8 b_ofs;       /* offset of the actual object in the request */
+  UINT32 dw_objSize; /* actual length of the actual object */
+  const void *pv_data; /* data of the actual object */
+
+  *pdw_dataLen = 0UL;
+
+  /* the response and an abort response refer to the first object */
+  SSDOS_SodAcsIdxCopy(B_INSTNUM_ ps_rxPyldData);
+  ps_sodAcs->o_multi = TRUE;
+
+  b_ofs = k_OFS_IDX;
+  while ((dw_abortCode == (UINT32)SOD_ABT_NO_ERROR) && (b_ofs < b_rxPyldLen))
+  {
+    SFS_NET_CPY16(&w_idx, &(ps_rxPyldData[b_ofs]));
+    SFS_NET_CPY8(&b_subIdx, &(ps_rxPyldData[b_ofs + 2U]));
+
+    s_entry.ps_attr = SOD_AttrGet(B_INSTNUM_ w_idx, b_subIdx, &s_entry.dw_hdl,
+                                  &s_entry.o_applObj, &s_errRes);
+
+    /* if SOD attribute is not available */
+    if (s_entry.ps_attr == NULL)
+    {
+      /* if SOD access error */
+      if ((s_errRes.e_abortCode != SOD_ABT_OBJ_DOES_NOT_EXIST) &&
+          (s_errRes.e_abortCode != SOD_ABT_SUB_IDX_DOES_NOT_EXIST))
+      {
+        SERR_SetError(B_INSTNUM_ s_errRes.w_errorCode,
+                      (UINT32)(s_errRes.e_abortCode));
+      }
+      /* no else : object was not found */
+
+      dw_abortCode = (UINT32)s_errRes.e_abortCode;
+    }
+    /* else if the object is neither readable nor readable constant */
+    else if ((!EPLS_IS_BIT_SET(s_entry.ps_attr->w_attr, SOD_k_ATTR_RO)) &&
+             (!EPLS_IS_BIT_SET(s_entry.ps_attr->w_attr, SOD_k_ATTR_RO_CONST)))
+    {
+      dw_abortCode = (UINT32)SOD_ABT_OBJ_NOT_READABLE;
+    }
+    /* else if the getting of the actual length of the object failed */
+    else if (!SOD_ActualLenGet(B_INSTNUM_ s_entry.dw_hdl, s_entry.o_applObj,
+                               &dw_objSize))
+    {
+      dw_abortCode = SERR_GetLastAddInfo();
+    }
+    /* else if the data does not fit into the multi-object buffer */
+    else if (dw_objSize > ((UINT32)SSDOS_cfg_MULTI_READ_LEN - *pdw_dataLen))
+    {
+      dw_abortCode = (UINT32)SOD_ABT_OUT_OF_MEMORY;
+    }
+    else /* the object can be read */
+    {
+      pv_data = SOD_Read(B_INSTNUM_ s_entry.dw_hdl, s_entry.o_applObj,
+                         SOD_k_NO_OFFSET, SOD_k_LEN_NOT_NEEDED, &s_errRes);
+
+      /* if the read access failed */
+      if (pv_data == NULL)
+      {
+        /* if the callback abort happened or
+              SAPL read abort happened */
+        if ((s_errRes.w_errorCode == SOD_k_ERR_CLBK_ABORT_BR) ||
+            (s_errRes.w_errorCode == SOD_k_ERR_SAPL_READ))
+        {
+          dw_abortCode = (UINT32)(s_errRes.e_abortCode);
+        }
+        else /* other error happened */
+        {
+          SERR_SetError(B_INSTNUM_ s_errRes.w_errorCode,
+                        (UINT32)(s_errRes.e_abortCode));
+          dw_abortCode = (UINT32)SOD_ABT_GENERAL_ERROR;
+        }
+      }
+      /* else if the byte order conversion failed */
+      else if (!SFS_NetworkCopyGen(&(ps_sodAcs->ab_multiData[*pdw_dataLen]),
+                                   pv_data, dw_objSize,
+                                   s_entry.ps_attr->e_dataType))
+      {
+        dw_abortCode = (UINT32)SOD_ABT_GENERAL_ERROR;
+      }
+      else /* the object data is collected */
+      {
+        *pdw_dataLen = *pdw_dataLen + dw_objSize;
+      }
+    }
+
+    b_ofs = (UINT8)(b_ofs + k_MULTI_ENTRY_LEN);
+  }
+
+  SCFM_TACK_PATH();
+  return dw_abortCode;
+}
+#endif
+
 /**
 * @brief This function assembles a SSDO Service Response for the SOD access except the raw data.
 *
@@ -790,5 +1232,131 @@ static BOOLEAN SodAcsWriteAllowed(BYTE_B_INSTNUM_ BOOLEAN o_seg,
   return o_return;
 }
 
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+/**
+* @brief This function passes a segment of a streamed download to the application and commits the transfer after the
+* last segment.
+*
+* A segment which was already passed is not passed again, if the step is repeated because the commit was not ready.
+*
+* @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()), valid range: 0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        pb_data            pointer to the segment in host format (pointer not checked, only called with reference to array in SSDOS_SodAcsWrite()), valid range: <> NULL
+*
+* @param        dw_offset          start offset in bytes of the segment within the object (not checked, checked by the application), valid range: (UINT32)
+*
+* @param        dw_size            size in bytes of the segment (not checked, checked by the application), valid range: (UINT32)
+*
+* @param        o_last
+* - TRUE  : last segment, the transfer is committed
+* - FALSE : further segments follow (not checked, any value allowed), valid range: TRUE, FALSE
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - if SSDOS_k_ABT_NOT_READY the step has to be repeated,
+* - otherwise abort response has to be sent with the returned abort code.
+*/
+static UINT32 SodAcsStreamWrite(BYTE_B_INSTNUM_ const UINT8 *pb_data,
+                                UINT32 dw_offset, UINT32 dw_size,
+                                BOOLEAN o_last)
+{
+  UINT32 dw_abortCode = (UINT32)SOD_ABT_NO_ERROR; /* return value */
+  t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
+                                                          access structure */
+  SOD_t_STREAM_RESULT e_result; /* result of the application */
+
+  /* if the segment was not passed to the application yet */
+  if ((dw_offset + dw_size) > ps_sodAcs->dw_streamPos)
+  {
+    e_result = SOD_StreamWrite(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
+                               pb_data, dw_offset, dw_size);
+
+    /* if the segment was taken over */
+    if (e_result == SOD_k_STREAM_DONE)
+    {
+      ps_sodAcs->dw_streamPos = dw_offset + dw_size;
+    }
+    /* else if the application is not ready */
+    else if (e_result == SOD_k_STREAM_NOT_READY)
+    {
+      dw_abortCode = SSDOS_k_ABT_NOT_READY;
+    }
+    else /* the application aborted the transfer */
+    {
+      dw_abortCode = SERR_GetLastAddInfo();
+    }
+  }
+  /* no else : the segment is already passed */
+
+  /* if the last segment was passed */
+  if ((dw_abortCode == (UINT32)SOD_ABT_NO_ERROR) && (o_last))
+  {
+    dw_abortCode = SSDOS_SodAcsStreamCommit(B_INSTNUM_ dw_offset + dw_size);
+  }
+  /* no else : further segments follow or the segment was not passed */
+
+  SCFM_TACK_PATH();
+  return dw_abortCode;
+}
+
+/**
+* @brief This function fetches a segment of a streamed upload from the application.
+*
+* A segment which was already fetched is taken from the buffer, if the step is repeated.
+*
+* @param        b_instNum          instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()), valid range: 0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        dw_offset          start offset in bytes of the segment within the object (not checked, checked by the application), valid range: (UINT32)
+*
+* @param        dw_size            size in bytes of the segment (not checked, only called with the segment size in SSDOS_UpldInitReqProc() or SSDOS_UpldSegReqProc()), valid range: 0 .. EPLS_cfg_MAX_PYLD_LEN
+*
+* @retval       pdw_abortCode      abort code, if SOD_ABT_NO_ERROR no abort response has to be sent, if SSDOS_k_ABT_NOT_READY the step has to be repeated,
+*       otherwise abort response has to be sent with this abort code. (pointer not checked, only called with reference to variable in SSDOS_SodAcsRead()) valid range: <> NULL
+*
+* @return
+* - <> NULL             - pointer to the segment, if pdw_abortCode is SOD_ABT_NO_ERROR
+* - == NULL             - the segment is not available, see pdw_abortCode
+*/
+static UINT8 *SodAcsStreamRead(BYTE_B_INSTNUM_ UINT32 dw_offset,
+                               UINT32 dw_size, UINT32 *pdw_abortCode)
+{
+  UINT8 *pb_return = (UINT8 *)NULL; /* return value */
+  t_SOD_ACCESS *ps_sodAcs = &as_SodAcs[B_INSTNUMidx]; /* pointer to the sod
+                                                          access structure */
+  SOD_t_STREAM_RESULT e_result; /* result of the application */
+
+  /* if the segment was not fetched from the application yet */
+  if ((dw_offset + dw_size) > ps_sodAcs->dw_streamPos)
+  {
+    e_result = SOD_StreamRead(B_INSTNUM_ ps_sodAcs->s_sodEntry.dw_hdl,
+                              ps_sodAcs->ab_streamData, dw_offset, dw_size);
+
+    /* if the segment was fetched */
+    if (e_result == SOD_k_STREAM_DONE)
+    {
+      ps_sodAcs->dw_streamPos = dw_offset + dw_size;
+      pb_return = ps_sodAcs->ab_streamData;
+      *pdw_abortCode = (UINT32)SOD_ABT_NO_ERROR;
+    }
+    /* else if the application is not ready */
+    else if (e_result == SOD_k_STREAM_NOT_READY)
+    {
+      *pdw_abortCode = SSDOS_k_ABT_NOT_READY;
+    }
+    else /* the application aborted the transfer */
+    {
+      *pdw_abortCode = SERR_GetLastAddInfo();
+    }
+  }
+  else /* the segment is already in the buffer */
+  {
+    pb_return = ps_sodAcs->ab_streamData;
+    *pdw_abortCode = (UINT32)SOD_ABT_NO_ERROR;
+  }
+
+  SCFM_TACK_PATH();
+  return pb_return;
+}
+#endif
 
 /** @} */
@@ -233,13 +233,40 @@ UINT32 SSDOS_DwnldInitSegRespSend(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
   UINT32 dw_abortCode = (UINT32)SOD_ABT_GENERAL_ERROR; /* return value */
   t_SEG_INFO *ps_segInfo = &as_SegInfo[B_INSTNUMidx]; /* pointer to the segment
                                                          info structure */
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+  UINT32 dw_totalSize; /* declared size of the streamed download */
+#endif
 
   /* SOD is locked */
   dw_abortCode = SSDOS_SodAcsLock(B_INSTNUM);
 
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
   /* if no error happened */
   if (dw_abortCode == (UINT32)SOD_ABT_NO_ERROR)
   {
+    /* if the SSDOC did not declare the size */
+    if (ps_segInfo->o_objSizeUnknown)
+    {
+      dw_totalSize = k_OBJ_SIZE_UNKNOWN;
+    }
+    else /* the size was declared */
+    {
+      dw_totalSize = ps_segInfo->dw_entrySize;
+    }
+
+    /* a streamed object is passed to the application from now on */
+    dw_abortCode = SSDOS_SodAcsStreamBegin(B_INSTNUM_ TRUE, dw_totalSize);
+  }
+  /* no else : abort response will be sent */
+#endif
+
+  /* if no error happened */
+  if (dw_abortCode == (UINT32)SOD_ABT_NO_ERROR)
+  {
+  #if (SOD_cfg_SEG_WRITE_SESSION == EPLS_k_ENABLE)
+    /* the object is checked once for all segments */
+    SSDOS_SodAcsSegWriteOpen(B_INSTNUM);
+  #endif
   #if ((EPLS_cfg_MAX_PYLD_LEN > 8) || (EPLS_cfg_MAX_PYLD_LEN_FAST_SSDO > 8))
     /* if number of bytes to be written is zero */
     if(ps_segInfo->b_rawDataLen == 0U)
@@ -546,6 +573,27 @@ UINT32 SSDOS_UpldInitReqProc(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
 
       dw_abortCode = SSDOS_SodAcsLock(B_INSTNUM);
 
+    #if (SOD_cfg_SNAPSHOT == EPLS_k_ENABLE)
+      /* if no error happened */
+      if (dw_abortCode == (UINT32)SOD_ABT_NO_ERROR)
+      {
+        /* the segments are read as they are at the start of the upload */
+        SSDOS_SodAcsSnapOpen(B_INSTNUM);
+      }
+      /* no else : abort response will be sent */
+    #endif
+
+    #if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+      /* if no error happened */
+      if (dw_abortCode == (UINT32)SOD_ABT_NO_ERROR)
+      {
+        /* a streamed object is fetched from the application from now on */
+        dw_abortCode = SSDOS_SodAcsStreamBegin(B_INSTNUM_ FALSE,
+                                               ps_segInfo->dw_entrySize);
+      }
+      /* no else : abort response will be sent */
+    #endif
+
       /* if no error happened */
       if (dw_abortCode == (UINT32)SOD_ABT_NO_ERROR)
       {
@@ -580,6 +628,70 @@ UINT32 SSDOS_UpldInitReqProc(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
   return dw_abortCode;
 }
 
+#if (SSDOS_cfg_MULTI_READ == EPLS_k_ENABLE)
+/**
+* @brief This function processes a SSDO multi-object upload request.
+*
+* The data of all requested objects is collected and uploaded like the data of a single DOMAIN object.
+*
+* @param        b_instNum        instance number (not checked, checked in SSC_ProcessSNMTSSDOFrame()),
+*       valid range: 0 .. ( EPLS_cfg_MAX_INSTANCES - 1 )
+*
+* @param        ps_rxBuf         reference to received openSAFETY frame  to be distributed (pointer
+*       not checked, only called with reference to struct in processStateReqProc()), valid range: <> NULL, see EPLS_t_FRM
+*
+* @retval       po_seg           only relevant if SOD_ABT_NO_ERROR returned,
+* - TRUE : segmented upload
+* - FALSE : expedited upload (pointer not checked, only called with reference to variable in WfReqInitState()), valid range: TRUE, FALSE
+*
+* @return
+* - if SOD_ABT_NO_ERROR no abort response has to be sent,
+* - otherwise abort response has to be sent with the returned abort code. See SOD_t_ABORT_CODES
+*/
+UINT32 SSDOS_UpldInitMultiReqProc(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
+                                  BOOLEAN *po_seg)
+{
+  UINT32 dw_abortCode = (UINT32)SOD_ABT_GENERAL_ERROR; /* return value */
+  t_SEG_INFO *ps_segInfo = &as_SegInfo[B_INSTNUMidx]; /* pointer to the segment
+                                                         info structure */
+
+  dw_abortCode = SSDOS_SodAcsMultiRead(B_INSTNUM_ ps_rxBuf->ab_frmData,
+                                       ps_rxBuf->s_frmHdr.b_le,
+                                       &ps_segInfo->dw_entrySize);
+
+  /* if no error happened */
+  if (dw_abortCode == (UINT32)SOD_ABT_NO_ERROR)
+  {
+    /* if the collected data has to be transferred SEGMENTED */
+    if(ps_segInfo->dw_entrySize >
+        (UINT8)((UINT8)EPLS_cfg_MAX_PYLD_LEN - k_DATA_HDR_LEN))
+    {
+      *po_seg = TRUE;
+
+      /* store the maximum segment length */
+      ps_segInfo->b_rawDataLen =
+          (UINT8)((UINT8)EPLS_cfg_MAX_PYLD_LEN -
+                  (k_DATA_HDR_LEN + k_DATA_OBJ_LEN)); /*lint !e778 */
+    }
+    else  /* EXPEDITED upload can be processed */
+    {
+      *po_seg = FALSE;
+
+      /* store the segment length */
+      ps_segInfo->b_rawDataLen = (UINT8)ps_segInfo->dw_entrySize;
+    }
+
+    ps_segInfo->pb_rawData =
+        SSDOS_SodAcsRead(B_INSTNUM_ 0x00UL, (UINT32)ps_segInfo->b_rawDataLen,
+                         &dw_abortCode);
+  }
+  /* no else : abort response will be sent */
+
+  SCFM_TACK_PATH();
+  return dw_abortCode;
+}
+#endif
+
 /**
 * @brief This function generates a SSDOS initiate expedited upload response.
 *
@@ -727,6 +839,17 @@ UINT32 SSDOS_UpldSegReqProc(BYTE_B_INSTNUM_ const EPLS_t_FRM *ps_rxBuf,
       SSDOS_SodAcsRead(B_INSTNUM_ ps_segInfo->dw_tranfDataLen,
                        (UINT32)ps_segInfo->b_rawDataLen, &dw_abortCode);
 
+#if (SOD_cfg_STREAM_OBJ == EPLS_k_ENABLE)
+  /* if no error happened and the end segment is sent */
+  if ((dw_abortCode == (UINT32)SOD_ABT_NO_ERROR) && (*po_end))
+  {
+    /* a streamed upload is committed before the last segment is sent */
+    dw_abortCode = SSDOS_SodAcsStreamCommit(B_INSTNUM_
+                                            ps_segInfo->dw_entrySize);
+  }
+  /* no else : middle segment or abort response will be sent */
+#endif
+
   /* if no error happened */
   if (dw_abortCode == (UINT32)SOD_ABT_NO_ERROR)
   {
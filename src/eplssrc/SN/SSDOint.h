@@ -140,8 +140,24 @@
 #define k_UPLD_SEG_END   0x48U
 /** transfer abort service */
 #define k_ABORT          0x04U
+/**
+ * init multi-object upload transfer, the response is an expedited or segmented
+ * upload response (k_UPLD_INIT_EXP, k_UPLD_INIT_SEG)
+ */
+#define k_UPLD_INIT_MULTI 0xA0U
 /** @} */
 
+/**
+ * This symbol represents the number of bytes used for index and sub-index of one object in the
+ * multi-object upload request.
+ *
+ * The first object is requested in DB1-3 of the data header, every further object is appended
+ * with the same layout (index, sub-index). The response contains the data of all objects one
+ * after the other in network format, the index and sub-index of the response are the ones of
+ * the first object.
+ */
+#define k_MULTI_ENTRY_LEN         0x03u
+
 
 /**
  * This symbol represents the object size is unknown during the upload.
@@ -73,6 +73,37 @@
  */
 #define EPLS_cfg_MAX_INSTANCES    11
 
+/**
+ * Define to enable or disable the frame router.
+ *
+ * If enabled then SSC_RouteFrame() and SSC_RouteNextInst() determine for a received frame
+ * the instances with a matching SDN and whether the frame has to be passed to
+ * SPDO_ProcessRxSpdo() or SSC_ProcessSNMTSSDOFrame(). This is used by gateways running one
+ * instance per safety domain.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define EPLS_cfg_FRAME_ROUTER     EPLS_k_DISABLE
+
+/**
+ * Define to enable or disable runtime-sized SPDO storage.
+ *
+ * If enabled then SSC_InitAll() sizes the per-SPDO storage of every instance (mapping, time
+ * synchronization, process image, Tx CRC cache and SPDO error statistic) from the SPDOs
+ * defined in its SOD instead of SPDO_cfg_MAX_NO_TX_SPDO(_SDG) and SPDO_cfg_MAX_NO_RX_SPDO(_SDG).
+ * The storage of an instance is packed into one arena, taken from a pool of
+ * EPLS_cfg_ARENA_SIZE bytes. SSC_GetArenaFootprint() returns the size of the arena of an instance.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define EPLS_cfg_RUNTIME_ARENA    EPLS_k_DISABLE
+
+/**
+ * Size of the pool for the arenas of all instances in bytes, only used if
+ * EPLS_cfg_RUNTIME_ARENA is enabled. Allowed values : 64..(2^24)
+ */
+#define EPLS_cfg_ARENA_SIZE       32768
+
 /**
  * Define to enable or disable the XXX_GetErrorStr function (e.g. SOD_GetErrorStr).
  *
@@ -87,6 +118,87 @@
  */
 #define EPLS_cfg_ERROR_STATISTIC  EPLS_k_ENABLE
 
+/**
+ * Define to enable or disable the snapshot of the statistic error counters.
+ *
+ * If this define is enabled then SERR_GetStatSnapshot() copies all statistic counters of an
+ * instance consistently and optionally restarts them. The counters of each instance are kept
+ * in blocks aligned to EPLS_cfg_CACHE_LINE_SIZE, SERR_aadwCommonEvtCtr is not available.
+ * The MEMORY_BARRIER() and CACHE_LINE_ALIGNED macros have to be defined for the target.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define EPLS_cfg_ERROR_STAT_SNAPSHOT EPLS_k_DISABLE
+
+/**
+ * Size of a data cache line of the target in bytes.
+ * Allowed values : 16, 32, 64, 128, 256
+ */
+#define EPLS_cfg_CACHE_LINE_SIZE  64
+
+/**
+ * Define to enable or disable the deferred error reporting.
+ *
+ * If this define is enabled then SERR_SetError() does not call SAPL_SERR_SignalErrorClbk()
+ * for errors of the type SERR_TYPE_NOT_FS. These errors are stored together with the instance
+ * number and a time stamp (SAPL_SERR_GetErrorTimeClbk()) in an error queue which is read by the
+ * application with SERR_GetErrorEvt(), e.g. in a low priority task. Errors of the type
+ * SERR_TYPE_FS are still signaled immediately by SAPL_SERR_SignalErrorClbk().
+ * The MEMORY_BARRIER() macro has to be defined for the target.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define EPLS_cfg_ERROR_QUEUE      EPLS_k_DISABLE
+
+/**
+ * Number of entries of the error queue, one entry is always kept free.
+ * Allowed values : 4, 8, 16, 32, 64, 128, 256, 512, 1024
+ */
+#define EPLS_cfg_ERROR_QUEUE_SIZE 32
+
+/**
+ * Define to enable or disable the coalescing of repeated errors in the error queue.
+ *
+ * If this define is enabled then an error with the same instance number, error code and
+ * additional error information as the last queued and not yet read error only increments
+ * the repeat counter of the queued error.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define EPLS_cfg_ERROR_QUEUE_COALESCE EPLS_k_ENABLE
+
+/**
+ * Define to enable or disable the profiling of the openSAFETY Stack.
+ *
+ * If this define is enabled then every SCFM_TACK_PATH() records the time since the previous
+ * one (SCFM_PROF_GET_TIME()) for its call site in the profiling table of the instance selected
+ * with SCFM_ProfSelect(). The tables are read with SCFM_ProfGetSite() or SCFM_ProfDumpSite().
+ * This define must only be enabled for measurement builds.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SCFM_cfg_PROFILING        EPLS_k_DISABLE
+
+/**
+ * Maximum number of call sites per instance recorded by the profiling.
+ * Allowed values : 64, 128, 256, 512, 1024, 2048
+ */
+#define SCFM_cfg_PROF_MAX_SITES   1024
+
+/**
+ * Define to enable or disable the cache of the serialized SNMT Slave responses.
+ *
+ * If this define is enabled then the header bytes, the payload data and the CRCs of the last
+ * transmitted frame of every SNMT Slave response type (UDID, SADR assigned, extended service
+ * and reset guarding SCM) are cached per instance. A response with the same header bytes
+ * only calculates the CRCs over the payload data, starting with the cached CRCs of the headers.
+ * A response which is identical to the cached one, e.g. the response to the node guarding,
+ * gets the cached CRCs without any CRC calculation.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SNMTS_cfg_RESP_CACHE      EPLS_k_DISABLE
+
 /**
  * Define to enable or disable the Safety Configuration Manager, SNMT Master and SSDO.
  *
@@ -149,6 +261,55 @@
  * - if EPLS_cfg_SCM == EPLS_k_DISABLE then EPLS_k_NOT_APPLICABLE
  */
 #define SCM_cfg_MAX_SADR_VALUE                     1023
+
+/**
+ * Define to enable or disable the staggered node guarding of the SCM.
+ *
+ * If enabled, every SN gets its own slot within the guard time (0x100C, 0x01) and the next
+ * guarding or retry of an SN is scheduled to its slot instead of one guard time after the last
+ * response. The guard requests of all SNs are therefore spread evenly over the guard time, also
+ * after power-up, SCM_ResetNodeGuarding() and retries. The time between two guard requests of
+ * an SN never exceeds the guard time.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SCM_cfg_STAGGERED_GUARDING                 EPLS_k_DISABLE
+/** @} */
+
+/**
+ * @name SSDO configuration defines
+ * @{
+ */
+/**
+ * Define to enable or disable the multi-object read of the SSDO Server.
+ *
+ * If enabled, the SSDO Server answers a multi-object read request with the data of all
+ * requested objects one after the other in network format. The data is collected in a
+ * buffer of SSDOS_cfg_MULTI_READ_LEN bytes per instance and transferred by an expedited
+ * or segmented upload response.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SSDOS_cfg_MULTI_READ       EPLS_k_DISABLE
+
+/**
+ * This define configures the size in bytes of the buffer for the data of a multi-object read.
+ *
+ * Only relevant if SSDOS_cfg_MULTI_READ is enabled. Allowed values: 1..1024
+ */
+#define SSDOS_cfg_MULTI_READ_LEN   16
+
+/**
+ * Define to enable or disable the multi-object read of the SSDO Client.
+ *
+ * If enabled, SSDOC_SendMultiReadReq() is available and the SCM reads the vendor ID, product
+ * code and revision number of an SN with one multi-object read instead of three uploads. An SN
+ * which rejects the multi-object read with SOD_ABT_CMD_ID_INVALID is verified with the three
+ * uploads from then on. Only relevant if EPLS_cfg_SCM is enabled.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SSDOC_cfg_MULTI_READ       EPLS_k_DISABLE
 /** @} */
 
 /**
@@ -179,6 +340,32 @@
  */
 #define SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE         EPLS_k_ENABLE
 
+/**
+ * Define to enable or disable the sorted search table for the SPDO number assignment.
+ *
+ * This define is only evaluated if SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE is disabled. If the sorted
+ * table is enabled then the search table is kept sorted by the SN address and the SPDO
+ * filtering uses a binary search, the number of comparisons is log2 of the configured SADRs
+ * instead of linear. The memory consumption is the same as for the linear search table.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SPDO_cfg_SPDO_NUM_SORTED_TABLE          EPLS_k_DISABLE
+
+/**
+ * Define to enable or disable the double buffered process image of the SPDOs.
+ *
+ * If the process image is enabled then the application exchanges the SPDO payload with
+ * SPDO_TxPiGetBuf(), SPDO_TxPiPublish() and SPDO_RxPiRead() instead of the mapped SOD objects.
+ * The application and the openSAFETY Stack may run in different tasks without a lock, the
+ * MEMORY_BARRIER() macro has to be defined for the target. The process image needs
+ * 2 * (SPDO_cfg_MAX_LEN_OF_TX_SPDO + 4) Bytes per Tx SPDO and
+ * 2 * (SPDO_cfg_MAX_LEN_OF_RX_SPDO + 3) Bytes per Rx SPDO.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SPDO_cfg_PROCESS_IMAGE                  EPLS_k_DISABLE
+
 /**
  * Maximum number of the Tx SPDOs
  *
@@ -223,6 +410,31 @@
 */
 #define SPDO_cfg_MAX_LEN_OF_TX_SPDO             128
 
+/**
+ * Define to enable or disable the delta CRC calculation of the Tx SPDOs.
+ *
+ * If enabled then the last transmitted frame of every Tx SPDO is cached. If the next frame of
+ * the Tx SPDO only differs in the CT and TR fields then the CRCs of both sub frames are derived
+ * from the cached CRCs by the contribution of the changed bits instead of a calculation over the
+ * whole sub frames. The cache needs about SPDO_cfg_MAX_LEN_OF_TX_SPDO + 64 Bytes per Tx SPDO.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SPDO_cfg_TX_DELTA_CRC                   EPLS_k_DISABLE
+
+/**
+ * Define to enable or disable the change detection of the Tx SPDOs.
+ *
+ * If enabled then the payload of the last transmitted frame of every Tx SPDO is kept. Until the
+ * refresh prescale expires, the mapped data is gathered every time the Tx SPDO is built and
+ * compared with the kept payload. The Tx SPDO is sent immediately if the data has changed, as if
+ * SPDO_TxDataChanged() had been called. The payload needs SPDO_cfg_MAX_LEN_OF_TX_SPDO Bytes
+ * per Tx SPDO.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SPDO_cfg_TX_CHANGE_DETECT               EPLS_k_DISABLE
+
 /**
  * Maximum number of RxSPDOs to be synchronized over a TxSPDO
  *
@@ -244,6 +456,17 @@
  */
 #define SPDO_cfg_CONNECTION_VALID_STATISTIC		EPLS_k_ENABLE
 
+/**
+ * Time synchronization statistic per RxSPDO is to be created
+ *
+ * If enabled then the minimum, maximum and mean time synchronization propagation delay,
+ * a histogram of the propagation delays and the not answered TReqs are recorded per
+ * RxSPDO and can be read with SPDO_GetTSyncStat(). It needs about 90 Bytes per RxSPDO.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SPDO_cfg_TSYNC_STATISTIC				EPLS_k_DISABLE
+
 /**
  * Maximum number of the Rx SPDOs.
  *
@@ -279,6 +502,18 @@
  */
 #define SPDO_cfg_NO_RX_SPDO_ACT_PER_CALL        4
 
+/**
+ * The SPDO activation is kept over the transition from Operational to Pre-operational state.
+ *
+ * If enabled then the activated SPDO mapping and communication parameters are reused at the next
+ * SNMTS_SN_set_to_op command if its parameter timestamp is the same as at the last transition
+ * to Operational and no SADR was changed in between. The Tx and Rx SPDO activation is skipped
+ * then, the parameter checksum is still checked by the application.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SPDO_cfg_ACTIVATION_CACHE               EPLS_k_DISABLE
+
 /**
  * Maximum number of the Rx SPDO mapping entries
  *
@@ -323,6 +558,76 @@
  */
 #define SOD_cfg_APPLICATION_OBJ    EPLS_k_ENABLE
 
+/**
+ * Define to enable or disable the segmented write session of the SOD
+ *
+ * If enabled, the SSDO Server checks and locks a DOMAIN, VISIBLE STRING or OCTET STRING
+ * object once at the initiate segment of a segmented download and copies every segment
+ * directly from the received frame into the object, see SOD_SegWriteOpen().
+ * Objects managed by the application are still written via SOD_Write(). Must not be enabled,
+ * if SFS_NET_CPY_DOMSTR() is adapted to convert the domain data.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SOD_cfg_SEG_WRITE_SESSION  EPLS_k_DISABLE
+
+/**
+ * Define to enable or disable the streaming of application objects
+ *
+ * If enabled, the segmented SSDO transfers of application objects with the attribute
+ * SOD_k_ATTR_STREAM are passed to the application chunk by chunk via the
+ * SAPL_SOD_StreamBeginClbk(), SAPL_SOD_StreamWriteClbk(), SAPL_SOD_StreamReadClbk(),
+ * SAPL_SOD_StreamCommitClbk() and SAPL_SOD_StreamAbortClbk() callbacks, so the object
+ * data does not have to fit into the RAM of the application. Requires
+ * SOD_cfg_APPLICATION_OBJ to be enabled.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SOD_cfg_STREAM_OBJ         EPLS_k_DISABLE
+
+/**
+ * Define to enable or disable the change feed of the SOD
+ *
+ * If enabled, every object written by SOD_Write() or SOD_SegWrite() is marked in a bitmap of
+ * the instance. The application fetches the handles of the changed objects with
+ * SOD_ChangedGet(), the marks are cleared by the fetch. Objects managed by the application
+ * are not marked.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SOD_cfg_CHANGE_FEED        EPLS_k_DISABLE
+
+/**
+ * Maximum number of SOD entries covered by the change feed. SOD_Init() fails, if the
+ * SOD has more entries.
+ *
+ * Allowed values: 32..65504, multiple of 32
+ * - if SOD_cfg_CHANGE_FEED == EPLS_k_DISABLE then EPLS_k_NOT_APPLICABLE
+ */
+#define SOD_cfg_MAX_CHANGE_ENTRIES 256
+
+/**
+ * Define to enable or disable the upload snapshots of the SOD
+ *
+ * If enabled, a segmented SSDO upload of a DOMAIN, VISIBLE STRING or OCTET STRING object with
+ * the attribute SOD_k_ATTR_SNAPSHOT reads the data of the object as it was at the start of the
+ * upload. The first write to the object via SOD_Write() or SOD_SegWrite() during the upload
+ * copies the old data into the snapshot buffer of the instance (copy on write), the remaining
+ * segments are read from this copy. Writes are not blocked by the upload.
+ *
+ * Allowed values: EPLS_k_ENABLE, EPLS_k_DISABLE
+ */
+#define SOD_cfg_SNAPSHOT           EPLS_k_DISABLE
+
+/**
+ * Size of the snapshot buffer of an instance in bytes, the maximum length of an object
+ * with the attribute SOD_k_ATTR_SNAPSHOT.
+ *
+ * Allowed values: 1..65535
+ * - if SOD_cfg_SNAPSHOT == EPLS_k_DISABLE then EPLS_k_NOT_APPLICABLE
+ */
+#define SOD_cfg_SNAPSHOT_LEN       1024
+
 /** @} */
 
 #endif
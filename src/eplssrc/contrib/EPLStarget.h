@@ -20,6 +20,7 @@
 #include <stdint.h>   /* include for the printf and sprintf function */
 #include <stdio.h>
 #include <string.h>  /* include for the memcpy and memcmp function */
+#include <time.h>    /* include for the clock function */
 
 //#pragma warning (disable : 4068) /* This pragma is used to avoid a compiler
 //                                    warning C4068: unknown pragma */
@@ -81,6 +82,17 @@
 #endif
 #define SAFE_NO_INIT_SEKTOR
 
+/**
+ * This symbol is used to align a variable to the start of a data cache line
+ * (EPLS_cfg_CACHE_LINE_SIZE). It is only needed if EPLS_cfg_ERROR_STAT_SNAPSHOT is enabled.
+ *
+ * E.g.: UINT32 adw_ctr[16] SAFE_NO_INIT_SEKTOR CACHE_LINE_ALIGNED;
+*/
+#ifdef CACHE_LINE_ALIGNED
+  #undef CACHE_LINE_ALIGNED
+#endif
+#define CACHE_LINE_ALIGNED __attribute__((aligned(EPLS_cfg_CACHE_LINE_SIZE)))
+
 /**
  * This define specifies, whether the target is big endian (see BIG) or little endian (see LITTLE).
  *
@@ -332,6 +344,40 @@ typedef char       CHAR;
 */
 #define MEMSET(dst, c, count) memset((void *)(dst), (int)(c), (size_t)(count))
 
+#ifdef MEMORY_BARRIER
+  #undef MEMORY_BARRIER
+#endif
+/**
+ * This macro is used to call the target specific full memory barrier. All memory accesses
+ * before the barrier are completed before any memory access after the barrier. It is only
+ * needed if SPDO_cfg_PROCESS_IMAGE, EPLS_cfg_ERROR_QUEUE or EPLS_cfg_ERROR_STAT_SNAPSHOT is enabled.
+*/
+#define MEMORY_BARRIER() __sync_synchronize()
+
+#ifdef BIT_SCAN_FORWARD
+  #undef BIT_SCAN_FORWARD
+#endif
+/**
+ * This macro returns the position (0..31) of the least significant set bit of a UINT32 value
+ * unequal 0, e.g. by the target specific bit scan or count trailing zeros instruction. It is
+ * only needed if SOD_cfg_CHANGE_FEED is enabled.
+*/
+#define BIT_SCAN_FORWARD(dw) ((UINT8)__builtin_ctz((unsigned int)(dw)))
+
+#ifdef SCFM_PROF_GET_TIME
+  #undef SCFM_PROF_GET_TIME
+#endif
+/**
+ * This macro is used to read a free running target specific time or cycle counter. The
+ * difference of two values must be the elapsed time, also if the counter overflowed. It is
+ * only needed if SCFM_cfg_PROFILING is enabled.
+*/
+#if defined(__i386__) || defined(__x86_64__)
+  #define SCFM_PROF_GET_TIME() ((UINT32)__builtin_ia32_rdtsc())
+#else
+  #define SCFM_PROF_GET_TIME() ((UINT32)clock())
+#endif
+
 /**
  * Gets a high 8-bit-value of an 16-bit-value dependent on the endianess of the target.
  *
@@ -0,0 +1,76 @@
+/**
+ * \file osadrbench/adrassign.c
+ * SPDOassign.c of the stack built with one of the SPDO address search methods
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osadrbench openSAFETY SPDO address search benchmark
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * The file is compiled once per method with ADRBENCH_METHOD set to
+ * ADRBENCH_LOOKUP, ADRBENCH_LINEAR or ADRBENCH_SORTED. The method replaces
+ * SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE and SPDO_cfg_SPDO_NUM_SORTED_TABLE of
+ * EPLScfg.h and SPDOassign.c is included unchanged. Its functions get the
+ * name of the method as prefix, so the three builds are linked into one
+ * executable. The SADR table is sized for every SN address.
+ */
+
+#include "adrbench.h"
+
+#undef SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE
+#undef SPDO_cfg_SPDO_NUM_SORTED_TABLE
+#undef SPDO_cfg_MAX_NO_RX_SPDO
+
+#define SPDO_cfg_MAX_NO_RX_SPDO ADRBENCH_MAX_ADR
+
+#if ( ADRBENCH_METHOD == ADRBENCH_LOOKUP )
+#define SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE EPLS_k_ENABLE
+#define SPDO_cfg_SPDO_NUM_SORTED_TABLE EPLS_k_DISABLE
+#define ADRBENCH_NAME(name) lookup##name
+#elif ( ADRBENCH_METHOD == ADRBENCH_LINEAR )
+#define SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE EPLS_k_DISABLE
+#define SPDO_cfg_SPDO_NUM_SORTED_TABLE EPLS_k_DISABLE
+#define ADRBENCH_NAME(name) linear##name
+#elif ( ADRBENCH_METHOD == ADRBENCH_SORTED )
+#define SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE EPLS_k_DISABLE
+#define SPDO_cfg_SPDO_NUM_SORTED_TABLE EPLS_k_ENABLE
+#define ADRBENCH_NAME(name) sorted##name
+#else
+#error ADRBENCH_METHOD is invalid
+#endif
+
+#define SPDO_InitAssign ADRBENCH_NAME(_InitAssign)
+#define SPDO_AddSAdr ADRBENCH_NAME(_AddSAdr)
+#define SPDO_AddTAdr ADRBENCH_NAME(_AddTAdr)
+#define SPDO_GetSpdoIdxForSAdr ADRBENCH_NAME(_GetSpdoIdxForSAdr)
+#define SPDO_GetSpdoIdxForTAdr ADRBENCH_NAME(_GetSpdoIdxForTAdr)
+#define SPDO_GetNoProcRxSpdo ADRBENCH_NAME(_GetNoProcRxSpdo)
+#define SPDO_GetNoProcTxSpdo ADRBENCH_NAME(_GetNoProcTxSpdo)
+
+#include "SPDOassign.c"
+
+const AdrMethod ADRBENCH_NAME(Method) =
+{
+#if ( ADRBENCH_METHOD == ADRBENCH_LOOKUP )
+    "lookup",
+#elif ( ADRBENCH_METHOD == ADRBENCH_LINEAR )
+    "linear",
+#else
+    "sorted",
+#endif
+    SPDO_InitAssign,
+    SPDO_AddSAdr,
+    SPDO_GetSpdoIdxForSAdr
+};
+
+/**
+ * \}
+ * \}
+ */
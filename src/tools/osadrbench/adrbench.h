@@ -0,0 +1,60 @@
+/**
+ * \file osadrbench/adrbench.h
+ * Interface of the SPDO address search methods of the stack
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osadrbench openSAFETY SPDO address search benchmark
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ */
+
+#ifndef _OSADRBENCH_ADRBENCH_H_
+#define _OSADRBENCH_ADRBENCH_H_
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+/** \brief Method of adrassign.c, 1024 entry lookup table */
+#define ADRBENCH_LOOKUP 1
+/** \brief Method of adrassign.c, linear search table */
+#define ADRBENCH_LINEAR 2
+/** \brief Method of adrassign.c, sorted search table with binary search */
+#define ADRBENCH_SORTED 3
+
+/** \brief Size of the SADR tables, every SN address can be configured */
+#define ADRBENCH_MAX_ADR 1023
+
+/** \brief SPDOassign.c built with one of the search methods */
+typedef struct
+{
+    /** name of the method */
+    const char * name;
+    /** SPDO_InitAssign() */
+    void (*initAssign)(BYTE_B_INSTNUM);
+    /** SPDO_AddSAdr() */
+    BOOLEAN (*addSAdr)(BYTE_B_INSTNUM_ UINT16 w_rxSpdoIdx, UINT16 w_sAdr);
+    /** SPDO_GetSpdoIdxForSAdr() */
+    UINT16 (*getSpdoIdxForSAdr)(BYTE_B_INSTNUM_ UINT16 w_sAdr);
+} AdrMethod;
+
+/** \brief SPDOassign.c with SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE */
+extern const AdrMethod lookupMethod;
+/** \brief SPDOassign.c without SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE and SPDO_cfg_SPDO_NUM_SORTED_TABLE */
+extern const AdrMethod linearMethod;
+/** \brief SPDOassign.c with SPDO_cfg_SPDO_NUM_SORTED_TABLE */
+extern const AdrMethod sortedMethod;
+
+#endif /* _OSADRBENCH_ADRBENCH_H_ */
+
+/**
+ * \}
+ * \}
+ */
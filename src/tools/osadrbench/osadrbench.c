@@ -0,0 +1,195 @@
+/**
+ * \file osadrbench/osadrbench.c
+ * Benchmark of the SPDO number assignment search methods
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osadrbench openSAFETY SPDO address search benchmark
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * Compares the three SN address to SPDO index search methods which can be
+ * selected in SPDOassign.c by SPDO_cfg_SPDO_NUM_LOOK_UP_TABLE and
+ * SPDO_cfg_SPDO_NUM_SORTED_TABLE: the 1024 entry lookup table, the linear
+ * search table and the sorted search table with binary search. SPDOassign.c
+ * of the stack is linked once per method (see adrassign.c), the tables are
+ * filled with SPDO_AddSAdr() and searched with SPDO_GetSpdoIdxForSAdr().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <getopt.h>
+
+#include "adrbench.h"
+
+/** \brief Highest SN address, same as EPLS_k_MAX_SADR */
+#define MAX_SADR 1023
+/** \brief Invalid SPDO index, same as k_INVALID_SPDO_NUM */
+#define INVALID_SPDO_NUM 0xFFFF
+
+void ParseOpt(int argc, char *argv[]);
+void help();
+
+/** \brief Loopback of the control flow monitoring */
+UINT32 SCFM_dw_PathProgress;
+
+/** \brief Number of configured addresses */
+unsigned long noAdr = 32;
+/** \brief Number of searches per method */
+unsigned long noSearch = 10000000;
+/** \brief Percentage of searched addresses which are not configured */
+unsigned long missRate = 10;
+
+/** \brief Configured addresses in configuration order */
+static uint16_t configAdr[MAX_SADR];
+/** \brief Addresses to be searched */
+static uint16_t * searchAdr;
+
+static void buildAddresses(void)
+{
+    static uint8_t used[MAX_SADR + 1];
+    unsigned long i;
+    uint16_t adr;
+
+    for ( i = 0; i < noAdr; i++ )
+    {
+        do
+        {
+            adr = (uint16_t)(1 + rand() % MAX_SADR);
+        } while ( used[adr] );
+
+        used[adr] = 1;
+        configAdr[i] = adr;
+    }
+
+    for ( i = 0; i < noSearch; i++ )
+    {
+        if ( noAdr == 0 || (unsigned long)(rand() % 100) < missRate )
+            searchAdr[i] = (uint16_t)(1 + rand() % MAX_SADR);
+        else
+            searchAdr[i] = configAdr[rand() % noAdr];
+    }
+}
+
+static int buildTable(const AdrMethod * method)
+{
+    unsigned long i;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    method->initAssign(B_INSTNUM);
+    for ( i = 0; i < noAdr; i++ )
+    {
+        if ( !method->addSAdr(B_INSTNUM_ (UINT16)i, configAdr[i]) )
+            return 0;
+    }
+    return 1;
+}
+
+static void runMethod(const AdrMethod * method)
+{
+    unsigned long i;
+    unsigned long found = 0;
+    clock_t start;
+    double seconds;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( !buildTable(method) )
+    {
+        printf("%-8s SPDO_AddSAdr failed\n", method->name);
+        return;
+    }
+
+    start = clock();
+    for ( i = 0; i < noSearch; i++ )
+    {
+        if ( method->getSpdoIdxForSAdr(B_INSTNUM_ searchAdr[i]) != INVALID_SPDO_NUM )
+            found++;
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%-8s %10.2f ns/search  %lu found\n", method->name,
+            seconds * 1e9 / (double)noSearch, found);
+}
+
+int main(int argc, char *argv[])
+{
+    ParseOpt(argc, argv);
+
+    searchAdr = (uint16_t *)malloc(noSearch * sizeof(uint16_t));
+    if ( searchAdr == NULL )
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    srand(1);
+    buildAddresses();
+
+    printf("%lu addresses, %lu searches, %lu%% not configured\n",
+            noAdr, noSearch, missRate);
+    runMethod(&lookupMethod);
+    runMethod(&linearMethod);
+    runMethod(&sortedMethod);
+
+    free(searchAdr);
+    return 0;
+}
+
+void ParseOpt(int argc, char *argv[])
+{
+    int c;
+
+    while ( ( c = getopt(argc, argv, "n:s:m:h") ) != -1 )
+    {
+        switch ( c )
+        {
+            case 'n':
+                noAdr = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                noSearch = strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                missRate = strtoul(optarg, NULL, 0);
+                break;
+            case 'h':
+            default:
+                help();
+                exit(0);
+        }
+    }
+
+    if ( noAdr > MAX_SADR || noSearch == 0 || missRate > 100 )
+    {
+        help();
+        exit(1);
+    }
+}
+
+void help()
+{
+    printf("Usage: osadrbench [-n addresses] [-s searches] [-m miss rate]\n\n");
+    printf("  -n    number of configured addresses, 0..%d (default: 32)\n", MAX_SADR);
+    printf("  -s    number of searches per method (default: 10000000)\n");
+    printf("  -m    percentage of searches for not configured addresses (default: 10)\n");
+    printf("  -h    this help\n");
+}
+
+/**
+ * \}
+ * \}
+ */
@@ -0,0 +1,200 @@
+/**
+ * \file osbench/benchsod.c
+ * Test SOD of the stack benchmarks
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osbench openSAFETY microbenchmark suite
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * Only the objects needed by SOD_Init(), SFS_Init(), SDN_Init() and the
+ * activation of the SPDOs are defined. The objects are sorted by index and
+ * sub-index as needed by the binary search of SOD_AttrGet().
+ */
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SODapi.h"
+#include "SPDOapi.h"
+
+#include "benchsod.h"
+
+/** \brief Attributes of a read only communication parameter */
+#define COMM_ATTR(type, len, def) { SOD_k_ATTR_RO, (type), (len), (def) }
+/** \brief Attributes of a mapping parameter, checked by the SPDO before it is written */
+#define MAPP_ATTR(type, len, def) { SOD_k_ATTR_RW | SOD_k_ATTR_BEF_WR, (type), (len), (def) }
+/** \brief Attributes of an object mapped into the Tx SPDO */
+#define TX_DATA_ATTR { SOD_k_ATTR_RO | SOD_k_ATTR_PDO_MAP, EPLS_k_UINT32, 4, &dataDef }
+/** \brief Attributes of an object mapped into the Rx SPDO */
+#define RX_DATA_ATTR { SOD_k_ATTR_RW | SOD_k_ATTR_PDO_MAP, EPLS_k_UINT32, 4, &dataDef }
+
+/** \brief Mapping entry of a UINT32 object, index, sub-index and length in bits */
+#define MAPP_ENTRY(idx, sub) ( ( (UINT32)(idx) << 16 ) | ( (UINT32)(sub) << 8 ) | 32u )
+
+/** \brief Default values of 0x1200, SDN and UDID of the SCM used to code the SPDOs */
+static const UINT16 sdnDef = BENCH_SOD_SDN;
+static const UINT8 scmUdidDef[EPLS_k_UDID_LEN] = { 0x00, 0x60, 0x65, 0x01, 0x02, 0x03 };
+
+/** \brief Default values of 0x1400 sub 0..12, the Rx SPDO is time synchronized once and is never timed out */
+static const UINT8 rxCommNoDef = 12u;
+static const UINT16 rxSadrDef = BENCH_SOD_RX_SADR;
+static const UINT16 rxSctDef = 1000u;
+static const UINT8 rxNoConsTReqDef = 1u;
+static const UINT32 rxTimeDelayTReqDef = 1000u;
+static const UINT32 rxTimeDelaySyncDef = 1000u;
+static const UINT16 rxMinTSyncPropDelayDef = 0u;
+static const UINT16 rxMaxTSyncPropDelayDef = BENCH_SOD_MAX_PROP_DELAY;
+static const UINT16 rxMinSpdoPropDelayDef = 0u;
+static const UINT16 rxMaxSpdoPropDelayDef = BENCH_SOD_MAX_PROP_DELAY;
+static const UINT16 rxBestCaseTResDelayDef = 0u;
+static const UINT32 rxTReqCycleDef = 10000u;
+static const UINT16 rxTxSpdoNoDef = 1u;
+
+/** \brief Default values of 0x1C00 sub 0..3 */
+static const UINT8 txCommNoDef = 3u;
+static const UINT16 txSadrDef = BENCH_SOD_TX_SADR;
+static const UINT16 txRefreshPrescaleDef = 1000u;
+static const UINT8 txNoTResDef = 1u;
+
+/** \brief Default value of 0x1800 sub 0 and 0xC000 sub 0, number of mapping entries */
+static const UINT8 mappNoDef = BENCH_SOD_NO_MAPP;
+
+/** \brief Default values of 0x1800 sub 1..8, mapping of the Rx SPDO */
+static const UINT32 rxMappDef[BENCH_SOD_NO_MAPP] =
+{
+    MAPP_ENTRY(BENCH_SOD_RX_DATA_IDX, 1), MAPP_ENTRY(BENCH_SOD_RX_DATA_IDX, 2),
+    MAPP_ENTRY(BENCH_SOD_RX_DATA_IDX, 3), MAPP_ENTRY(BENCH_SOD_RX_DATA_IDX, 4),
+    MAPP_ENTRY(BENCH_SOD_RX_DATA_IDX, 5), MAPP_ENTRY(BENCH_SOD_RX_DATA_IDX, 6),
+    MAPP_ENTRY(BENCH_SOD_RX_DATA_IDX, 7), MAPP_ENTRY(BENCH_SOD_RX_DATA_IDX, 8)
+};
+
+/** \brief Default values of 0xC000 sub 1..8, mapping of the Tx SPDO */
+static const UINT32 txMappDef[BENCH_SOD_NO_MAPP] =
+{
+    MAPP_ENTRY(BENCH_SOD_TX_DATA_IDX, 1), MAPP_ENTRY(BENCH_SOD_TX_DATA_IDX, 2),
+    MAPP_ENTRY(BENCH_SOD_TX_DATA_IDX, 3), MAPP_ENTRY(BENCH_SOD_TX_DATA_IDX, 4),
+    MAPP_ENTRY(BENCH_SOD_TX_DATA_IDX, 5), MAPP_ENTRY(BENCH_SOD_TX_DATA_IDX, 6),
+    MAPP_ENTRY(BENCH_SOD_TX_DATA_IDX, 7), MAPP_ENTRY(BENCH_SOD_TX_DATA_IDX, 8)
+};
+
+/** \brief Default value of the objects mapped into the SPDOs */
+static const UINT32 dataDef = 0x5AA5C33Cu;
+
+/** \brief Actual values of 0x1200 */
+static UINT16 sdn;
+static UINT8 scmUdid[EPLS_k_UDID_LEN];
+static SOD_t_ACT_LEN_PTR_DATA scmUdidObj = { EPLS_k_UDID_LEN, scmUdid };
+
+/** \brief Actual values of 0x1400 */
+static UINT8 rxCommNo;
+static UINT16 rxSadr;
+static UINT16 rxSct;
+static UINT8 rxNoConsTReq;
+static UINT32 rxTimeDelayTReq;
+static UINT32 rxTimeDelaySync;
+static UINT16 rxMinTSyncPropDelay;
+static UINT16 rxMaxTSyncPropDelay;
+static UINT16 rxMinSpdoPropDelay;
+static UINT16 rxMaxSpdoPropDelay;
+static UINT16 rxBestCaseTResDelay;
+static UINT32 rxTReqCycle;
+static UINT16 rxTxSpdoNo;
+
+/** \brief Actual values of 0x1C00 */
+static UINT8 txCommNo;
+static UINT16 txSadr;
+static UINT16 txRefreshPrescale;
+static UINT8 txNoTRes;
+
+/** \brief Actual values of 0x1800 and 0xC000 */
+static UINT8 rxMappNo;
+static UINT32 rxMapp[BENCH_SOD_NO_MAPP];
+static UINT8 txMappNo;
+static UINT32 txMapp[BENCH_SOD_NO_MAPP];
+
+/** \brief Actual values of 0x6000 and 0x6200, objects mapped into the Tx and the Rx SPDO */
+static UINT32 txData[BENCH_SOD_NO_MAPP];
+static UINT32 rxData[BENCH_SOD_NO_MAPP];
+
+/** \brief Test SOD, the actual values are set to the default values by SOD_Init() */
+static const SOD_t_OBJECT benchSod[] =
+{
+    { EPLS_k_IDX_COMMON_COM_PARAM, EPLS_k_SUBIDX_SDN, COMM_ATTR(EPLS_k_UINT16, 2, &sdnDef), &sdn, NULL, SOD_k_NO_CALLBACK },
+    { EPLS_k_IDX_COMMON_COM_PARAM, EPLS_k_SUBIDX_UDID_SCM, COMM_ATTR(EPLS_k_OCTET_STRING, EPLS_k_UDID_LEN, scmUdidDef), &scmUdidObj, NULL, SOD_k_NO_CALLBACK },
+
+    { 0x1400, 0, COMM_ATTR(EPLS_k_UINT8, 1, &rxCommNoDef), &rxCommNo, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 1, COMM_ATTR(EPLS_k_UINT16, 2, &rxSadrDef), &rxSadr, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 2, COMM_ATTR(EPLS_k_UINT16, 2, &rxSctDef), &rxSct, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 3, COMM_ATTR(EPLS_k_UINT8, 1, &rxNoConsTReqDef), &rxNoConsTReq, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 4, COMM_ATTR(EPLS_k_UINT32, 4, &rxTimeDelayTReqDef), &rxTimeDelayTReq, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 5, COMM_ATTR(EPLS_k_UINT32, 4, &rxTimeDelaySyncDef), &rxTimeDelaySync, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 6, COMM_ATTR(EPLS_k_UINT16, 2, &rxMinTSyncPropDelayDef), &rxMinTSyncPropDelay, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 7, COMM_ATTR(EPLS_k_UINT16, 2, &rxMaxTSyncPropDelayDef), &rxMaxTSyncPropDelay, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 8, COMM_ATTR(EPLS_k_UINT16, 2, &rxMinSpdoPropDelayDef), &rxMinSpdoPropDelay, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 9, COMM_ATTR(EPLS_k_UINT16, 2, &rxMaxSpdoPropDelayDef), &rxMaxSpdoPropDelay, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 10, COMM_ATTR(EPLS_k_UINT16, 2, &rxBestCaseTResDelayDef), &rxBestCaseTResDelay, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 11, COMM_ATTR(EPLS_k_UINT32, 4, &rxTReqCycleDef), &rxTReqCycle, NULL, SOD_k_NO_CALLBACK },
+    { 0x1400, 12, COMM_ATTR(EPLS_k_UINT16, 2, &rxTxSpdoNoDef), &rxTxSpdoNo, NULL, SOD_k_NO_CALLBACK },
+
+    { 0x1800, 0, MAPP_ATTR(EPLS_k_UINT8, 1, &mappNoDef), &rxMappNo, NULL, SPDO_SOD_RxMappPara_CLBK },
+    { 0x1800, 1, MAPP_ATTR(EPLS_k_UINT32, 4, &rxMappDef[0]), &rxMapp[0], NULL, SPDO_SOD_RxMappPara_CLBK },
+    { 0x1800, 2, MAPP_ATTR(EPLS_k_UINT32, 4, &rxMappDef[1]), &rxMapp[1], NULL, SPDO_SOD_RxMappPara_CLBK },
+    { 0x1800, 3, MAPP_ATTR(EPLS_k_UINT32, 4, &rxMappDef[2]), &rxMapp[2], NULL, SPDO_SOD_RxMappPara_CLBK },
+    { 0x1800, 4, MAPP_ATTR(EPLS_k_UINT32, 4, &rxMappDef[3]), &rxMapp[3], NULL, SPDO_SOD_RxMappPara_CLBK },
+    { 0x1800, 5, MAPP_ATTR(EPLS_k_UINT32, 4, &rxMappDef[4]), &rxMapp[4], NULL, SPDO_SOD_RxMappPara_CLBK },
+    { 0x1800, 6, MAPP_ATTR(EPLS_k_UINT32, 4, &rxMappDef[5]), &rxMapp[5], NULL, SPDO_SOD_RxMappPara_CLBK },
+    { 0x1800, 7, MAPP_ATTR(EPLS_k_UINT32, 4, &rxMappDef[6]), &rxMapp[6], NULL, SPDO_SOD_RxMappPara_CLBK },
+    { 0x1800, 8, MAPP_ATTR(EPLS_k_UINT32, 4, &rxMappDef[7]), &rxMapp[7], NULL, SPDO_SOD_RxMappPara_CLBK },
+
+    { 0x1C00, 0, COMM_ATTR(EPLS_k_UINT8, 1, &txCommNoDef), &txCommNo, NULL, SOD_k_NO_CALLBACK },
+    { 0x1C00, 1, COMM_ATTR(EPLS_k_UINT16, 2, &txSadrDef), &txSadr, NULL, SOD_k_NO_CALLBACK },
+    { 0x1C00, 2, COMM_ATTR(EPLS_k_UINT16, 2, &txRefreshPrescaleDef), &txRefreshPrescale, NULL, SOD_k_NO_CALLBACK },
+    { 0x1C00, 3, COMM_ATTR(EPLS_k_UINT8, 1, &txNoTResDef), &txNoTRes, NULL, SOD_k_NO_CALLBACK },
+
+    { BENCH_SOD_TX_DATA_IDX, 1, TX_DATA_ATTR, &txData[0], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_TX_DATA_IDX, 2, TX_DATA_ATTR, &txData[1], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_TX_DATA_IDX, 3, TX_DATA_ATTR, &txData[2], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_TX_DATA_IDX, 4, TX_DATA_ATTR, &txData[3], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_TX_DATA_IDX, 5, TX_DATA_ATTR, &txData[4], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_TX_DATA_IDX, 6, TX_DATA_ATTR, &txData[5], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_TX_DATA_IDX, 7, TX_DATA_ATTR, &txData[6], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_TX_DATA_IDX, 8, TX_DATA_ATTR, &txData[7], NULL, SOD_k_NO_CALLBACK },
+
+    { BENCH_SOD_RX_DATA_IDX, 1, RX_DATA_ATTR, &rxData[0], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_RX_DATA_IDX, 2, RX_DATA_ATTR, &rxData[1], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_RX_DATA_IDX, 3, RX_DATA_ATTR, &rxData[2], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_RX_DATA_IDX, 4, RX_DATA_ATTR, &rxData[3], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_RX_DATA_IDX, 5, RX_DATA_ATTR, &rxData[4], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_RX_DATA_IDX, 6, RX_DATA_ATTR, &rxData[5], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_RX_DATA_IDX, 7, RX_DATA_ATTR, &rxData[6], NULL, SOD_k_NO_CALLBACK },
+    { BENCH_SOD_RX_DATA_IDX, 8, RX_DATA_ATTR, &rxData[7], NULL, SOD_k_NO_CALLBACK },
+
+    { 0xC000, 0, MAPP_ATTR(EPLS_k_UINT8, 1, &mappNoDef), &txMappNo, NULL, SPDO_SOD_TxMappPara_CLBK },
+    { 0xC000, 1, MAPP_ATTR(EPLS_k_UINT32, 4, &txMappDef[0]), &txMapp[0], NULL, SPDO_SOD_TxMappPara_CLBK },
+    { 0xC000, 2, MAPP_ATTR(EPLS_k_UINT32, 4, &txMappDef[1]), &txMapp[1], NULL, SPDO_SOD_TxMappPara_CLBK },
+    { 0xC000, 3, MAPP_ATTR(EPLS_k_UINT32, 4, &txMappDef[2]), &txMapp[2], NULL, SPDO_SOD_TxMappPara_CLBK },
+    { 0xC000, 4, MAPP_ATTR(EPLS_k_UINT32, 4, &txMappDef[3]), &txMapp[3], NULL, SPDO_SOD_TxMappPara_CLBK },
+    { 0xC000, 5, MAPP_ATTR(EPLS_k_UINT32, 4, &txMappDef[4]), &txMapp[4], NULL, SPDO_SOD_TxMappPara_CLBK },
+    { 0xC000, 6, MAPP_ATTR(EPLS_k_UINT32, 4, &txMappDef[5]), &txMapp[5], NULL, SPDO_SOD_TxMappPara_CLBK },
+    { 0xC000, 7, MAPP_ATTR(EPLS_k_UINT32, 4, &txMappDef[6]), &txMapp[6], NULL, SPDO_SOD_TxMappPara_CLBK },
+    { 0xC000, 8, MAPP_ATTR(EPLS_k_UINT32, 4, &txMappDef[7]), &txMapp[7], NULL, SPDO_SOD_TxMappPara_CLBK },
+
+    { SOD_k_END_OF_THE_OD, 0, { 0, EPLS_k_BOOLEAN, 0, NULL }, NULL, NULL, SOD_k_NO_CALLBACK }
+};
+
+/** \brief SOD of the instances, used by SOD_Init() */
+const SOD_t_OBJECT * const SAPL_ps_OD[EPLS_cfg_MAX_INSTANCES] = { benchSod };
+
+/**
+ * \}
+ * \}
+ */
@@ -0,0 +1,51 @@
+/**
+ * \file osbench/benchsod.h
+ * Test SOD of the stack benchmarks
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osbench openSAFETY microbenchmark suite
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * The SOD configures one Tx SPDO and one Rx SPDO. Both map BENCH_SOD_NO_MAPP
+ * UINT32 objects, the Rx SPDO receives the Tx SPDO of the producer with the
+ * address BENCH_SOD_RX_SADR and sends its time request with the Tx SPDO.
+ */
+
+#ifndef _OSBENCH_BENCHSOD_H_
+#define _OSBENCH_BENCHSOD_H_
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+/** \brief SDN of the SN */
+#define BENCH_SOD_SDN 0x0001u
+/** \brief SADR of the Tx SPDO */
+#define BENCH_SOD_TX_SADR 0x0012u
+/** \brief SADR of the producer of the Rx SPDO */
+#define BENCH_SOD_RX_SADR 0x0020u
+/** \brief Number of objects mapped into each SPDO */
+#define BENCH_SOD_NO_MAPP 8u
+/** \brief Payload of each SPDO, UINT32 objects */
+#define BENCH_SOD_SPDO_LEN ( BENCH_SOD_NO_MAPP * 4u )
+/** \brief Index of the objects mapped into the Tx SPDO, sub-index 1..BENCH_SOD_NO_MAPP */
+#define BENCH_SOD_TX_DATA_IDX 0x6000u
+/** \brief Index of the objects mapped into the Rx SPDO, sub-index 1..BENCH_SOD_NO_MAPP */
+#define BENCH_SOD_RX_DATA_IDX 0x6200u
+/** \brief Maximum propagation delay of the time synchronization and of the SPDOs */
+#define BENCH_SOD_MAX_PROP_DELAY 100u
+
+#endif /* _OSBENCH_BENCHSOD_H_ */
+
+/**
+ * \}
+ * \}
+ */
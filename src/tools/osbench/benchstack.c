@@ -0,0 +1,464 @@
+/**
+ * \file osbench/benchstack.c
+ * Stack benchmarks of the openSAFETY microbenchmark suite
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osbench openSAFETY microbenchmark suite
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * Benchmarks of the frame serialization and deserialization, of the SOD access
+ * and of the SPDO processing of the stack. The SFS, SOD, SPDO, SDN, SERR and
+ * SCFM units are linked unchanged and are initialized once with the test SOD
+ * of benchsod.c. The SHNF and the SAPL are the loopback stubs shared with the
+ * unit tests (unittest/eplssrc/stubs): a transmitted frame stays in the memory
+ * block of the SHNF stub and the signaled errors are counted, every benchmark
+ * fails if an error was signaled.
+ */
+
+#include <string.h>
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+#include "SCFM.h"
+#include "SHNF.h"
+#include "SERRapi.h"
+#include "SERR.h"
+#include "SODapi.h"
+#include "SOD.h"
+#include "SDN.h"
+#include "SFS.h"
+#include "SFSint.h"
+#include "SPDOapi.h"
+#include "SPDO.h"
+#include "SPDOint.h"
+
+#include "TST_Stubs.h"
+
+#include "osbench.h"
+#include "benchsod.h"
+
+/** \brief Frame ID of SNMT_Service_Response */
+#define SNMT_SERV_RESP_ID 0x2Du
+/** \brief Consecutive time of the SN when the SPDOs are set to operational */
+#define STACK_CT_START 1000u
+/** \brief Consecutive time of the producer of the Rx SPDO at the time synchronization */
+#define STACK_CT_PROD 0x0100u
+/** \brief Number of received SPDOs, their consecutive times cover the 16 bit range */
+#define RX_SPDO_RING 4u
+/** \brief Difference of the consecutive times of two received SPDOs */
+#define RX_SPDO_CT_STEP 0x4000u
+
+/** \brief Initialization state of the stack, 0 not initialized, 1 initialized, -1 failed */
+static int stackState;
+
+/** \brief Header info of the transmitted frames */
+static EPLS_t_FRM_HDR txHdr;
+/** \brief Memory block of the transmitted frame, requested from the SHNF stub */
+static UINT8 * txFrame;
+/** \brief Serialized frame to be deserialized */
+static UINT8 rxFrameRef[TST_SHNF_MAX_FRAME_LEN];
+/** \brief Buffer of the received frame */
+static UINT8 rxFrame[TST_SHNF_MAX_FRAME_LEN];
+/** \brief Length of the serialized frame */
+static UINT16 rxFrameLen;
+
+/** \brief Handle of the SOD object accessed by sod_read and sod_write */
+static UINT32 sodHdl;
+/** \brief Application object flag of the SOD object accessed by sod_read and sod_write */
+static BOOLEAN sodAppObj;
+
+/** \brief Data only SPDOs received by spdo_rx */
+static UINT8 rxSpdoRef[RX_SPDO_RING][TST_SHNF_MAX_FRAME_LEN];
+/** \brief Length of the received SPDOs */
+static UINT16 rxSpdoLen;
+/** \brief Number of SPDOs received by spdo_rx */
+static unsigned long rxSpdoNo;
+
+static void setupHdr(UINT8 id, UINT8 le)
+{
+    txHdr.b_id = id;
+    txHdr.w_adr = BENCH_SOD_TX_SADR;
+    txHdr.w_sdn = BENCH_SOD_SDN;
+    txHdr.b_le = le;
+    txHdr.w_ct = 0x1234u;
+    txHdr.w_tadr = 0x0000u;
+    txHdr.b_tr = 0x00u;
+}
+
+/* Requests the memory block of a frame from the SHNF and fills the payload. */
+static BOOLEAN setupTxFrame(SHNF_t_TEL_TYPE telType, UINT8 le)
+{
+    UINT8 i;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    txFrame = SFS_GetMemBlock(B_INSTNUM_ telType, 0u, le);
+    if ( txFrame == NULL )
+        return FALSE;
+
+    for ( i = 0; i < le; i++ )
+        txFrame[SFS_k_FRM_DATA_OFFSET + i] = (UINT8)( 0xA5u + i );
+    return TRUE;
+}
+
+/* Serializes the frame of txHdr and copies it as received frame. The memory
+ * block holds sub frame TWO before sub frame ONE, a received frame starts
+ * with sub frame ONE. */
+static UINT16 receiveTxFrame(UINT8 * frame)
+{
+    UINT16 crcLen = ( txHdr.b_le > k_MAX_DATA_LEN_SHORT ) ? 2u : 1u;
+    UINT16 sub1Len = (UINT16)( k_SFRM1_HDR_LEN + txHdr.b_le + crcLen );
+    UINT16 sub2Len = (UINT16)( k_SFRM2_HDR_LEN + txHdr.b_le + crcLen );
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( !setupTxFrame(SHNF_k_SPDO, txHdr.b_le) ||
+         !SFS_FrmSerialize(B_INSTNUM_ &txHdr, txFrame) )
+        return 0;
+
+    memcpy(frame, &txFrame[sub2Len], sub1Len);
+    memcpy(&frame[sub1Len], txFrame, sub2Len);
+    return (UINT16)( sub1Len + sub2Len );
+}
+
+/* Activates both SPDOs of the test SOD and synchronizes the time of the Rx
+ * SPDO: the time request is sent by SPDO_BuildTxSpdo() and the time response
+ * is received one tick later. */
+static BOOLEAN setupStack(void)
+{
+    BOOLEAN o_busy = TRUE;
+    UINT8 b_noFreeFrm = 4u;
+    UINT16 len;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    TST_SAPL_ErrorReset();
+    SERR_Init();
+    SCFM_Init();
+
+    if ( !SOD_Init(B_INSTNUM) || !SFS_Init(B_INSTNUM) || !SDN_Init(B_INSTNUM) ||
+         !SPDO_Init(B_INSTNUM) )
+        return FALSE;
+
+    SPDO_ActivateStart(B_INSTNUM);
+    while ( o_busy )
+    {
+        if ( !SPDO_ActivateTxSpdoMapping(B_INSTNUM_ &o_busy) )
+            return FALSE;
+    }
+    o_busy = TRUE;
+    while ( o_busy )
+    {
+        if ( !SPDO_ActivateRxSpdoMapping(B_INSTNUM_ &o_busy) )
+            return FALSE;
+    }
+    SPDO_SetToOp(B_INSTNUM_ STACK_CT_START);
+
+    SPDO_BuildTxSpdo(B_INSTNUM_ STACK_CT_START, &b_noFreeFrm);
+
+    setupHdr(k_FRAME_ID_TRES | k_FRAME_BIT_CONN_VALID, BENCH_SOD_SPDO_LEN);
+    txHdr.w_adr = BENCH_SOD_RX_SADR;
+    txHdr.w_tadr = BENCH_SOD_TX_SADR;
+    txHdr.w_ct = STACK_CT_PROD;
+    len = receiveTxFrame(rxFrame);
+    if ( len == 0 )
+        return FALSE;
+    SPDO_ProcessRxSpdo(B_INSTNUM_ STACK_CT_START + 1u, rxFrame, len);
+
+    return ( TST_SAPL_ErrorCount() == 0 ) ? TRUE : FALSE;
+}
+
+static void initStack(void)
+{
+    if ( stackState == 0 )
+        stackState = setupStack() ? 1 : -1;
+}
+
+static unsigned long serialize(unsigned long count)
+{
+    unsigned long i;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( stackState != 1 || txFrame == NULL )
+        return 0;
+
+    TST_SAPL_ErrorReset();
+    for ( i = 0; i < count; i++ )
+    {
+        txHdr.w_ct = (UINT16)i;
+        if ( !SFS_FrmSerialize(B_INSTNUM_ &txHdr, txFrame) )
+            return 0;
+    }
+    return ( TST_SAPL_ErrorCount() == 0 ) ? (unsigned long)txFrame[0] + 1 : 0;
+}
+
+/* The frame is serialized once, every operation copies it into the receive
+ * buffer as the deserialization decodes sub frame TWO in place. */
+static void setupDeserialize(UINT8 id, UINT8 le)
+{
+    initStack();
+    setupHdr(id, le);
+    rxFrameLen = receiveTxFrame(rxFrameRef);
+}
+
+static unsigned long deserialize(unsigned long count)
+{
+    unsigned long i, sum = 0;
+    const UINT8 * data;
+    EPLS_t_FRM_HDR rxHdr;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( stackState != 1 || rxFrameLen == 0 )
+        return 0;
+
+    TST_SAPL_ErrorReset();
+    for ( i = 0; i < count; i++ )
+    {
+        memcpy(rxFrame, rxFrameRef, rxFrameLen);
+        data = SFS_FrmDeSerialize(B_INSTNUM_ rxFrame, rxFrameLen, &rxHdr);
+        if ( data == NULL )
+            return 0;
+        sum += data[0];
+    }
+    return ( TST_SAPL_ErrorCount() == 0 ) ? sum + 1 : 0;
+}
+
+static void setupSerSpdo8(void)
+{
+    initStack();
+    setupHdr(k_FRAME_ID_DATA_ONLY, 8u);
+    (void)setupTxFrame(SHNF_k_SPDO, 8u);
+}
+
+static void setupSerSpdo32(void)
+{
+    initStack();
+    setupHdr(k_FRAME_ID_DATA_ONLY, 32u);
+    (void)setupTxFrame(SHNF_k_SPDO, 32u);
+}
+
+static void setupSerSnmt(void)
+{
+    initStack();
+    setupHdr(SNMT_SERV_RESP_ID, 2u);
+    (void)setupTxFrame(SHNF_k_SNMT, 2u);
+}
+
+static void setupDeserSpdo8(void)
+{
+    setupDeserialize(k_FRAME_ID_DATA_ONLY, 8u);
+}
+
+static void setupDeserSpdo32(void)
+{
+    setupDeserialize(k_FRAME_ID_DATA_ONLY, 32u);
+}
+
+static unsigned long sodAttrGet(unsigned long count)
+{
+    unsigned long i, sum = 0;
+    const SOD_t_ATTR * attr;
+    UINT32 hdl;
+    BOOLEAN appObj;
+    SOD_t_ERROR_RESULT errRes;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( stackState != 1 )
+        return 0;
+
+    TST_SAPL_ErrorReset();
+    for ( i = 0; i < count; i++ )
+    {
+        attr = SOD_AttrGet(B_INSTNUM_ BENCH_SOD_TX_DATA_IDX,
+                (UINT8)( 1u + ( i % BENCH_SOD_NO_MAPP ) ), &hdl, &appObj, &errRes);
+        if ( attr == NULL )
+            return 0;
+        sum += attr->dw_objLen;
+    }
+    return ( TST_SAPL_ErrorCount() == 0 ) ? sum + 1 : 0;
+}
+
+/* The handle of the first object mapped into the Tx SPDO is searched once. */
+static void setupSodAccess(void)
+{
+    SOD_t_ERROR_RESULT errRes;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    initStack();
+    if ( SOD_AttrGet(B_INSTNUM_ BENCH_SOD_TX_DATA_IDX, 1u, &sodHdl, &sodAppObj, &errRes) == NULL )
+        sodHdl = 0u;
+}
+
+static unsigned long sodRead(unsigned long count)
+{
+    unsigned long i, sum = 0;
+    const UINT32 * data;
+    SOD_t_ERROR_RESULT errRes;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( stackState != 1 || sodHdl == 0u )
+        return 0;
+
+    TST_SAPL_ErrorReset();
+    for ( i = 0; i < count; i++ )
+    {
+        data = (const UINT32 *)SOD_Read(B_INSTNUM_ sodHdl, sodAppObj, SOD_k_NO_OFFSET,
+                SOD_k_LEN_NOT_NEEDED, &errRes);
+        if ( data == NULL )
+            return 0;
+        sum += *data & 0xFFu;
+    }
+    return ( TST_SAPL_ErrorCount() == 0 ) ? sum + 1 : 0;
+}
+
+/* The object is read only for the SSDO, the application overwrites it. */
+static unsigned long sodWrite(unsigned long count)
+{
+    unsigned long i;
+    UINT32 value;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( stackState != 1 || sodHdl == 0u )
+        return 0;
+
+    TST_SAPL_ErrorReset();
+    for ( i = 0; i < count; i++ )
+    {
+        value = (UINT32)i;
+        if ( !SOD_Write(B_INSTNUM_ sodHdl, sodAppObj, &value, TRUE, SOD_k_NO_OFFSET,
+                SOD_k_LEN_NOT_NEEDED) )
+            return 0;
+    }
+    return ( TST_SAPL_ErrorCount() == 0 ) ? count + 1 : 0;
+}
+
+static void setupSpdo(void)
+{
+    initStack();
+}
+
+static unsigned long spdoTxMapp(unsigned long count)
+{
+    unsigned long i, sum = 0;
+    const UINT8 * frame;
+    UINT8 len;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( stackState != 1 )
+        return 0;
+
+    TST_SAPL_ErrorReset();
+    for ( i = 0; i < count; i++ )
+    {
+        frame = SPDO_TxMappingProcess(B_INSTNUM_ 0u, &len);
+        if ( frame == NULL )
+            return 0;
+        sum += len;
+    }
+    return ( TST_SAPL_ErrorCount() == 0 ) ? sum + 1 : 0;
+}
+
+/* The consecutive time of the SN and of the producer advance by
+ * RX_SPDO_CT_STEP with every SPDO, so the 16 bit consecutive time of the
+ * ring of SPDOs stays valid and the propagation delay stays 1. The first SPDO
+ * after the time synchronization is only checked, it is received here. */
+static void setupSpdoRx(void)
+{
+    UINT16 k;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    initStack();
+    if ( stackState != 1 || rxSpdoLen != 0 )
+        return;
+
+    setupHdr(k_FRAME_ID_DATA_ONLY | k_FRAME_BIT_CONN_VALID, BENCH_SOD_SPDO_LEN);
+    txHdr.w_adr = BENCH_SOD_RX_SADR;
+    for ( k = 0; k < RX_SPDO_RING; k++ )
+    {
+        txHdr.w_ct = (UINT16)( STACK_CT_PROD + ( k + 1u ) * RX_SPDO_CT_STEP );
+        rxSpdoLen = receiveTxFrame(rxSpdoRef[k]);
+        if ( rxSpdoLen == 0 )
+            return;
+    }
+
+    memcpy(rxFrame, rxSpdoRef[0], rxSpdoLen);
+    SPDO_ProcessRxSpdo(B_INSTNUM_ STACK_CT_START + 1u + RX_SPDO_CT_STEP, rxFrame, rxSpdoLen);
+    rxSpdoNo = 1;
+}
+
+static unsigned long spdoRx(unsigned long count)
+{
+    unsigned long i;
+    UINT32 ct;
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    UINT8 b_instNum = 0u;
+#endif
+
+    if ( rxSpdoLen == 0 )
+        return 0;
+
+    TST_SAPL_ErrorReset();
+    for ( i = 0; i < count; i++ )
+    {
+        ct = (UINT32)( STACK_CT_START + 1u + ( rxSpdoNo + 1u ) * RX_SPDO_CT_STEP );
+        memcpy(rxFrame, rxSpdoRef[rxSpdoNo % RX_SPDO_RING], rxSpdoLen);
+        SPDO_ProcessRxSpdo(B_INSTNUM_ ct, rxFrame, rxSpdoLen);
+        rxSpdoNo++;
+    }
+    return ( TST_SAPL_ErrorCount() == 0 ) ? (unsigned long)rxFrame[0] + 1 : 0;
+}
+
+/** \brief Registry of the stack benchmarks */
+static const BenchEntry stackEntries[] =
+{
+    { "sfs_ser_spdo8", "SFS_FrmSerialize, SPDO with 8 byte payload", setupSerSpdo8, serialize },
+    { "sfs_ser_spdo32", "SFS_FrmSerialize, SPDO with 32 byte payload", setupSerSpdo32, serialize },
+    { "sfs_ser_snmt", "SFS_FrmSerialize, SNMT response with 2 byte payload", setupSerSnmt, serialize },
+    { "sfs_deser_spdo8", "SFS_FrmDeSerialize, SPDO with 8 byte payload", setupDeserSpdo8, deserialize },
+    { "sfs_deser_spdo32", "SFS_FrmDeSerialize, SPDO with 32 byte payload", setupDeserSpdo32, deserialize },
+    { "sod_attrget", "SOD_AttrGet, UINT32 object of the test SOD", setupSpdo, sodAttrGet },
+    { "sod_read", "SOD_Read, UINT32 object of the test SOD", setupSodAccess, sodRead },
+    { "sod_write", "SOD_Write, UINT32 object of the test SOD", setupSodAccess, sodWrite },
+    { "spdo_txmapp", "SPDO_TxMappingProcess, 8 UINT32 objects", setupSpdo, spdoTxMapp },
+    { "spdo_rx", "SPDO_ProcessRxSpdo, data only SPDO with 8 UINT32 objects", setupSpdoRx, spdoRx },
+};
+
+const BenchEntry * benchStackEntries(unsigned long * count)
+{
+    *count = sizeof(stackEntries) / sizeof(stackEntries[0]);
+    return stackEntries;
+}
+
+/**
+ * \}
+ * \}
+ */
@@ -0,0 +1,442 @@
+/**
+ * \file osbench/osbench.c
+ * openSAFETY microbenchmark suite
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osbench openSAFETY microbenchmark suite
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * Runs the registered benchmarks of liboschecksum and of the stack. Every
+ * benchmark is warmed up and then measured in a number of repetitions, the
+ * median of the repetitions is reported in ns/op and ops/s. The results can
+ * be written as JSON file, which can be used as baseline of a later run: the
+ * compare mode reports every benchmark which is slower than the baseline by
+ * more than the given threshold and returns with exit code 2.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <getopt.h>
+
+#include <oschecksum/crc.h>
+
+#include "osbench.h"
+
+/** \brief Maximum number of registered benchmarks */
+#define MAX_BENCH 64
+/** \brief Maximum number of repetitions */
+#define MAX_REPEAT 101
+/** \brief Number of subframes of the multi-buffer CRC benchmarks */
+#define MULTI_FRAMES 16
+/** \brief Longest subframe, 254 byte payload and 5 byte header */
+#define MAX_LEN 259
+
+void ParseOpt(int argc, char *argv[]);
+void help();
+
+/** \brief Number of operations per repetition */
+unsigned long noOps = 100000;
+/** \brief Number of measured repetitions */
+unsigned long noRepeat = 5;
+/** \brief Number of operations of the warm-up */
+unsigned long noWarmup = 10000;
+/** \brief Allowed slow down against the baseline in percent */
+double threshold = 10.0;
+/** \brief Only benchmarks containing this string are run */
+const char * filter = NULL;
+/** \brief JSON file for the results */
+const char * jsonFile = NULL;
+/** \brief JSON file with the baseline */
+const char * baselineFile = NULL;
+/** \brief Only list the benchmarks */
+int listOnly = 0;
+
+/** \brief Result of a benchmark */
+typedef struct
+{
+    const BenchEntry * entry;
+    /** median of the repetitions */
+    double nsPerOp;
+    /** fastest repetition */
+    double nsPerOpMin;
+} BenchResult;
+
+static BenchEntry benchList[MAX_BENCH];
+static unsigned long noBench = 0;
+static BenchResult results[MAX_BENCH];
+static unsigned long noResults = 0;
+
+static uint8_t frameData[MULTI_FRAMES * MAX_LEN];
+static const uint8_t * frameBuffer[MULTI_FRAMES];
+static uint32_t frameLen[MULTI_FRAMES];
+static uint8_t crc8[MULTI_FRAMES];
+static uint16_t crc16[MULTI_FRAMES];
+
+static void setupFrames(uint32_t len)
+{
+    unsigned long i, j;
+
+    srand(1);
+    for ( i = 0; i < MULTI_FRAMES; i++ )
+    {
+        frameLen[i] = len;
+        frameBuffer[i] = &frameData[i * MAX_LEN];
+        for ( j = 0; j < MAX_LEN; j++ )
+            frameData[i * MAX_LEN + j] = (uint8_t)rand();
+    }
+}
+
+static void setupShort(void)
+{
+    /* SPDO sub frame TWO with 8 byte payload */
+    setupFrames(13);
+}
+
+static void setupLong(void)
+{
+    /* SPDO sub frame TWO with 32 byte payload */
+    setupFrames(37);
+}
+
+static unsigned long runCrc8(unsigned long count)
+{
+    unsigned long i, sum = 1;
+
+    for ( i = 0; i < count; i++ )
+        sum += crc8Checksum(frameLen[0], frameBuffer[i % MULTI_FRAMES], 0);
+    return sum;
+}
+
+static unsigned long runCrc16(unsigned long count)
+{
+    unsigned long i, sum = 1;
+
+    for ( i = 0; i < count; i++ )
+        sum += crc16Checksum(frameLen[0], frameBuffer[i % MULTI_FRAMES], 0);
+    return sum;
+}
+
+static unsigned long runCrc16Slim(unsigned long count)
+{
+    unsigned long i, sum = 1;
+
+    for ( i = 0; i < count; i++ )
+        sum += crc16Checksum_AC9A(frameLen[0], frameBuffer[i % MULTI_FRAMES], 0);
+    return sum;
+}
+
+static unsigned long runCrc8Multi(unsigned long count)
+{
+    unsigned long i, sum = 1;
+
+    for ( i = 0; i < count; i++ )
+    {
+        crc8ChecksumMulti(MULTI_FRAMES, frameLen, frameBuffer, 0, crc8);
+        sum += crc8[0];
+    }
+    return sum;
+}
+
+static unsigned long runCrc16Multi(unsigned long count)
+{
+    unsigned long i, sum = 1;
+
+    for ( i = 0; i < count; i++ )
+    {
+        crc16ChecksumMulti(MULTI_FRAMES, frameLen, frameBuffer, 0, crc16);
+        sum += crc16[0];
+    }
+    return sum;
+}
+
+/** \brief Registry of the liboschecksum benchmarks */
+static const BenchEntry crcEntries[] =
+{
+    { "crc8", "crc8Checksum, 13 byte subframe", setupShort, runCrc8 },
+    { "crc16", "crc16Checksum, 37 byte subframe", setupLong, runCrc16 },
+    { "crc16_slim", "crc16Checksum_AC9A, 37 byte subframe", setupLong, runCrc16Slim },
+    { "crc8_multi16", "crc8ChecksumMulti, 16 subframes of 13 byte", setupShort, runCrc8Multi },
+    { "crc16_multi16", "crc16ChecksumMulti, 16 subframes of 37 byte", setupLong, runCrc16Multi },
+};
+
+static void registerEntries(const BenchEntry * entries, unsigned long count)
+{
+    unsigned long i;
+
+    for ( i = 0; i < count && noBench < MAX_BENCH; i++ )
+        benchList[noBench++] = entries[i];
+}
+
+static double timeNs(void)
+{
+#if defined(WIN32) || !defined(CLOCK_MONOTONIC)
+    return (double)clock() * 1e9 / CLOCKS_PER_SEC;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+static int compareDouble(const void * a, const void * b)
+{
+    double da = *(const double *)a, db = *(const double *)b;
+
+    return ( da > db ) - ( da < db );
+}
+
+static int runBench(const BenchEntry * entry, BenchResult * result)
+{
+    double times[MAX_REPEAT];
+    double start;
+    unsigned long i;
+
+    if ( entry->setup != NULL )
+        entry->setup();
+
+    if ( noWarmup > 0 && entry->run(noWarmup) == 0 )
+        return 0;
+
+    for ( i = 0; i < noRepeat; i++ )
+    {
+        start = timeNs();
+        if ( entry->run(noOps) == 0 )
+            return 0;
+        times[i] = ( timeNs() - start ) / (double)noOps;
+    }
+
+    qsort(times, noRepeat, sizeof(double), compareDouble);
+    result->entry = entry;
+    result->nsPerOp = times[noRepeat / 2];
+    result->nsPerOpMin = times[0];
+    return 1;
+}
+
+static int writeJson(const char * fileName)
+{
+    FILE * file;
+    unsigned long i;
+
+    file = fopen(fileName, "w");
+    if ( file == NULL )
+    {
+        fprintf(stderr, "Cannot write %s\n", fileName);
+        return 0;
+    }
+
+    fprintf(file, "{\n  \"ops\": %lu,\n  \"repetitions\": %lu,\n  \"benchmarks\": [\n",
+            noOps, noRepeat);
+    for ( i = 0; i < noResults; i++ )
+    {
+        fprintf(file, "    { \"name\": \"%s\", \"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, "
+                "\"ops_per_sec\": %.0f }%s\n", results[i].entry->name,
+                results[i].nsPerOp, results[i].nsPerOpMin, 1e9 / results[i].nsPerOp,
+                ( i + 1 < noResults ) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+    return 1;
+}
+
+/* Searches the ns_per_op value of a benchmark in the baseline, the JSON
+ * file is expected in the layout written by writeJson(). */
+static int baselineValue(const char * json, const char * name, double * value)
+{
+    char key[128];
+    const char * pos;
+
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+    pos = strstr(json, key);
+    if ( pos == NULL )
+        return 0;
+    pos = strstr(pos, "\"ns_per_op\":");
+    if ( pos == NULL )
+        return 0;
+    *value = strtod(pos + strlen("\"ns_per_op\":"), NULL);
+    return ( *value > 0.0 );
+}
+
+static int compareBaseline(const char * fileName)
+{
+    FILE * file;
+    char * json;
+    long size;
+    unsigned long i, noRegress = 0;
+    double base, delta;
+
+    file = fopen(fileName, "rb");
+    if ( file == NULL )
+    {
+        fprintf(stderr, "Cannot read %s\n", fileName);
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    json = (char *)malloc((size_t)size + 1);
+    if ( json == NULL || fread(json, 1, (size_t)size, file) != (size_t)size )
+    {
+        fprintf(stderr, "Cannot read %s\n", fileName);
+        free(json);
+        fclose(file);
+        return -1;
+    }
+    json[size] = '\0';
+    fclose(file);
+
+    printf("\n%-18s %12s %12s %9s\n", "benchmark", "baseline", "current", "delta");
+    for ( i = 0; i < noResults; i++ )
+    {
+        if ( !baselineValue(json, results[i].entry->name, &base) )
+        {
+            printf("%-18s %12s %9.2f ns %9s\n", results[i].entry->name, "-",
+                    results[i].nsPerOp, "new");
+            continue;
+        }
+        delta = ( results[i].nsPerOp - base ) * 100.0 / base;
+        printf("%-18s %9.2f ns %9.2f ns %+8.1f%%%s\n", results[i].entry->name, base,
+                results[i].nsPerOp, delta, ( delta > threshold ) ? "  REGRESSION" : "");
+        if ( delta > threshold )
+            noRegress++;
+    }
+    free(json);
+
+    if ( noRegress > 0 )
+        printf("\n%lu benchmark(s) slower than the baseline by more than %.1f%%\n",
+                noRegress, threshold);
+    return (int)noRegress;
+}
+
+int main(int argc, char *argv[])
+{
+    const BenchEntry * entries;
+    unsigned long i, count;
+    int ret = 0;
+
+    ParseOpt(argc, argv);
+
+    registerEntries(crcEntries, sizeof(crcEntries) / sizeof(crcEntries[0]));
+    entries = benchStackEntries(&count);
+    registerEntries(entries, count);
+
+    if ( listOnly )
+    {
+        for ( i = 0; i < noBench; i++ )
+            printf("%-18s %s\n", benchList[i].name, benchList[i].desc);
+        return 0;
+    }
+
+    printf("%lu ops per repetition, %lu repetitions, %lu warm-up ops\n\n",
+            noOps, noRepeat, noWarmup);
+    printf("%-18s %12s %12s %14s\n", "benchmark", "ns/op", "min ns/op", "ops/s");
+    for ( i = 0; i < noBench; i++ )
+    {
+        if ( filter != NULL && strstr(benchList[i].name, filter) == NULL )
+            continue;
+
+        if ( !runBench(&benchList[i], &results[noResults]) )
+        {
+            fprintf(stderr, "%s: operation failed\n", benchList[i].name);
+            ret = 1;
+            continue;
+        }
+        printf("%-18s %12.2f %12.2f %14.0f\n", benchList[i].name,
+                results[noResults].nsPerOp, results[noResults].nsPerOpMin,
+                1e9 / results[noResults].nsPerOp);
+        noResults++;
+    }
+
+    if ( jsonFile != NULL && !writeJson(jsonFile) )
+        ret = 1;
+
+    if ( baselineFile != NULL )
+    {
+        count = (unsigned long)compareBaseline(baselineFile);
+        if ( (int)count < 0 )
+            ret = 1;
+        else if ( count > 0 && ret == 0 )
+            ret = 2;
+    }
+
+    return ret;
+}
+
+void ParseOpt(int argc, char *argv[])
+{
+    int c;
+
+    while ( ( c = getopt(argc, argv, "n:r:w:f:o:c:t:lh") ) != -1 )
+    {
+        switch ( c )
+        {
+            case 'n':
+                noOps = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                noRepeat = strtoul(optarg, NULL, 0);
+                break;
+            case 'w':
+                noWarmup = strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                filter = optarg;
+                break;
+            case 'o':
+                jsonFile = optarg;
+                break;
+            case 'c':
+                baselineFile = optarg;
+                break;
+            case 't':
+                threshold = strtod(optarg, NULL);
+                break;
+            case 'l':
+                listOnly = 1;
+                break;
+            case 'h':
+            default:
+                help();
+                exit(0);
+        }
+    }
+
+    if ( noOps == 0 || noRepeat == 0 || noRepeat > MAX_REPEAT || threshold < 0.0 )
+    {
+        help();
+        exit(1);
+    }
+}
+
+void help()
+{
+    printf("Usage: osbench [-n ops] [-r repetitions] [-w warm-up ops] [-f filter]\n");
+    printf("               [-o result.json] [-c baseline.json] [-t threshold] [-l]\n\n");
+    printf("  -n    number of operations per repetition (default: 100000)\n");
+    printf("  -r    number of repetitions, the median is reported, up to %d (default: 5)\n", MAX_REPEAT);
+    printf("  -w    number of warm-up operations (default: 10000)\n");
+    printf("  -f    only run the benchmarks containing this string\n");
+    printf("  -o    write the results as JSON file\n");
+    printf("  -c    compare the results with a JSON file written by -o, returns 2\n");
+    printf("        if a benchmark is slower than the baseline by more than the threshold\n");
+    printf("  -t    allowed slow down against the baseline in percent (default: 10)\n");
+    printf("  -l    list the benchmarks\n");
+    printf("  -h    this help\n");
+}
+
+/**
+ * \}
+ * \}
+ */
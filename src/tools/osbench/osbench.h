@@ -0,0 +1,54 @@
+/**
+ * \file osbench/osbench.h
+ * Benchmark registry of the openSAFETY microbenchmark suite
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osbench openSAFETY microbenchmark suite
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ */
+
+#ifndef _OSBENCH_H_
+#define _OSBENCH_H_
+
+#include <stdint.h>
+
+/** \brief Entry of the benchmark registry */
+typedef struct
+{
+    /** Name of the benchmark, used for the selection and the baseline */
+    const char * name;
+    /** Short description of one operation */
+    const char * desc;
+    /** Prepares the data of the benchmark, may be NULL */
+    void (*setup)(void);
+    /**
+     * Executes the operation count times and returns a value depending on
+     * the results, so that the compiler can not remove the operations.
+     * Returns 0 if an operation failed.
+     */
+    unsigned long (*run)(unsigned long count);
+} BenchEntry;
+
+/**
+ * \brief Provides the benchmarks which call the openSAFETY stack
+ *
+ * \param count number of benchmarks, returned
+ *
+ * \return the stack benchmarks
+ */
+const BenchEntry * benchStackEntries(unsigned long * count);
+
+#endif /* _OSBENCH_H_ */
+
+/**
+ * \}
+ * \}
+ */
@@ -0,0 +1,193 @@
+/**
+ * \file oscapture/capture.c
+ * Writing and reading of capture files
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oscapture
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <oscapture/capture.h>
+
+/** \brief Length of the file header */
+#define HEADER_LEN 12
+/** \brief Longest LEB128 encoding of a 32 bit value */
+#define MAX_VARINT_LEN 5
+
+static const uint8_t magic[4] = { 'O', 'S', 'C', 'P' };
+
+struct oscapFile
+{
+    FILE * file;
+    uint32_t ctUnitNs;
+    uint32_t lastCt;
+    int error;
+    uint8_t frame[OSCAP_MAX_FRAME_LEN];
+};
+
+static int putVarint(uint8_t * buffer, uint32_t value)
+{
+    int len = 0;
+
+    while ( value >= 0x80 )
+    {
+        buffer[len++] = (uint8_t)( value | 0x80 );
+        value >>= 7;
+    }
+    buffer[len++] = (uint8_t)value;
+    return len;
+}
+
+static int getVarint(FILE * file, uint32_t * value)
+{
+    int i, c;
+
+    *value = 0;
+    for ( i = 0; i < MAX_VARINT_LEN; i++ )
+    {
+        if ( ( c = fgetc(file) ) == EOF )
+            return -1;
+        *value |= (uint32_t)( c & 0x7F ) << ( 7 * i );
+        if ( ( c & 0x80 ) == 0 )
+            return 0;
+    }
+    return -1;
+}
+
+oscapFile * oscapCreate(const char * path, uint32_t ctUnitNs)
+{
+    oscapFile * cap;
+    uint8_t header[HEADER_LEN];
+
+    cap = (oscapFile *)calloc(1, sizeof(oscapFile));
+    if ( cap == NULL )
+        return NULL;
+
+    cap->file = fopen(path, "wb");
+    if ( cap->file == NULL )
+    {
+        free(cap);
+        return NULL;
+    }
+    cap->ctUnitNs = ctUnitNs;
+
+    memset(header, 0, sizeof(header));
+    memcpy(header, magic, sizeof(magic));
+    header[4] = OSCAP_VERSION;
+    header[8] = (uint8_t)ctUnitNs;
+    header[9] = (uint8_t)( ctUnitNs >> 8 );
+    header[10] = (uint8_t)( ctUnitNs >> 16 );
+    header[11] = (uint8_t)( ctUnitNs >> 24 );
+    if ( fwrite(header, 1, sizeof(header), cap->file) != sizeof(header) )
+        cap->error = 1;
+
+    return cap;
+}
+
+int oscapWrite(oscapFile * cap, uint8_t dir, uint8_t instNum,
+        uint32_t ct, const uint8_t * frame, uint16_t len)
+{
+    uint8_t head[2 + 2 * MAX_VARINT_LEN];
+    int headLen;
+
+    if ( cap == NULL || frame == NULL || len > OSCAP_MAX_FRAME_LEN ||
+         ( dir != OSCAP_DIR_RX && dir != OSCAP_DIR_TX ) )
+        return -1;
+
+    head[0] = dir;
+    head[1] = instNum;
+    headLen = 2;
+    /* the difference also covers a wrap-around of the consecutive time */
+    headLen += putVarint(&head[headLen], (uint32_t)( ct - cap->lastCt ));
+    headLen += putVarint(&head[headLen], len);
+    cap->lastCt = ct;
+
+    if ( fwrite(head, 1, (size_t)headLen, cap->file) != (size_t)headLen ||
+         fwrite(frame, 1, len, cap->file) != len )
+    {
+        cap->error = 1;
+        return -1;
+    }
+    return 0;
+}
+
+oscapFile * oscapOpen(const char * path)
+{
+    oscapFile * cap;
+    uint8_t header[HEADER_LEN];
+
+    cap = (oscapFile *)calloc(1, sizeof(oscapFile));
+    if ( cap == NULL )
+        return NULL;
+
+    cap->file = fopen(path, "rb");
+    if ( cap->file == NULL ||
+         fread(header, 1, sizeof(header), cap->file) != sizeof(header) ||
+         memcmp(header, magic, sizeof(magic)) != 0 || header[4] != OSCAP_VERSION )
+    {
+        if ( cap->file != NULL )
+            fclose(cap->file);
+        free(cap);
+        return NULL;
+    }
+    cap->ctUnitNs = (uint32_t)header[8] | ( (uint32_t)header[9] << 8 ) |
+            ( (uint32_t)header[10] << 16 ) | ( (uint32_t)header[11] << 24 );
+
+    return cap;
+}
+
+uint32_t oscapCtUnit(const oscapFile * cap)
+{
+    return cap->ctUnitNs;
+}
+
+int oscapRead(oscapFile * cap, oscapRecord * rec)
+{
+    int dir, instNum;
+    uint32_t delta, len;
+
+    if ( ( dir = fgetc(cap->file) ) == EOF )
+        return 0;
+    if ( ( instNum = fgetc(cap->file) ) == EOF ||
+         getVarint(cap->file, &delta) != 0 || getVarint(cap->file, &len) != 0 ||
+         ( dir != OSCAP_DIR_RX && dir != OSCAP_DIR_TX ) || len > OSCAP_MAX_FRAME_LEN ||
+         fread(cap->frame, 1, len, cap->file) != len )
+        return -1;
+
+    cap->lastCt += delta;
+    rec->dir = (uint8_t)dir;
+    rec->instNum = (uint8_t)instNum;
+    rec->len = (uint16_t)len;
+    rec->ct = cap->lastCt;
+    rec->frame = cap->frame;
+    return 1;
+}
+
+int oscapClose(oscapFile * cap)
+{
+    int result;
+
+    if ( cap == NULL )
+        return -1;
+
+    result = ( fclose(cap->file) != 0 || cap->error ) ? -1 : 0;
+    free(cap);
+    return result;
+}
+
+/**
+ * \}
+ * \}
+ */
@@ -0,0 +1,252 @@
+/**
+ * \file capture.h
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oscapture
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * Capture of the openSAFETY frames exchanged between the SHNF and the stack,
+ * and deterministic replay of such a capture.
+ *
+ * The SHNF records every received frame before it is passed to
+ * SPDO_ProcessRxSpdo() or SSC_ProcessSNMTSSDOFrame() and every frame marked
+ * with SHNF_MarkTxMemBlock(), together with the consecutive time of the
+ * call, the instance number and the direction.
+ *
+ * The replay feeds the received frames of a capture back into the stack,
+ * either as fast as possible or paced by the recorded consecutive time. The
+ * SHNF of the replay build passes every transmitted frame to oscapReplayTx(),
+ * which compares it with the next recorded frame of the instance.
+ *
+ * Capture file layout, all numbers little endian:
+ * - header: "OSCP", version (1 byte), 3 reserved bytes, time unit of the
+ *   consecutive time in ns (4 byte, 0 if unknown)
+ * - records: direction (1 byte), instance number (1 byte), consecutive time
+ *   difference to the previous record and frame length (both unsigned LEB128),
+ *   frame data
+ */
+
+#ifndef _LIBOSCAPTURE_CAPTURE_H_
+#define _LIBOSCAPTURE_CAPTURE_H_
+
+#include <stdint.h>
+
+#if defined (_WIN32)
+  #if defined(oscapture_EXPORTS)
+/** \brief Defines the export definition for the shared library */
+    #define  OSCAPTURE_EXPORT extern __declspec(dllexport)
+  #else
+/** \brief Defines the export definition for the shared library */
+    #define  OSCAPTURE_EXPORT extern __declspec(dllimport)
+  #endif /* oscapture_EXPORTS */
+#else /* defined (_WIN32) */
+/** \brief Defines the export definition for the shared library */
+ #define OSCAPTURE_EXPORT extern
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Version of the capture file layout */
+#define OSCAP_VERSION 1
+
+/** \brief Frame received by the stack */
+#define OSCAP_DIR_RX 0
+/** \brief Frame transmitted by the stack */
+#define OSCAP_DIR_TX 1
+
+/** \brief Longest openSAFETY frame, two sub frames with 254 byte payload and CRC16 */
+#define OSCAP_MAX_FRAME_LEN 523
+
+/** \brief Capture file, opened for writing or reading */
+typedef struct oscapFile oscapFile;
+
+/** \brief One record of a capture file */
+typedef struct
+{
+    /** \brief OSCAP_DIR_RX or OSCAP_DIR_TX */
+    uint8_t dir;
+    /** \brief instance number */
+    uint8_t instNum;
+    /** \brief frame length */
+    uint16_t len;
+    /** \brief consecutive time */
+    uint32_t ct;
+    /** \brief frame data, valid until the next call of oscapRead() */
+    const uint8_t * frame;
+} oscapRecord;
+
+/**
+ * \brief Creates a capture file
+ *
+ * \param path name of the file, an existing file is overwritten
+ * \param ctUnitNs time unit of the consecutive time in ns, 0 if unknown.
+ *   Paced replay requires the time unit.
+ *
+ * \return the capture or NULL if the file cannot be created
+ */
+OSCAPTURE_EXPORT oscapFile * oscapCreate(const char * path, uint32_t ctUnitNs);
+
+/**
+ * \brief Appends a frame to a capture created with oscapCreate
+ *
+ * \param cap the capture
+ * \param dir OSCAP_DIR_RX or OSCAP_DIR_TX
+ * \param instNum instance number
+ * \param ct consecutive time of the frame
+ * \param frame the frame, received frames with sub frame ONE first, transmitted
+ *   frames as passed to SHNF_MarkTxMemBlock() with sub frame TWO first
+ * \param len frame length, up to OSCAP_MAX_FRAME_LEN
+ *
+ * \return 0 on success, -1 on an invalid argument or a write error
+ */
+OSCAPTURE_EXPORT int oscapWrite(oscapFile * cap, uint8_t dir, uint8_t instNum,
+        uint32_t ct, const uint8_t * frame, uint16_t len);
+
+/**
+ * \brief Opens a capture file for reading
+ *
+ * \param path name of the file
+ *
+ * \return the capture or NULL if the file cannot be opened or is no capture
+ */
+OSCAPTURE_EXPORT oscapFile * oscapOpen(const char * path);
+
+/**
+ * \brief Returns the time unit of the consecutive time in ns
+ *
+ * \param cap the capture
+ *
+ * \return time unit in ns, 0 if unknown
+ */
+OSCAPTURE_EXPORT uint32_t oscapCtUnit(const oscapFile * cap);
+
+/**
+ * \brief Reads the next record of a capture opened with oscapOpen
+ *
+ * \param cap the capture
+ * \param rec the record to be filled
+ *
+ * \return 1 if a record was read, 0 at the end of the file, -1 on a corrupt file
+ */
+OSCAPTURE_EXPORT int oscapRead(oscapFile * cap, oscapRecord * rec);
+
+/**
+ * \brief Closes a capture and frees its memory
+ *
+ * \param cap the capture
+ *
+ * \return 0 on success, -1 if the capture could not be written completely
+ */
+OSCAPTURE_EXPORT int oscapClose(oscapFile * cap);
+
+/** \brief Capture loaded for replay */
+typedef struct oscapReplay oscapReplay;
+
+/** \brief Stack entry points called by oscapReplayRun */
+typedef struct
+{
+    /**
+     * \brief Called before every received frame with its consecutive time,
+     * e.g. to call SPDO_BuildTxSpdo() and SPDO_CheckRxTimeout() of the
+     * instance. May be NULL.
+     */
+    void (*cycle)(void * ctx, uint8_t instNum, uint32_t ct);
+    /** \brief Passes a received SPDO to SPDO_ProcessRxSpdo() */
+    void (*rxSpdo)(void * ctx, uint8_t instNum, uint32_t ct,
+            const uint8_t * frame, uint16_t len);
+    /**
+     * \brief Passes a received SNMT or SSDO frame to SSC_ProcessSNMTSSDOFrame().
+     * Returns non-zero for SSC_k_BUSY, the function is then called again with
+     * a NULL frame.
+     */
+    int (*rxSnmtSsdo)(void * ctx, uint8_t instNum, uint32_t ct,
+            const uint8_t * frame, uint16_t len);
+} oscapReplayOps;
+
+/** \brief Result of oscapReplayRun */
+typedef struct
+{
+    /** \brief received frames passed to the stack */
+    unsigned long rxFrames;
+    /** \brief frames passed to oscapReplayTx */
+    unsigned long txFrames;
+    /** \brief transmitted frames different from the recorded frame */
+    unsigned long txMismatch;
+    /** \brief recorded transmitted frames which were not transmitted */
+    unsigned long txMissing;
+    /** \brief transmitted frames without a recorded frame */
+    unsigned long txExtra;
+    /** \brief wall clock time of the replay */
+    double seconds;
+} oscapReplayStats;
+
+/**
+ * \brief Loads a capture file for replay
+ *
+ * \param path name of the file
+ *
+ * \return the loaded capture or NULL if the file cannot be read
+ */
+OSCAPTURE_EXPORT oscapReplay * oscapReplayLoad(const char * path);
+
+/**
+ * \brief Feeds the received frames of a capture into the stack
+ *
+ * SPDOs are passed to ops->rxSpdo, all other frames to ops->rxSnmtSsdo, the
+ * instance number and the consecutive time are the recorded ones. The
+ * transmitted frames are verified by oscapReplayTx.
+ *
+ * \param rp the loaded capture
+ * \param ops the stack entry points
+ * \param ctx passed to the entry points
+ * \param paced 0 to replay as fast as possible, otherwise the frames are passed
+ *   at the recorded times
+ * \param stats filled with the result
+ *
+ * \return 0 if all transmitted frames match the capture, 1 if not, -1 if the
+ *   capture cannot be replayed paced because the time unit is unknown
+ */
+OSCAPTURE_EXPORT int oscapReplayRun(oscapReplay * rp, const oscapReplayOps * ops,
+        void * ctx, int paced, oscapReplayStats * stats);
+
+/**
+ * \brief Verifies a frame transmitted during oscapReplayRun
+ *
+ * To be called by SHNF_MarkTxMemBlock() of the replay build. The frame is
+ * compared with the next recorded transmitted frame of the instance.
+ *
+ * \param rp the loaded capture
+ * \param instNum instance number
+ * \param frame the frame with sub frame TWO first
+ * \param len frame length
+ */
+OSCAPTURE_EXPORT void oscapReplayTx(oscapReplay * rp, uint8_t instNum,
+        const uint8_t * frame, uint16_t len);
+
+/**
+ * \brief Frees a capture loaded with oscapReplayLoad
+ *
+ * \param rp the loaded capture
+ */
+OSCAPTURE_EXPORT void oscapReplayFree(oscapReplay * rp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LIBOSCAPTURE_CAPTURE_H_ */
+
+/**
+ * \}
+ * \}
+ */
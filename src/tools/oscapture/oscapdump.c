@@ -0,0 +1,227 @@
+/**
+ * \file oscapture/oscapdump.c
+ * Display and comparison of capture files
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oscapture openSAFETY frame capture
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * Prints the number of frames, bytes and the consecutive time range per
+ * instance and direction of a capture file. With -v every frame is printed.
+ * With -c the transmitted frames of a second capture, e.g. recorded during a
+ * replay, are compared per instance with the first one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <getopt.h>
+
+#include <oscapture/capture.h>
+
+/** \brief Number of possible instance numbers */
+#define MAX_INSTANCES 256
+
+void ParseOpt(int argc, char *argv[]);
+void help();
+
+/** \brief Name of the capture file */
+char * capFile = NULL;
+/** \brief Name of the capture file to compare with */
+char * cmpFile = NULL;
+/** \brief Print every frame */
+int verbose = 0;
+
+typedef struct
+{
+    unsigned long frames;
+    unsigned long bytes;
+    uint32_t firstCt;
+    uint32_t lastCt;
+} dirSummary;
+
+static dirSummary summary[MAX_INSTANCES][2];
+
+static void printFrame(const oscapRecord * rec)
+{
+    uint16_t i;
+
+    printf("%10lu %3u %s %3u ", (unsigned long)rec->ct, rec->instNum,
+            rec->dir == OSCAP_DIR_RX ? "rx" : "tx", rec->len);
+    for ( i = 0; i < rec->len; i++ )
+        printf(" %02x", rec->frame[i]);
+    printf("\n");
+}
+
+static int dump(void)
+{
+    oscapFile * cap;
+    oscapRecord rec;
+    dirSummary * sum;
+    int result, i, dir;
+
+    cap = oscapOpen(capFile);
+    if ( cap == NULL )
+    {
+        fprintf(stderr, "%s is no capture file\n", capFile);
+        return 1;
+    }
+
+    printf("%s: time unit %lu ns\n", capFile, (unsigned long)oscapCtUnit(cap));
+    while ( ( result = oscapRead(cap, &rec) ) == 1 )
+    {
+        if ( verbose )
+            printFrame(&rec);
+
+        sum = &summary[rec.instNum][rec.dir];
+        if ( sum->frames == 0 )
+            sum->firstCt = rec.ct;
+        sum->lastCt = rec.ct;
+        sum->frames++;
+        sum->bytes += rec.len;
+    }
+    oscapClose(cap);
+
+    for ( i = 0; i < MAX_INSTANCES; i++ )
+    {
+        for ( dir = OSCAP_DIR_RX; dir <= OSCAP_DIR_TX; dir++ )
+        {
+            sum = &summary[i][dir];
+            if ( sum->frames > 0 )
+                printf("instance %3d %s %10lu frames %12lu byte  ct %lu..%lu\n", i,
+                        dir == OSCAP_DIR_RX ? "rx" : "tx", sum->frames, sum->bytes,
+                        (unsigned long)sum->firstCt, (unsigned long)sum->lastCt);
+        }
+    }
+
+    if ( result != 0 )
+    {
+        fprintf(stderr, "%s is corrupt\n", capFile);
+        return 1;
+    }
+    return 0;
+}
+
+/* reads the next transmitted frame of the instance, returns 0 at the end */
+static int nextTx(oscapFile * cap, uint8_t instNum, oscapRecord * rec)
+{
+    int result;
+
+    while ( ( result = oscapRead(cap, rec) ) == 1 )
+    {
+        if ( rec->dir == OSCAP_DIR_TX && rec->instNum == instNum )
+            break;
+    }
+    return result == 1;
+}
+
+static int compare(void)
+{
+    oscapFile * capA, * capB;
+    oscapRecord recA, recB;
+    unsigned long frame, differ = 0;
+    int i, moreA, moreB;
+
+    for ( i = 0; i < MAX_INSTANCES; i++ )
+    {
+        if ( summary[i][OSCAP_DIR_TX].frames == 0 )
+            continue;
+
+        capA = oscapOpen(capFile);
+        capB = oscapOpen(cmpFile);
+        if ( capA == NULL || capB == NULL )
+        {
+            fprintf(stderr, "%s is no capture file\n", capA == NULL ? capFile : cmpFile);
+            return 1;
+        }
+
+        frame = 0;
+        do
+        {
+            moreA = nextTx(capA, (uint8_t)i, &recA);
+            moreB = nextTx(capB, (uint8_t)i, &recB);
+            if ( moreA != moreB || ( moreA &&
+                 ( recA.len != recB.len || memcmp(recA.frame, recB.frame, recA.len) != 0 ) ) )
+            {
+                printf("instance %d: tx frame %lu differs\n", i, frame);
+                if ( moreA )
+                    printFrame(&recA);
+                if ( moreB )
+                    printFrame(&recB);
+                differ++;
+                break;
+            }
+            frame++;
+        } while ( moreA );
+
+        oscapClose(capA);
+        oscapClose(capB);
+    }
+
+    printf("%s: tx frames %s\n", cmpFile, differ ? "differ" : "match");
+    return differ ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int result;
+
+    ParseOpt(argc, argv);
+
+    result = dump();
+    if ( result == 0 && cmpFile != NULL )
+        result = compare();
+    return result;
+}
+
+void ParseOpt(int argc, char *argv[])
+{
+    int c;
+
+    while ( ( c = getopt(argc, argv, "c:vh") ) != -1 )
+    {
+        switch ( c )
+        {
+            case 'c':
+                cmpFile = optarg;
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case 'h':
+            default:
+                help();
+                exit(0);
+        }
+    }
+
+    if ( optind != argc - 1 )
+    {
+        help();
+        exit(1);
+    }
+    capFile = argv[optind];
+}
+
+void help()
+{
+    printf("Usage: oscapdump [-v] [-c capture] capture\n\n");
+    printf("  -v    print every frame\n");
+    printf("  -c    compare the transmitted frames with this capture\n");
+    printf("  -h    this help\n");
+}
+
+/**
+ * \}
+ * \}
+ */
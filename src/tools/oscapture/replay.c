@@ -0,0 +1,256 @@
+/**
+ * \file oscapture/replay.c
+ * Deterministic replay of a capture file
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oscapture
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * The whole capture is loaded into memory, so that the replay itself does not
+ * wait for the file system. The transmitted frames are verified per instance
+ * in the recorded order, the order between the instances is not verified.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include <oscapture/capture.h>
+
+/** \brief Number of possible instance numbers */
+#define MAX_INSTANCES 256
+
+/** \brief Mask of the frame type in the frame ID */
+#define FRAME_TYPE_MASK 0x38
+/** \brief Frame type SPDO */
+#define FRAME_TYPE_SPDO 0x30
+
+typedef struct
+{
+    uint8_t dir;
+    uint8_t instNum;
+    uint16_t len;
+    uint32_t ct;
+    /* recorded time relative to the first record, without wrap-around */
+    uint64_t time;
+    /* offset of the frame in the data buffer */
+    size_t offset;
+    /* index of the next transmitted frame of the instance */
+    unsigned long txNext;
+} replayRecord;
+
+struct oscapReplay
+{
+    uint32_t ctUnitNs;
+    unsigned long noRecords;
+    replayRecord * records;
+    uint8_t * data;
+    /* index of the first transmitted frame per instance */
+    unsigned long txFirst[MAX_INSTANCES];
+    /* index of the next expected transmitted frame per instance */
+    unsigned long txNext[MAX_INSTANCES];
+    oscapReplayStats * stats;
+};
+
+static double now(void)
+{
+#if defined (_WIN32)
+    LARGE_INTEGER counter, frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+oscapReplay * oscapReplayLoad(const char * path)
+{
+    oscapFile * cap;
+    oscapReplay * rp;
+    oscapRecord rec;
+    unsigned long size = 0, maxRecords = 0, maxData = 0, i;
+    uint64_t time = 0;
+    int result;
+    void * p;
+
+    cap = oscapOpen(path);
+    if ( cap == NULL )
+        return NULL;
+
+    rp = (oscapReplay *)calloc(1, sizeof(oscapReplay));
+    if ( rp == NULL )
+    {
+        oscapClose(cap);
+        return NULL;
+    }
+    rp->ctUnitNs = oscapCtUnit(cap);
+
+    while ( ( result = oscapRead(cap, &rec) ) == 1 )
+    {
+        if ( rp->noRecords == maxRecords )
+        {
+            maxRecords = maxRecords ? maxRecords * 2 : 1024;
+            p = realloc(rp->records, maxRecords * sizeof(replayRecord));
+            if ( p == NULL )
+                break;
+            rp->records = (replayRecord *)p;
+        }
+        if ( rp->data == NULL || size + rec.len > maxData )
+        {
+            maxData = maxData ? maxData * 2 : 65536;
+            p = realloc(rp->data, maxData);
+            if ( p == NULL )
+                break;
+            rp->data = (uint8_t *)p;
+        }
+
+        if ( rp->noRecords > 0 )
+            time += (uint32_t)( rec.ct - rp->records[rp->noRecords - 1].ct );
+        memcpy(&rp->data[size], rec.frame, rec.len);
+
+        rp->records[rp->noRecords].dir = rec.dir;
+        rp->records[rp->noRecords].instNum = rec.instNum;
+        rp->records[rp->noRecords].len = rec.len;
+        rp->records[rp->noRecords].ct = rec.ct;
+        rp->records[rp->noRecords].time = time;
+        rp->records[rp->noRecords].offset = size;
+        rp->noRecords++;
+        size += rec.len;
+    }
+    oscapClose(cap);
+
+    if ( result != 0 )
+    {
+        oscapReplayFree(rp);
+        return NULL;
+    }
+
+    /* chain the transmitted frames of every instance */
+    for ( i = 0; i < MAX_INSTANCES; i++ )
+        rp->txFirst[i] = rp->noRecords;
+    for ( i = rp->noRecords; i-- > 0; )
+    {
+        if ( rp->records[i].dir == OSCAP_DIR_TX )
+        {
+            rp->records[i].txNext = rp->txFirst[rp->records[i].instNum];
+            rp->txFirst[rp->records[i].instNum] = i;
+        }
+    }
+
+    return rp;
+}
+
+int oscapReplayRun(oscapReplay * rp, const oscapReplayOps * ops,
+        void * ctx, int paced, oscapReplayStats * stats)
+{
+    const replayRecord * rec;
+    const uint8_t * frame;
+    unsigned long i;
+    double start, due;
+
+    if ( paced && rp->ctUnitNs == 0 )
+        return -1;
+
+    memset(stats, 0, sizeof(oscapReplayStats));
+    rp->stats = stats;
+    memcpy(rp->txNext, rp->txFirst, sizeof(rp->txNext));
+
+    start = now();
+    for ( i = 0; i < rp->noRecords; i++ )
+    {
+        rec = &rp->records[i];
+        if ( rec->dir != OSCAP_DIR_RX )
+            continue;
+
+        if ( paced )
+        {
+            due = start + (double)rec->time * (double)rp->ctUnitNs * 1e-9;
+            /* busy wait, a sleep is too coarse for cycle times below 1 ms */
+            while ( now() < due )
+                ;
+        }
+
+        if ( ops->cycle != NULL )
+            ops->cycle(ctx, rec->instNum, rec->ct);
+
+        frame = &rp->data[rec->offset];
+        if ( rec->len > 1 && ( ( frame[1] >> 2 ) & FRAME_TYPE_MASK ) == FRAME_TYPE_SPDO )
+        {
+            ops->rxSpdo(ctx, rec->instNum, rec->ct, frame, rec->len);
+        }
+        else if ( ops->rxSnmtSsdo(ctx, rec->instNum, rec->ct, frame, rec->len) )
+        {
+            while ( ops->rxSnmtSsdo(ctx, rec->instNum, rec->ct, NULL, 0) )
+                ;
+        }
+        stats->rxFrames++;
+    }
+    stats->seconds = now() - start;
+
+    for ( i = 0; i < MAX_INSTANCES; i++ )
+    {
+        while ( rp->txNext[i] < rp->noRecords )
+        {
+            stats->txMissing++;
+            rp->txNext[i] = rp->records[rp->txNext[i]].txNext;
+        }
+    }
+    rp->stats = NULL;
+
+    return ( stats->txMismatch || stats->txMissing || stats->txExtra ) ? 1 : 0;
+}
+
+void oscapReplayTx(oscapReplay * rp, uint8_t instNum,
+        const uint8_t * frame, uint16_t len)
+{
+    const replayRecord * rec;
+
+    /* frames transmitted outside of oscapReplayRun, e.g. during the start-up */
+    if ( rp->stats == NULL )
+        return;
+
+    rp->stats->txFrames++;
+    if ( rp->txNext[instNum] >= rp->noRecords )
+    {
+        rp->stats->txExtra++;
+        return;
+    }
+
+    rec = &rp->records[rp->txNext[instNum]];
+    if ( rec->len != len || memcmp(&rp->data[rec->offset], frame, len) != 0 )
+        rp->stats->txMismatch++;
+    rp->txNext[instNum] = rec->txNext;
+}
+
+void oscapReplayFree(oscapReplay * rp)
+{
+    if ( rp == NULL )
+        return;
+
+    free(rp->records);
+    free(rp->data);
+    free(rp);
+}
+
+/**
+ * \}
+ * \}
+ */
@@ -124,12 +124,12 @@ uint16_t crc16ChecksumPoly(uint32_t len, const uint8_t * pBuffer,
         switch (Polynom)
         {
         case (CRC16_POLY_AC9A):
-            ulTab_AC9A = PrecompiledCRC16_AC9A[(*pBuffer++) ^ (crc >> 8)];
+            ulTab_AC9A = PrecompiledCRC16_AC9A[(*pBuffer) ^ (crc >> 8)];
             crc = (crc << 8) ^ ulTab_AC9A;
             break;
 
         case (CRC16_POLY):
-            ulTab = PrecompiledCRC16[(*pBuffer++) ^ (crc >> 8)];
+            ulTab = PrecompiledCRC16[(*pBuffer) ^ (crc >> 8)];
             crc = (crc << 8) ^ ulTab;
             break;
         default:
@@ -0,0 +1,489 @@
+/*
+ * \file crc_multi.c
+ * \version 1.0
+ *
+ * Multi-buffer CRC8/CRC16 calculation. Short subframes are processed in
+ * parallel, one buffer per byte lane of a SIMD register. The table
+ * lookup of the byte-wise CRC is split into two 16 entry lookups of the
+ * high and low nibble, which are done with a byte shuffle. This is
+ * possible, because the CRC tables are linear:
+ * T[x] = T[x & 0xF0] ^ T[x & 0x0F].
+ *
+ * The SIMD kernels are only used on x86 with GCC compatible compilers
+ * (selected at runtime) or if the compiler already generates AVX2 or
+ * SSE4.1 code. Otherwise the buffers are calculated one after the other.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <oschecksum/crc.h>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+  #define CRC_MULTI_SSE41 __attribute__((target("sse4.1")))
+  #define CRC_MULTI_AVX2 __attribute__((target("avx2")))
+  /* the load is inlined into both kernels, a call from the AVX2 kernel
+     into SSE code would cost a state transition at every block */
+  #define CRC_MULTI_INLINE __inline__ __attribute__((always_inline))
+  #define CRC_MULTI_RUNTIME_DISPATCH
+#elif defined(__AVX2__)
+  #define CRC_MULTI_SSE41
+  #define CRC_MULTI_AVX2
+  #define CRC_MULTI_INLINE __inline
+#elif defined(__SSE4_1__)
+  #define CRC_MULTI_SSE41
+  #define CRC_MULTI_INLINE __inline
+#endif
+
+#if defined(CRC_MULTI_SSE41)
+  #include <immintrin.h>
+#endif
+
+/** \brief Kernel selection, see crcMultiLanes() */
+typedef enum
+{
+    CRC_MULTI_UNKNOWN = 0,
+    CRC_MULTI_SCALAR,
+    CRC_MULTI_KERNEL_SSE41,
+    CRC_MULTI_KERNEL_AVX2
+} CrcMultiKernel;
+
+static CrcMultiKernel crcMultiKernel = CRC_MULTI_UNKNOWN;
+
+static CrcMultiKernel crcMultiSelect(void)
+{
+    if ( crcMultiKernel == CRC_MULTI_UNKNOWN )
+    {
+        crcMultiKernel = CRC_MULTI_SCALAR;
+#if defined(CRC_MULTI_RUNTIME_DISPATCH)
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports("avx2") )
+            crcMultiKernel = CRC_MULTI_KERNEL_AVX2;
+        else if ( __builtin_cpu_supports("sse4.1") )
+            crcMultiKernel = CRC_MULTI_KERNEL_SSE41;
+#elif defined(CRC_MULTI_AVX2)
+        crcMultiKernel = CRC_MULTI_KERNEL_AVX2;
+#elif defined(CRC_MULTI_SSE41)
+        crcMultiKernel = CRC_MULTI_KERNEL_SSE41;
+#endif
+    }
+    return crcMultiKernel;
+}
+
+uint32_t crcMultiLanes(void)
+{
+    switch ( crcMultiSelect() )
+    {
+    case CRC_MULTI_KERNEL_AVX2:
+        return 32;
+    case CRC_MULTI_KERNEL_SSE41:
+        return 16;
+    default:
+        return 1;
+    }
+}
+
+#if defined(CRC_MULTI_SSE41)
+
+/** \brief Number of bytes of each buffer, which are transposed at once */
+#define CRC_MULTI_BLOCK 16
+
+/**
+ * Shuffle masks, which move the low 8 bytes of a register to byte offset
+ * 0..8 and clear all other bytes.
+ */
+static const uint8_t crcMultiPlace[9][16] = {
+    { 0, 1, 2, 3, 4, 5, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0, 1, 2, 3, 4, 5, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0x80, 0, 1, 2, 3, 4, 5, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0x80, 0x80, 0, 1, 2, 3, 4, 5, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0x80, 0x80, 0x80, 0, 1, 2, 3, 4, 5, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0, 1, 2, 3, 4, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 1, 2, 3, 4, 5, 6, 7, 0x80, 0x80 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 1, 2, 3, 4, 5, 6, 7, 0x80 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 1, 2, 3, 4, 5, 6, 7 }
+};
+
+/**
+ * Loads n (0..16) bytes into a register, the other bytes are zero. No byte
+ * behind the buffer is read, two overlapping loads are used instead.
+ */
+CRC_MULTI_SSE41 static CRC_MULTI_INLINE __m128i crcMultiRow(const uint8_t * pData, uint32_t n)
+{
+    uint32_t head, tail;
+    __m128i place;
+
+    if ( n >= 16 )
+        return _mm_loadu_si128((const __m128i *)pData);
+
+    if ( n >= 8 )
+    {
+        place = _mm_loadu_si128((const __m128i *)crcMultiPlace[n - 8]);
+        return _mm_or_si128(_mm_loadl_epi64((const __m128i *)pData),
+            _mm_shuffle_epi8(_mm_loadl_epi64((const __m128i *)(pData + n - 8)), place));
+    }
+
+    if ( n >= 4 )
+    {
+        memcpy(&head, pData, 4);
+        memcpy(&tail, pData + n - 4, 4);
+        place = _mm_loadu_si128((const __m128i *)crcMultiPlace[n - 4]);
+        return _mm_or_si128(_mm_cvtsi32_si128((int)head),
+            _mm_shuffle_epi8(_mm_cvtsi32_si128((int)tail), place));
+    }
+
+    if ( n > 0 )
+    {
+        /* the first, the middle and the last byte cover 1..3 bytes */
+        head = (uint32_t)pData[0] | ((uint32_t)pData[n >> 1] << (8 * (n >> 1))) |
+               ((uint32_t)pData[n - 1] << (8 * (n - 1)));
+        return _mm_cvtsi32_si128((int)head);
+    }
+
+    return _mm_setzero_si128();
+}
+
+/**
+ * Loads the next block of 16 lanes and transposes it, so that column[j]
+ * contains byte j of every lane. The number of bytes of every lane, which
+ * are still to be calculated within this block, is returned in remain.
+ */
+CRC_MULTI_SSE41 static CRC_MULTI_INLINE void crcMultiLoad(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint32_t offset,
+                __m128i * column, __m128i * remain)
+{
+    uint8_t rest[CRC_MULTI_BLOCK];
+    __m128i tmp[CRC_MULTI_BLOCK];
+    uint32_t k, n;
+    int i;
+
+    for ( k = 0; k < CRC_MULTI_BLOCK; k++ )
+    {
+        n = 0;
+        column[k] = _mm_setzero_si128();
+        /* lanes behind the last buffer stay empty */
+        if ( k < count && pLen[k] > offset )
+        {
+            n = pLen[k] - offset;
+            if ( n > CRC_MULTI_BLOCK )
+                n = CRC_MULTI_BLOCK;
+            column[k] = crcMultiRow(ppBuffer[k] + offset, n);
+        }
+        rest[k] = (uint8_t)n;
+    }
+    *remain = _mm_loadu_si128((const __m128i *)rest);
+
+    /* four perfect shuffles of the rows result in the transposed block */
+    for ( i = 0; i < 2; i++ )
+    {
+        for ( k = 0; k < 8; k++ )
+        {
+            tmp[2 * k] = _mm_unpacklo_epi8(column[k], column[k + 8]);
+            tmp[2 * k + 1] = _mm_unpackhi_epi8(column[k], column[k + 8]);
+        }
+        for ( k = 0; k < 8; k++ )
+        {
+            column[2 * k] = _mm_unpacklo_epi8(tmp[k], tmp[k + 8]);
+            column[2 * k + 1] = _mm_unpackhi_epi8(tmp[k], tmp[k + 8]);
+        }
+    }
+}
+
+/** \brief Returns the longest length of the given buffers */
+static uint32_t crcMultiMaxLen(uint32_t count, const uint32_t * pLen)
+{
+    uint32_t k, maxLen = 0;
+
+    for ( k = 0; k < count; k++ )
+    {
+        if ( pLen[k] > maxLen )
+            maxLen = pLen[k];
+    }
+    return maxLen;
+}
+
+CRC_MULTI_SSE41 static void crc8MultiSse41(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint8_t initCRC, uint8_t * pCRC)
+{
+    uint8_t hiTab[16], loTab[16], result[16];
+    __m128i column[CRC_MULTI_BLOCK];
+    __m128i remain, crc, x, next, active;
+    __m128i tabHi, tabLo, nibble;
+    uint32_t maxLen, offset, j, k;
+
+    for ( k = 0; k < 16; k++ )
+    {
+        hiTab[k] = PrecompiledCRC8[k << 4];
+        loTab[k] = PrecompiledCRC8[k];
+    }
+    tabHi = _mm_loadu_si128((const __m128i *)hiTab);
+    tabLo = _mm_loadu_si128((const __m128i *)loTab);
+    nibble = _mm_set1_epi8(0x0F);
+
+    crc = _mm_set1_epi8((char)initCRC);
+    maxLen = crcMultiMaxLen(count, pLen);
+
+    for ( offset = 0; offset < maxLen; offset += CRC_MULTI_BLOCK )
+    {
+        crcMultiLoad(count, pLen, ppBuffer, offset, column, &remain);
+        for ( j = 0; j < CRC_MULTI_BLOCK && offset + j < maxLen; j++ )
+        {
+            x = _mm_xor_si128(crc, column[j]);
+            next = _mm_xor_si128(
+                _mm_shuffle_epi8(tabHi, _mm_and_si128(_mm_srli_epi16(x, 4), nibble)),
+                _mm_shuffle_epi8(tabLo, _mm_and_si128(x, nibble)));
+            active = _mm_cmpgt_epi8(remain, _mm_set1_epi8((char)j));
+            crc = _mm_blendv_epi8(crc, next, active);
+        }
+    }
+
+    _mm_storeu_si128((__m128i *)result, crc);
+    memcpy(pCRC, result, count);
+}
+
+CRC_MULTI_SSE41 static void crc16MultiSse41(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint16_t initCRC,
+                const uint16_t * pTable, uint16_t * pCRC)
+{
+    uint8_t hhTab[16], hlTab[16], lhTab[16], llTab[16];
+    uint8_t resultHi[16], resultLo[16];
+    __m128i column[CRC_MULTI_BLOCK];
+    __m128i remain, crcHi, crcLo, x, xHi, xLo, nextHi, nextLo, active;
+    __m128i tabHh, tabHl, tabLh, tabLl, nibble;
+    uint32_t maxLen, offset, j, k;
+
+    /* high and low byte of the table entries for the high and low nibble */
+    for ( k = 0; k < 16; k++ )
+    {
+        hhTab[k] = (uint8_t)(pTable[k << 4] >> 8);
+        hlTab[k] = (uint8_t)(pTable[k] >> 8);
+        lhTab[k] = (uint8_t)pTable[k << 4];
+        llTab[k] = (uint8_t)pTable[k];
+    }
+    tabHh = _mm_loadu_si128((const __m128i *)hhTab);
+    tabHl = _mm_loadu_si128((const __m128i *)hlTab);
+    tabLh = _mm_loadu_si128((const __m128i *)lhTab);
+    tabLl = _mm_loadu_si128((const __m128i *)llTab);
+    nibble = _mm_set1_epi8(0x0F);
+
+    crcHi = _mm_set1_epi8((char)(initCRC >> 8));
+    crcLo = _mm_set1_epi8((char)initCRC);
+    maxLen = crcMultiMaxLen(count, pLen);
+
+    for ( offset = 0; offset < maxLen; offset += CRC_MULTI_BLOCK )
+    {
+        crcMultiLoad(count, pLen, ppBuffer, offset, column, &remain);
+        for ( j = 0; j < CRC_MULTI_BLOCK && offset + j < maxLen; j++ )
+        {
+            /* crc = (crc << 8) ^ T[(crc >> 8) ^ data] */
+            x = _mm_xor_si128(crcHi, column[j]);
+            xHi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+            xLo = _mm_and_si128(x, nibble);
+            nextHi = _mm_xor_si128(crcLo, _mm_xor_si128(
+                _mm_shuffle_epi8(tabHh, xHi), _mm_shuffle_epi8(tabHl, xLo)));
+            nextLo = _mm_xor_si128(
+                _mm_shuffle_epi8(tabLh, xHi), _mm_shuffle_epi8(tabLl, xLo));
+            active = _mm_cmpgt_epi8(remain, _mm_set1_epi8((char)j));
+            crcHi = _mm_blendv_epi8(crcHi, nextHi, active);
+            crcLo = _mm_blendv_epi8(crcLo, nextLo, active);
+        }
+    }
+
+    _mm_storeu_si128((__m128i *)resultHi, crcHi);
+    _mm_storeu_si128((__m128i *)resultLo, crcLo);
+    for ( k = 0; k < count; k++ )
+        pCRC[k] = (uint16_t)((resultHi[k] << 8) | resultLo[k]);
+}
+
+#endif /* defined(CRC_MULTI_SSE41) */
+
+#if defined(CRC_MULTI_AVX2)
+
+/** \brief Combines the columns of two blocks of 16 lanes to 32 lanes */
+#define CRC_MULTI_COMBINE(lo, hi) \
+    _mm256_inserti128_si256(_mm256_castsi128_si256(lo), (hi), 1)
+
+CRC_MULTI_AVX2 static void crc8MultiAvx2(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint8_t initCRC, uint8_t * pCRC)
+{
+    uint8_t hiTab[16], loTab[16], result[32];
+    __m128i columnA[CRC_MULTI_BLOCK], columnB[CRC_MULTI_BLOCK];
+    __m128i remainA, remainB;
+    __m256i remain, crc, x, next, active, tabHi, tabLo, nibble;
+    uint32_t maxLen, offset, j, k;
+    /* the second 16 lanes, pointers stay within the arrays if empty */
+    uint32_t countA = ( count > 16 ) ? 16 : count;
+    uint32_t countB = count - countA;
+
+    for ( k = 0; k < 16; k++ )
+    {
+        hiTab[k] = PrecompiledCRC8[k << 4];
+        loTab[k] = PrecompiledCRC8[k];
+    }
+    tabHi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)hiTab));
+    tabLo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)loTab));
+    nibble = _mm256_set1_epi8(0x0F);
+
+    crc = _mm256_set1_epi8((char)initCRC);
+    maxLen = crcMultiMaxLen(count, pLen);
+
+    for ( offset = 0; offset < maxLen; offset += CRC_MULTI_BLOCK )
+    {
+        crcMultiLoad(count, pLen, ppBuffer, offset, columnA, &remainA);
+        crcMultiLoad(countB, pLen + countA, ppBuffer + countA, offset, columnB, &remainB);
+        remain = CRC_MULTI_COMBINE(remainA, remainB);
+        for ( j = 0; j < CRC_MULTI_BLOCK && offset + j < maxLen; j++ )
+        {
+            x = _mm256_xor_si256(crc, CRC_MULTI_COMBINE(columnA[j], columnB[j]));
+            next = _mm256_xor_si256(
+                _mm256_shuffle_epi8(tabHi, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble)),
+                _mm256_shuffle_epi8(tabLo, _mm256_and_si256(x, nibble)));
+            active = _mm256_cmpgt_epi8(remain, _mm256_set1_epi8((char)j));
+            crc = _mm256_blendv_epi8(crc, next, active);
+        }
+    }
+
+    _mm256_storeu_si256((__m256i *)result, crc);
+    memcpy(pCRC, result, count);
+}
+
+CRC_MULTI_AVX2 static void crc16MultiAvx2(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint16_t initCRC,
+                const uint16_t * pTable, uint16_t * pCRC)
+{
+    uint8_t hhTab[16], hlTab[16], lhTab[16], llTab[16];
+    uint8_t resultHi[32], resultLo[32];
+    __m128i columnA[CRC_MULTI_BLOCK], columnB[CRC_MULTI_BLOCK];
+    __m128i remainA, remainB;
+    __m256i remain, crcHi, crcLo, x, xHi, xLo, nextHi, nextLo, active;
+    __m256i tabHh, tabHl, tabLh, tabLl, nibble;
+    uint32_t maxLen, offset, j, k;
+    /* the second 16 lanes, pointers stay within the arrays if empty */
+    uint32_t countA = ( count > 16 ) ? 16 : count;
+    uint32_t countB = count - countA;
+
+    for ( k = 0; k < 16; k++ )
+    {
+        hhTab[k] = (uint8_t)(pTable[k << 4] >> 8);
+        hlTab[k] = (uint8_t)(pTable[k] >> 8);
+        lhTab[k] = (uint8_t)pTable[k << 4];
+        llTab[k] = (uint8_t)pTable[k];
+    }
+    tabHh = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)hhTab));
+    tabHl = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)hlTab));
+    tabLh = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)lhTab));
+    tabLl = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)llTab));
+    nibble = _mm256_set1_epi8(0x0F);
+
+    crcHi = _mm256_set1_epi8((char)(initCRC >> 8));
+    crcLo = _mm256_set1_epi8((char)initCRC);
+    maxLen = crcMultiMaxLen(count, pLen);
+
+    for ( offset = 0; offset < maxLen; offset += CRC_MULTI_BLOCK )
+    {
+        crcMultiLoad(count, pLen, ppBuffer, offset, columnA, &remainA);
+        crcMultiLoad(countB, pLen + countA, ppBuffer + countA, offset, columnB, &remainB);
+        remain = CRC_MULTI_COMBINE(remainA, remainB);
+        for ( j = 0; j < CRC_MULTI_BLOCK && offset + j < maxLen; j++ )
+        {
+            x = _mm256_xor_si256(crcHi, CRC_MULTI_COMBINE(columnA[j], columnB[j]));
+            xHi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+            xLo = _mm256_and_si256(x, nibble);
+            nextHi = _mm256_xor_si256(crcLo, _mm256_xor_si256(
+                _mm256_shuffle_epi8(tabHh, xHi), _mm256_shuffle_epi8(tabHl, xLo)));
+            nextLo = _mm256_xor_si256(
+                _mm256_shuffle_epi8(tabLh, xHi), _mm256_shuffle_epi8(tabLl, xLo));
+            active = _mm256_cmpgt_epi8(remain, _mm256_set1_epi8((char)j));
+            crcHi = _mm256_blendv_epi8(crcHi, nextHi, active);
+            crcLo = _mm256_blendv_epi8(crcLo, nextLo, active);
+        }
+    }
+
+    _mm256_storeu_si256((__m256i *)resultHi, crcHi);
+    _mm256_storeu_si256((__m256i *)resultLo, crcLo);
+    for ( k = 0; k < count; k++ )
+        pCRC[k] = (uint16_t)((resultHi[k] << 8) | resultLo[k]);
+}
+
+#endif /* defined(CRC_MULTI_AVX2) */
+
+void crc8ChecksumMulti(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint8_t initCRC, uint8_t * pCRC)
+{
+    uint32_t lanes = crcMultiLanes();
+    uint32_t n, k;
+
+    while ( count > 0 )
+    {
+        n = ( count < lanes ) ? count : lanes;
+        switch ( crcMultiKernel )
+        {
+#if defined(CRC_MULTI_AVX2)
+        case CRC_MULTI_KERNEL_AVX2:
+            crc8MultiAvx2(n, pLen, ppBuffer, initCRC, pCRC);
+            break;
+#endif
+#if defined(CRC_MULTI_SSE41)
+        case CRC_MULTI_KERNEL_SSE41:
+            crc8MultiSse41(n, pLen, ppBuffer, initCRC, pCRC);
+            break;
+#endif
+        default:
+            for ( k = 0; k < n; k++ )
+                pCRC[k] = crc8Checksum(pLen[k], ppBuffer[k], initCRC);
+            break;
+        }
+        count -= n;
+        pLen += n;
+        ppBuffer += n;
+        pCRC += n;
+    }
+}
+
+static void crc16ChecksumMultiTable(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint16_t initCRC,
+                uint16_t Polynom, const uint16_t * pTable, uint16_t * pCRC)
+{
+    uint32_t lanes = crcMultiLanes();
+    uint32_t n, k;
+
+    while ( count > 0 )
+    {
+        n = ( count < lanes ) ? count : lanes;
+        switch ( crcMultiKernel )
+        {
+#if defined(CRC_MULTI_AVX2)
+        case CRC_MULTI_KERNEL_AVX2:
+            crc16MultiAvx2(n, pLen, ppBuffer, initCRC, pTable, pCRC);
+            break;
+#endif
+#if defined(CRC_MULTI_SSE41)
+        case CRC_MULTI_KERNEL_SSE41:
+            crc16MultiSse41(n, pLen, ppBuffer, initCRC, pTable, pCRC);
+            break;
+#endif
+        default:
+            for ( k = 0; k < n; k++ )
+                pCRC[k] = crc16ChecksumPoly(pLen[k], ppBuffer[k], initCRC, Polynom);
+            break;
+        }
+        count -= n;
+        pLen += n;
+        ppBuffer += n;
+        pCRC += n;
+    }
+}
+
+void crc16ChecksumMulti(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint16_t initCRC, uint16_t * pCRC)
+{
+    crc16ChecksumMultiTable(count, pLen, ppBuffer, initCRC,
+                    (uint16_t) CRC16_POLY, PrecompiledCRC16, pCRC);
+}
+
+void crc16ChecksumMulti_AC9A(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint16_t initCRC, uint16_t * pCRC)
+{
+    crc16ChecksumMultiTable(count, pLen, ppBuffer, initCRC,
+                    (uint16_t) CRC16_POLY_AC9A, PrecompiledCRC16_AC9A, pCRC);
+}
@@ -186,6 +186,57 @@ OSCHECKSUM_EXPORT uint8_t crc8ChecksumCalculator(uint32_t len, const uint8_t * p
  * \return although being an uint8, the return value is 0 for incorrect functionality, 1 for correct one
  */
 OSCHECKSUM_EXPORT uint8_t crc8SanityCheck(void);
+
+/**
+ * \brief Returns the number of buffers, which are calculated in parallel by the multi-buffer functions
+ *
+ * \return 32 for the AVX2 kernel, 16 for the SSE4.1 kernel and 1 if the buffers are calculated one after the other
+ */
+OSCHECKSUM_EXPORT uint32_t crcMultiLanes(void);
+
+/**
+ * \brief Calculates the CRC8 checksums for a number of independent buffers, e.g. all subframes of a cycle
+ *
+ * The result is the same as calling crc8Checksum for every buffer, but up to crcMultiLanes() buffers
+ * are calculated in parallel. This is faster for short buffers like SPDO subframes.
+ *
+ * \param count the number of buffers
+ * \param pLen an array with the length of every buffer
+ * \param ppBuffer an array with a pointer to every buffer
+ * \param initCRC Initial value for the CRC calculation of every buffer. In case of openSAFETY, this is always 0
+ * \param pCRC an array, which receives the CRC8 checksum of every buffer
+ */
+OSCHECKSUM_EXPORT void crc8ChecksumMulti(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint8_t initCRC, uint8_t * pCRC);
+
+/**
+ * \brief Calculates the CRC16 checksums for a number of independent buffers, e.g. all subframes of a cycle
+ *
+ * The result is the same as calling crc16Checksum for every buffer, but up to crcMultiLanes() buffers
+ * are calculated in parallel.
+ *
+ * \param count the number of buffers
+ * \param pLen an array with the length of every buffer
+ * \param ppBuffer an array with a pointer to every buffer
+ * \param initCRC Initial value for the CRC calculation of every buffer. In case of openSAFETY, this is always 0
+ * \param pCRC an array, which receives the CRC16 checksum of every buffer
+ */
+OSCHECKSUM_EXPORT void crc16ChecksumMulti(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint16_t initCRC, uint16_t * pCRC);
+
+/**
+ * \brief Calculates the CRC16 checksums with the old polynomial for a number of independent buffers
+ *
+ * The result is the same as calling crc16Checksum_AC9A for every buffer.
+ *
+ * \param count the number of buffers
+ * \param pLen an array with the length of every buffer
+ * \param ppBuffer an array with a pointer to every buffer
+ * \param initCRC Initial value for the CRC calculation of every buffer. In case of openSAFETY, this is always 0
+ * \param pCRC an array, which receives the CRC16 checksum of every buffer
+ */
+OSCHECKSUM_EXPORT void crc16ChecksumMulti_AC9A(uint32_t count, const uint32_t * pLen,
+                const uint8_t * const * ppBuffer, uint16_t initCRC, uint16_t * pCRC);
 #ifdef __cplusplus
 }
 #endif
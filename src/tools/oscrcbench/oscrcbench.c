@@ -0,0 +1,202 @@
+/**
+ * \file oscrcbench/oscrcbench.c
+ * Benchmark of the multi-buffer CRC calculation
+ * \addtogroup Tools
+ * \{
+ * \addtogroup oscrcbench openSAFETY multi-buffer CRC benchmark
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * Compares the CRC calculation of a batch of subframes with
+ * crc8ChecksumMulti/crc16ChecksumMulti against a loop over
+ * crc8Checksum/crc16ChecksumPoly. The subframe lengths are chosen at
+ * random between the given minimum and maximum length.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <getopt.h>
+
+#include <oschecksum/crc.h>
+
+/** \brief Longest subframe, 254 byte payload and 5 byte header */
+#define MAX_LEN 259
+
+void ParseOpt(int argc, char *argv[]);
+void help();
+
+/** \brief Number of subframes per batch */
+unsigned long noFrames = 64;
+/** \brief Number of batches per method */
+unsigned long noBatches = 200000;
+/** \brief Shortest subframe */
+unsigned long minLen = 5;
+/** \brief Longest subframe */
+unsigned long maxLen = 13;
+
+static uint8_t * frameData;
+static const uint8_t ** frameBuffer;
+static uint32_t * frameLen;
+static uint8_t * crc8;
+static uint16_t * crc16;
+
+static void loop8(void)
+{
+    unsigned long i;
+
+    for ( i = 0; i < noFrames; i++ )
+        crc8[i] = crc8Checksum(frameLen[i], frameBuffer[i], 0);
+}
+
+static void multi8(void)
+{
+    crc8ChecksumMulti((uint32_t)noFrames, frameLen, frameBuffer, 0, crc8);
+}
+
+static void loop16(void)
+{
+    unsigned long i;
+
+    for ( i = 0; i < noFrames; i++ )
+        crc16[i] = crc16ChecksumPoly(frameLen[i], frameBuffer[i], 0, CRC16_POLY);
+}
+
+static void multi16(void)
+{
+    crc16ChecksumMulti((uint32_t)noFrames, frameLen, frameBuffer, 0, crc16);
+}
+
+static unsigned long sum8(void)
+{
+    unsigned long i, sum = 0;
+
+    for ( i = 0; i < noFrames; i++ )
+        sum += crc8[i];
+    return sum;
+}
+
+static unsigned long sum16(void)
+{
+    unsigned long i, sum = 0;
+
+    for ( i = 0; i < noFrames; i++ )
+        sum += crc16[i];
+    return sum;
+}
+
+static void runMethod(const char * name, void (*calc)(void), unsigned long (*sum)(void))
+{
+    unsigned long i;
+    clock_t start;
+    double seconds;
+
+    start = clock();
+    for ( i = 0; i < noBatches; i++ )
+        calc();
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%-8s %10.2f ns/frame  checksum sum 0x%lx\n", name,
+            seconds * 1e9 / ((double)noBatches * (double)noFrames), sum());
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long i, j;
+
+    ParseOpt(argc, argv);
+
+    frameData = (uint8_t *)malloc(noFrames * MAX_LEN);
+    frameBuffer = (const uint8_t **)malloc(noFrames * sizeof(uint8_t *));
+    frameLen = (uint32_t *)malloc(noFrames * sizeof(uint32_t));
+    crc8 = (uint8_t *)malloc(noFrames * sizeof(uint8_t));
+    crc16 = (uint16_t *)malloc(noFrames * sizeof(uint16_t));
+    if ( frameData == NULL || frameBuffer == NULL || frameLen == NULL ||
+         crc8 == NULL || crc16 == NULL )
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    srand(1);
+    for ( i = 0; i < noFrames; i++ )
+    {
+        frameLen[i] = (uint32_t)(minLen + rand() % (maxLen - minLen + 1));
+        frameBuffer[i] = &frameData[i * MAX_LEN];
+        for ( j = 0; j < MAX_LEN; j++ )
+            frameData[i * MAX_LEN + j] = (uint8_t)rand();
+    }
+
+    printf("%lu subframes of %lu..%lu byte, %lu batches, %u parallel buffers\n",
+            noFrames, minLen, maxLen, noBatches, crcMultiLanes());
+    runMethod("crc8", loop8, sum8);
+    runMethod("crc8m", multi8, sum8);
+    runMethod("crc16", loop16, sum16);
+    runMethod("crc16m", multi16, sum16);
+
+    free(crc16);
+    free(crc8);
+    free(frameLen);
+    free((void *)frameBuffer);
+    free(frameData);
+    return 0;
+}
+
+void ParseOpt(int argc, char *argv[])
+{
+    int c;
+
+    while ( ( c = getopt(argc, argv, "n:b:l:L:h") ) != -1 )
+    {
+        switch ( c )
+        {
+            case 'n':
+                noFrames = strtoul(optarg, NULL, 0);
+                break;
+            case 'b':
+                noBatches = strtoul(optarg, NULL, 0);
+                break;
+            case 'l':
+                minLen = strtoul(optarg, NULL, 0);
+                break;
+            case 'L':
+                maxLen = strtoul(optarg, NULL, 0);
+                break;
+            case 'h':
+            default:
+                help();
+                exit(0);
+        }
+    }
+
+    if ( noFrames == 0 || noBatches == 0 || minLen > maxLen || maxLen > MAX_LEN )
+    {
+        help();
+        exit(1);
+    }
+}
+
+void help()
+{
+    printf("Usage: oscrcbench [-n subframes] [-b batches] [-l min length] [-L max length]\n\n");
+    printf("  -n    number of subframes per batch (default: 64)\n");
+    printf("  -b    number of batches per method (default: 200000)\n");
+    printf("  -l    shortest subframe in byte (default: 5)\n");
+    printf("  -L    longest subframe in byte, up to %d (default: 13)\n", MAX_LEN);
+    printf("  -h    this help\n");
+}
+
+/**
+ * \}
+ * \}
+ */
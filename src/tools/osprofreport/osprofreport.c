@@ -0,0 +1,265 @@
+/**
+ * \file osprofreport/osprofreport.c
+ * Main program for the command-line profiling report
+ * \addtogroup Tools
+ * \{
+ * \addtogroup osprofreport openSAFETY profiling report utility
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ *
+ * Reads the lines written by SCFM_ProfDumpSite() of a stack built with
+ * SCFM_cfg_PROFILING and prints the call sites with the highest total and the
+ * highest maximum time. Lines which do not start with "SCFM;" are ignored, so
+ * a complete console log can be passed to the tool.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <getopt.h>
+
+/** \brief Maximum length of an input line */
+#define LINE_LEN 1024
+
+/** \brief Profiling data of one call site */
+typedef struct
+{
+    /** source file of the call site */
+    char * file;
+    /** source line of the call site */
+    unsigned long line;
+    /** number of tacks */
+    unsigned long long count;
+    /** sum of the times since the previous tack */
+    unsigned long long total;
+    /** maximum time since the previous tack */
+    unsigned long max;
+} ProfSite;
+
+void ParseOpt(int argc, char *argv[]);
+int readSites(FILE * fp);
+int compareTotal(const void * a, const void * b);
+int compareMax(const void * a, const void * b);
+void printTop(const char * title, int (*compare)(const void *, const void *));
+void help();
+
+/** \brief Instance to be reported, -1 reports the sum of all instances */
+long instance = -1;
+/** \brief Number of call sites printed per table */
+unsigned long topCount = 20;
+/** \brief Input file, NULL reads stdin */
+char * inputFile = NULL;
+
+/** \brief All call sites read */
+ProfSite * sites = NULL;
+/** \brief Number of call sites read */
+size_t siteCount = 0;
+/** \brief Number of allocated call sites */
+size_t siteSize = 0;
+
+/** \brief The helpstring for the program */
+const char * helpstring = "osprofreport [-f FILE] [-i INSTANCE] [-n COUNT]\n\n"
+        "Prints the openSAFETY call sites with the highest total and maximum time.\n\n"
+        "\t-f FILE\t\tFile containing the SCFM_ProfDumpSite() lines (default stdin)\n"
+        "\t-i INSTANCE\tReport only the given instance (default sum of all instances)\n"
+        "\t-n COUNT\tNumber of call sites per table (default 20)\n"
+        "\t-h\t\tThis help\n";
+
+int main(int argc, char *argv[])
+{
+    FILE * fp = stdin;
+    unsigned long long total = 0;
+    size_t i;
+
+    ParseOpt(argc, argv);
+
+    if ( inputFile != NULL && NULL == ( fp = fopen(inputFile, "r") ) )
+    {
+        fprintf(stderr, "Could not open %s\n", inputFile);
+        return 1;
+    }
+
+    if ( readSites(fp) != 0 )
+    {
+        fputs("Out of memory\n", stderr);
+        return 1;
+    }
+
+    if ( fp != stdin )
+        fclose(fp);
+
+    for ( i = 0; i < siteCount; i++ )
+        total += sites[i].total;
+
+    printf("%lu call sites, total time %llu\n", (unsigned long) siteCount, total);
+    printTop("by total time", compareTotal);
+    printTop("by maximum time", compareMax);
+
+    for ( i = 0; i < siteCount; i++ )
+        free(sites[i].file);
+    free(sites);
+
+    return 0;
+}
+
+/**
+ * \brief Reads all "SCFM;" lines and sums the call sites of all selected instances
+ * \param fp opened input file
+ * \return 0 on success, 1 if no memory could be allocated
+ */
+int readSites(FILE * fp)
+{
+    char line[LINE_LEN];
+    char file[LINE_LEN];
+    unsigned long inst, srcLine, count, max;
+    unsigned long long total;
+    size_t i;
+    ProfSite * site;
+
+    while ( fgets(line, sizeof(line), fp) != NULL )
+    {
+        if ( strncmp(line, "SCFM;", 5) != 0 )
+            continue;
+        if ( sscanf(line, "SCFM;%lu;%1023[^;];%lu;%lu;%llx;%lu",
+                    &inst, file, &srcLine, &count, &total, &max) != 6 )
+            continue;
+        if ( instance >= 0 && (unsigned long) instance != inst )
+            continue;
+
+        site = NULL;
+        for ( i = 0; i < siteCount && site == NULL; i++ )
+        {
+            if ( sites[i].line == srcLine && strcmp(sites[i].file, file) == 0 )
+                site = &sites[i];
+        }
+
+        if ( site == NULL )
+        {
+            if ( siteCount == siteSize )
+            {
+                siteSize = ( siteSize == 0 ) ? 256 : siteSize * 2;
+                site = (ProfSite *) realloc(sites, siteSize * sizeof(ProfSite));
+                if ( site == NULL )
+                    return 1;
+                sites = site;
+            }
+            site = &sites[siteCount];
+            memset(site, 0, sizeof(ProfSite));
+            site->file = (char *) malloc(strlen(file) + 1);
+            if ( site->file == NULL )
+                return 1;
+            strcpy(site->file, file);
+            site->line = srcLine;
+            siteCount++;
+        }
+
+        site->count += count;
+        site->total += total;
+        if ( max > site->max )
+            site->max = max;
+    }
+
+    return 0;
+}
+
+/** \brief Sorts the call sites by descending total time */
+int compareTotal(const void * a, const void * b)
+{
+    const ProfSite * sa = (const ProfSite *) a;
+    const ProfSite * sb = (const ProfSite *) b;
+
+    if ( sa->total != sb->total )
+        return ( sa->total < sb->total ) ? 1 : -1;
+    return ( sa->max < sb->max ) ? 1 : ( ( sa->max > sb->max ) ? -1 : 0 );
+}
+
+/** \brief Sorts the call sites by descending maximum time */
+int compareMax(const void * a, const void * b)
+{
+    const ProfSite * sa = (const ProfSite *) a;
+    const ProfSite * sb = (const ProfSite *) b;
+
+    if ( sa->max != sb->max )
+        return ( sa->max < sb->max ) ? 1 : -1;
+    return ( sa->total < sb->total ) ? 1 : ( ( sa->total > sb->total ) ? -1 : 0 );
+}
+
+/**
+ * \brief Prints the first call sites after sorting
+ * \param title title of the table
+ * \param compare sort function
+ */
+void printTop(const char * title, int (*compare)(const void *, const void *))
+{
+    size_t i;
+
+    qsort(sites, siteCount, sizeof(ProfSite), compare);
+
+    printf("\nTop call sites %s\n", title);
+    printf("%20s %12s %12s %10s  %s\n", "total", "count", "average", "max", "call site");
+    for ( i = 0; i < siteCount && i < topCount; i++ )
+    {
+        printf("%20llu %12llu %12llu %10lu  %s:%lu\n", sites[i].total, sites[i].count,
+               ( sites[i].count != 0 ) ? sites[i].total / sites[i].count : 0ULL,
+               sites[i].max, sites[i].file, sites[i].line);
+    }
+}
+
+/**
+ * \brief Parses the command-line options
+ * \param argc number of arguments
+ * \param argv arguments
+ */
+void ParseOpt(int argc, char *argv[])
+{
+    int     c;
+
+    while( EOF != (c = getopt(argc, argv, "f:i:n:h")) )
+    {
+        switch( c )
+        {
+            case 'f':
+            {
+                inputFile = optarg;
+                break;
+            }
+            case 'i':
+            {
+                instance = strtol(optarg, NULL, 0);
+                break;
+            }
+            case 'n':
+            {
+                topCount = strtoul(optarg, NULL, 0);
+                break;
+            }
+            case 'h':
+            {
+                help();
+                exit(0);
+            }
+            default:        //false parameter
+            {
+                help();
+                exit(1);
+            }
+        }
+    }
+}
+
+/** \brief Displays the helpstring */
+void help() { printf("%s", helpstring); }
+
+/**
+ * \}
+ * \}
+ */
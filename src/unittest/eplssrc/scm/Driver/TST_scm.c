@@ -0,0 +1,67 @@
+/**
+ * \file TST_scm.c
+ * Specifies the unittests for the node commands of the safety configuration manager
+ * \addtogroup unittest
+ * \{
+ * \addtogroup eplssrc
+ * \{
+ * \addtogroup scm
+ * \{
+ * \addtogroup scm_unittest
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <cunit/CUnit.h>
+#include "TST_scm_Unit.h"
+
+/*Initialization for the test, no effects at all*/
+int TST_SCM_INIT(void)
+{
+    return 0;
+}
+
+static CU_TestInfo nodeTests[] = {
+    { "[SCM] Node commands with a gap in the SADR-DVI list", TST_SCM_node_cmd_gap },
+    { "[SCM] Update of the Additional SADR list", TST_SCM_add_sadr_update },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_SuiteInfo suites[] = {
+    { "SCM Unittests", TST_SCM_INIT, NULL, nodeTests },
+    CU_SUITE_INFO_NULL,
+};
+
+
+/*Add tests to the suites*/
+void TST_AddTests(void)
+{
+    assert(NULL != CU_get_registry());
+    assert(!CU_is_test_running());
+
+    /* Register suites. */
+    if (CU_register_suites(suites) != CUE_SUCCESS) {
+        fprintf(stderr, "suite registration failed - %s\n", CU_get_error_msg());
+        exit(EXIT_FAILURE);
+    }
+
+}/*TST_AddTests()*/
+
+/**
+* \}
+* \}
+* \}
+* \}
+*/
@@ -0,0 +1,317 @@
+/**
+ * \file TST_scm_Stubs.c
+ * Simulated SOD and stubs of the units used by the safety configuration manager
+ * \addtogroup unittest
+ * \{
+ * \addtogroup eplssrc
+ * \{
+ * \addtogroup scm
+ * \{
+ * \addtogroup scm_unittest
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <string.h>
+
+#include "SCMint.h"
+
+#include "TST_scm_Unit.h"
+
+/* number of SADRs with an UDID and an Additional SADR list entry */
+#define TST_NO_SADR 8
+#define TST_MAX_OBJ 64
+#define TST_UDID_LEN 6
+#define TST_CHKSM_LEN 16
+
+typedef struct
+{
+    UINT16 idx;
+    UINT8 subIdx;
+    SOD_t_ATTR attr;
+    void * data;
+} tstObj;
+
+static tstObj sodObj[TST_MAX_OBJ];
+static UINT16 noObj;
+
+static UINT32 guardTime;
+static UINT8 configMode;
+static UINT16 dviSadr[TST_SCM_NO_DVI];
+static UINT8 dviStatus[TST_SCM_NO_DVI];
+static UINT16 dviPayLd[TST_SCM_NO_DVI];
+static UINT32 dviPollInt[TST_SCM_NO_DVI];
+static UINT8 dviRemChksm[TST_SCM_NO_DVI][TST_CHKSM_LEN];
+static UINT8 udid[TST_NO_SADR][TST_UDID_LEN];
+static UINT16 mainSadr[TST_NO_SADR];
+static UINT16 txSpdoNum[TST_NO_SADR];
+
+static UINT16 lastError;
+
+UINT32 SCFM_dw_PathProgress;
+
+static void addObj(UINT16 idx, UINT8 subIdx, EPLS_t_DATATYPE type, void * data, UINT32 len)
+{
+    assert(noObj < TST_MAX_OBJ);
+
+    sodObj[noObj].idx = idx;
+    sodObj[noObj].subIdx = subIdx;
+    sodObj[noObj].attr.w_attr = SOD_k_ATTR_RW;
+    sodObj[noObj].attr.e_dataType = type;
+    sodObj[noObj].attr.dw_objLen = len;
+    sodObj[noObj].attr.pv_defValue = NULL;
+    sodObj[noObj].data = data;
+    noObj++;
+}
+
+void TST_SCM_SodReset(void)
+{
+    UINT16 i;
+
+    noObj = 0;
+    lastError = 0;
+
+    guardTime = 1000UL;
+    configMode = 0;
+    addObj(SCM_k_IDX_GUARD_TIME, EPLS_k_UINT32, &guardTime, sizeof(guardTime));
+    addObj(SCM_k_IDX_CONFIG_MODE, EPLS_k_UINT8, &configMode, sizeof(configMode));
+
+    /* entry 1 is not used, this is the gap in the SADR-DVI list */
+    dviSadr[0] = 2;
+    dviSadr[1] = 0;
+    dviSadr[2] = 4;
+
+    for ( i = 0; i < TST_SCM_NO_DVI; i++ )
+    {
+        dviStatus[i] = SCM_k_NS_MISSING;
+        dviPayLd[i] = 8;
+        dviPollInt[i] = 500UL;
+        memset(dviRemChksm[i], 0, TST_CHKSM_LEN);
+
+        addObj(SCM_k_IDX_SADR(i), EPLS_k_UINT16, &dviSadr[i], sizeof(UINT16));
+        addObj(SCM_k_IDX_SN_STATUS(i), EPLS_k_UINT8, &dviStatus[i], sizeof(UINT8));
+        addObj(SCM_k_IDX_MAX_SSDO_PAYLD(i), EPLS_k_UINT16, &dviPayLd[i], sizeof(UINT16));
+        addObj(SCM_k_IDX_POLL_INTERVALL(i), EPLS_k_UINT32, &dviPollInt[i], sizeof(UINT32));
+        addObj(SCM_k_IDX_REM_PARA_CHKSM(i), EPLS_k_DOMAIN, dviRemChksm[i], TST_CHKSM_LEN);
+    }
+
+    for ( i = 0; i < TST_NO_SADR; i++ )
+    {
+        memset(udid[i], (int)(i + 1), TST_UDID_LEN);
+        mainSadr[i] = (UINT16)(i + 1);
+        txSpdoNum[i] = 1;
+
+        addObj(SCM_k_IDX_UDID_LIST(i + 1, 1), EPLS_k_OCTET_STRING, udid[i], TST_UDID_LEN);
+        addObj((UINT16)(0xC801U + i), 1, EPLS_k_UINT16, &mainSadr[i], sizeof(UINT16));
+        addObj((UINT16)(0xC801U + i), 2, EPLS_k_UINT16, &txSpdoNum[i], sizeof(UINT16));
+    }
+}
+
+void TST_SCM_DviSadrSet(uint16_t dviIdx, uint16_t sadr)
+{
+    assert(dviIdx < TST_SCM_NO_DVI);
+    dviSadr[dviIdx] = sadr;
+}
+
+void TST_SCM_MainSadrSet(uint16_t addSadr, uint16_t mSadr)
+{
+    assert((addSadr > 0) && (addSadr <= TST_NO_SADR));
+    mainSadr[addSadr - 1] = mSadr;
+}
+
+uint16_t TST_SCM_LastError(void)
+{
+    uint16_t err = lastError;
+
+    lastError = 0;
+    return err;
+}
+
+/* simulated SOD, the handle is the index in sodObj */
+
+const SOD_t_ATTR *SOD_AttrGet(BYTE_B_INSTNUM_ UINT16 w_idx, UINT8 b_subIdx,
+        UINT32 *pdw_hdl, BOOLEAN *po_appObj,
+        SOD_t_ERROR_RESULT *ps_errRes)
+{
+    UINT16 i;
+
+    *po_appObj = FALSE;
+    for ( i = 0; i < noObj; i++ )
+    {
+        if ( ( sodObj[i].idx == w_idx ) && ( sodObj[i].subIdx == b_subIdx ) )
+        {
+            *pdw_hdl = i;
+            return &sodObj[i].attr;
+        }
+    }
+
+    ps_errRes->w_errorCode = 1;
+    ps_errRes->e_abortCode = SOD_ABT_OBJ_DOES_NOT_EXIST;
+    return NULL;
+}
+
+void *SOD_Read(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
+        UINT32 dw_offset, UINT32 dw_size,
+        SOD_t_ERROR_RESULT *ps_errRes)
+{
+    (void)o_appObj;
+    (void)dw_size;
+    (void)ps_errRes;
+
+    return (UINT8 *)sodObj[dw_hdl].data + dw_offset;
+}
+
+BOOLEAN SOD_Write(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
+        const void *pv_data, BOOLEAN o_overwrite, UINT32 dw_offset,
+        UINT32 dw_size)
+{
+    (void)o_appObj;
+    (void)o_overwrite;
+
+    if ( dw_size == SOD_k_LEN_NOT_NEEDED )
+        dw_size = sodObj[dw_hdl].attr.dw_objLen;
+    memcpy((UINT8 *)sodObj[dw_hdl].data + dw_offset, pv_data, dw_size);
+    return TRUE;
+}
+
+BOOLEAN SOD_ActualLenGet(BYTE_B_INSTNUM_ UINT32 dw_hdl, BOOLEAN o_appObj,
+        UINT32 *pdw_objLen)
+{
+    (void)o_appObj;
+
+    *pdw_objLen = sodObj[dw_hdl].attr.dw_objLen;
+    return TRUE;
+}
+
+/* stubs of the other units */
+
+void SERR_SetError(BYTE_B_INSTNUM_ UINT16 w_error, UINT32 dw_addInfo)
+{
+    (void)dw_addInfo;
+    lastError = w_error;
+}
+
+UINT16 SDN_GetSdn(BYTE_B_INSTNUM)
+{
+    return 1;
+}
+
+BOOLEAN SNMTM_CheckFsmAvailable(void)
+{
+    return TRUE;
+}
+
+BOOLEAN SNMTM_ReqAssgnAddSadr(UINT32 dw_ct, UINT16 w_regNum, UINT16 w_sadr,
+                              UINT16 w_sadrAssgn, UINT16 w_spdoNumAssgn)
+{
+    (void)dw_ct; (void)w_regNum; (void)w_sadr; (void)w_sadrAssgn; (void)w_spdoNumAssgn;
+    return TRUE;
+}
+
+BOOLEAN SNMTM_ReqAssgnSadr(UINT32 dw_ct, UINT16 w_regNum, UINT16 w_sadr,
+                           const UINT8 *pb_udid)
+{
+    (void)dw_ct; (void)w_regNum; (void)w_sadr; (void)pb_udid;
+    return TRUE;
+}
+
+BOOLEAN SNMTM_ReqAssgnScmUdid(UINT32 dw_ct, UINT16 w_regNum, UINT16 w_sadr,
+                              const UINT8 *pb_udidScm)
+{
+    (void)dw_ct; (void)w_regNum; (void)w_sadr; (void)pb_udidScm;
+    return TRUE;
+}
+
+BOOLEAN SNMTM_ReqGuarding(UINT32 dw_ct, UINT16 w_regNum, UINT16 w_sadr)
+{
+    (void)dw_ct; (void)w_regNum; (void)w_sadr;
+    return TRUE;
+}
+
+BOOLEAN SNMTM_ReqSnTrans(UINT32 dw_ct, UINT16 w_regNum, UINT16 w_sadr,
+                         SNMTM_t_SN_TRANS e_snTrans, UINT32 dw_paramTStmp)
+{
+    (void)dw_ct; (void)w_regNum; (void)w_sadr; (void)e_snTrans; (void)dw_paramTStmp;
+    return TRUE;
+}
+
+BOOLEAN SNMTM_ReqUdid(UINT32 dw_ct, UINT16 w_regNum, UINT16 w_sadr)
+{
+    (void)dw_ct; (void)w_regNum; (void)w_sadr;
+    return TRUE;
+}
+
+BOOLEAN SNMTM_SnErrorAck(UINT16 w_sadr, UINT8 b_errorGroup, UINT8 b_errorCode)
+{
+    (void)w_sadr; (void)b_errorGroup; (void)b_errorCode;
+    return TRUE;
+}
+
+BOOLEAN SSDOC_CheckFsmAvailable(void)
+{
+    return TRUE;
+}
+
+BOOLEAN SSDOC_SendReadReq(UINT16 w_sadr, UINT16 w_reqNum,
+                          SSDOC_t_RESP_CLBK pf_respClbk, UINT32 dw_ct,
+                          const SSDOC_t_REQ *ps_req)
+{
+    (void)w_sadr; (void)w_reqNum; (void)pf_respClbk; (void)dw_ct; (void)ps_req;
+    return TRUE;
+}
+
+BOOLEAN SSDOC_SendWriteReq(UINT16 w_sadr, UINT16 w_reqNum,
+                           SSDOC_t_RESP_CLBK pf_respClbk, UINT32 dw_ct,
+                           SSDOC_t_REQ *ps_req, BOOLEAN const o_fastDld)
+{
+    (void)w_sadr; (void)w_reqNum; (void)pf_respClbk; (void)dw_ct; (void)ps_req;
+    (void)o_fastDld;
+    return TRUE;
+}
+
+/* the FSMs are not processed, only the node commands are executed */
+BOOLEAN SAPL_ScmProcessSn(UINT16 const w_sadr)
+{
+    (void)w_sadr;
+    return FALSE;
+}
+
+void SAPL_ScmNodeStatusChangedClbk(UINT16 w_sadr, UINT8 b_oldStatus,
+                                   UINT8 b_newStatus)
+{
+    (void)w_sadr; (void)b_oldStatus; (void)b_newStatus;
+}
+
+BOOLEAN SAPL_ScmRevisionNumberClbk(UINT16 w_sadr, UINT32 dw_expRevNum,
+                                   UINT32 dw_recRevNum)
+{
+    (void)w_sadr; (void)dw_expRevNum; (void)dw_recRevNum;
+    return TRUE;
+}
+
+void SAPL_ScmSnFailClbk(UINT16 w_sadr, UINT8 b_errGroup, UINT8 b_errCode,
+                        UINT16 w_hdl)
+{
+    (void)w_sadr; (void)b_errGroup; (void)b_errCode; (void)w_hdl;
+}
+
+void SAPL_ScmUdidMismatchClbk(UINT16 w_sadr, const UINT8 *pa_newUdid,
+                              UINT16 w_hdl)
+{
+    (void)w_sadr; (void)pa_newUdid; (void)w_hdl;
+}
+
+/**
+* \}
+* \}
+* \}
+* \}
+*/
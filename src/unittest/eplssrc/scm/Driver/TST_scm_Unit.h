@@ -0,0 +1,113 @@
+/**
+ * \file TST_scm_Unit.h
+ * Specifies the unittests for the node commands of the safety configuration manager
+ * \addtogroup unittest
+ * \{
+ * \addtogroup eplssrc
+ * \{
+ * \addtogroup scm
+ * \{
+ * \addtogroup scm_unittest
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <stdint.h>
+#include <assert.h>
+
+#ifndef U_TST_scm_H_
+#define U_TST_scm_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** number of entries of the simulated SADR-DVI list */
+#define TST_SCM_NO_DVI 3
+
+/**
+ * \brief reset the simulated SOD of the SCM
+ *
+ * \details the SADR-DVI list has a gap, entry 1 is not used (SADR 0), so the
+ * SNs of the entries 0 and 2 get the FSM slots 0 and 1. No additional SADR
+ * is assigned.
+ *
+ * \param none
+ *
+ * \return none
+ */
+void TST_SCM_SodReset(void);
+
+/**
+ * \brief set the SADR of an entry of the simulated SADR-DVI list
+ *
+ * \param dviIdx index in the SADR-DVI list, < TST_SCM_NO_DVI
+ * \param sadr SADR of the SN, 0 for an unused entry
+ *
+ * \return none
+ */
+void TST_SCM_DviSadrSet(uint16_t dviIdx, uint16_t sadr);
+
+/**
+ * \brief set the main SADR of an entry of the simulated Additional SADR list
+ *
+ * \param addSadr additional SADR, 1 .. 8
+ * \param mainSadr main SADR, == addSadr if the entry is not used
+ *
+ * \return none
+ */
+void TST_SCM_MainSadrSet(uint16_t addSadr, uint16_t mainSadr);
+
+/**
+ * \brief return and clear the last error reported via SERR_SetError()
+ *
+ * \param none
+ *
+ * \return error code, 0 if no error was reported
+ */
+uint16_t TST_SCM_LastError(void);
+
+/**
+ * \brief test the node commands with a gap in the SADR-DVI list
+ *
+ * \details the SNs are addressed by their SADR-DVI list index, the FSM slots
+ * are packed, reconfigure and remove have to access the SADR-DVI entry of the
+ * SN and add has to fill a new slot with the entry of the gap
+ *
+ * \param none
+ *
+ * \return none
+ */
+void TST_SCM_node_cmd_gap(void);
+
+/**
+ * \brief test the update of the Additional SADR list
+ *
+ * \details a changed entry must not be used while an SN is in the additional
+ * SADR assignment, the assignment is finished with the old list
+ *
+ * \param none
+ *
+ * \return none
+ */
+void TST_SCM_add_sadr_update(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*TST_scm_H_*/
+/**
+* \}
+* \}
+* \}
+* \}
+*/
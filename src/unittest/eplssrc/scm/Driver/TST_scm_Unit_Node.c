@@ -0,0 +1,141 @@
+/**
+ * \file TST_scm_Unit_Node.c
+ * Specifies the unittests for the node commands of the safety configuration manager
+ * \addtogroup unittest
+ * \{
+ * \addtogroup eplssrc
+ * \{
+ * \addtogroup scm
+ * \{
+ * \addtogroup scm_unittest
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include "SCMint.h"
+
+#include <cunit/CUnit.h>
+#include "TST_scm_Unit.h"
+
+/* calls of SCM_Trigger() which visit every FSM slot once */
+static void scmTriggerAll(void)
+{
+    UINT8 numFreeFrms;
+    UINT16 i;
+
+    for ( i = 0; i < SCM_cfg_MAX_NUM_OF_NODES; i++ )
+    {
+        numFreeFrms = 1;
+        SCM_Trigger(0UL, &numFreeFrms);
+    }
+}
+
+static void scmStart(void)
+{
+    TST_SCM_SodReset();
+    SCM_Init();
+    CU_ASSERT_TRUE(SCM_Activate());
+    CU_ASSERT_EQUAL(TST_SCM_LastError(), 0);
+}
+
+void TST_SCM_node_cmd_gap(void)
+{
+    scmStart();
+
+    /* the FSM slots are packed, the SADR-DVI entry 1 is skipped */
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[0].w_sadr, 2);
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[0].w_dviIdx, 0);
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[1].w_sadr, 4);
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[1].w_dviIdx, 2);
+
+    /* reconfigure reads the SADR-DVI entry 2 into slot 1, slot 0 is unchanged */
+    TST_SCM_DviSadrSet(2, 6);
+    CU_ASSERT_TRUE(SCM_ReconfigureNode(2));
+    scmTriggerAll();
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[1].w_sadr, 6);
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[1].w_dviIdx, 2);
+    CU_ASSERT_FALSE(SCM_as_FsmCb[1].o_removed);
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[0].w_sadr, 2);
+
+    /* the unused entry is not managed by the SCM */
+    CU_ASSERT_FALSE(SCM_RemoveNode(1));
+    CU_ASSERT_EQUAL(TST_SCM_LastError(), SCM_k_NODE_DVI_IDX_ERR);
+    CU_ASSERT_FALSE(SCM_ReconfigureNode(1));
+    CU_ASSERT_EQUAL(TST_SCM_LastError(), SCM_k_NODE_DVI_IDX_ERR);
+
+    /* remove stops the SN of slot 1 only */
+    CU_ASSERT_TRUE(SCM_RemoveNode(2));
+    scmTriggerAll();
+    CU_ASSERT_TRUE(SCM_as_FsmCb[1].o_removed);
+    CU_ASSERT_FALSE(SCM_as_FsmCb[0].o_removed);
+
+    /* add fills a new slot with the SN of the former gap */
+    TST_SCM_DviSadrSet(1, 3);
+    CU_ASSERT_TRUE(SCM_AddNode(1));
+    scmTriggerAll();
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[2].w_sadr, 3);
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[2].w_dviIdx, 1);
+    CU_ASSERT_FALSE(SCM_as_FsmCb[2].o_removed);
+
+    /* add of a removed SN uses its former slot again */
+    CU_ASSERT_TRUE(SCM_AddNode(2));
+    scmTriggerAll();
+    CU_ASSERT_FALSE(SCM_as_FsmCb[1].o_removed);
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[1].w_sadr, 6);
+    CU_ASSERT_EQUAL(SCM_as_FsmCb[0].w_sadr, 2);
+
+    /* a SADR-DVI list index out of range is rejected */
+    CU_ASSERT_FALSE(SCM_AddNode(SCM_cfg_MAX_NUM_OF_NODES));
+    CU_ASSERT_EQUAL(TST_SCM_LastError(), SCM_k_NODE_DVI_IDX_ERR);
+
+    SCM_Deactivate();
+    CU_ASSERT_FALSE(SCM_ReconfigureNode(0));
+    CU_ASSERT_EQUAL(TST_SCM_LastError(), SCM_k_NODE_STOPPED_ERR);
+}
+
+void TST_SCM_add_sadr_update(void)
+{
+    UINT16 w_pos;
+
+    scmStart();
+
+    /* SADR 5 becomes an additional SADR of the SN with SADR 4 (slot 1) */
+    TST_SCM_MainSadrSet(5, 4);
+
+    /* the SN of slot 1 is in the additional SADR assignment */
+    SCM_as_FsmCb[1].e_state = SCM_k_WF_ADD_SADR_RESP;
+    CU_ASSERT_TRUE(SCM_UpdateAddSadr(5));
+    scmTriggerAll();
+
+    /* the running assignment still uses the old list */
+    w_pos = 0;
+    CU_ASSERT_EQUAL(SCM_GetNextAddSadr(4, &w_pos), 0);
+
+    /* the list is used after the assignment */
+    SCM_as_FsmCb[1].e_state = SCM_k_WF_GUARD_TIMER;
+    scmTriggerAll();
+    w_pos = 0;
+    CU_ASSERT_EQUAL(SCM_GetNextAddSadr(4, &w_pos), 5);
+    CU_ASSERT_EQUAL(SCM_GetNextAddSadr(4, &w_pos), 0);
+
+    /* an invalid additional SADR is rejected */
+    CU_ASSERT_FALSE(SCM_UpdateAddSadr(0));
+    CU_ASSERT_EQUAL(TST_SCM_LastError(), SCM_k_ADD_SADR_ERR);
+
+    SCM_Deactivate();
+}
+
+/**
+* \}
+* \}
+* \}
+* \}
+*/
@@ -0,0 +1,75 @@
+/**
+ * \file TST_Stubs.h
+ * Loopback stubs of the SHNF and the SAPL shared by the tests of the stack
+ * \addtogroup unittest
+ * \{
+ * \addtogroup eplssrc
+ * \{
+ * \addtogroup stubs
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ *
+ * TST_shnf_Stubs.c provides the SHNF of the stack: the CRCs are calculated by
+ * liboschecksum and a transmitted frame stays in one memory block, which is
+ * read back with TST_SHNF_TxFrame(). TST_sapl_Stubs.c provides the SAPL
+ * callbacks of the SOD and the SERR without any application objects, the
+ * signaled errors are counted.
+ */
+
+#ifndef U_TST_Stubs_H_
+#define U_TST_Stubs_H_
+
+#include "EPLStarget.h"
+#include "EPLScfg.h"
+#include "EPLStypes.h"
+
+/** \brief Size of the memory block of a transmitted frame, the longest frame has 254 bytes payload twice */
+#define TST_SHNF_MAX_FRAME_LEN (2u * 254u + 13u)
+
+/**
+ * \brief Returns the memory block of the last frame requested by the stack
+ *
+ * The memory block holds sub frame TWO before sub frame ONE, as serialized by
+ * SFS_FrmSerialize().
+ *
+ * \param len length of the memory block, returned
+ *
+ * \return the memory block
+ */
+UINT8 * TST_SHNF_TxFrame(UINT16 * len);
+
+/**
+ * \brief Returns the number of frames marked as ready to send by the stack
+ */
+unsigned long TST_SHNF_TxCount(void);
+
+/**
+ * \brief Resets the counted and the last error signaled by SAPL_SERR_SignalErrorClbk()
+ */
+void TST_SAPL_ErrorReset(void);
+
+/**
+ * \brief Returns the number of errors signaled since TST_SAPL_ErrorReset()
+ */
+unsigned long TST_SAPL_ErrorCount(void);
+
+/**
+ * \brief Returns the last error code signaled, 0 if none was signaled
+ */
+UINT16 TST_SAPL_LastError(void);
+
+#endif /* U_TST_Stubs_H_ */
+
+/**
+ * \}
+ * \}
+ * \}
+ */
@@ -0,0 +1,159 @@
+/**
+ * \file TST_sapl_Stubs.c
+ * Stubs of the SAPL callbacks used by the units of the stack
+ * \addtogroup unittest
+ * \{
+ * \addtogroup eplssrc
+ * \{
+ * \addtogroup stubs
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include "TST_Stubs.h"
+
+#include "SODapi.h"
+#include "SERRapi.h"
+
+static unsigned long errorCount;
+static UINT16 lastError;
+
+void TST_SAPL_ErrorReset(void)
+{
+    errorCount = 0;
+    lastError = 0;
+}
+
+unsigned long TST_SAPL_ErrorCount(void)
+{
+    return errorCount;
+}
+
+UINT16 TST_SAPL_LastError(void)
+{
+    return lastError;
+}
+
+void SAPL_SERR_SignalErrorClbk(BYTE_B_INSTNUM_ UINT16 w_errorCode,
+        UINT32 dw_addInfo)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)dw_addInfo;
+
+    errorCount++;
+    lastError = w_errorCode;
+}
+
+#if (SOD_cfg_APPLICATION_OBJ == EPLS_k_ENABLE)
+/* the application has no objects, every object is searched in the SOD only */
+
+BOOLEAN SAPL_SOD_DefaultValueSetClbk(BYTE_B_INSTNUM)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    return TRUE;
+}
+
+const SOD_t_ATTR *SAPL_SOD_AttrGetClbk(BYTE_B_INSTNUM_ UINT16 w_idx,
+        UINT8 b_subIdx, UINT32 *pdw_hdl,
+        SOD_t_ABORT_CODES *pe_saplError)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)w_idx;
+    (void)b_subIdx;
+    (void)pdw_hdl;
+
+    *pe_saplError = SOD_ABT_OBJ_DOES_NOT_EXIST;
+    return (SOD_t_ATTR *)NULL;
+}
+
+void *SAPL_SOD_ReadClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl, UINT32 dw_offset,
+        UINT32 dw_size, SOD_t_ABORT_CODES *pe_saplError)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)dw_hdl;
+    (void)dw_offset;
+    (void)dw_size;
+
+    *pe_saplError = SOD_ABT_OBJ_DOES_NOT_EXIST;
+    return NULL;
+}
+
+SOD_t_ABORT_CODES SAPL_SOD_WriteClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+        const void *pv_data,
+        BOOLEAN o_overwrite, UINT32 dw_offset,
+        UINT32 dw_size)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)dw_hdl;
+    (void)pv_data;
+    (void)o_overwrite;
+    (void)dw_offset;
+    (void)dw_size;
+
+    return SOD_ABT_OBJ_DOES_NOT_EXIST;
+}
+
+BOOLEAN SAPL_SOD_LockClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)dw_hdl;
+    return FALSE;
+}
+
+BOOLEAN SAPL_SOD_UnlockClbk(BYTE_B_INSTNUM_ UINT32 dw_hdl)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)dw_hdl;
+    return FALSE;
+}
+
+SOD_t_ABORT_CODES SAPL_SOD_ActualLenSet(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+        UINT32 dw_actLen)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)dw_hdl;
+    (void)dw_actLen;
+    return SOD_ABT_OBJ_DOES_NOT_EXIST;
+}
+
+SOD_t_ABORT_CODES SAPL_SOD_ActualLenGet(BYTE_B_INSTNUM_ UINT32 dw_hdl,
+        UINT32 *pdw_objLen)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)dw_hdl;
+    (void)pdw_objLen;
+    return SOD_ABT_OBJ_DOES_NOT_EXIST;
+}
+#endif
+
+/**
+* \}
+* \}
+* \}
+*/
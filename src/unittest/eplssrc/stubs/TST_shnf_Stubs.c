@@ -0,0 +1,100 @@
+/**
+ * \file TST_shnf_Stubs.c
+ * Loopback stubs of the SHNF used by the units of the stack
+ * \addtogroup unittest
+ * \{
+ * \addtogroup eplssrc
+ * \{
+ * \addtogroup stubs
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include "TST_Stubs.h"
+
+#include "SHNF.h"
+
+#include <oschecksum/crc.h>
+
+#if (SPDO_cfg_CONNECTION_VALID_BIT_FIELD == EPLS_k_ENABLE)
+UINT32 SHNF_aaulConnValidBit[EPLS_cfg_MAX_INSTANCES][(SPDO_cfg_MAX_NO_RX_SPDO + 31) / 32];
+#if (SPDO_cfg_CONNECTION_VALID_STATISTIC == EPLS_k_ENABLE)
+UINT32 SHNF_aaulConnValidStatistic[EPLS_cfg_MAX_INSTANCES][SPDO_cfg_MAX_NO_RX_SPDO];
+#endif
+#endif
+
+static UINT8 txBlock[TST_SHNF_MAX_FRAME_LEN];
+static UINT16 txBlockLen;
+static unsigned long txCount;
+
+UINT8 * TST_SHNF_TxFrame(UINT16 * len)
+{
+    *len = txBlockLen;
+    return txBlock;
+}
+
+unsigned long TST_SHNF_TxCount(void)
+{
+    return txCount;
+}
+
+UINT8 * SHNF_GetTxMemBlock(BYTE_B_INSTNUM_ UINT16 w_blockSize,
+        SHNF_t_TEL_TYPE e_telType, UINT16 w_txSpdoNum)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+    (void)e_telType;
+    (void)w_txSpdoNum;
+
+    if ( w_blockSize > sizeof(txBlock) )
+        return (UINT8 *)NULL;
+
+    txBlockLen = w_blockSize;
+    return txBlock;
+}
+
+BOOLEAN SHNF_MarkTxMemBlock(BYTE_B_INSTNUM_ const UINT8 *pb_memBlock)
+{
+#if (EPLS_cfg_MAX_INSTANCES > 1)
+    (void)b_instNum;
+#endif
+
+    if ( pb_memBlock != txBlock )
+        return FALSE;
+
+    txCount++;
+    return TRUE;
+}
+
+UINT8 HNFiff_Crc8CalcSwp(UINT8 b_initCrc, INT32 l_subFrameLength,
+        const void *pv_subFrame)
+{
+    return crc8Checksum((uint32_t)l_subFrameLength, (const uint8_t *)pv_subFrame, b_initCrc);
+}
+
+UINT16 HNFiff_Crc16_755B_CalcSwp(UINT16 w_initCrc, INT32 l_subFrameLength,
+        const void *pv_subFrame)
+{
+    return crc16Checksum((uint32_t)l_subFrameLength, (const uint8_t *)pv_subFrame, w_initCrc);
+}
+
+UINT16 HNFiff_Crc16CalcSwp(UINT16 w_initCrc, INT32 l_subFrameLength,
+        const void *pv_subFrame)
+{
+    return crc16Checksum_AC9A((uint32_t)l_subFrameLength, (const uint8_t *)pv_subFrame, w_initCrc);
+}
+
+/**
+* \}
+* \}
+* \}
+*/
@@ -0,0 +1,67 @@
+/**
+ * \file TST_oscapture.c
+ * Specifies the unittests for the capture and replay of openSAFETY frames
+ * \addtogroup unittest
+ * \{
+ * \addtogroup tools
+ * \{
+ * \addtogroup oscapture
+ * \{
+ * \addtogroup liboscapture_unittest
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <cunit/CUnit.h>
+#include "TST_oscapture_Unit.h"
+
+/*Initialization for the test, no effects at all*/
+int TST_CAP_INIT(void)
+{
+    return 0;
+}
+
+static CU_TestInfo captureTests[] = {
+    { "[CAP] Write and read back", TST_CAP_write_read },
+    { "[CAP] Replay against simulated stack", TST_CAP_replay },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_SuiteInfo suites[] = {
+    { "Capture Unittests", TST_CAP_INIT, NULL, captureTests },
+    CU_SUITE_INFO_NULL,
+};
+
+
+/*Add tests to the suites*/
+void TST_AddTests(void)
+{
+    assert(NULL != CU_get_registry());
+    assert(!CU_is_test_running());
+
+    /* Register suites. */
+    if (CU_register_suites(suites) != CUE_SUCCESS) {
+        fprintf(stderr, "suite registration failed - %s\n", CU_get_error_msg());
+        exit(EXIT_FAILURE);
+    }
+
+}/*TST_AddTests()*/
+
+/**
+* \}
+* \}
+* \}
+* \}
+*/
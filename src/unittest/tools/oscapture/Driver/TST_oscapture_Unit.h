@@ -0,0 +1,72 @@
+/**
+ * \file TST_oscapture_Unit.h
+ * Specifies the unittests for the capture and replay of openSAFETY frames
+ * \addtogroup unittest
+ * \{
+ * \addtogroup tools
+ * \{
+ * \addtogroup oscapture
+ * \{
+ * \addtogroup liboscapture_unittest
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <stdint.h>
+#include <assert.h>
+
+#include <cunit/CUnit.h>
+
+#include <oscapture/capture.h>
+
+#ifndef U_TST_oscapture_H_
+#define U_TST_oscapture_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief test that written records are read back unchanged
+ *
+ * \details random frames of all lengths are written with a consecutive time
+ * which wraps around, a truncated file has to be reported as corrupt
+ *
+ * \param none
+ *
+ * \return none
+ */
+void TST_CAP_write_read(void);
+
+/**
+ * \brief test the replay of a capture against a simulated stack
+ *
+ * \details the simulated stack answers every received SNMT frame with a frame
+ * derived from it, the replay has to report matching, differing, missing and
+ * additional transmitted frames
+ *
+ * \param none
+ *
+ * \return none
+ */
+void TST_CAP_replay(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*TST_oscapture_H_*/
+/**
+* \}
+* \}
+* \}
+* \}
+*/
@@ -0,0 +1,277 @@
+/**
+ * \file TST_oscapture_Unit_Capture.c
+ * Specifies the unittests for the capture and replay of openSAFETY frames
+ * \addtogroup unittest
+ * \{
+ * \addtogroup tools
+ * \{
+ * \addtogroup oscapture
+ * \{
+ * \addtogroup liboscapture_unittest
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cunit/CUnit.h>
+#include <oscapture/capture.h>
+#include "TST_oscapture_Unit.h"
+
+#define CAP_FILE "TST_oscapture.cap"
+#define CAP_NO_RECORDS 600
+#define CAP_NO_RX 100
+
+/* frame ID byte of sub frame ONE for an SPDO and an SNMT frame */
+#define CAP_ID_SPDO ( 0x30 << 2 )
+#define CAP_ID_SNMT ( 0x28 << 2 )
+
+static uint8_t capData[CAP_NO_RECORDS][OSCAP_MAX_FRAME_LEN];
+
+/* simulated stack, answers every SNMT frame with the inverted frame */
+typedef struct
+{
+    oscapReplay * rp;
+    uint8_t frame[OSCAP_MAX_FRAME_LEN];
+    uint16_t len;
+    unsigned long cycles;
+    unsigned long spdos;
+    unsigned long snmts;
+    /* SNMT frame number to be answered wrong, dropped or answered twice */
+    long corrupt;
+    long drop;
+    long twice;
+} capStack;
+
+static void capAnswer(uint8_t * answer, const uint8_t * frame, uint16_t len)
+{
+    uint16_t i;
+
+    for ( i = 0; i < len; i++ )
+        answer[i] = (uint8_t)~frame[i];
+}
+
+static void capCycle(void * ctx, uint8_t instNum, uint32_t ct)
+{
+    (void)instNum;
+    (void)ct;
+    ((capStack *)ctx)->cycles++;
+}
+
+static void capRxSpdo(void * ctx, uint8_t instNum, uint32_t ct,
+        const uint8_t * frame, uint16_t len)
+{
+    (void)instNum;
+    (void)ct;
+    CU_ASSERT_EQUAL(frame[1], CAP_ID_SPDO);
+    CU_ASSERT_TRUE(len > 1);
+    ((capStack *)ctx)->spdos++;
+}
+
+/* busy for one call, like SSC_ProcessSNMTSSDOFrame() for a longer request */
+static int capRxSnmt(void * ctx, uint8_t instNum, uint32_t ct,
+        const uint8_t * frame, uint16_t len)
+{
+    capStack * stack = (capStack *)ctx;
+    long n;
+
+    (void)ct;
+    if ( frame != NULL )
+    {
+        CU_ASSERT_EQUAL(frame[1], CAP_ID_SNMT);
+        memcpy(stack->frame, frame, len);
+        stack->len = len;
+        return 1;
+    }
+
+    n = (long)stack->snmts++;
+    if ( n == stack->drop )
+        return 0;
+
+    capAnswer(stack->frame, stack->frame, stack->len);
+    if ( n == stack->corrupt )
+        stack->frame[0] ^= 1;
+    oscapReplayTx(stack->rp, instNum, stack->frame, stack->len);
+    if ( n == stack->twice )
+        oscapReplayTx(stack->rp, instNum, stack->frame, stack->len);
+    return 0;
+}
+
+/* writes CAP_NO_RX received frames, every third one an SNMT frame with answer */
+static unsigned long capWriteReplay(uint32_t ctUnitNs, uint32_t ctStep)
+{
+    oscapFile * cap;
+    uint8_t answer[OSCAP_MAX_FRAME_LEN];
+    unsigned long i, noSnmt = 0;
+    uint16_t len, j;
+
+    cap = oscapCreate(CAP_FILE, ctUnitNs);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(cap);
+
+    for ( i = 0; i < CAP_NO_RX; i++ )
+    {
+        len = (uint16_t)( 11 + rand() % 20 );
+        for ( j = 0; j < len; j++ )
+            capData[0][j] = (uint8_t)rand();
+        capData[0][1] = ( i % 3 == 0 ) ? CAP_ID_SNMT : CAP_ID_SPDO;
+
+        CU_ASSERT_EQUAL(oscapWrite(cap, OSCAP_DIR_RX, (uint8_t)( i % 2 ),
+                (uint32_t)( i * ctStep ), capData[0], len), 0);
+        if ( i % 3 == 0 )
+        {
+            capAnswer(answer, capData[0], len);
+            CU_ASSERT_EQUAL(oscapWrite(cap, OSCAP_DIR_TX, (uint8_t)( i % 2 ),
+                    (uint32_t)( i * ctStep ), answer, len), 0);
+            noSnmt++;
+        }
+    }
+    CU_ASSERT_EQUAL_FATAL(oscapClose(cap), 0);
+    return noSnmt;
+}
+
+/* replays with the stack answering SNMT frame corrupt wrong, dropping drop and answering twice twice */
+static int capRun(oscapReplay * rp, capStack * stack, int paced, long corrupt,
+        long drop, long twice, oscapReplayStats * stats)
+{
+    static const oscapReplayOps ops = { capCycle, capRxSpdo, capRxSnmt };
+
+    memset(stack, 0, sizeof(capStack));
+    stack->rp = rp;
+    stack->corrupt = corrupt;
+    stack->drop = drop;
+    stack->twice = twice;
+    return oscapReplayRun(rp, &ops, stack, paced, stats);
+}
+
+void TST_CAP_write_read(void)
+{
+    oscapFile * cap;
+    oscapRecord rec;
+    uint32_t ct[CAP_NO_RECORDS];
+    uint16_t len[CAP_NO_RECORDS];
+    uint16_t i, j;
+    long size;
+    FILE * file;
+
+    cap = oscapCreate(CAP_FILE, 1000);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(cap);
+
+    /* the consecutive time wraps around after a few records */
+    for ( i = 0; i < CAP_NO_RECORDS; i++ )
+    {
+        ct[i] = 0xFFFFFF00UL + (uint32_t)i * (uint32_t)( rand() % 100000 );
+        len[i] = (uint16_t)( i % ( OSCAP_MAX_FRAME_LEN + 1 ) );
+        for ( j = 0; j < len[i]; j++ )
+            capData[i][j] = (uint8_t)rand();
+        CU_ASSERT_EQUAL(oscapWrite(cap, (uint8_t)( i % 2 ), (uint8_t)( i % 7 ),
+                ct[i], capData[i], len[i]), 0);
+    }
+    CU_ASSERT_EQUAL(oscapWrite(cap, 2, 0, 0, capData[0], 1), -1);
+    CU_ASSERT_EQUAL(oscapWrite(cap, OSCAP_DIR_RX, 0, 0, capData[0], OSCAP_MAX_FRAME_LEN + 1), -1);
+    CU_ASSERT_EQUAL_FATAL(oscapClose(cap), 0);
+
+    cap = oscapOpen(CAP_FILE);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(cap);
+    CU_ASSERT_EQUAL(oscapCtUnit(cap), 1000);
+    for ( i = 0; i < CAP_NO_RECORDS; i++ )
+    {
+        CU_ASSERT_EQUAL_FATAL(oscapRead(cap, &rec), 1);
+        CU_ASSERT_EQUAL(rec.dir, i % 2);
+        CU_ASSERT_EQUAL(rec.instNum, i % 7);
+        CU_ASSERT_EQUAL(rec.ct, ct[i]);
+        CU_ASSERT_EQUAL_FATAL(rec.len, len[i]);
+        CU_ASSERT_EQUAL(memcmp(rec.frame, capData[i], len[i]), 0);
+    }
+    CU_ASSERT_EQUAL(oscapRead(cap, &rec), 0);
+    CU_ASSERT_EQUAL(oscapClose(cap), 0);
+
+    /* cut the last frame */
+    file = fopen(CAP_FILE, "rb");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(file);
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    CU_ASSERT_EQUAL_FATAL(fread(capData[0], 1, (size_t)( size - 1 ), file), (size_t)( size - 1 ));
+    fclose(file);
+    file = fopen(CAP_FILE, "wb");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(file);
+    fwrite(capData[0], 1, (size_t)( size - 1 ), file);
+    fclose(file);
+
+    cap = oscapOpen(CAP_FILE);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(cap);
+    for ( i = 0; i < CAP_NO_RECORDS - 1; i++ )
+        CU_ASSERT_EQUAL_FATAL(oscapRead(cap, &rec), 1);
+    CU_ASSERT_EQUAL(oscapRead(cap, &rec), -1);
+    oscapClose(cap);
+    CU_ASSERT_PTR_NULL(oscapReplayLoad(CAP_FILE));
+
+    remove(CAP_FILE);
+    CU_ASSERT_PTR_NULL(oscapOpen(CAP_FILE));
+}
+
+void TST_CAP_replay(void)
+{
+    oscapReplay * rp;
+    oscapReplayStats stats;
+    capStack stack;
+    unsigned long noSnmt;
+
+    noSnmt = capWriteReplay(0, 7);
+    rp = oscapReplayLoad(CAP_FILE);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(rp);
+
+    CU_ASSERT_EQUAL(capRun(rp, &stack, 0, -1, -1, -1, &stats), 0);
+    CU_ASSERT_EQUAL(stats.rxFrames, CAP_NO_RX);
+    CU_ASSERT_EQUAL(stats.txFrames, noSnmt);
+    CU_ASSERT_EQUAL(stats.txMismatch + stats.txMissing + stats.txExtra, 0);
+    CU_ASSERT_EQUAL(stack.cycles, CAP_NO_RX);
+    CU_ASSERT_EQUAL(stack.spdos + stack.snmts, CAP_NO_RX);
+
+    /* unknown time unit */
+    CU_ASSERT_EQUAL(capRun(rp, &stack, 1, -1, -1, -1, &stats), -1);
+
+    CU_ASSERT_EQUAL(capRun(rp, &stack, 0, 5, -1, -1, &stats), 1);
+    CU_ASSERT_EQUAL(stats.txMismatch, 1);
+    CU_ASSERT_EQUAL(stats.txMissing + stats.txExtra, 0);
+
+    /* the last SNMT frame of an instance is dropped or answered twice */
+    CU_ASSERT_EQUAL(capRun(rp, &stack, 0, -1, (long)noSnmt - 1, -1, &stats), 1);
+    CU_ASSERT_EQUAL(stats.txMissing, 1);
+    CU_ASSERT_EQUAL(stats.txMismatch + stats.txExtra, 0);
+
+    CU_ASSERT_EQUAL(capRun(rp, &stack, 0, -1, -1, (long)noSnmt - 1, &stats), 1);
+    CU_ASSERT_EQUAL(stats.txExtra, 1);
+    CU_ASSERT_EQUAL(stats.txMismatch + stats.txMissing, 0);
+
+    /* frames outside of the replay are ignored */
+    oscapReplayTx(rp, 0, stack.frame, stack.len);
+    oscapReplayFree(rp);
+
+    /* paced replay, 100 frames in 7 us steps */
+    capWriteReplay(1000, 7);
+    rp = oscapReplayLoad(CAP_FILE);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(rp);
+    CU_ASSERT_EQUAL(capRun(rp, &stack, 1, -1, -1, -1, &stats), 0);
+    CU_ASSERT_TRUE(stats.seconds >= ( CAP_NO_RX - 1 ) * 7e-6);
+    oscapReplayFree(rp);
+
+    remove(CAP_FILE);
+}
+
+/**
+* \}
+* \}
+* \}
+* \}
+*/
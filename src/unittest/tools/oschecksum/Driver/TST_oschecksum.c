@@ -41,6 +41,7 @@ static CU_TestInfo crc8Tests[] = {
     { "[CRC8] Protocol implementation against pre-calculated", TST_CRC8_cksum_protocol_prec },
     { "[CRC8] Protocol implementation against implemented calculation", TST_CRC8_cksum_protocol_calc },
     { "[CRC8] Random subframe tests", TST_CRC8_rnd_subframe },
+    { "[CRC8] Multi-buffer against calculated", TST_CRC8_multi },
     CU_TEST_INFO_NULL,
 };
 
@@ -51,6 +52,7 @@ static CU_TestInfo crc16Tests[] = {
     { "[CRC16] Protocol implementation against implemented calculation", TST_CRC16_cksum_protocol_calc },
     { "[CRC16] Random subframe tests", TST_CRC16_rnd_subframe },
     { "[CRC16] Test checksum polynom for basic functionality", TST_CRC16_checksum_poly },
+    { "[CRC16] Multi-buffer against calculated", TST_CRC16_multi },
     CU_TEST_INFO_NULL,
 };
 
@@ -159,6 +159,30 @@ void TST_CRC8_rnd_subframe(void);
  */
 void TST_CRC16_rnd_subframe(void);
 
+/**
+ * \brief test the multi-buffer CRC8 calculation against the CRC8 calculator
+ *
+ * \details random buffers with different lengths are calculated with crc8ChecksumMulti,
+ * the number of buffers is also larger than the number of parallel calculated buffers
+ *
+ * \param none
+ *
+ * \return none
+ */
+void TST_CRC8_multi(void);
+
+/**
+ * \brief test the multi-buffer CRC16 calculation against the CRC16 calculator
+ *
+ * \details random buffers with up to 259 byte are calculated with crc16ChecksumMulti
+ * and crc16ChecksumMulti_AC9A
+ *
+ * \param none
+ *
+ * \return none
+ */
+void TST_CRC16_multi(void);
+
 /**
  * \brief test if the sanity check for crc32 works
  *
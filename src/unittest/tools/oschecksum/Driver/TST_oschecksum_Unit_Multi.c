@@ -0,0 +1,102 @@
+/**
+ * \file TST_oschecksum_Unit_Multi.c
+ * Specifies the unittests for the multi-buffer functions crc8ChecksumMulti and crc16ChecksumMulti
+ * \addtogroup unittest
+ * \{
+ * \addtogroup tools
+ * \{
+ * \addtogroup oschecksum
+ * \{
+ * \addtogroup liboschecksum_unittest
+ * \{
+ * \details
+ * \{
+ * Copyright (c) 2011,  Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ * All rights reserved, Bernecker + Rainer Industrie-Elektronik Ges.m.b.H
+ *
+ * This source code is free software; you can redistribute it and/or modify it
+ * under the terms of the BSD license (according to License.txt).
+ * \}
+ * \version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <cunit/CUnit.h>
+#include <oschecksum/crc.h>
+#include "TST_oschecksum_Unit.h"
+
+/* more buffers than lanes of the widest kernel, to test the partial last batch */
+#define MULTI_NO_BUFFERS 77
+/* longest subframe: 254 byte payload and 5 byte header */
+#define MULTI_MAX_LEN 259
+
+static uint8_t multiData[MULTI_NO_BUFFERS][MULTI_MAX_LEN];
+static const uint8_t * multiBuffer[MULTI_NO_BUFFERS];
+static uint32_t multiLen[MULTI_NO_BUFFERS];
+
+/* fills the buffers with random data, maxLen is the longest length */
+static void multiFill(uint32_t count, uint32_t maxLen)
+{
+    uint32_t i, j;
+
+    for ( i = 0; i < count; i++ )
+    {
+        multiLen[i] = rand() % ( maxLen + 1 );
+        for ( j = 0; j < multiLen[i]; j++ )
+            multiData[i][j] = rand() % 256;
+        multiBuffer[i] = multiData[i];
+    }
+}
+
+/** \brief test crc8ChecksumMulti against crc8ChecksumCalculator for random subframes */
+void TST_CRC8_multi(void)
+{
+    uint8_t crc[MULTI_NO_BUFFERS];
+    uint32_t count, i;
+
+    for ( count = 0; count <= MULTI_NO_BUFFERS; count += 11 )
+    {
+        /* CRC8 is used for payload data length <= 8 byte */
+        multiFill(count, 13);
+        crc8ChecksumMulti(count, multiLen, multiBuffer, 0, crc);
+        for ( i = 0; i < count; i++ )
+            CU_ASSERT_EQUAL_FATAL(crc[i], crc8ChecksumCalculator(multiLen[i], multiBuffer[i], 0));
+
+        /* longer buffers and a start value */
+        multiFill(count, MULTI_MAX_LEN);
+        crc8ChecksumMulti(count, multiLen, multiBuffer, 0x5A, crc);
+        for ( i = 0; i < count; i++ )
+            CU_ASSERT_EQUAL_FATAL(crc[i], crc8ChecksumCalculator(multiLen[i], multiBuffer[i], 0x5A));
+    }
+}
+
+/** \brief test crc16ChecksumMulti against crc16ChecksumCalculator for random subframes */
+void TST_CRC16_multi(void)
+{
+    uint16_t crc[MULTI_NO_BUFFERS];
+    uint32_t count, i;
+
+    for ( count = 0; count <= MULTI_NO_BUFFERS; count += 11 )
+    {
+        multiFill(count, MULTI_MAX_LEN);
+        crc16ChecksumMulti(count, multiLen, multiBuffer, 0, crc);
+        for ( i = 0; i < count; i++ )
+        {
+            CU_ASSERT_EQUAL_FATAL(crc[i], crc16ChecksumCalculator(multiLen[i], multiBuffer[i], 0));
+            CU_ASSERT_EQUAL_FATAL(crc[i], crc16Checksum(multiLen[i], multiBuffer[i], 0));
+        }
+
+        crc16ChecksumMulti_AC9A(count, multiLen, multiBuffer, 0x1234, crc);
+        for ( i = 0; i < count; i++ )
+            CU_ASSERT_EQUAL_FATAL(crc[i], crc16ChecksumCalculator_AC9A(multiLen[i], multiBuffer[i], 0x1234));
+    }
+}
+
+/**
+* \}
+* \}
+* \}
+* \}
+*/